@@ -39,6 +39,8 @@
 #include "m+mBlobOutputInputHandler.hpp"
 #include "m+mBlobOutputService.hpp"
 
+#include <m+m/m+mRawInput.hpp>
+
 //#include <odlEnable.h>
 #include <odlInclude.h>
 
@@ -88,6 +90,8 @@ BlobOutputInputHandler::BlobOutputInputHandler(BlobOutputService & owner) :
 {
     ODL_ENTER(); //####
     ODL_P1("owner = ", &owner); //####
+    // The blobs are forwarded as they were received, so there is no need to decode them.
+    enableRawInput();
     ODL_EXIT_P(this); //####
 } // BlobOutputInputHandler::BlobOutputInputHandler
 
@@ -138,29 +142,7 @@ BlobOutputInputHandler::handleInput(const yarp::os::Bottle &     input,
 
                     if (firstTopValue.isBlob())
                     {
-                        size_t       numBytes = firstTopValue.asBlobLength();
-                        const char * asBytes = firstTopValue.asBlob();
-
-                        if ((0 < numBytes) && asBytes)
-                        {
-                            int retVal = send(_outSocket, asBytes, static_cast<int>(numBytes), 0);
-
-                            cerr << "send--> " << retVal << endl; //!!!!
-                            if (0 > retVal)
-                            {
-                                _owner.deactivateConnection();
-                            }
-                            else
-                            {
-                                SendReceiveCounters toBeAdded(0, 0, numBytes, 1);
-
-                                _owner.incrementAuxiliaryCounters(toBeAdded);
-                            }
-                        }
-                        else
-                        {
-                            cerr << "Bad blob." << endl;
-                        }
+                        sendBlob(firstTopValue.asBlob(), firstTopValue.asBlobLength());
                     }
                     else
                     {
@@ -186,6 +168,72 @@ BlobOutputInputHandler::handleInput(const yarp::os::Bottle &     input,
 # pragma warning(pop)
 #endif // ! MAC_OR_LINUX_
 
+bool
+BlobOutputInputHandler::handleRawInput(RawInput &                   input,
+                                       const YarpString &           senderChannel,
+                                       yarp::os::ConnectionWriter * replyMechanism,
+                                       const size_t                 numBytes)
+{
+    ODL_OBJENTER(); //####
+    ODL_P2("input = ", &input, "replyMechanism = ", replyMechanism); //####
+    ODL_S1s("senderChannel = ", senderChannel); //####
+    ODL_I1("numBytes = ", numBytes); //####
+    bool         result = true;
+    const char * blobBytes;
+    size_t       blobLength;
+
+    try
+    {
+        if (_owner.isActive() && (INVALID_SOCKET != _outSocket) &&
+            input.getSingleBlob(blobBytes, blobLength))
+        {
+            sendBlob(blobBytes, blobLength);
+        }
+        else
+        {
+            // Let the normal processing report the problem.
+            result = inherited::handleRawInput(input, senderChannel, replyMechanism, numBytes);
+        }
+    }
+    catch (...)
+    {
+        ODL_LOG("Exception caught"); //####
+        throw;
+    }
+    ODL_OBJEXIT_B(result); //####
+    return result;
+} // BlobOutputInputHandler::handleRawInput
+
+void
+BlobOutputInputHandler::sendBlob(const char * asBytes,
+                                 const size_t numBytes)
+{
+    ODL_OBJENTER(); //####
+    ODL_P1("asBytes = ", asBytes); //####
+    ODL_I1("numBytes = ", numBytes); //####
+    if ((0 < numBytes) && asBytes)
+    {
+        int retVal = send(_outSocket, asBytes, static_cast<int>(numBytes), 0);
+
+        cerr << "send--> " << retVal << endl; //!!!!
+        if (0 > retVal)
+        {
+            _owner.deactivateConnection();
+        }
+        else
+        {
+            SendReceiveCounters toBeAdded(0, 0, numBytes, 1);
+
+            _owner.incrementAuxiliaryCounters(toBeAdded);
+        }
+    }
+    else
+    {
+        cerr << "Bad blob." << endl;
+    }
+    ODL_OBJEXIT(); //####
+} // BlobOutputInputHandler::sendBlob
+
 void
 BlobOutputInputHandler::setSocket(const SOCKET outSocket)
 {
@@ -39,6 +39,8 @@
 
 #include "m+mRecordBlobOutputInputHandler.hpp"
 
+#include <m+m/m+mRawInput.hpp>
+
 //#include <odlEnable.h>
 #include <odlInclude.h>
 
@@ -88,6 +90,8 @@ RecordBlobOutputInputHandler::RecordBlobOutputInputHandler(void) :
     inherited(), _outFile(NULL)
 {
     ODL_ENTER(); //####
+    // The blobs are written as they were received, so there is no need to decode them.
+    enableRawInput();
     ODL_EXIT_P(this); //####
 } // RecordBlobOutputInputHandler::RecordBlobOutputInputHandler
 
@@ -133,26 +137,7 @@ RecordBlobOutputInputHandler::handleInput(const yarp::os::Bottle &     input,
 
                 if (firstTopValue.isBlob())
                 {
-                    size_t       numBytes = firstTopValue.asBlobLength();
-                    const char * asBytes = firstTopValue.asBlob();
-
-                    if ((0 < numBytes) && asBytes)
-                    {
-                        size_t retVal = fwrite(asBytes, numBytes, 1, _outFile);
-
-                        if (retVal == numBytes)
-                        {
-                            fflush(_outFile);
-                        }
-                        else
-                        {
-                            cerr << "Write error" << endl; //!!!!
-                        }
-                    }
-                    else
-                    {
-                        cerr << "Bad blob" << endl; //!!!!
-                    }
+                    recordBlob(firstTopValue.asBlob(), firstTopValue.asBlobLength());
                 }
                 else
                 {
@@ -177,6 +162,68 @@ RecordBlobOutputInputHandler::handleInput(const yarp::os::Bottle &     input,
 # pragma warning(pop)
 #endif // ! MAC_OR_LINUX_
 
+bool
+RecordBlobOutputInputHandler::handleRawInput(RawInput &                   input,
+                                             const YarpString &           senderChannel,
+                                             yarp::os::ConnectionWriter * replyMechanism,
+                                             const size_t                 numBytes)
+{
+    ODL_OBJENTER(); //####
+    ODL_P2("input = ", &input, "replyMechanism = ", replyMechanism); //####
+    ODL_S1s("senderChannel = ", senderChannel); //####
+    ODL_I1("numBytes = ", numBytes); //####
+    bool         result = true;
+    const char * blobBytes;
+    size_t       blobLength;
+
+    try
+    {
+        if (_outFile && input.getSingleBlob(blobBytes, blobLength))
+        {
+            recordBlob(blobBytes, blobLength);
+        }
+        else
+        {
+            // Let the normal processing report the problem.
+            result = inherited::handleRawInput(input, senderChannel, replyMechanism, numBytes);
+        }
+    }
+    catch (...)
+    {
+        ODL_LOG("Exception caught"); //####
+        throw;
+    }
+    ODL_OBJEXIT_B(result); //####
+    return result;
+} // RecordBlobOutputInputHandler::handleRawInput
+
+void
+RecordBlobOutputInputHandler::recordBlob(const char * asBytes,
+                                         const size_t numBytes)
+{
+    ODL_OBJENTER(); //####
+    ODL_P1("asBytes = ", asBytes); //####
+    ODL_I1("numBytes = ", numBytes); //####
+    if ((0 < numBytes) && asBytes)
+    {
+        size_t retVal = fwrite(asBytes, numBytes, 1, _outFile);
+
+        if (retVal == numBytes)
+        {
+            fflush(_outFile);
+        }
+        else
+        {
+            cerr << "Write error" << endl; //!!!!
+        }
+    }
+    else
+    {
+        cerr << "Bad blob" << endl; //!!!!
+    }
+    ODL_OBJEXIT(); //####
+} // RecordBlobOutputInputHandler::recordBlob
+
 void
 RecordBlobOutputInputHandler::setFile(FILE * outFile)
 {
@@ -106,12 +106,31 @@ namespace MplusM
                         yarp::os::ConnectionWriter * replyMechanism,
                         const size_t                 numBytes);
 
+            /*! @brief Process input that has not been decoded.
+             @param[in] input The undecoded input data.
+             @param[in] senderChannel The name of the channel used to send the input data.
+             @param[in] replyMechanism @c NULL if no reply is expected and non-@c NULL otherwise.
+             @param[in] numBytes The number of bytes available on the connection.
+             @return @c true if the input was correctly structured and successfully processed. */
+            virtual bool
+            handleRawInput(Common::RawInput &           input,
+                           const YarpString &           senderChannel,
+                           yarp::os::ConnectionWriter * replyMechanism,
+                           const size_t                 numBytes);
+
             /*! @brief The assignment operator.
              @param[in] other The object to be copied.
              @return The updated object. */
             RecordBlobOutputInputHandler &
             operator =(const RecordBlobOutputInputHandler & other);
 
+            /*! @brief Write the contents of a blob to the output file.
+             @param[in] asBytes The contents of the blob.
+             @param[in] numBytes The number of bytes in the blob. */
+            void
+            recordBlob(const char * asBytes,
+                       const size_t numBytes);
+
         public :
 
         protected :
@@ -42,6 +42,7 @@
 #include <m+m/m+mRequests.hpp>
 #include <m+m/m+mServiceRequest.hpp>
 #include <m+m/m+mServiceResponse.hpp>
+#include <m+m/m+mRegistryCache.hpp>
 #include <m+m/m+mUtilities.hpp>
 
 //#include <odlEnable.h>
@@ -345,6 +346,11 @@ main(int      argc,
                 {
                     YarpString channelName(firstArg.getCurrentValue());
 
+                    // Repeated matches are answered locally, rather than by the Registry Service.
+                    if (! RegistryCache::Enable())
+                    {
+                        ODL_LOG("! (RegistryCache::Enable())"); //####
+                    }
                     setUpAndGo(channelName, flavour);
                 }
                 else
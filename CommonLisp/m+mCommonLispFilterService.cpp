@@ -42,6 +42,7 @@
 #include "m+mCommonLispFilterThread.hpp"
 
 #include <m+m/m+mEndpoint.hpp>
+#include <m+m/m+mNumericArray.hpp>
 
 //#include <odlEnable.h>
 #include <odlInclude.h>
@@ -511,6 +512,15 @@ convertValue(cl_object               setHashFunction,
             }
         }
     }
+    else if (NumericArray::IsNumericArray(inputValue))
+    {
+        ODL_LOG("(NumericArray::IsNumericArray(inputValue))"); //####
+        yarp::os::Bottle asList;
+
+        NumericArray::ConvertToList(inputValue, asList);
+        result = convertList(setHashFunction, asList);
+        ODL_P1("result <- ", result); //####
+    }
     else
     {
         ODL_LOG("! (inputValue.isList())"); //####
@@ -44,9 +44,20 @@
 #include "m+mTest10Service.hpp"
 #include "m+mTest11Service.hpp"
 #include "m+mTest12Service.hpp"
+#include "m+mTest13CounterThread.hpp"
+#include "m+mTest15WriterThread.hpp"
+#include "m+mTest17Handler.hpp"
+#include "m+mTest20RequestThread.hpp"
+#include "m+mTest21WriterThread.hpp"
+#include "m+mTest22Handler.hpp"
 
 #include <m+m/m+mClientChannel.hpp>
+#include <m+m/m+mClientChannelPool.hpp>
 #include <m+m/m+mEndpoint.hpp>
+#include <m+m/m+mGeneralChannel.hpp>
+#include <m+m/m+mNumericArrayView.hpp>
+#include <m+m/m+mPendingResponse.hpp>
+#include <m+m/m+mRawInput.hpp>
 #include <m+m/m+mRequests.hpp>
 #include <m+m/m+mServiceRequest.hpp>
 #include <m+m/m+mServiceResponse.hpp>
@@ -83,6 +94,20 @@ using std::endl;
 # pragma mark Private structures, constants and variables
 #endif // defined(__APPLE__)
 
+/*! @brief The number of messages sent by the overflow policy test. */
+static const int kOverflowMessageCount = 20;
+
+/*! @brief The time, in seconds, that the receiver in the overflow policy test takes to process
+ each message. */
+static const double kOverflowProcessingTime = 0.05;
+
+/*! @brief The number of destinations used by the connection pool test. */
+static const int kPoolDestinationCount = 3;
+
+/*! @brief The time, in seconds, that a pooled connection may be idle in the connection pool
+ test. */
+static const double kPoolIdleLimit = 0.5;
+
 #if defined(__APPLE__)
 # pragma mark Global constants and variables
 #endif // defined(__APPLE__)
@@ -1674,133 +1699,1777 @@ doTestRequestEchoFromServiceWithRequestHandlerAndInfo(const char * launchPath,
     return result;
 } // doTestRequestEchoFromServiceWithRequestHandlerAndInfo
 
-/*! @brief The signal handler to catch requests to stop the service.
- @param[in] signal The signal being handled. */
-static void
-catchSignal(int signal)
+#if defined(__APPLE__)
+# pragma mark *** Test Case 13 ***
+#endif // defined(__APPLE__)
+
+/*! @brief Retrieve a large counter value from a metrics dictionary.
+ @param[in] props The dictionary to be searched.
+ @param[in] tag The tag associated with the value.
+ @return The value, or @c -1 if it could not be retrieved. */
+static int64_t
+getLargeValueFromDictionary(yarp::os::Property & props,
+                            const char *         tag)
 {
     ODL_ENTER(); //####
-    ODL_I1("signal = ", signal); //####
-    std::stringstream buff;
-    YarpString        message("Exiting due to signal ");
+    ODL_P1("props = ", &props); //####
+    ODL_S1("tag = ", tag); //####
+    int64_t         result = -1;
+    yarp::os::Value aValue(props.find(tag));
 
-    buff << signal;
-    message += buff.str();
-    message += " = ";
-    message += NameOfSignal(signal);
-    MpM_ERROR_(message.c_str());
-    ODL_EXIT_EXIT(1); //####
-    yarp::os::exit(1);
-} // catchSignal
+    if (aValue.isList())
+    {
+        yarp::os::Bottle * asList = aValue.asList();
 
-#if defined(__APPLE__)
-# pragma mark Global functions
-#endif // defined(__APPLE__)
+        if (asList && (2 == asList->size()) && asList->get(0).isInt() && asList->get(1).isInt())
+        {
+            result = (static_cast<int64_t>(asList->get(0).asInt()) << 32) +
+                        static_cast<uint32_t>(asList->get(1).asInt());
+        }
+    }
+    ODL_EXIT_I(result); //####
+    return result;
+} // getLargeValueFromDictionary
+
+/*! @brief Return the total of the counts in a histogram from a metrics dictionary.
+ @param[in] props The dictionary to be searched.
+ @param[in] tag The tag associated with the histogram.
+ @param[out] nonEmptyBuckets The number of histogram buckets with a non-zero count.
+ @return The total of the counts, or @c -1 if the histogram could not be retrieved. */
+static int64_t
+getHistogramTotalFromDictionary(yarp::os::Property & props,
+                                const char *         tag,
+                                int &                nonEmptyBuckets)
+{
+    ODL_ENTER(); //####
+    ODL_P2("props = ", &props, "nonEmptyBuckets = ", &nonEmptyBuckets); //####
+    ODL_S1("tag = ", tag); //####
+    int64_t         result = -1;
+    yarp::os::Value aValue(props.find(tag));
 
-/*! @brief The entry point for unit tests of the m+m common classes.
+    nonEmptyBuckets = 0;
+    if (aValue.isList())
+    {
+        yarp::os::Bottle * asList = aValue.asList();
 
- The first argument is the test number, the second argument is the name of the channel to be used
- with the test, the optional third argument is the machine to connect to and the optional fourth
- argument is the port number to be used. Output depends on the test being run.
+        if (asList && (MpM_SENDRECEIVE_HISTOGRAM_BUCKETS_ == asList->size()))
+        {
+            result = 0;
+            for (int ii = 0; ii < asList->size(); ++ii)
+            {
+                int aCount = asList->get(ii).asInt();
+
+                if (0 < aCount)
+                {
+                    result += aCount;
+                    ++nonEmptyBuckets;
+                }
+            }
+        }
+    }
+    ODL_EXIT_I(result); //####
+    return result;
+} // getHistogramTotalFromDictionary
+
+#if (! MAC_OR_LINUX_)
+# pragma warning(push)
+# pragma warning(disable: 4100)
+#endif // ! MAC_OR_LINUX_
+/*! @brief Perform a test case.
+ @param[in] launchPath The command-line name used to launch the service.
  @param[in] argc The number of arguments in 'argv'.
- @param[in] argv The arguments to be used with the unit tests.
- @return @c 0 on a successful test and @c 1 on failure. */
-int
-main(int      argc,
-     char * * argv)
+ @param[in] argv The arguments to be used for the test.
+ @return @c 0 on success and @c 1 on failure. */
+static int
+doTestConcurrentSendReceiveCounters(const char * launchPath,
+                                    const int    argc,
+                                    char * *     argv) // update counters from several threads
 {
-    YarpString progName(*argv);
-
-    ODL_INIT(progName.c_str(), kODLoggingOptionIncludeProcessID | //####
-             kODLoggingOptionIncludeThreadID | kODLoggingOptionEnableThreadSupport | //####
-             kODLoggingOptionWriteToStderr); //####
+#if (! defined(ODL_ENABLE_LOGGING_))
+# if MAC_OR_LINUX_
+#  pragma unused(launchPath)
+# endif // MAC_OR_LINUX_
+#endif // ! defined(ODL_ENABLE_LOGGING_)
     ODL_ENTER(); //####
-#if MAC_OR_LINUX_
-    SetUpLogger(progName);
-#endif // MAC_OR_LINUX_
+    ODL_S1("launchPath = ", launchPath); //####
+    ODL_I1("argc = ", argc); //####
+    ODL_P1("argv = ", argv); //####
     int result = 1;
 
     try
     {
-        Utilities::SetUpGlobalStatusReporter();
-        Utilities::CheckForNameServerReporter();
-        if (Utilities::CheckForValidNetwork())
+        if (2 == argc)
         {
-            yarp::os::Network yarp; // This is necessary to establish any connections to the YARP
-                                    // infrastructure
+            int threadCount = atoi(argv[0]);
+            int iterations = atoi(argv[1]);
 
-            Initialize(progName);
-            if (0 < --argc)
+            if ((0 < threadCount) && (0 < iterations))
             {
-                const char * startPtr = argv[1];
-                char *       endPtr;
-                int          selector = strtol(startPtr, &endPtr, 10);
+                const int64_t                      messageSize = 100;
+                ShardedSendReceiveCounters         counters;
+                std::vector<Test13CounterThread *> threads;
 
-                if ((startPtr != endPtr) && (! *endPtr) && (0 < selector))
+                for (int ii = 0; ii < threadCount; ++ii)
                 {
-                    SetSignalHandlers(catchSignal);
-                    switch (selector)
-                    {
-                        case 0 :
-                            // Just used to validate the random number seed.
-                            result = 0;
-                            break;
-
-                        case 1 :
-                            result = doTestCreateEndpoint(*argv, argc - 1, argv + 2);
-                            break;
-
-                        case 2 :
-                            result = doTestConnectToEndpoint(*argv, argc - 1, argv + 2);
-                            break;
-
-                        case 3 :
-                            result = doTestWriteToEndpoint(*argv, argc - 1, argv + 2);
-                            break;
+                    threads.push_back(new Test13CounterThread(counters, iterations, messageSize));
+                }
+                for (int ii = 0; ii < threadCount; ++ii)
+                {
+                    threads[ii]->start();
+                }
+                for (int ii = 0; ii < threadCount; ++ii)
+                {
+                    threads[ii]->stop();
+                    delete threads[ii];
+                }
+                SendReceiveCounters snapshot;
+                yarp::os::Bottle    metrics;
 
-                        case 4 :
-                            result = doTestEchoFromEndpointWithReader(*argv, argc - 1, argv + 2);
-                            break;
+                counters.getCounters(snapshot);
+                snapshot.addToList(metrics, "test");
+                yarp::os::Property * props = metrics.get(0).asDict();
 
-                        case 5 :
-                            result = doTestEchoFromEndpointWithReaderCreator(*argv, argc - 1,
-                                                                             argv + 2);
-                            break;
+                if (props)
+                {
+                    int64_t expectedMessages = static_cast<int64_t>(threadCount) * iterations;
+                    int     inSizeBuckets;
+                    int     outSizeBuckets;
+                    int     intervalBuckets;
+
+                    if ((expectedMessages == getLargeValueFromDictionary(*props,
+                                                                MpM_SENDRECEIVE_INMESSAGES_)) &&
+                        (expectedMessages == getLargeValueFromDictionary(*props,
+                                                                MpM_SENDRECEIVE_OUTMESSAGES_)) &&
+                        ((expectedMessages * messageSize) ==
+                         getLargeValueFromDictionary(*props, MpM_SENDRECEIVE_INBYTES_)) &&
+                        ((expectedMessages * messageSize) ==
+                         getLargeValueFromDictionary(*props, MpM_SENDRECEIVE_OUTBYTES_)) &&
+                        (expectedMessages == getHistogramTotalFromDictionary(*props,
+                                                                    MpM_SENDRECEIVE_INSIZES_,
+                                                                            inSizeBuckets)) &&
+                        (expectedMessages == getHistogramTotalFromDictionary(*props,
+                                                                    MpM_SENDRECEIVE_OUTSIZES_,
+                                                                            outSizeBuckets)) &&
+                        ((expectedMessages - 1) ==
+                         getHistogramTotalFromDictionary(*props, MpM_SENDRECEIVE_ININTERVALS_,
+                                                         intervalBuckets)) &&
+                        (1 == inSizeBuckets) && (1 == outSizeBuckets))
+                    {
+                        result = 0;
+                    }
+                    else
+                    {
+                        ODL_LOG("! (counters match expected values)"); //####
+                    }
+                }
+                else
+                {
+                    ODL_LOG("! (props)"); //####
+                }
+            }
+            else
+            {
+                ODL_LOG("! ((0 < threadCount) && (0 < iterations))"); //####
+            }
+        }
+        else
+        {
+            ODL_LOG("! (2 == argc)"); //####
+        }
+    }
+    catch (...)
+    {
+        ODL_LOG("Exception caught"); //####
+        throw;
+    }
+    ODL_EXIT_I(result); //####
+    return result;
+} // doTestConcurrentSendReceiveCounters
+#if (! MAC_OR_LINUX_)
+# pragma warning(pop)
+#endif // ! MAC_OR_LINUX_
 
-                        case 6 :
-                            result = doTestCreateRequest(*argv, argc - 1, argv + 2);
-                            break;
+#if defined(__APPLE__)
+# pragma mark *** Test Case 14 ***
+#endif // defined(__APPLE__)
 
-                        case 7 :
-                            result = doTestCreateResponse(*argv, argc - 1, argv + 2);
-                            break;
+#if (! MAC_OR_LINUX_)
+# pragma warning(push)
+# pragma warning(disable: 4100)
+#endif // ! MAC_OR_LINUX_
+/*! @brief Perform a test case.
+ @param[in] launchPath The command-line name used to launch the service.
+ @param[in] argc The number of arguments in 'argv'.
+ @param[in] argv The arguments to be used for the test.
+ @return @c 0 on success and @c 1 on failure. */
+static int
+doTestEchoFromEndpointWithDispatchThreads(const char * launchPath,
+                                          const int    argc,
+                                          char * *     argv) // send to endpoint
+{
+#if (! defined(MpM_DoExplicitDisconnect))
+# if MAC_OR_LINUX_
+#  pragma unused(launchPath)
+# endif // MAC_OR_LINUX_
+#endif // ! defined(MpM_DoExplicitDisconnect)
+    ODL_ENTER(); //####
+    ODL_S1("launchPath = ", launchPath); //####
+    ODL_I1("argc = ", argc); //####
+    ODL_P1("argv = ", argv); //####
+    int result = 1;
 
-                        case 8 :
-                            result = doTestRequestEchoFromEndpoint(*argv, argc - 1, argv + 2);
-                            break;
+    try
+    {
+        Endpoint *              stuff = doCreateEndpointForTest(argc, argv);
+        ChannelStatusReporter & reporter = *Utilities::GetGlobalStatusReporter();
 
-                        case 9 :
-                            result = doTestRequestEchoFromServiceUsingDefaultWithReader(*argv,
-                                                                                        argc - 1,
-                                                                                        argv + 2);
-                            break;
+        if (stuff)
+        {
+            Test04Handler handler;
 
-                        case 10 :
-                            result =
-                            doTestRequestEchoFromServiceUsingDefaultWithReaderCreator(*argv,
-                                                                                      argc - 1,
-                                                                                      argv + 2);
-                            break;
+            if (handler.enableAsynchronousDispatch(2) && stuff->setInputHandler(handler) &&
+                stuff->open(STANDARD_WAIT_TIME_) && stuff->setReporter(reporter, true))
+            {
+                ODL_S1s("endpoint name = ", stuff->getName());
+                // Now we try to connect!
+                YarpString      aName(GetRandomChannelName("_test_/echofromendpointwithdispatch"
+                                                           "threads_"));
+                ClientChannel * outChannel = new ClientChannel;
 
-                        case 11 :
-                            result = doTestRequestEchoFromServiceWithRequestHandler(*argv, argc - 1,
-                                                                                    argv + 2);
-                            break;
+                if (outChannel)
+                {
+#if defined(MpM_ReportOnConnections)
+                    outChannel->setReporter(reporter);
+                    outChannel->getReport(reporter);
+#endif // defined(MpM_ReportOnConnections)
+                    if (outChannel->openWithRetries(aName, STANDARD_WAIT_TIME_))
+                    {
+                        outChannel->getReport(reporter);
+                        if (outChannel->addOutputWithRetries(stuff->getName(), STANDARD_WAIT_TIME_))
+                        {
+                            yarp::os::Bottle message;
+                            yarp::os::Bottle response;
+                            bool             okSoFar = true;
 
-                        case 12 :
-                            result = doTestRequestEchoFromServiceWithRequestHandlerAndInfo(*argv,
-                                                                                           argc - 1,
-                                                                                           argv + 2);
+                            message.addString(aName);
+                            message.addString("howdi");
+                            // Send several messages, so that the dispatch thread is kept busy.
+                            for (int ii = 0; okSoFar && (ii < 10); ++ii)
+                            {
+                                okSoFar = outChannel->writeBottle(message);
+                            }
+                            if (okSoFar && outChannel->writeBottle(message, response) &&
+                                (message.toString() == response.toString()))
+                            {
+                                result = 0;
+#if defined(MpM_DoExplicitDisconnect)
+                                if (! NetworkDisconnectWithRetries(outChannel->name(),
+                                                                   stuff->getName(),
+                                                                   STANDARD_WAIT_TIME_))
+                                {
+                                    ODL_LOG("(! NetworkDisconnectWithRetries(outChannel->" //####
+                                            "name(), stuff->getName(), " //####
+                                            "STANDARD_WAIT_TIME_))"); //####
+                                }
+#endif // defined(MpM_DoExplicitDisconnect)
+                            }
+                            else
+                            {
+                                ODL_LOG("! (okSoFar && outChannel->writeBottle(message, " //####
+                                        "response) && (message.toString() == " //####
+                                        "response.toString()))"); //####
+#if defined(MpM_StallOnSendProblem)
+                                Stall();
+#endif // defined(MpM_StallOnSendProblem)
+                            }
+                        }
+                        else
+                        {
+                            ODL_LOG("! (outChannel->addOutputWithRetries(stuff->getName(), " //####
+                                    "STANDARD_WAIT_TIME_))"); //####
+                        }
+#if defined(MpM_DoExplicitClose)
+                        outChannel->close();
+#endif // defined(MpM_DoExplicitClose)
+                    }
+                    else
+                    {
+                        ODL_LOG("! (outChannel->openWithRetries(aName, " //####
+                                "STANDARD_WAIT_TIME_))"); //####
+                    }
+                    BaseChannel::RelinquishChannel(outChannel);
+                }
+                else
+                {
+                    ODL_LOG("! (outChannel)");
+                }
+            }
+            else
+            {
+                ODL_LOG("! (handler.enableAsynchronousDispatch(2) && " //####
+                        "stuff->setInputHandler(handler) && " //####
+                        "stuff->open(STANDARD_WAIT_TIME_) && " //####
+                        "stuff->setReporter(reporter, true))"); //####
+            }
+            delete stuff;
+            handler.stopProcessing();
+        }
+        else
+        {
+            ODL_LOG("! (stuff)"); //####
+        }
+    }
+    catch (...)
+    {
+        ODL_LOG("Exception caught"); //####
+        throw;
+    }
+    ODL_EXIT_I(result); //####
+    return result;
+} // doTestEchoFromEndpointWithDispatchThreads
+#if (! MAC_OR_LINUX_)
+# pragma warning(pop)
+#endif // ! MAC_OR_LINUX_
+
+#if defined(__APPLE__)
+# pragma mark *** Test Case 15 ***
+#endif // defined(__APPLE__)
+
+#if (! MAC_OR_LINUX_)
+# pragma warning(push)
+# pragma warning(disable: 4100)
+#endif // ! MAC_OR_LINUX_
+/*! @brief Perform a test case.
+ @param[in] launchPath The command-line name used to launch the service.
+ @param[in] argc The number of arguments in 'argv'.
+ @param[in] argv The arguments to be used for the test.
+ @return @c 0 on success and @c 1 on failure. */
+static int
+doTestSharedMemoryStream(const char * launchPath,
+                         const int    argc,
+                         char * *     argv) // send data through a shared memory segment
+{
+#if (! defined(ODL_ENABLE_LOGGING_))
+# if MAC_OR_LINUX_
+#  pragma unused(launchPath)
+# endif // MAC_OR_LINUX_
+#endif // ! defined(ODL_ENABLE_LOGGING_)
+    ODL_ENTER(); //####
+    ODL_S1("launchPath = ", launchPath); //####
+    ODL_I1("argc = ", argc); //####
+    ODL_P1("argv = ", argv); //####
+    int result = 1;
+
+    try
+    {
+#if defined(MpM_UseSharedMemory)
+        if (2 == argc)
+        {
+            int ringSize = atoi(argv[0]);
+            int byteCount = atoi(argv[1]);
+
+            if ((0 < ringSize) && (0 < byteCount))
+            {
+                yarp::os::Contact    address;
+                SharedMemoryStream * reader =
+                                SharedMemoryStream::Create(static_cast<size_t>(ringSize), address,
+                                                           address);
+
+                if (reader)
+                {
+                    SharedMemoryStream * writer =
+                                            SharedMemoryStream::Attach(reader->getSegmentName(),
+                                                                       address, address);
+
+                    if (writer)
+                    {
+                        Test15WriterThread * sender =
+                                            new Test15WriterThread(*writer,
+                                                                   static_cast<size_t>(byteCount));
+                        bool                 matched = true;
+                        char                 buffer[777];
+                        size_t               received = 0;
+                        unsigned char        pattern = 0;
+
+                        sender->start();
+                        for ( ; ; )
+                        {
+                            YARP_SSIZE_T count = reader->read(yarp::os::Bytes(buffer,
+                                                                              sizeof(buffer)));
+
+                            if (0 >= count)
+                            {
+                                break;
+                            }
+
+                            for (YARP_SSIZE_T ii = 0; count > ii; ++ii)
+                            {
+                                if (static_cast<unsigned char>(buffer[ii]) != pattern++)
+                                {
+                                    matched = false;
+                                }
+                            }
+                            received += static_cast<size_t>(count);
+                        }
+                        sender->stop();
+                        delete sender;
+                        delete writer;
+                        if (matched && (static_cast<size_t>(byteCount) == received))
+                        {
+                            result = 0;
+                        }
+                        else
+                        {
+                            ODL_LOG("! (matched && (static_cast<size_t>(byteCount) == " //####
+                                    "received))"); //####
+                        }
+                    }
+                    else
+                    {
+                        ODL_LOG("! (writer)"); //####
+                    }
+                    delete reader;
+                }
+                else
+                {
+                    ODL_LOG("! (reader)"); //####
+                }
+            }
+            else
+            {
+                ODL_LOG("! ((0 < ringSize) && (0 < byteCount))"); //####
+            }
+        }
+        else
+        {
+            ODL_LOG("! (2 == argc)"); //####
+        }
+#else // ! defined(MpM_UseSharedMemory)
+        // Nothing to test if shared memory connections are not available.
+        result = 0;
+#endif // ! defined(MpM_UseSharedMemory)
+    }
+    catch (...)
+    {
+        ODL_LOG("Exception caught"); //####
+        throw;
+    }
+    ODL_EXIT_I(result); //####
+    return result;
+} // doTestSharedMemoryStream
+#if (! MAC_OR_LINUX_)
+# pragma warning(pop)
+#endif // ! MAC_OR_LINUX_
+
+#if defined(__APPLE__)
+# pragma mark *** Test Case 16 ***
+#endif // defined(__APPLE__)
+
+#if (! MAC_OR_LINUX_)
+# pragma warning(push)
+# pragma warning(disable: 4100)
+#endif // ! MAC_OR_LINUX_
+/*! @brief Perform a test case.
+ @param[in] launchPath The command-line name used to launch the service.
+ @param[in] argc The number of arguments in 'argv'.
+ @param[in] argv The arguments to be used for the test.
+ @return @c 0 on success and @c 1 on failure. */
+static int
+doTestNumericArray(const char * launchPath,
+                   const int    argc,
+                   char * *     argv) // send a packed numeric array in a message
+{
+#if (! defined(ODL_ENABLE_LOGGING_))
+# if MAC_OR_LINUX_
+#  pragma unused(launchPath)
+# endif // MAC_OR_LINUX_
+#endif // ! defined(ODL_ENABLE_LOGGING_)
+    ODL_ENTER(); //####
+    ODL_S1("launchPath = ", launchPath); //####
+    ODL_I1("argc = ", argc); //####
+    ODL_P1("argv = ", argv); //####
+    int result = 1;
+
+    try
+    {
+        if ((2 == argc) || (3 == argc))
+        {
+            int  elementBits = atoi(argv[0]);
+            int  elementCount = atoi(argv[1]);
+            bool swapOrder = (3 == argc);
+
+            if (((32 == elementBits) || (64 == elementBits)) && (0 <= elementCount))
+            {
+                NumericArrayKind kind = ((32 == elementBits) ? kNumericArrayKindFloat32 :
+                                         kNumericArrayKindFloat64);
+                NumericArray     anArray(kind, static_cast<size_t>(elementCount));
+                yarp::os::Bottle original;
+
+                for (int ii = 0; ii < elementCount; ++ii)
+                {
+                    anArray.addValue(ii + 0.5);
+                }
+                original.addString("before");
+                if (swapOrder)
+                {
+                    // Rewrite the array as it would be sent by a machine with the other byte
+                    // order.
+                    yarp::os::Value   asValue(anArray.asValue());
+                    std::vector<char> foreign(asValue.asBlob(),
+                                              asValue.asBlob() + asValue.asBlobLength());
+                    size_t            size = ((32 == elementBits) ? sizeof(float) :
+                                              sizeof(double));
+
+                    foreign[5] = (('L' == foreign[5]) ? 'B' : 'L');
+                    for (size_t ii = MpM_NUMERICARRAY_HEADER_SIZE_, mm = foreign.size(); mm > ii;
+                         ii += size)
+                    {
+                        std::reverse(foreign.begin() + ii, foreign.begin() + ii + size);
+                    }
+                    original.add(yarp::os::Value(&foreign[0], static_cast<int>(foreign.size())));
+                }
+                else
+                {
+                    anArray.addToBottle(original);
+                }
+                original.addString("after");
+                // Round-trip the message through its binary form, as it would be sent.
+                size_t           messageSize = 0;
+                const char *     asBinary = original.toBinary(&messageSize);
+                yarp::os::Bottle received;
+
+                received.fromBinary(asBinary, static_cast<int>(messageSize));
+                if (3 == received.size())
+                {
+                    NumericArrayView view;
+                    yarp::os::Bottle asList;
+
+                    if (view.attach(received.get(1)) && (kind == view.kind()) &&
+                        (static_cast<size_t>(elementCount) == view.size()) &&
+                        NumericArray::ConvertToList(received.get(1), asList) &&
+                        (elementCount == asList.size()) &&
+                        (! NumericArray::IsNumericArray(received.get(0))))
+                    {
+                        result = 0;
+                        for (int ii = 0; ii < elementCount; ++ii)
+                        {
+                            if (((ii + 0.5) != view[static_cast<size_t>(ii)]) ||
+                                ((ii + 0.5) != asList.get(ii).asDouble()))
+                            {
+                                ODL_LOG("! (elements match)"); //####
+                                result = 1;
+                                break;
+                            }
+                        }
+                    }
+                    else
+                    {
+                        ODL_LOG("! (view.attach(received.get(1)) && " //####
+                                "(kind == view.kind()) && " //####
+                                "(static_cast<size_t>(elementCount) == view.size()) && " //####
+                                "NumericArray::ConvertToList(received.get(1), asList) && " //####
+                                "(elementCount == asList.size()) && " //####
+                                "(! NumericArray::IsNumericArray(received.get(0))))"); //####
+                    }
+                }
+                else
+                {
+                    ODL_LOG("! (3 == received.size())"); //####
+                }
+            }
+            else
+            {
+                ODL_LOG("! (((32 == elementBits) || (64 == elementBits)) && " //####
+                        "(0 <= elementCount))"); //####
+            }
+        }
+        else
+        {
+            ODL_LOG("! ((2 == argc) || (3 == argc))"); //####
+        }
+    }
+    catch (...)
+    {
+        ODL_LOG("Exception caught"); //####
+        throw;
+    }
+    ODL_EXIT_I(result); //####
+    return result;
+} // doTestNumericArray
+#if (! MAC_OR_LINUX_)
+# pragma warning(pop)
+#endif // ! MAC_OR_LINUX_
+
+#if defined(__APPLE__)
+# pragma mark *** Test Case 17 ***
+#endif // defined(__APPLE__)
+
+#if (! MAC_OR_LINUX_)
+# pragma warning(push)
+# pragma warning(disable: 4100)
+#endif // ! MAC_OR_LINUX_
+/*! @brief Perform a test case.
+ @param[in] launchPath The command-line name used to launch the service.
+ @param[in] argc The number of arguments in 'argv'.
+ @param[in] argv The arguments to be used for the test.
+ @return @c 0 on success and @c 1 on failure. */
+static int
+doTestBatchedMessages(const char * launchPath,
+                      const int    argc,
+                      char * *     argv) // send coalesced messages to an endpoint
+{
+#if (! defined(ODL_ENABLE_LOGGING_))
+# if MAC_OR_LINUX_
+#  pragma unused(launchPath)
+# endif // MAC_OR_LINUX_
+#endif // ! defined(ODL_ENABLE_LOGGING_)
+    ODL_ENTER(); //####
+    ODL_S1("launchPath = ", launchPath); //####
+    ODL_I1("argc = ", argc); //####
+    ODL_P1("argv = ", argv); //####
+    int result = 1;
+
+    try
+    {
+        // Argument order for the test = endpoint name, byte limit, message count
+        if (3 == argc)
+        {
+            int        byteLimit = atoi(argv[1]);
+            int        messageCount = atoi(argv[2]);
+            Endpoint * stuff = doCreateEndpointForTest(1, argv);
+
+            if (stuff && (0 <= byteLimit) && (0 < messageCount))
+            {
+                Test17Handler handler;
+
+                if (0 < byteLimit)
+                {
+                    handler.enableBatchedInput();
+                }
+                if (stuff->setInputHandler(handler) && stuff->open(STANDARD_WAIT_TIME_))
+                {
+                    YarpString       aName(GetRandomChannelName("_test_/batchedmessages_"));
+                    GeneralChannel * outChannel = new GeneralChannel(true);
+
+                    if (outChannel->openWithRetries(aName, STANDARD_WAIT_TIME_) &&
+                        Utilities::NetworkConnectWithRetries(aName, stuff->getName(),
+                                                             STANDARD_WAIT_TIME_) &&
+                        outChannel->setBatching(static_cast<size_t>(byteLimit)))
+                    {
+                        bool okSoFar = true;
+
+                        for (int ii = 0; okSoFar && (ii < messageCount); ++ii)
+                        {
+                            yarp::os::Bottle message;
+
+                            message.addInt(ii);
+                            okSoFar = outChannel->writeBottle(message);
+                        }
+                        // Send anything that is still being held.
+                        outChannel->setBatching(0);
+                        for (int ii = 0; okSoFar && (ii < messageCount); ++ii)
+                        {
+                            okSoFar = handler.waitForMessage(STANDARD_WAIT_TIME_);
+                        }
+                        if (okSoFar && handler.inOrder() &&
+                            ((0 < handler.batchCount()) == (0 < byteLimit)))
+                        {
+                            result = 0;
+                        }
+                        else
+                        {
+                            ODL_LOG("! (okSoFar && handler.inOrder() && " //####
+                                    "((0 < handler.batchCount()) == (0 < byteLimit)))"); //####
+                        }
+                        outChannel->close();
+                    }
+                    else
+                    {
+                        ODL_LOG("! (outChannel->openWithRetries(aName, " //####
+                                "STANDARD_WAIT_TIME_) && " //####
+                                "Utilities::NetworkConnectWithRetries(aName, " //####
+                                "stuff->getName(), STANDARD_WAIT_TIME_) && " //####
+                                "outChannel->setBatching(static_cast<size_t>(byteLimit)))"); //####
+                    }
+                    BaseChannel::RelinquishChannel(outChannel);
+                }
+                else
+                {
+                    ODL_LOG("! (stuff->setInputHandler(handler) && " //####
+                            "stuff->open(STANDARD_WAIT_TIME_))"); //####
+                }
+                delete stuff;
+                handler.stopProcessing();
+            }
+            else
+            {
+                ODL_LOG("! (stuff && (0 <= byteLimit) && (0 < messageCount))"); //####
+                delete stuff;
+            }
+        }
+        else
+        {
+            ODL_LOG("! (3 == argc)"); //####
+        }
+    }
+    catch (...)
+    {
+        ODL_LOG("Exception caught"); //####
+        throw;
+    }
+    ODL_EXIT_I(result); //####
+    return result;
+} // doTestBatchedMessages
+#if (! MAC_OR_LINUX_)
+# pragma warning(pop)
+#endif // ! MAC_OR_LINUX_
+
+#if defined(__APPLE__)
+# pragma mark *** Test Case 18 ***
+#endif // defined(__APPLE__)
+
+#if (! MAC_OR_LINUX_)
+# pragma warning(push)
+# pragma warning(disable: 4100)
+#endif // ! MAC_OR_LINUX_
+/*! @brief Perform a test case.
+ @param[in] launchPath The command-line name used to launch the service.
+ @param[in] argc The number of arguments in 'argv'.
+ @param[in] argv The arguments to be used for the test.
+ @return @c 0 on success and @c 1 on failure. */
+static int
+doTestRawInput(const char * launchPath,
+               const int    argc,
+               char * *     argv) // examine a message without decoding it
+{
+#if (! defined(ODL_ENABLE_LOGGING_))
+# if MAC_OR_LINUX_
+#  pragma unused(launchPath)
+# endif // MAC_OR_LINUX_
+#endif // ! defined(ODL_ENABLE_LOGGING_)
+    ODL_ENTER(); //####
+    ODL_S1("launchPath = ", launchPath); //####
+    ODL_I1("argc = ", argc); //####
+    ODL_P1("argv = ", argv); //####
+    int result = 1;
+
+    try
+    {
+        // Argument order for the test = blob size, element count
+        if (2 == argc)
+        {
+            int blobSize = atoi(argv[0]);
+            int elementCount = atoi(argv[1]);
+
+            if ((0 < blobSize) && (0 < elementCount))
+            {
+                std::vector<char> blobData(static_cast<size_t>(blobSize));
+                yarp::os::Bottle  original;
+
+                for (int ii = 0; ii < blobSize; ++ii)
+                {
+                    blobData[static_cast<size_t>(ii)] = static_cast<char>(ii * 7);
+                }
+                original.add(yarp::os::Value(&blobData[0], blobSize));
+                for (int ii = 1; ii < elementCount; ++ii)
+                {
+                    original.addInt(ii);
+                }
+                size_t       messageSize = 0;
+                const char * asBinary = original.toBinary(&messageSize);
+                RawInput     rawInput(asBinary, messageSize);
+                const char * blobBytes = NULL;
+                size_t       blobLength = 0;
+                bool         isSingleBlob = rawInput.getSingleBlob(blobBytes, blobLength);
+
+                // Only a message with a single element is a single blob.
+                if ((1 == elementCount) == isSingleBlob)
+                {
+                    const yarp::os::Bottle & decoded = rawInput.asBottle();
+
+                    if ((elementCount == decoded.size()) && decoded.get(0).isBlob() &&
+                        (static_cast<size_t>(blobSize) == decoded.get(0).asBlobLength()) &&
+                        (! memcmp(&blobData[0], decoded.get(0).asBlob(), blobData.size())))
+                    {
+                        if (isSingleBlob)
+                        {
+                            if ((blobData.size() == blobLength) &&
+                                (! memcmp(&blobData[0], blobBytes, blobLength)))
+                            {
+                                result = 0;
+                            }
+                            else
+                            {
+                                ODL_LOG("! ((blobData.size() == blobLength) && " //####
+                                        "(! memcmp(&blobData[0], blobBytes, blobLength)))"); //####
+                            }
+                        }
+                        else
+                        {
+                            result = 0;
+                        }
+                    }
+                    else
+                    {
+                        ODL_LOG("! ((elementCount == decoded.size()) && " //####
+                                "decoded.get(0).isBlob() && " //####
+                                "(static_cast<size_t>(blobSize) == " //####
+                                "decoded.get(0).asBlobLength()) && " //####
+                                "(! memcmp(&blobData[0], decoded.get(0).asBlob(), " //####
+                                "blobData.size())))"); //####
+                    }
+                }
+                else
+                {
+                    ODL_LOG("! ((1 == elementCount) == isSingleBlob)"); //####
+                }
+            }
+            else
+            {
+                ODL_LOG("! ((0 < blobSize) && (0 < elementCount))"); //####
+            }
+        }
+        else
+        {
+            ODL_LOG("! (2 == argc)"); //####
+        }
+    }
+    catch (...)
+    {
+        ODL_LOG("Exception caught"); //####
+        throw;
+    }
+    ODL_EXIT_I(result); //####
+    return result;
+} // doTestRawInput
+#if (! MAC_OR_LINUX_)
+# pragma warning(pop)
+#endif // ! MAC_OR_LINUX_
+
+#if defined(__APPLE__)
+# pragma mark *** Test Case 19 ***
+#endif // defined(__APPLE__)
+
+/*! @brief Perform a test case.
+ @param[in] launchPath The command-line name used to launch the service.
+ @param[in] argc The number of arguments in 'argv'.
+ @param[in] argv The arguments to be used for the test.
+ @return @c 0 on success and @c 1 on failure. */
+static int
+doTestAsyncRequests(const char * launchPath,
+                    const int    argc,
+                    char * *     argv) // send 'echo' requests without waiting for responses
+{
+    ODL_ENTER(); //####
+    ODL_S1("launchPath = ", launchPath); //####
+    ODL_I1("argc = ", argc); //####
+    ODL_P1("argv = ", argv); //####
+    int result = 1;
+
+    try
+    {
+        // Argument order for the test = endpoint name, request count, outstanding request limit
+        if (3 == argc)
+        {
+            int requestCount = atoi(argv[1]);
+            int requestLimit = atoi(argv[2]);
+
+            if ((0 < requestCount) && (0 < requestLimit))
+            {
+                Test11Service * aService = new Test11Service(launchPath, 1, argv);
+
+                if (aService)
+                {
+                    if (aService->startService())
+                    {
+                        ClientChannel * outChannel =
+                                                doCreateTestChannel(aService->getEndpoint(),
+                                                                    "test/asyncrequests_");
+
+                        if (outChannel)
+                        {
+                            if (outChannel->enableAsyncRequests(static_cast<size_t>(requestLimit)))
+                            {
+                                std::vector<PendingResponse *> pendingList;
+                                bool                           okSoFar = true;
+
+                                for (int ii = 0; okSoFar && (ii < requestCount); ++ii)
+                                {
+                                    yarp::os::Bottle  parameters;
+                                    PendingResponse * pending = new PendingResponse;
+
+                                    parameters.addInt(ii);
+                                    ServiceRequest request(MpM_ECHO_REQUEST_, parameters);
+
+                                    pendingList.push_back(pending);
+                                    okSoFar = request.sendAsync(*outChannel, *pending);
+                                }
+                                for (int ii = 0; okSoFar && (ii < requestCount); ++ii)
+                                {
+                                    ServiceResponse response;
+
+                                    if (pendingList[ii]->waitWithTimeout(response,
+                                                                         STANDARD_WAIT_TIME_))
+                                    {
+                                        okSoFar = ((1 == response.count()) &&
+                                                   (ii == response.element(0).asInt()));
+                                    }
+                                    else
+                                    {
+                                        ODL_LOG("! (pendingList[ii]->waitWithTimeout(" //####
+                                                "response, STANDARD_WAIT_TIME_))"); //####
+                                        okSoFar = false;
+                                    }
+                                }
+                                if (okSoFar)
+                                {
+                                    result = 0;
+                                }
+                                for (size_t ii = 0, mm = pendingList.size(); mm > ii; ++ii)
+                                {
+                                    delete pendingList[ii];
+                                }
+                            }
+                            else
+                            {
+                                ODL_LOG("! (outChannel->enableAsyncRequests(" //####
+                                        "static_cast<size_t>(requestLimit)))"); //####
+                            }
+                            doDestroyTestChannel(aService->getEndpoint(), outChannel);
+                            outChannel = NULL;
+                        }
+                        else
+                        {
+                            ODL_LOG("! (outChannel)"); //####
+                        }
+                        aService->stopService();
+                    }
+                    else
+                    {
+                        ODL_LOG("! (aService->startService())"); //####
+                    }
+                    delete aService;
+                }
+                else
+                {
+                    ODL_LOG("! (aService)"); //####
+                }
+            }
+            else
+            {
+                ODL_LOG("! ((0 < requestCount) && (0 < requestLimit))"); //####
+            }
+        }
+        else
+        {
+            ODL_LOG("! (3 == argc)"); //####
+        }
+    }
+    catch (...)
+    {
+        ODL_LOG("Exception caught"); //####
+        throw;
+    }
+    ODL_EXIT_I(result); //####
+    return result;
+} // doTestAsyncRequests
+
+#if defined(__APPLE__)
+# pragma mark *** Test Case 20 ***
+#endif // defined(__APPLE__)
+
+/*! @brief Perform a test case.
+ @param[in] launchPath The command-line name used to launch the service.
+ @param[in] argc The number of arguments in 'argv'.
+ @param[in] argv The arguments to be used for the test.
+ @return @c 0 on success and @c 1 on failure. */
+static int
+doTestConcurrentRequests(const char * launchPath,
+                         const int    argc,
+                         char * *     argv) // send 'echo' requests from several clients at once
+{
+    ODL_ENTER(); //####
+    ODL_S1("launchPath = ", launchPath); //####
+    ODL_I1("argc = ", argc); //####
+    ODL_P1("argv = ", argv); //####
+    int result = 1;
+
+    try
+    {
+        // Argument order for the test = endpoint name, client count, request count
+        if (3 == argc)
+        {
+            int clientCount = atoi(argv[1]);
+            int requestCount = atoi(argv[2]);
+
+            if ((0 < clientCount) && (0 < requestCount))
+            {
+                // The service uses a pool of request workers, as the Echo service does.
+                Test11Service * aService = new Test11Service(launchPath, 1, argv, 4);
+
+                if (aService)
+                {
+                    if (aService->startService())
+                    {
+                        std::vector<ClientChannel *>       channels;
+                        std::vector<Test20RequestThread *> threads;
+                        bool                               okSoFar = true;
+
+                        for (int ii = 0; okSoFar && (ii < clientCount); ++ii)
+                        {
+                            ClientChannel * outChannel =
+                                        doCreateTestChannel(aService->getEndpoint(),
+                                                            "test/concurrentrequests_");
+
+                            if (outChannel)
+                            {
+                                channels.push_back(outChannel);
+                                threads.push_back(new Test20RequestThread(*outChannel, ii,
+                                                                          requestCount));
+                            }
+                            else
+                            {
+                                ODL_LOG("! (outChannel)"); //####
+                                okSoFar = false;
+                            }
+                        }
+                        if (okSoFar)
+                        {
+                            for (size_t ii = 0, mm = threads.size(); mm > ii; ++ii)
+                            {
+                                threads[ii]->start();
+                            }
+                            for (size_t ii = 0, mm = threads.size(); mm > ii; ++ii)
+                            {
+                                threads[ii]->stop();
+                                if (! threads[ii]->succeeded())
+                                {
+                                    okSoFar = false;
+                                }
+                            }
+                        }
+                        for (size_t ii = 0, mm = threads.size(); mm > ii; ++ii)
+                        {
+                            delete threads[ii];
+                        }
+                        for (size_t ii = 0, mm = channels.size(); mm > ii; ++ii)
+                        {
+                            doDestroyTestChannel(aService->getEndpoint(), channels[ii]);
+                        }
+                        if (okSoFar)
+                        {
+                            result = 0;
+                        }
+                        aService->stopService();
+                    }
+                    else
+                    {
+                        ODL_LOG("! (aService->startService())"); //####
+                    }
+                    delete aService;
+                }
+                else
+                {
+                    ODL_LOG("! (aService)"); //####
+                }
+            }
+            else
+            {
+                ODL_LOG("! ((0 < clientCount) && (0 < requestCount))"); //####
+            }
+        }
+        else
+        {
+            ODL_LOG("! (3 == argc)"); //####
+        }
+    }
+    catch (...)
+    {
+        ODL_LOG("Exception caught"); //####
+        throw;
+    }
+    ODL_EXIT_I(result); //####
+    return result;
+} // doTestConcurrentRequests
+
+#if defined(__APPLE__)
+# pragma mark *** Test Case 21 ***
+#endif // defined(__APPLE__)
+
+#if (! MAC_OR_LINUX_)
+# pragma warning(push)
+# pragma warning(disable: 4100)
+#endif // ! MAC_OR_LINUX_
+/*! @brief Perform a test case.
+ @param[in] launchPath The command-line name used to launch the service.
+ @param[in] argc The number of arguments in 'argv'.
+ @param[in] argv The arguments to be used for the test.
+ @return @c 0 on success and @c 1 on failure. */
+static int
+doTestShutdownWithDispatchThreads(const char * launchPath,
+                                  const int    argc,
+                                  char * *     argv) // close endpoint while input is arriving
+{
+#if (! defined(ODL_ENABLE_LOGGING_))
+# if MAC_OR_LINUX_
+#  pragma unused(launchPath)
+# endif // MAC_OR_LINUX_
+#endif // ! defined(ODL_ENABLE_LOGGING_)
+    ODL_ENTER(); //####
+    ODL_S1("launchPath = ", launchPath); //####
+    ODL_I1("argc = ", argc); //####
+    ODL_P1("argv = ", argv); //####
+    int result = 1;
+
+    try
+    {
+        bool okSoFar = true;
+
+        // Repeat the shutdown, as the input that is in flight differs each time.
+        for (int round = 0; okSoFar && (3 > round); ++round)
+        {
+            Endpoint * stuff = doCreateEndpointForTest(argc, argv);
+
+            okSoFar = false;
+            if (stuff)
+            {
+                Test04Handler handler;
+
+                if (handler.enableAsynchronousDispatch(2, 4) && stuff->setInputHandler(handler) &&
+                    stuff->open(STANDARD_WAIT_TIME_))
+                {
+                    YarpString                        endpointName(stuff->getName());
+                    std::vector<ClientChannel *>      channels;
+                    std::vector<Test21WriterThread *> writers;
+                    yarp::os::Bottle                  message;
+
+                    message.addString("howdi");
+                    // Two senders, so that both dispatch threads are kept busy.
+                    for (int ii = 0; 2 > ii; ++ii)
+                    {
+                        ClientChannel * outChannel =
+                                    doCreateTestChannel(endpointName,
+                                                        "_test_/shutdownwithdispatchthreads_");
+
+                        if (outChannel)
+                        {
+                            Test21WriterThread * aWriter = new Test21WriterThread(*outChannel,
+                                                                                  message);
+
+                            channels.push_back(outChannel);
+                            if (aWriter->start())
+                            {
+                                writers.push_back(aWriter);
+                            }
+                            else
+                            {
+                                ODL_LOG("! (aWriter->start())"); //####
+                                delete aWriter;
+                            }
+                        }
+                        else
+                        {
+                            ODL_LOG("! (outChannel)"); //####
+                        }
+                    }
+                    if (2 == writers.size())
+                    {
+                        okSoFar = true;
+                    }
+                    else
+                    {
+                        ODL_LOG("! (2 == writers.size())"); //####
+                    }
+                    yarp::os::Time::delay(5 * INITIAL_RETRY_INTERVAL_);
+                    // Close the endpoint while the writers are still sending.
+                    delete stuff;
+                    stuff = NULL;
+                    for (size_t ii = 0, mm = writers.size(); mm > ii; ++ii)
+                    {
+                        writers[ii]->stop();
+                        if (0 >= writers[ii]->sentCount())
+                        {
+                            ODL_LOG("(0 >= writers[ii]->sentCount())"); //####
+                            okSoFar = false;
+                        }
+                        delete writers[ii];
+                    }
+                    for (size_t ii = 0, mm = channels.size(); mm > ii; ++ii)
+                    {
+                        doDestroyTestChannel(endpointName, channels[ii]);
+                    }
+                }
+                else
+                {
+                    ODL_LOG("! (handler.enableAsynchronousDispatch(2, 4) && " //####
+                            "stuff->setInputHandler(handler) && " //####
+                            "stuff->open(STANDARD_WAIT_TIME_))"); //####
+                }
+                delete stuff;
+            }
+            else
+            {
+                ODL_LOG("! (stuff)"); //####
+            }
+        }
+        if (okSoFar)
+        {
+            result = 0;
+        }
+    }
+    catch (...)
+    {
+        ODL_LOG("Exception caught"); //####
+        throw;
+    }
+    ODL_EXIT_I(result); //####
+    return result;
+} // doTestShutdownWithDispatchThreads
+#if (! MAC_OR_LINUX_)
+# pragma warning(pop)
+#endif // ! MAC_OR_LINUX_
+
+#if defined(__APPLE__)
+# pragma mark *** Test Case 22 ***
+#endif // defined(__APPLE__)
+
+/*! @brief Check the messages that were received and the counters of a channel against its
+ overflow policy.
+ @param[in] received The numbers of the messages that were received, in order.
+ @param[in] counters The send / receive counters of the channel.
+ @param[in] policy The overflow policy of the channel.
+ @param[in] limit The maximum number of messages that could be waiting to be sent.
+ @return @c true if the messages and the counters match the policy and @c false otherwise. */
+static bool
+checkOverflowResults(const std::vector<int> &    received,
+                     const SendReceiveCounters & counters,
+                     const OverflowPolicy        policy,
+                     const size_t                limit)
+{
+    ODL_ENTER(); //####
+    ODL_P2("received = ", &received, "counters = ", &counters); //####
+    ODL_I2("policy = ", policy, "limit = ", limit); //####
+    bool    result = (0 < received.size());
+    int64_t dropped = counters.outDropped();
+    int64_t maxLag = counters.maxOutLag();
+    size_t  count = received.size();
+
+    // Whatever the policy, the messages that get through are in the order in which they were
+    // written and every message that didn't get through is counted.
+    for (size_t ii = 1; result && (count > ii); ++ii)
+    {
+        result = (received[ii - 1] < received[ii]);
+    }
+    if (result)
+    {
+        result = ((kOverflowMessageCount - static_cast<int64_t>(count)) == dropped);
+    }
+    if (result)
+    {
+        switch (policy)
+        {
+            case kOverflowPolicyBlock :
+                result = ((kOverflowMessageCount == static_cast<int>(count)) && (0 == maxLag));
+                break;
+
+            case kOverflowPolicyDropOldest :
+                // The newest messages are the ones that were kept.
+                result = ((0 < dropped) && (limit <= count) &&
+                          (static_cast<int64_t>(limit) == maxLag));
+                for (size_t ii = 0; result && (limit > ii); ++ii)
+                {
+                    result = ((kOverflowMessageCount - 1 - static_cast<int>(ii)) ==
+                              received[count - 1 - ii]);
+                }
+                break;
+
+            case kOverflowPolicyDropNewest :
+                // The oldest messages are the ones that were kept.
+                result = ((0 < dropped) && (static_cast<int64_t>(limit) == maxLag));
+                for (size_t ii = 0; result && (count > ii); ++ii)
+                {
+                    result = (static_cast<int>(ii) == received[ii]);
+                }
+                break;
+
+            case kOverflowPolicyLatestOnly :
+                result = ((0 < dropped) && (1 == maxLag) &&
+                          ((kOverflowMessageCount - 1) == received[count - 1]));
+                break;
+
+            default :
+                result = false;
+                break;
+
+        }
+    }
+    ODL_EXIT_B(result); //####
+    return result;
+} // checkOverflowResults
+
+#if (! MAC_OR_LINUX_)
+# pragma warning(push)
+# pragma warning(disable: 4100)
+#endif // ! MAC_OR_LINUX_
+/*! @brief Perform a test case.
+ @param[in] launchPath The command-line name used to launch the service.
+ @param[in] argc The number of arguments in 'argv'.
+ @param[in] argv The arguments to be used for the test.
+ @return @c 0 on success and @c 1 on failure. */
+static int
+doTestOverflowPolicy(const char * launchPath,
+                     const int    argc,
+                     char * *     argv) // send messages faster than the receiver can handle them
+{
+#if (! defined(ODL_ENABLE_LOGGING_))
+# if MAC_OR_LINUX_
+#  pragma unused(launchPath)
+# endif // MAC_OR_LINUX_
+#endif // ! defined(ODL_ENABLE_LOGGING_)
+    ODL_ENTER(); //####
+    ODL_S1("launchPath = ", launchPath); //####
+    ODL_I1("argc = ", argc); //####
+    ODL_P1("argv = ", argv); //####
+    int result = 1;
+
+    try
+    {
+        // Argument order for the test = endpoint name, overflow policy, queue limit
+        if (3 == argc)
+        {
+            int        policy = atoi(argv[1]);
+            int        limit = atoi(argv[2]);
+            Endpoint * stuff = doCreateEndpointForTest(1, argv);
+
+            if (stuff && (kOverflowPolicyBlock <= policy) &&
+                (kOverflowPolicyLatestOnly >= policy) && (0 < limit))
+            {
+                Test22Handler handler(kOverflowProcessingTime);
+
+                if (stuff->setInputHandler(handler) && stuff->open(STANDARD_WAIT_TIME_))
+                {
+                    OverflowPolicy   thePolicy = static_cast<OverflowPolicy>(policy);
+                    YarpString       aName(GetRandomChannelName("_test_/overflowpolicy_"));
+                    GeneralChannel * outChannel = new GeneralChannel(true);
+
+                    outChannel->enableMetrics();
+                    if (outChannel->openWithRetries(aName, STANDARD_WAIT_TIME_) &&
+                        Utilities::NetworkConnectWithRetries(aName, stuff->getName(),
+                                                             STANDARD_WAIT_TIME_) &&
+                        outChannel->setOverflowPolicy(thePolicy, static_cast<size_t>(limit)))
+                    {
+                        SendReceiveCounters counters;
+
+                        for (int ii = 0; kOverflowMessageCount > ii; ++ii)
+                        {
+                            yarp::os::Bottle message;
+
+                            message.addInt(ii);
+                            if (! outChannel->writeBottle(message))
+                            {
+                                ODL_LOG("(! outChannel->writeBottle(message))"); //####
+                            }
+                        }
+                        // Wait for the queued messages to get through, which is when the
+                        // receiver goes quiet.
+                        for (bool waiting = handler.waitForMessage(STANDARD_WAIT_TIME_);
+                             waiting; )
+                        {
+                            waiting = handler.waitForMessage(20 * kOverflowProcessingTime);
+                        }
+                        outChannel->getSendReceiveCounters(counters);
+                        if (checkOverflowResults(handler.received(), counters, thePolicy,
+                                                 static_cast<size_t>(limit)))
+                        {
+                            result = 0;
+                        }
+                        else
+                        {
+                            ODL_LOG("! (checkOverflowResults(handler.received(), counters, " //####
+                                    "thePolicy, static_cast<size_t>(limit)))"); //####
+                        }
+                        outChannel->close();
+                    }
+                    else
+                    {
+                        ODL_LOG("! (outChannel->openWithRetries(aName, " //####
+                                "STANDARD_WAIT_TIME_) && " //####
+                                "Utilities::NetworkConnectWithRetries(aName, " //####
+                                "stuff->getName(), STANDARD_WAIT_TIME_) && " //####
+                                "outChannel->setOverflowPolicy(thePolicy, " //####
+                                "static_cast<size_t>(limit)))"); //####
+                    }
+                    BaseChannel::RelinquishChannel(outChannel);
+                }
+                else
+                {
+                    ODL_LOG("! (stuff->setInputHandler(handler) && " //####
+                            "stuff->open(STANDARD_WAIT_TIME_))"); //####
+                }
+                delete stuff;
+                handler.stopProcessing();
+            }
+            else
+            {
+                ODL_LOG("! (stuff && (kOverflowPolicyBlock <= policy) && " //####
+                        "(kOverflowPolicyLatestOnly >= policy) && (0 < limit))"); //####
+                delete stuff;
+            }
+        }
+        else
+        {
+            ODL_LOG("! (3 == argc)"); //####
+        }
+    }
+    catch (...)
+    {
+        ODL_LOG("Exception caught"); //####
+        throw;
+    }
+    ODL_EXIT_I(result); //####
+    return result;
+} // doTestOverflowPolicy
+#if (! MAC_OR_LINUX_)
+# pragma warning(pop)
+#endif // ! MAC_OR_LINUX_
+
+#if defined(__APPLE__)
+# pragma mark *** Test Case 23 ***
+#endif // defined(__APPLE__)
+
+/*! @brief Send an echo request using a pooled connection.
+ @param[in] destination The name of the channel that is to receive the request.
+ @return @c true if the request was sent and a response received and @c false otherwise. */
+static bool
+doPooledEchoRequest(const YarpString & destination)
+{
+    ODL_ENTER(); //####
+    ODL_S1s("destination = ", destination); //####
+    yarp::os::Bottle parameters("some to send");
+    ServiceRequest   request(MpM_ECHO_REQUEST_, parameters);
+    ServiceResponse  response;
+    bool             result = (ClientChannelPool::SendRequest(destination, request, response,
+                                                              true, false) &&
+                               (0 < response.count()));
+
+    ODL_EXIT_B(result); //####
+    return result;
+} // doPooledEchoRequest
+
+#if (! MAC_OR_LINUX_)
+# pragma warning(push)
+# pragma warning(disable: 4100)
+#endif // ! MAC_OR_LINUX_
+/*! @brief Perform a test case.
+ @param[in] launchPath The command-line name used to launch the service.
+ @param[in] argc The number of arguments in 'argv'.
+ @param[in] argv The arguments to be used for the test.
+ @return @c 0 on success and @c 1 on failure. */
+static int
+doTestConnectionPool(const char * launchPath,
+                     const int    argc,
+                     char * *     argv) // reuse, expire and evict pooled connections
+{
+#if (! defined(ODL_ENABLE_LOGGING_))
+# if MAC_OR_LINUX_
+#  pragma unused(launchPath)
+# endif // MAC_OR_LINUX_
+#endif // ! defined(ODL_ENABLE_LOGGING_)
+    ODL_ENTER(); //####
+    ODL_S1("launchPath = ", launchPath); //####
+    ODL_I1("argc = ", argc); //####
+    ODL_P1("argv = ", argv); //####
+    int result = 1;
+
+    try
+    {
+        // Argument order for the test = endpoint name, scenario
+        if (2 == argc)
+        {
+            int                     scenario = atoi(argv[1]);
+            bool                    okSoFar = true;
+            Endpoint *              endpoints[kPoolDestinationCount];
+            Test08Handler           handlers[kPoolDestinationCount];
+            std::vector<YarpString> names;
+
+            for (int ii = 0; kPoolDestinationCount > ii; ++ii)
+            {
+                std::stringstream buff;
+
+                buff << *argv << "_" << ii;
+                endpoints[ii] = new Endpoint(buff.str());
+                if (okSoFar)
+                {
+                    okSoFar = (endpoints[ii]->setInputHandler(handlers[ii]) &&
+                               endpoints[ii]->open(STANDARD_WAIT_TIME_));
+                    if (okSoFar)
+                    {
+                        names.push_back(endpoints[ii]->getName());
+                    }
+                    else
+                    {
+                        ODL_LOG("! (endpoints[ii]->setInputHandler(handlers[ii]) && " //####
+                                "endpoints[ii]->open(STANDARD_WAIT_TIME_))"); //####
+                    }
+                }
+            }
+            if (okSoFar)
+            {
+                switch (scenario)
+                {
+                    case 0 :
+                        // Requests sent one after the other share a single connection.
+                        for (int ii = 0; okSoFar && (3 > ii); ++ii)
+                        {
+                            okSoFar = doPooledEchoRequest(names[0]);
+                        }
+                        okSoFar = (okSoFar &&
+                                   (1 == ClientChannelPool::GetIdleChannelCount(names[0])) &&
+                                   (1 == ClientChannelPool::GetIdleDestinationCount()));
+                        break;
+
+                    case 1 :
+                        // A connection that has been idle for too long is discarded when another
+                        // connection is returned to the pool.
+                        ClientChannelPool::SetLimits(kPoolIdleLimit,
+                                                     CONNECTION_POOL_DESTINATION_LIMIT_);
+                        okSoFar = (doPooledEchoRequest(names[0]) &&
+                                   (1 == ClientChannelPool::GetIdleChannelCount(names[0])));
+                        if (okSoFar)
+                        {
+                            yarp::os::Time::delay(2 * kPoolIdleLimit);
+                            okSoFar = (doPooledEchoRequest(names[1]) &&
+                                       (0 == ClientChannelPool::GetIdleChannelCount(names[0])) &&
+                                       (1 == ClientChannelPool::GetIdleChannelCount(names[1])) &&
+                                       (1 == ClientChannelPool::GetIdleDestinationCount()));
+                        }
+                        break;
+
+                    case 2 :
+                        // Only the most recently used destinations keep their connections.
+                        ClientChannelPool::SetLimits(CONNECTION_POOL_IDLE_LIMIT_,
+                                                     kPoolDestinationCount - 1);
+                        for (int ii = 0; okSoFar && (kPoolDestinationCount > ii); ++ii)
+                        {
+                            okSoFar = doPooledEchoRequest(names[ii]);
+                        }
+                        okSoFar = (okSoFar &&
+                                   (0 == ClientChannelPool::GetIdleChannelCount(names[0])) &&
+                                   (1 == ClientChannelPool::GetIdleChannelCount(names[1])) &&
+                                   (1 == ClientChannelPool::GetIdleChannelCount(names[2])) &&
+                                   (static_cast<size_t>(kPoolDestinationCount - 1) ==
+                                    ClientChannelPool::GetIdleDestinationCount()));
+                        break;
+
+                    default :
+                        okSoFar = false;
+                        break;
+
+                }
+                if (okSoFar)
+                {
+                    result = 0;
+                }
+                else
+                {
+                    ODL_LOG("! (okSoFar)"); //####
+                }
+            }
+            ClientChannelPool::CloseAll();
+            for (int ii = 0; kPoolDestinationCount > ii; ++ii)
+            {
+                delete endpoints[ii];
+            }
+        }
+        else
+        {
+            ODL_LOG("! (2 == argc)"); //####
+        }
+    }
+    catch (...)
+    {
+        ODL_LOG("Exception caught"); //####
+        throw;
+    }
+    ODL_EXIT_I(result); //####
+    return result;
+} // doTestConnectionPool
+#if (! MAC_OR_LINUX_)
+# pragma warning(pop)
+#endif // ! MAC_OR_LINUX_
+
+/*! @brief The signal handler to catch requests to stop the service.
+ @param[in] signal The signal being handled. */
+static void
+catchSignal(int signal)
+{
+    ODL_ENTER(); //####
+    ODL_I1("signal = ", signal); //####
+    std::stringstream buff;
+    YarpString        message("Exiting due to signal ");
+
+    buff << signal;
+    message += buff.str();
+    message += " = ";
+    message += NameOfSignal(signal);
+    MpM_ERROR_(message.c_str());
+    ODL_EXIT_EXIT(1); //####
+    yarp::os::exit(1);
+} // catchSignal
+
+#if defined(__APPLE__)
+# pragma mark Global functions
+#endif // defined(__APPLE__)
+
+/*! @brief The entry point for unit tests of the m+m common classes.
+
+ The first argument is the test number, the second argument is the name of the channel to be used
+ with the test, the optional third argument is the machine to connect to and the optional fourth
+ argument is the port number to be used. Output depends on the test being run.
+ @param[in] argc The number of arguments in 'argv'.
+ @param[in] argv The arguments to be used with the unit tests.
+ @return @c 0 on a successful test and @c 1 on failure. */
+int
+main(int      argc,
+     char * * argv)
+{
+    YarpString progName(*argv);
+
+    ODL_INIT(progName.c_str(), kODLoggingOptionIncludeProcessID | //####
+             kODLoggingOptionIncludeThreadID | kODLoggingOptionEnableThreadSupport | //####
+             kODLoggingOptionWriteToStderr); //####
+    ODL_ENTER(); //####
+#if MAC_OR_LINUX_
+    SetUpLogger(progName);
+#endif // MAC_OR_LINUX_
+    int result = 1;
+
+    try
+    {
+        Utilities::SetUpGlobalStatusReporter();
+        Utilities::CheckForNameServerReporter();
+        if (Utilities::CheckForValidNetwork())
+        {
+            yarp::os::Network yarp; // This is necessary to establish any connections to the YARP
+                                    // infrastructure
+
+            Initialize(progName);
+            if (0 < --argc)
+            {
+                const char * startPtr = argv[1];
+                char *       endPtr;
+                int          selector = strtol(startPtr, &endPtr, 10);
+
+                if ((startPtr != endPtr) && (! *endPtr) && (0 < selector))
+                {
+                    SetSignalHandlers(catchSignal);
+                    switch (selector)
+                    {
+                        case 0 :
+                            // Just used to validate the random number seed.
+                            result = 0;
+                            break;
+
+                        case 1 :
+                            result = doTestCreateEndpoint(*argv, argc - 1, argv + 2);
+                            break;
+
+                        case 2 :
+                            result = doTestConnectToEndpoint(*argv, argc - 1, argv + 2);
+                            break;
+
+                        case 3 :
+                            result = doTestWriteToEndpoint(*argv, argc - 1, argv + 2);
+                            break;
+
+                        case 4 :
+                            result = doTestEchoFromEndpointWithReader(*argv, argc - 1, argv + 2);
+                            break;
+
+                        case 5 :
+                            result = doTestEchoFromEndpointWithReaderCreator(*argv, argc - 1,
+                                                                             argv + 2);
+                            break;
+
+                        case 6 :
+                            result = doTestCreateRequest(*argv, argc - 1, argv + 2);
+                            break;
+
+                        case 7 :
+                            result = doTestCreateResponse(*argv, argc - 1, argv + 2);
+                            break;
+
+                        case 8 :
+                            result = doTestRequestEchoFromEndpoint(*argv, argc - 1, argv + 2);
+                            break;
+
+                        case 9 :
+                            result = doTestRequestEchoFromServiceUsingDefaultWithReader(*argv,
+                                                                                        argc - 1,
+                                                                                        argv + 2);
+                            break;
+
+                        case 10 :
+                            result =
+                            doTestRequestEchoFromServiceUsingDefaultWithReaderCreator(*argv,
+                                                                                      argc - 1,
+                                                                                      argv + 2);
+                            break;
+
+                        case 11 :
+                            result = doTestRequestEchoFromServiceWithRequestHandler(*argv, argc - 1,
+                                                                                    argv + 2);
+                            break;
+
+                        case 12 :
+                            result = doTestRequestEchoFromServiceWithRequestHandlerAndInfo(*argv,
+                                                                                           argc - 1,
+                                                                                           argv + 2);
+                            break;
+
+                        case 13 :
+                            result = doTestConcurrentSendReceiveCounters(*argv, argc - 1, argv + 2);
+                            break;
+
+                        case 14 :
+                            result = doTestEchoFromEndpointWithDispatchThreads(*argv, argc - 1,
+                                                                               argv + 2);
+                            break;
+
+                        case 15 :
+                            result = doTestSharedMemoryStream(*argv, argc - 1, argv + 2);
+                            break;
+
+                        case 16 :
+                            result = doTestNumericArray(*argv, argc - 1, argv + 2);
+                            break;
+
+                        case 17 :
+                            result = doTestBatchedMessages(*argv, argc - 1, argv + 2);
+                            break;
+
+                        case 18 :
+                            result = doTestRawInput(*argv, argc - 1, argv + 2);
+                            break;
+
+                        case 19 :
+                            result = doTestAsyncRequests(*argv, argc - 1, argv + 2);
+                            break;
+
+                        case 20 :
+                            result = doTestConcurrentRequests(*argv, argc - 1, argv + 2);
+                            break;
+
+                        case 21 :
+                            result = doTestShutdownWithDispatchThreads(*argv, argc - 1, argv + 2);
+                            break;
+
+                        case 22 :
+                            result = doTestOverflowPolicy(*argv, argc - 1, argv + 2);
+                            break;
+
+                        case 23 :
+                            result = doTestConnectionPool(*argv, argc - 1, argv + 2);
                             break;
 
                         default :
@@ -90,6 +90,7 @@ Test04Handler::Test04Handler(void) :
 Test04Handler::~Test04Handler(void)
 {
     ODL_OBJENTER(); //####
+    stopProcessing();
     ODL_OBJEXIT(); //####
 } // Test04Handler::~Test04Handler
 
@@ -106,7 +106,8 @@ bool
 Test09DefaultRequestHandler::processRequest(const YarpString &           request,
                                             const yarp::os::Bottle &     restOfInput,
                                             const YarpString &           senderChannel,
-                                            yarp::os::ConnectionWriter * replyMechanism)
+                                            yarp::os::ConnectionWriter * replyMechanism,
+                                            yarp::os::Bottle &           response)
 {
 #if (! defined(ODL_ENABLE_LOGGING_))
 # if MAC_OR_LINUX_
@@ -116,13 +117,12 @@ Test09DefaultRequestHandler::processRequest(const YarpString &           request
     ODL_OBJENTER(); //####
     ODL_S3s("request = ", request, "restOfInput = ", restOfInput.toString(), //####
             "senderChannel = ", senderChannel); //####
-    ODL_P1("replyMechanism = ", replyMechanism); //####
+    ODL_P2("replyMechanism = ", replyMechanism, "response = ", &response); //####
     bool result = true;
 
-    _response.clear();
-    _response.addString(name());
-    _response.append(restOfInput);
-    sendResponse(replyMechanism);
+    response.addString(name());
+    response.append(restOfInput);
+    sendResponse(response, replyMechanism);
     ODL_OBJEXIT_B(result); //####
     return result;
 } // Test09DefaultRequestHandler::processRequest
@@ -85,14 +85,16 @@ using namespace MplusM::Test;
 
 Test11Service::Test11Service(const YarpString & launchPath,
                              const int          argc,
-                             char * *           argv) :
-    inherited(kServiceKindNormal, launchPath, argc, argv, true, "Test11",
+                             char * *           argv,
+                             const size_t       requestWorkers) :
+    inherited(kServiceKindNormal, launchPath, argc, argv, (0 == requestWorkers), "Test11",
               "Simple service for unit tests", ""), _echoHandler(NULL)
 {
     ODL_ENTER(); //####
     ODL_S1s("launchPath = ", launchPath); //####
-    ODL_I1("argc = ", argc); //####
+    ODL_I2("argc = ", argc, "requestWorkers = ", requestWorkers); //####
     ODL_P1("argv = ", argv); //####
+    setRequestWorkerCount(requestWorkers);
     attachRequestHandlers();
     ODL_EXIT_P(this); //####
 } // Test11Service::Test11Service
@@ -75,10 +75,13 @@ namespace MplusM
             /*! @brief The constructor.
              @param[in] launchPath The command-line name used to launch the service.
              @param[in] argc The number of arguments in 'argv'.
-             @param[in] argv The arguments to be used to specify the new service. */
+             @param[in] argv The arguments to be used to specify the new service.
+             @param[in] requestWorkers The number of worker threads that process requests, as
+             used by the Echo service, or zero to give each connection its own handler. */
             Test11Service(const YarpString & launchPath,
                           const int          argc,
-                          char * *           argv);
+                          char * *           argv,
+                          const size_t       requestWorkers = 0);
 
             /*! @brief The destructor. */
             virtual
@@ -131,7 +131,8 @@ bool
 Test12EchoRequestHandler::processRequest(const YarpString &           request,
                                          const yarp::os::Bottle &     restOfInput,
                                          const YarpString &           senderChannel,
-                                         yarp::os::ConnectionWriter * replyMechanism)
+                                         yarp::os::ConnectionWriter * replyMechanism,
+                                         yarp::os::Bottle &           response)
 {
 #if (! defined(ODL_ENABLE_LOGGING_))
 # if MAC_OR_LINUX_
@@ -141,11 +142,11 @@ Test12EchoRequestHandler::processRequest(const YarpString &           request,
     ODL_OBJENTER(); //####
     ODL_S3s("request = ", request, "restOfInput = ", restOfInput.toString(), //####
             "senderChannel = ", senderChannel); //####
-    ODL_P1("replyMechanism = ", replyMechanism); //####
+    ODL_P2("replyMechanism = ", replyMechanism, "response = ", &response); //####
     bool result = true;
 
-    _response = restOfInput;
-    sendResponse(replyMechanism);
+    response = restOfInput;
+    sendResponse(response, replyMechanism);
     ODL_OBJEXIT_B(result); //####
     return result;
 } // Test12EchoRequestHandler::processRequest
@@ -0,0 +1,138 @@
+//--------------------------------------------------------------------------------------------------
+//
+//  File:       CommonTests/m+mTest13CounterThread.hpp
+//
+//  Project:    m+m
+//
+//  Contains:   The class declaration for a thread that updates send / receive counters, used by the
+//              unit tests.
+//
+//  Written by: Norman Jaffe
+//
+//  Copyright:  (c) 2026 by OpenDragon.
+//
+//              All rights reserved. Redistribution and use in source and binary forms, with or
+//              without modification, are permitted provided that the following conditions are met:
+//                * Redistributions of source code must retain the above copyright notice, this list
+//                  of conditions and the following disclaimer.
+//                * Redistributions in binary form must reproduce the above copyright notice, this
+//                  list of conditions and the following disclaimer in the documentation and / or
+//                  other materials provided with the distribution.
+//                * Neither the name of the copyright holders nor the names of its contributors may
+//                  be used to endorse or promote products derived from this software without
+//                  specific prior written permission.
+//
+//              THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//              EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//              OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//              SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//              INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//              TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//              BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//              CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//              ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//              DAMAGE.
+//
+//  Created:    2026-10-17
+//
+//--------------------------------------------------------------------------------------------------
+
+
+#if (! defined(MpMTest13CounterThread_HPP_))
+# define MpMTest13CounterThread_HPP_ /* Header guard */
+
+# include <m+m/m+mBaseThread.hpp>
+# include <m+m/m+mShardedSendReceiveCounters.hpp>
+
+# if defined(__APPLE__)
+#  pragma clang diagnostic push
+#  pragma clang diagnostic ignored "-Wunknown-pragmas"
+#  pragma clang diagnostic ignored "-Wdocumentation-unknown-command"
+# endif // defined(__APPLE__)
+/*! @file
+ @brief The class declaration for a thread that updates send / receive counters, used by the unit
+ tests. */
+# if defined(__APPLE__)
+#  pragma clang diagnostic pop
+# endif // defined(__APPLE__)
+
+namespace MplusM
+{
+    namespace Test
+    {
+        /*! @brief A thread that repeatedly updates a shared set of send / receive counters. */
+        class Test13CounterThread : public Common::BaseThread
+        {
+        public :
+
+        protected :
+
+        private :
+
+            /*! @brief The class that this class is derived from. */
+            typedef BaseThread inherited;
+
+        public :
+
+            /*! @brief The constructor.
+             @param[in] counters The counters to be updated.
+             @param[in] iterations The number of times to update the counters.
+             @param[in] messageSize The message size to be recorded with each update. */
+            Test13CounterThread(Common::ShardedSendReceiveCounters & counters,
+                                const int                            iterations,
+                                const int64_t                        messageSize);
+
+            /*! @brief The destructor. */
+            virtual
+            ~Test13CounterThread(void);
+
+        protected :
+
+        private :
+
+            /*! @brief The copy constructor.
+             @param[in] other The object to be copied. */
+            Test13CounterThread(const Test13CounterThread & other);
+
+            /*! @brief The assignment operator.
+             @param[in] other The object to be copied.
+             @return The updated object. */
+            Test13CounterThread &
+            operator =(const Test13CounterThread & other);
+
+            /*! @brief The thread main body. */
+            virtual void
+            run(void);
+
+        public :
+
+        protected :
+
+        private :
+
+            /*! @brief The counters to be updated. */
+            Common::ShardedSendReceiveCounters & _counters;
+
+            /*! @brief The message size to be recorded with each update. */
+            int64_t _messageSize;
+
+            /*! @brief The number of times to update the counters. */
+            int _iterations;
+
+# if defined(__APPLE__)
+#  pragma clang diagnostic push
+#  pragma clang diagnostic ignored "-Wunused-private-field"
+# endif // defined(__APPLE__)
+            /*! @brief Filler to pad to alignment boundary */
+            char _filler[4];
+# if defined(__APPLE__)
+#  pragma clang diagnostic pop
+# endif // defined(__APPLE__)
+
+        }; // Test13CounterThread
+
+    } // Test
+
+} // MplusM
+
+#endif // ! defined(MpMTest13CounterThread_HPP_)
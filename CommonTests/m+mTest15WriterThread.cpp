@@ -0,0 +1,136 @@
+//--------------------------------------------------------------------------------------------------
+//
+//  File:       CommonTests/m+mTest15WriterThread.cpp
+//
+//  Project:    m+m
+//
+//  Contains:   The class definition for a thread that writes a test pattern to a shared memory
+//              stream, used by the unit tests.
+//
+//  Written by: Norman Jaffe
+//
+//  Copyright:  (c) 2026 by OpenDragon.
+//
+//              All rights reserved. Redistribution and use in source and binary forms, with or
+//              without modification, are permitted provided that the following conditions are met:
+//                * Redistributions of source code must retain the above copyright notice, this list
+//                  of conditions and the following disclaimer.
+//                * Redistributions in binary form must reproduce the above copyright notice, this
+//                  list of conditions and the following disclaimer in the documentation and / or
+//                  other materials provided with the distribution.
+//                * Neither the name of the copyright holders nor the names of its contributors may
+//                  be used to endorse or promote products derived from this software without
+//                  specific prior written permission.
+//
+//              THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//              EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//              OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//              SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//              INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//              TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//              BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//              CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//              ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//              DAMAGE.
+//
+//  Created:    2026-10-17
+//
+//--------------------------------------------------------------------------------------------------
+
+
+#include "m+mTest15WriterThread.hpp"
+
+//#include <odlEnable.h>
+#include <odlInclude.h>
+
+#if defined(__APPLE__)
+# pragma clang diagnostic push
+# pragma clang diagnostic ignored "-Wunknown-pragmas"
+# pragma clang diagnostic ignored "-Wdocumentation-unknown-command"
+#endif // defined(__APPLE__)
+/*! @file
+ @brief The class definition for a thread that writes a test pattern to a shared memory stream,
+ used by the unit tests. */
+#if defined(__APPLE__)
+# pragma clang diagnostic pop
+#endif // defined(__APPLE__)
+
+#if defined(__APPLE__)
+# pragma mark Namespace references
+#endif // defined(__APPLE__)
+
+using namespace MplusM;
+using namespace MplusM::Common;
+using namespace MplusM::Test;
+
+#if defined(MpM_UseSharedMemory)
+# if defined(__APPLE__)
+#  pragma mark Private structures, constants and variables
+# endif // defined(__APPLE__)
+
+/*! @brief The number of bytes written at a time; not a divisor of the ring size, so that writes
+ wrap around the end of the ring. */
+static const size_t kChunkSize = 1000;
+
+# if defined(__APPLE__)
+#  pragma mark Global constants and variables
+# endif // defined(__APPLE__)
+
+# if defined(__APPLE__)
+#  pragma mark Local functions
+# endif // defined(__APPLE__)
+
+# if defined(__APPLE__)
+#  pragma mark Class methods
+# endif // defined(__APPLE__)
+
+# if defined(__APPLE__)
+#  pragma mark Constructors and Destructors
+# endif // defined(__APPLE__)
+
+Test15WriterThread::Test15WriterThread(SharedMemoryStream & stream,
+                                       const size_t         byteCount) :
+    inherited(), _stream(stream), _byteCount(byteCount)
+{
+    ODL_ENTER(); //####
+    ODL_P1("stream = ", &stream); //####
+    ODL_I1("byteCount = ", byteCount); //####
+    ODL_EXIT_P(this); //####
+} // Test15WriterThread::Test15WriterThread
+
+Test15WriterThread::~Test15WriterThread(void)
+{
+    ODL_OBJENTER(); //####
+    ODL_OBJEXIT(); //####
+} // Test15WriterThread::~Test15WriterThread
+
+# if defined(__APPLE__)
+#  pragma mark Actions and Accessors
+# endif // defined(__APPLE__)
+
+void
+Test15WriterThread::run(void)
+{
+    ODL_OBJENTER(); //####
+    char          buffer[kChunkSize];
+    unsigned char pattern = 0;
+
+    for (size_t written = 0; _byteCount > written; )
+    {
+        size_t count = std::min(kChunkSize, _byteCount - written);
+
+        for (size_t ii = 0; count > ii; ++ii)
+        {
+            buffer[ii] = static_cast<char>(pattern++);
+        }
+        _stream.write(yarp::os::Bytes(buffer, count));
+        written += count;
+    }
+    _stream.close();
+    ODL_OBJEXIT(); //####
+} // Test15WriterThread::run
+#endif // defined(MpM_UseSharedMemory)
+
+#if defined(__APPLE__)
+# pragma mark Global functions
+#endif // defined(__APPLE__)
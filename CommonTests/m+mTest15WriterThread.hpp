@@ -1,14 +1,15 @@
 //--------------------------------------------------------------------------------------------------
 //
-//  File:       m+m/m+mBailOutThread.hpp
+//  File:       CommonTests/m+mTest15WriterThread.hpp
 //
 //  Project:    m+m
 //
-//  Contains:   The class declaration for a timeout thread for m+m.
+//  Contains:   The class declaration for a thread that writes a test pattern to a shared memory
+//              stream, used by the unit tests.
 //
 //  Written by: Norman Jaffe
 //
-//  Copyright:  (c) 2014 by H Plus Technologies Ltd. and Simon Fraser University.
+//  Copyright:  (c) 2026 by OpenDragon.
 //
 //              All rights reserved. Redistribution and use in source and binary forms, with or
 //              without modification, are permitted provided that the following conditions are met:
@@ -32,14 +33,16 @@
 //              ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
 //              DAMAGE.
 //
-//  Created:    2014-04-01
+//  Created:    2026-10-17
 //
 //--------------------------------------------------------------------------------------------------
 
-#if (! defined(MpMBailOutThread_HPP_))
-# define MpMBailOutThread_HPP_ /* Header guard */
+
+#if (! defined(MpMTest15WriterThread_HPP_))
+# define MpMTest15WriterThread_HPP_ /* Header guard */
 
 # include <m+m/m+mBaseThread.hpp>
+# include <m+m/m+mSharedMemoryStream.hpp>
 
 # if defined(__APPLE__)
 #  pragma clang diagnostic push
@@ -47,19 +50,20 @@
 #  pragma clang diagnostic ignored "-Wdocumentation-unknown-command"
 # endif // defined(__APPLE__)
 /*! @file
- @brief The class declaration for a timeout thread for m+m. */
+ @brief The class declaration for a thread that writes a test pattern to a shared memory stream,
+ used by the unit tests. */
 # if defined(__APPLE__)
 #  pragma clang diagnostic pop
 # endif // defined(__APPLE__)
 
+# if defined(MpM_UseSharedMemory)
 namespace MplusM
 {
-    namespace Common
+    namespace Test
     {
-        class BaseChannel;
-
-        /*! @brief A convenience class to timeout objects. */
-        class BailOutThread : public Common::BaseThread
+        /*! @brief A thread that writes a test pattern to a shared memory stream and then closes
+         the stream. */
+        class Test15WriterThread : public Common::BaseThread
         {
         public :
 
@@ -73,19 +77,14 @@ namespace MplusM
         public :
 
             /*! @brief The constructor.
-             @param[in] timeToWait The number of seconds to delay before triggering. */
-            explicit
-            BailOutThread(const double timeToWait);
-
-            /*! @brief The constructor.
-             @param[in] channelOfInterest The channel that we are waiting for.
-             @param[in] timeToWait The number of seconds to delay before triggering. */
-            BailOutThread(BaseChannel & channelOfInterest,
-                          const double  timeToWait);
+             @param[in] stream The stream to be written to.
+             @param[in] byteCount The number of bytes to be written. */
+            Test15WriterThread(Common::SharedMemoryStream & stream,
+                               const size_t                 byteCount);
 
             /*! @brief The destructor. */
             virtual
-            ~BailOutThread(void);
+            ~Test15WriterThread(void);
 
         protected :
 
@@ -93,42 +92,35 @@ namespace MplusM
 
             /*! @brief The copy constructor.
              @param[in] other The object to be copied. */
-            BailOutThread(const BailOutThread & other);
+            Test15WriterThread(const Test15WriterThread & other);
 
             /*! @brief The assignment operator.
              @param[in] other The object to be copied.
              @return The updated object. */
-            BailOutThread &
-            operator =(const BailOutThread & other);
+            Test15WriterThread &
+            operator =(const Test15WriterThread & other);
 
             /*! @brief The thread main body. */
             virtual void
             run(void);
 
-            /*! @brief The thread initialization method.
-             @return @c true if the thread is ready to run. */
-            virtual bool
-            threadInit(void);
-
         public :
 
         protected :
 
         private :
 
-            /*! @brief The base channel that we are waiting on. */
-            BaseChannel * _baseChannel;
-
-            /*! @brief The time at which the thread will stop running. */
-            double _endTime;
+            /*! @brief The stream to be written to. */
+            Common::SharedMemoryStream & _stream;
 
-            /*! @brief The number of seconds to delay before triggering. */
-            double _timeToWait;
+            /*! @brief The number of bytes to be written. */
+            size_t _byteCount;
 
-        }; // BailOutThread
+        }; // Test15WriterThread
 
-    } // Common
+    } // Test
 
 } // MplusM
+# endif // defined(MpM_UseSharedMemory)
 
-#endif // ! defined(MpMBailOutThread_HPP_)
+#endif // ! defined(MpMTest15WriterThread_HPP_)
@@ -0,0 +1,176 @@
+//--------------------------------------------------------------------------------------------------
+//
+//  File:       CommonTests/m+mTest17Handler.cpp
+//
+//  Project:    m+m
+//
+//  Contains:   The class definition for an input handler that counts coalesced messages, used by
+//              the unit tests.
+//
+//  Written by: Norman Jaffe
+//
+//  Copyright:  (c) 2026 by OpenDragon.
+//
+//              All rights reserved. Redistribution and use in source and binary forms, with or
+//              without modification, are permitted provided that the following conditions are met:
+//                * Redistributions of source code must retain the above copyright notice, this list
+//                  of conditions and the following disclaimer.
+//                * Redistributions in binary form must reproduce the above copyright notice, this
+//                  list of conditions and the following disclaimer in the documentation and / or
+//                  other materials provided with the distribution.
+//                * Neither the name of the copyright holders nor the names of its contributors may
+//                  be used to endorse or promote products derived from this software without
+//                  specific prior written permission.
+//
+//              THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//              EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//              OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//              SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//              INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//              TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//              BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//              CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//              ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//              DAMAGE.
+//
+//  Created:    2026-10-17
+//
+//--------------------------------------------------------------------------------------------------
+
+
+#include "m+mTest17Handler.hpp"
+
+//#include <odlEnable.h>
+#include <odlInclude.h>
+
+#if defined(__APPLE__)
+# pragma clang diagnostic push
+# pragma clang diagnostic ignored "-Wunknown-pragmas"
+# pragma clang diagnostic ignored "-Wdocumentation-unknown-command"
+#endif // defined(__APPLE__)
+/*! @file
+ @brief The class definition for an input handler that counts coalesced messages, used by the
+ unit tests. */
+#if defined(__APPLE__)
+# pragma clang diagnostic pop
+#endif // defined(__APPLE__)
+
+#if defined(__APPLE__)
+# pragma mark Namespace references
+#endif // defined(__APPLE__)
+
+using namespace MplusM;
+using namespace MplusM::Common;
+using namespace MplusM::Test;
+
+#if defined(__APPLE__)
+# pragma mark Private structures, constants and variables
+#endif // defined(__APPLE__)
+
+#if defined(__APPLE__)
+# pragma mark Global constants and variables
+#endif // defined(__APPLE__)
+
+#if defined(__APPLE__)
+# pragma mark Local functions
+#endif // defined(__APPLE__)
+
+#if defined(__APPLE__)
+# pragma mark Class methods
+#endif // defined(__APPLE__)
+
+#if defined(__APPLE__)
+# pragma mark Constructors and Destructors
+#endif // defined(__APPLE__)
+
+Test17Handler::Test17Handler(void) :
+    inherited(), _received(0), _batchCount(0), _nextNumber(0), _inOrder(true)
+{
+    ODL_ENTER(); //####
+    ODL_EXIT_P(this); //####
+} // Test17Handler::Test17Handler
+
+Test17Handler::~Test17Handler(void)
+{
+    ODL_OBJENTER(); //####
+    ODL_OBJEXIT(); //####
+} // Test17Handler::~Test17Handler
+
+#if defined(__APPLE__)
+# pragma mark Actions and Accessors
+#endif // defined(__APPLE__)
+
+#if (! MAC_OR_LINUX_)
+# pragma warning(push)
+# pragma warning(disable: 4100)
+#endif // ! MAC_OR_LINUX_
+bool
+Test17Handler::handleInput(const yarp::os::Bottle &     input,
+                           const YarpString &           senderChannel,
+                           yarp::os::ConnectionWriter * replyMechanism,
+                           const size_t                 numBytes)
+{
+#if (! defined(ODL_ENABLE_LOGGING_))
+# if MAC_OR_LINUX_
+#  pragma unused(senderChannel,replyMechanism,numBytes)
+# endif // MAC_OR_LINUX_
+#endif // ! defined(ODL_ENABLE_LOGGING_)
+    ODL_OBJENTER(); //####
+    ODL_S2s("senderChannel = ", senderChannel, "got ", input.toString()); //####
+    ODL_P1("replyMechanism = ", replyMechanism); //####
+    ODL_I1("numBytes = ", numBytes); //####
+    bool result = ((1 == input.size()) && input.get(0).isInt());
+
+    if (result)
+    {
+        if (input.get(0).asInt() != _nextNumber)
+        {
+            ODL_LOG("(input.get(0).asInt() != _nextNumber)"); //####
+            _inOrder = false;
+        }
+        ++_nextNumber;
+    }
+    else
+    {
+        ODL_LOG("! ((1 == input.size()) && input.get(0).isInt())"); //####
+        _inOrder = false;
+    }
+    _received.post();
+    ODL_OBJEXIT_B(result); //####
+    return result;
+} // Test17Handler::handleInput
+#if (! MAC_OR_LINUX_)
+# pragma warning(pop)
+#endif // ! MAC_OR_LINUX_
+
+bool
+Test17Handler::handleInputBatch(const yarp::os::Bottle &     inputs,
+                                const YarpString &           senderChannel,
+                                yarp::os::ConnectionWriter * replyMechanism,
+                                const size_t                 numBytes)
+{
+    ODL_OBJENTER(); //####
+    ODL_P2("inputs = ", &inputs, "replyMechanism = ", replyMechanism); //####
+    ODL_S1s("senderChannel = ", senderChannel); //####
+    ODL_I1("numBytes = ", numBytes); //####
+    ++_batchCount;
+    bool result = inherited::handleInputBatch(inputs, senderChannel, replyMechanism, numBytes);
+
+    ODL_OBJEXIT_B(result); //####
+    return result;
+} // Test17Handler::handleInputBatch
+
+bool
+Test17Handler::waitForMessage(const double timeToWait)
+{
+    ODL_OBJENTER(); //####
+    ODL_D1("timeToWait = ", timeToWait); //####
+    bool result = _received.waitWithTimeout(timeToWait);
+
+    ODL_OBJEXIT_B(result); //####
+    return result;
+} // Test17Handler::waitForMessage
+
+#if defined(__APPLE__)
+# pragma mark Global functions
+#endif // defined(__APPLE__)
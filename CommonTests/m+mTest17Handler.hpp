@@ -0,0 +1,183 @@
+//--------------------------------------------------------------------------------------------------
+//
+//  File:       CommonTests/m+mTest17Handler.hpp
+//
+//  Project:    m+m
+//
+//  Contains:   The class declaration for an input handler that counts coalesced messages, used by
+//              the unit tests.
+//
+//  Written by: Norman Jaffe
+//
+//  Copyright:  (c) 2026 by OpenDragon.
+//
+//              All rights reserved. Redistribution and use in source and binary forms, with or
+//              without modification, are permitted provided that the following conditions are met:
+//                * Redistributions of source code must retain the above copyright notice, this list
+//                  of conditions and the following disclaimer.
+//                * Redistributions in binary form must reproduce the above copyright notice, this
+//                  list of conditions and the following disclaimer in the documentation and / or
+//                  other materials provided with the distribution.
+//                * Neither the name of the copyright holders nor the names of its contributors may
+//                  be used to endorse or promote products derived from this software without
+//                  specific prior written permission.
+//
+//              THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//              EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//              OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//              SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//              INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//              TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//              BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//              CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//              ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//              DAMAGE.
+//
+//  Created:    2026-10-17
+//
+//--------------------------------------------------------------------------------------------------
+
+
+#if (! defined(MpMTest17Handler_HPP_))
+# define MpMTest17Handler_HPP_ /* Header guard */
+
+# include <m+m/m+mBaseInputHandler.hpp>
+
+# if defined(__APPLE__)
+#  pragma clang diagnostic push
+#  pragma clang diagnostic ignored "-Wunknown-pragmas"
+#  pragma clang diagnostic ignored "-Wdocumentation-unknown-command"
+# endif // defined(__APPLE__)
+/*! @file
+ @brief The class declaration for an input handler that counts coalesced messages, used by the
+ unit tests. */
+# if defined(__APPLE__)
+#  pragma clang diagnostic pop
+# endif // defined(__APPLE__)
+
+namespace MplusM
+{
+    namespace Test
+    {
+        /*! @brief A test input handler that checks that numbered messages arrive in order. */
+        class Test17Handler : public Common::BaseInputHandler
+        {
+        public :
+
+        protected :
+
+        private :
+
+            /*! @brief The class that this class is derived from. */
+            typedef BaseInputHandler inherited;
+
+        public :
+
+            /*! @brief The constructor. */
+            Test17Handler(void);
+
+            /*! @brief The destructor. */
+            virtual
+            ~Test17Handler(void);
+
+            /*! @brief Return the number of frames of coalesced messages that were received.
+             @return The number of frames of coalesced messages that were received. */
+            inline int
+            batchCount(void)
+            const
+            {
+                return _batchCount;
+            } // batchCount
+
+            /*! @brief Return @c true if the messages were received in order and @c false
+             otherwise.
+             @return @c true if the messages were received in order and @c false otherwise. */
+            inline bool
+            inOrder(void)
+            const
+            {
+                return _inOrder;
+            } // inOrder
+
+            /*! @brief Wait for a message to be received.
+             @param[in] timeToWait The number of seconds to wait for the message.
+             @return @c true if a message was received and @c false otherwise. */
+            bool
+            waitForMessage(const double timeToWait);
+
+        protected :
+
+        private :
+
+            /*! @brief The copy constructor.
+             @param[in] other The object to be copied. */
+            Test17Handler(const Test17Handler & other);
+
+            /*! @brief Process partially-structured input data.
+             @param[in] input The partially-structured input data.
+             @param[in] senderChannel The name of the channel used to send the input data.
+             @param[in] replyMechanism @c NULL if no reply is expected and non-@c NULL otherwise.
+             @param[in] numBytes The number of bytes available on the connection.
+             @return @c true if the input was correctly structured and successfully processed. */
+            virtual bool
+            handleInput(const yarp::os::Bottle &     input,
+                        const YarpString &           senderChannel,
+                        yarp::os::ConnectionWriter * replyMechanism,
+                        const size_t                 numBytes);
+
+            /*! @brief Process a set of messages that were coalesced by the sender.
+             @param[in] inputs The messages, each as a list, in the order in which they were
+             written.
+             @param[in] senderChannel The name of the channel used to send the input data.
+             @param[in] replyMechanism @c NULL if no reply is expected and non-@c NULL otherwise.
+             @param[in] numBytes The number of bytes available on the connection, for all the
+             messages.
+             @return @c true if the messages were correctly structured and successfully
+             processed. */
+            virtual bool
+            handleInputBatch(const yarp::os::Bottle &     inputs,
+                             const YarpString &           senderChannel,
+                             yarp::os::ConnectionWriter * replyMechanism,
+                             const size_t                 numBytes);
+
+            /*! @brief The assignment operator.
+             @param[in] other The object to be copied.
+             @return The updated object. */
+            Test17Handler &
+            operator =(const Test17Handler & other);
+
+        public :
+
+        protected :
+
+        private :
+
+            /*! @brief Signalled when a message has been received. */
+            yarp::os::Semaphore _received;
+
+            /*! @brief The number of frames of coalesced messages that were received. */
+            int _batchCount;
+
+            /*! @brief The number expected in the next message. */
+            int _nextNumber;
+
+            /*! @brief @c true if the messages were received in order and @c false otherwise. */
+            bool _inOrder;
+
+# if defined(__APPLE__)
+#  pragma clang diagnostic push
+#  pragma clang diagnostic ignored "-Wunused-private-field"
+# endif // defined(__APPLE__)
+            /*! @brief Filler to pad to alignment boundary */
+            char _filler[7];
+# if defined(__APPLE__)
+#  pragma clang diagnostic pop
+# endif // defined(__APPLE__)
+
+        }; // Test17Handler
+
+    } // Test
+
+} // MplusM
+
+#endif // ! defined(MpMTest17Handler_HPP_)
@@ -0,0 +1,146 @@
+//--------------------------------------------------------------------------------------------------
+//
+//  File:       CommonTests/m+mTest20RequestThread.cpp
+//
+//  Project:    m+m
+//
+//  Contains:   The class definition for a thread that sends requests to a service, used by the unit
+//              tests.
+//
+//  Written by: Norman Jaffe
+//
+//  Copyright:  (c) 2026 by OpenDragon.
+//
+//              All rights reserved. Redistribution and use in source and binary forms, with or
+//              without modification, are permitted provided that the following conditions are met:
+//                * Redistributions of source code must retain the above copyright notice, this list
+//                  of conditions and the following disclaimer.
+//                * Redistributions in binary form must reproduce the above copyright notice, this
+//                  list of conditions and the following disclaimer in the documentation and / or
+//                  other materials provided with the distribution.
+//                * Neither the name of the copyright holders nor the names of its contributors may
+//                  be used to endorse or promote products derived from this software without
+//                  specific prior written permission.
+//
+//              THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//              EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//              OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//              SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//              INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//              TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//              BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//              CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//              ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//              DAMAGE.
+//
+//  Created:    2026-10-17
+//
+//--------------------------------------------------------------------------------------------------
+
+
+#include "m+mTest20RequestThread.hpp"
+
+#include <m+m/m+mClientChannel.hpp>
+#include <m+m/m+mRequests.hpp>
+#include <m+m/m+mServiceRequest.hpp>
+#include <m+m/m+mServiceResponse.hpp>
+
+//#include <odlEnable.h>
+#include <odlInclude.h>
+
+#if defined(__APPLE__)
+# pragma clang diagnostic push
+# pragma clang diagnostic ignored "-Wunknown-pragmas"
+# pragma clang diagnostic ignored "-Wdocumentation-unknown-command"
+#endif // defined(__APPLE__)
+/*! @file
+ @brief The class definition for a thread that sends requests to a service, used by the unit
+ tests. */
+#if defined(__APPLE__)
+# pragma clang diagnostic pop
+#endif // defined(__APPLE__)
+
+#if defined(__APPLE__)
+# pragma mark Namespace references
+#endif // defined(__APPLE__)
+
+using namespace MplusM;
+using namespace MplusM::Common;
+using namespace MplusM::Test;
+
+#if defined(__APPLE__)
+# pragma mark Private structures, constants and variables
+#endif // defined(__APPLE__)
+
+#if defined(__APPLE__)
+# pragma mark Global constants and variables
+#endif // defined(__APPLE__)
+
+#if defined(__APPLE__)
+# pragma mark Local functions
+#endif // defined(__APPLE__)
+
+#if defined(__APPLE__)
+# pragma mark Class methods
+#endif // defined(__APPLE__)
+
+#if defined(__APPLE__)
+# pragma mark Constructors and Destructors
+#endif // defined(__APPLE__)
+
+Test20RequestThread::Test20RequestThread(ClientChannel & channel,
+                                         const int       threadNumber,
+                                         const int       requestCount) :
+    inherited(), _channel(channel), _requestCount(requestCount), _threadNumber(threadNumber),
+    _succeeded(false)
+{
+    ODL_ENTER(); //####
+    ODL_P1("channel = ", &channel); //####
+    ODL_I2("threadNumber = ", threadNumber, "requestCount = ", requestCount); //####
+    ODL_EXIT_P(this); //####
+} // Test20RequestThread::Test20RequestThread
+
+Test20RequestThread::~Test20RequestThread(void)
+{
+    ODL_OBJENTER(); //####
+    ODL_OBJEXIT(); //####
+} // Test20RequestThread::~Test20RequestThread
+
+#if defined(__APPLE__)
+# pragma mark Actions and Accessors
+#endif // defined(__APPLE__)
+
+void
+Test20RequestThread::run(void)
+{
+    ODL_OBJENTER(); //####
+    bool okSoFar = true;
+
+    for (int ii = 0; okSoFar && (_requestCount > ii); ++ii)
+    {
+        yarp::os::Bottle parameters;
+        ServiceResponse  response;
+
+        parameters.addInt(_threadNumber);
+        parameters.addInt(ii);
+        ServiceRequest request(MpM_ECHO_REQUEST_, parameters);
+
+        if (request.send(_channel, response))
+        {
+            okSoFar = ((2 == response.count()) &&
+                       (_threadNumber == response.element(0).asInt()) &&
+                       (ii == response.element(1).asInt()));
+        }
+        else
+        {
+            ODL_LOG("! (request.send(_channel, response))"); //####
+            okSoFar = false;
+        }
+    }
+    _succeeded = okSoFar;
+    ODL_OBJEXIT(); //####
+} // Test20RequestThread::run
+
+#if defined(__APPLE__)
+# pragma mark Global functions
+#endif // defined(__APPLE__)
@@ -1,14 +1,15 @@
 //--------------------------------------------------------------------------------------------------
 //
-//  File:       m+m/m+mBailOutThread.cpp
+//  File:       CommonTests/m+mTest21WriterThread.cpp
 //
 //  Project:    m+m
 //
-//  Contains:   The class definition for a timeout thread for m+m.
+//  Contains:   The class definition for a thread that sends messages to an endpoint until it is
+//              stopped, used by the unit tests.
 //
 //  Written by: Norman Jaffe
 //
-//  Copyright:  (c) 2014 by H Plus Technologies Ltd. and Simon Fraser University.
+//  Copyright:  (c) 2026 by OpenDragon.
 //
 //              All rights reserved. Redistribution and use in source and binary forms, with or
 //              without modification, are permitted provided that the following conditions are met:
@@ -32,13 +33,14 @@
 //              ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
 //              DAMAGE.
 //
-//  Created:    2014-04-01
+//  Created:    2026-10-17
 //
 //--------------------------------------------------------------------------------------------------
 
-#include "m+mBailOutThread.hpp"
 
-#include <m+m/m+mBaseChannel.hpp>
+#include "m+mTest21WriterThread.hpp"
+
+#include <m+m/m+mClientChannel.hpp>
 
 //#include <odlEnable.h>
 #include <odlInclude.h>
@@ -49,7 +51,8 @@
 # pragma clang diagnostic ignored "-Wdocumentation-unknown-command"
 #endif // defined(__APPLE__)
 /*! @file
- @brief The class definition for a timeout thread for m+m. */
+ @brief The class definition for a thread that sends messages to an endpoint until it is
+ stopped, used by the unit tests. */
 #if defined(__APPLE__)
 # pragma clang diagnostic pop
 #endif // defined(__APPLE__)
@@ -60,11 +63,15 @@
 
 using namespace MplusM;
 using namespace MplusM::Common;
+using namespace MplusM::Test;
 
 #if defined(__APPLE__)
 # pragma mark Private structures, constants and variables
 #endif // defined(__APPLE__)
 
+/*! @brief The time, in seconds, to wait after a message could not be sent. */
+static const double kRetryDelay = 0.01;
+
 #if defined(__APPLE__)
 # pragma mark Global constants and variables
 #endif // defined(__APPLE__)
@@ -81,72 +88,43 @@ using namespace MplusM::Common;
 # pragma mark Constructors and Destructors
 #endif // defined(__APPLE__)
 
-BailOutThread::BailOutThread(const double timeToWait) :
-    inherited(), _baseChannel(NULL), _timeToWait(timeToWait)
+Test21WriterThread::Test21WriterThread(ClientChannel &          channel,
+                                       const yarp::os::Bottle & message) :
+    inherited(), _channel(channel), _message(message), _sentCount(0)
 {
     ODL_ENTER(); //####
-    ODL_D1("timeToWait = ", timeToWait); //####
+    ODL_P2("channel = ", &channel, "message = ", &message); //####
     ODL_EXIT_P(this); //####
-} // BailOutThread::BailOutThread
+} // Test21WriterThread::Test21WriterThread
 
-BailOutThread::BailOutThread(BaseChannel & channelOfInterest,
-                             const double  timeToWait) :
-    inherited(), _baseChannel(&channelOfInterest), _timeToWait(timeToWait)
-{
-    ODL_ENTER(); //####
-    ODL_P1("channelOfInterest = ", &channelOfInterest); //####
-    ODL_D1("timeToWait = ", timeToWait); //####
-    ODL_EXIT_P(this); //####
-} // BailOutThread::BailOutThread
-
-BailOutThread::~BailOutThread(void)
+Test21WriterThread::~Test21WriterThread(void)
 {
     ODL_OBJENTER(); //####
     ODL_OBJEXIT(); //####
-} // BailOutThread::~BailOutThread
+} // Test21WriterThread::~Test21WriterThread
 
 #if defined(__APPLE__)
 # pragma mark Actions and Accessors
 #endif // defined(__APPLE__)
 
 void
-BailOutThread::run(void)
+Test21WriterThread::run(void)
 {
     ODL_OBJENTER(); //####
     for ( ; ! isStopping(); )
     {
-        if (_endTime <= yarp::os::Time::now())
+        if (_channel.writeBottle(_message))
         {
-            ODL_LOG("(_endTime <= yarp::os::Time::now())"); //####
-            if (_baseChannel)
-            {
-                _baseChannel->interrupt();
-            }
-            raise(STANDARD_SIGNAL_TO_USE_);
-#if defined(__APPLE__)
-# pragma clang diagnostic push
-# pragma clang diagnostic ignored "-Wunreachable-code"
-#endif // defined(__APPLE__)
-            break;
-#if defined(__APPLE__)
-# pragma clang diagnostic pop
-#endif // defined(__APPLE__)
+            ++_sentCount;
+        }
+        else
+        {
+            // The endpoint has gone away; keep trying, as the test stops this thread.
+            yarp::os::Time::delay(kRetryDelay);
         }
-        ConsumeSomeTime();
     }
     ODL_OBJEXIT(); //####
-} // BailOutThread::run
-
-bool
-BailOutThread::threadInit(void)
-{
-    ODL_OBJENTER(); //####
-    bool result = true;
-
-    _endTime = yarp::os::Time::now() + _timeToWait;
-    ODL_OBJEXIT_B(result); //####
-    return result;
-} // BailOutThread::threadInit
+} // Test21WriterThread::run
 
 #if defined(__APPLE__)
 # pragma mark Global functions
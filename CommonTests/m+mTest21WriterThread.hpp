@@ -0,0 +1,150 @@
+//--------------------------------------------------------------------------------------------------
+//
+//  File:       CommonTests/m+mTest21WriterThread.hpp
+//
+//  Project:    m+m
+//
+//  Contains:   The class declaration for a thread that sends messages to an endpoint until it is
+//              stopped, used by the unit tests.
+//
+//  Written by: Norman Jaffe
+//
+//  Copyright:  (c) 2026 by OpenDragon.
+//
+//              All rights reserved. Redistribution and use in source and binary forms, with or
+//              without modification, are permitted provided that the following conditions are met:
+//                * Redistributions of source code must retain the above copyright notice, this list
+//                  of conditions and the following disclaimer.
+//                * Redistributions in binary form must reproduce the above copyright notice, this
+//                  list of conditions and the following disclaimer in the documentation and / or
+//                  other materials provided with the distribution.
+//                * Neither the name of the copyright holders nor the names of its contributors may
+//                  be used to endorse or promote products derived from this software without
+//                  specific prior written permission.
+//
+//              THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//              EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//              OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//              SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//              INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//              TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//              BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//              CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//              ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//              DAMAGE.
+//
+//  Created:    2026-10-17
+//
+//--------------------------------------------------------------------------------------------------
+
+
+#if (! defined(MpMTest21WriterThread_HPP_))
+# define MpMTest21WriterThread_HPP_ /* Header guard */
+
+# include <m+m/m+mBaseThread.hpp>
+
+# if defined(__APPLE__)
+#  pragma clang diagnostic push
+#  pragma clang diagnostic ignored "-Wunknown-pragmas"
+#  pragma clang diagnostic ignored "-Wdocumentation-unknown-command"
+# endif // defined(__APPLE__)
+/*! @file
+ @brief The class declaration for a thread that sends messages to an endpoint until it is
+ stopped, used by the unit tests. */
+# if defined(__APPLE__)
+#  pragma clang diagnostic pop
+# endif // defined(__APPLE__)
+
+namespace MplusM
+{
+    namespace Common
+    {
+        class ClientChannel;
+    } // Common
+
+    namespace Test
+    {
+        /*! @brief A thread that sends the same message, without waiting for a reply, until it is
+         stopped. */
+        class Test21WriterThread : public Common::BaseThread
+        {
+        public :
+
+        protected :
+
+        private :
+
+            /*! @brief The class that this class is derived from. */
+            typedef BaseThread inherited;
+
+        public :
+
+            /*! @brief The constructor.
+             @param[in] channel The channel to send the messages on.
+             @param[in] message The message to be sent. */
+            Test21WriterThread(Common::ClientChannel &  channel,
+                               const yarp::os::Bottle & message);
+
+            /*! @brief The destructor. */
+            virtual
+            ~Test21WriterThread(void);
+
+            /*! @brief Return the number of messages that were sent.
+             @return The number of messages that were sent. */
+            inline int
+            sentCount(void)
+            const
+            {
+                return _sentCount;
+            } // sentCount
+
+        protected :
+
+        private :
+
+            /*! @brief The copy constructor.
+             @param[in] other The object to be copied. */
+            Test21WriterThread(const Test21WriterThread & other);
+
+            /*! @brief The assignment operator.
+             @param[in] other The object to be copied.
+             @return The updated object. */
+            Test21WriterThread &
+            operator =(const Test21WriterThread & other);
+
+            /*! @brief The thread main body. */
+            virtual void
+            run(void);
+
+        public :
+
+        protected :
+
+        private :
+
+            /*! @brief The channel to send the messages on. */
+            Common::ClientChannel & _channel;
+
+            /*! @brief The message to be sent. */
+            yarp::os::Bottle _message;
+
+            /*! @brief The number of messages that were sent. */
+            int _sentCount;
+
+# if defined(__APPLE__)
+#  pragma clang diagnostic push
+#  pragma clang diagnostic ignored "-Wunused-private-field"
+# endif // defined(__APPLE__)
+            /*! @brief Filler to pad to alignment boundary */
+            char _filler[4];
+# if defined(__APPLE__)
+#  pragma clang diagnostic pop
+# endif // defined(__APPLE__)
+
+        }; // Test21WriterThread
+
+    } // Test
+
+} // MplusM
+
+#endif // ! defined(MpMTest21WriterThread_HPP_)
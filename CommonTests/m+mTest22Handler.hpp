@@ -0,0 +1,149 @@
+//--------------------------------------------------------------------------------------------------
+//
+//  File:       CommonTests/m+mTest22Handler.hpp
+//
+//  Project:    m+m
+//
+//  Contains:   The class declaration for a slow input handler that records the numbered messages
+//              that it receives, used by the unit tests.
+//
+//  Written by: Norman Jaffe
+//
+//  Copyright:  (c) 2026 by OpenDragon.
+//
+//              All rights reserved. Redistribution and use in source and binary forms, with or
+//              without modification, are permitted provided that the following conditions are met:
+//                * Redistributions of source code must retain the above copyright notice, this list
+//                  of conditions and the following disclaimer.
+//                * Redistributions in binary form must reproduce the above copyright notice, this
+//                  list of conditions and the following disclaimer in the documentation and / or
+//                  other materials provided with the distribution.
+//                * Neither the name of the copyright holders nor the names of its contributors may
+//                  be used to endorse or promote products derived from this software without
+//                  specific prior written permission.
+//
+//              THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//              EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//              OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//              SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//              INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//              TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//              BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//              CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//              ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//              DAMAGE.
+//
+//  Created:    2026-10-17
+//
+//--------------------------------------------------------------------------------------------------
+
+
+#if (! defined(MpMTest22Handler_HPP_))
+# define MpMTest22Handler_HPP_ /* Header guard */
+
+# include <m+m/m+mBaseInputHandler.hpp>
+
+# if defined(__APPLE__)
+#  pragma clang diagnostic push
+#  pragma clang diagnostic ignored "-Wunknown-pragmas"
+#  pragma clang diagnostic ignored "-Wdocumentation-unknown-command"
+# endif // defined(__APPLE__)
+/*! @file
+ @brief The class declaration for a slow input handler that records the numbered messages that it
+ receives, used by the unit tests. */
+# if defined(__APPLE__)
+#  pragma clang diagnostic pop
+# endif // defined(__APPLE__)
+
+namespace MplusM
+{
+    namespace Test
+    {
+        /*! @brief A test input handler that takes a fixed time to process each numbered message and
+         records the numbers in the order in which they arrive. */
+        class Test22Handler : public Common::BaseInputHandler
+        {
+        public :
+
+        protected :
+
+        private :
+
+            /*! @brief The class that this class is derived from. */
+            typedef BaseInputHandler inherited;
+
+        public :
+
+            /*! @brief The constructor.
+             @param[in] processingTime The time, in seconds, taken to process each message. */
+            explicit
+            Test22Handler(const double processingTime);
+
+            /*! @brief The destructor. */
+            virtual
+            ~Test22Handler(void);
+
+            /*! @brief Return the numbers of the messages that were received.
+             @return The numbers of the messages that were received, in the order in which they
+             arrived. */
+            inline const std::vector<int> &
+            received(void)
+            const
+            {
+                return _received;
+            } // received
+
+            /*! @brief Wait for a message to be received.
+             @param[in] timeToWait The number of seconds to wait for the message.
+             @return @c true if a message was received and @c false otherwise. */
+            bool
+            waitForMessage(const double timeToWait);
+
+        protected :
+
+        private :
+
+            /*! @brief The copy constructor.
+             @param[in] other The object to be copied. */
+            Test22Handler(const Test22Handler & other);
+
+            /*! @brief Process partially-structured input data.
+             @param[in] input The partially-structured input data.
+             @param[in] senderChannel The name of the channel used to send the input data.
+             @param[in] replyMechanism @c NULL if no reply is expected and non-@c NULL otherwise.
+             @param[in] numBytes The number of bytes available on the connection.
+             @return @c true if the input was correctly structured and successfully processed. */
+            virtual bool
+            handleInput(const yarp::os::Bottle &     input,
+                        const YarpString &           senderChannel,
+                        yarp::os::ConnectionWriter * replyMechanism,
+                        const size_t                 numBytes);
+
+            /*! @brief The assignment operator.
+             @param[in] other The object to be copied.
+             @return The updated object. */
+            Test22Handler &
+            operator =(const Test22Handler & other);
+
+        public :
+
+        protected :
+
+        private :
+
+            /*! @brief The numbers of the messages that were received. */
+            std::vector<int> _received;
+
+            /*! @brief Signalled when a message has been received. */
+            yarp::os::Semaphore _receivedSignal;
+
+            /*! @brief The time, in seconds, taken to process each message. */
+            double _processingTime;
+
+        }; // Test22Handler
+
+    } // Test
+
+} // MplusM
+
+#endif // ! defined(MpMTest22Handler_HPP_)
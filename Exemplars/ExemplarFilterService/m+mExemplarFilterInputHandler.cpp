@@ -139,9 +139,9 @@ ExemplarFilterInputHandler::handleInput(const yarp::os::Bottle &     input,
         }
         if ((0 < outBottle.size()) && _outChannel)
         {
-            if (! _outChannel->write(outBottle))
+            if (! _outChannel->writeBottle(outBottle))
             {
-                ODL_LOG("(! _outChannel->write(message))"); //####
+                ODL_LOG("(! _outChannel->writeBottle(message))"); //####
 #if defined(MpM_StallOnSendProblem)
                 Stall();
 #endif // defined(MpM_StallOnSendProblem)
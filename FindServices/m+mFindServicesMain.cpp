@@ -37,6 +37,7 @@
 //--------------------------------------------------------------------------------------------------
 
 #include <m+m/m+mStringArgumentDescriptor.hpp>
+#include <m+m/m+mRegistryCache.hpp>
 #include <m+m/m+mUtilities.hpp>
 
 //#include <odlEnable.h>
@@ -318,6 +319,11 @@ main(int      argc,
                 {
                     YarpString criteria(firstArg.getCurrentValue());
 
+                    // Repeated matches are answered locally, rather than by the Registry Service.
+                    if (! RegistryCache::Enable())
+                    {
+                        ODL_LOG("! (RegistryCache::Enable())"); //####
+                    }
                     setUpAndGo(criteria, flavour);
                 }
                 else
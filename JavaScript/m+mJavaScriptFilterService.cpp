@@ -42,6 +42,7 @@
 #include "m+mJavaScriptFilterThread.hpp"
 
 #include <m+m/m+mEndpoint.hpp>
+#include <m+m/m+mNumericArray.hpp>
 
 //#include <odlEnable.h>
 #include <odlInclude.h>
@@ -225,6 +226,13 @@ convertValue(JSContext *             jct,
             }
         }
     }
+    else if (NumericArray::IsNumericArray(inputValue))
+    {
+        yarp::os::Bottle asList;
+
+        NumericArray::ConvertToList(inputValue, asList);
+        convertList(jct, theData, asList);
+    }
     else
     {
         // We don't know what to do with this...
@@ -474,9 +474,9 @@ KinectV2BlobEventThread::processEventData(void)
                     {
                         if (0 < _messageBottle.size())
                         {
-                            if (! _outChannel->write(_messageBottle))
+                            if (! _outChannel->writeBottle(_messageBottle))
                             {
-                                ODL_LOG("(! _outChannel->write(_messageBottle))"); //####
+                                ODL_LOG("(! _outChannel->writeBottle(_messageBottle))"); //####
 # if defined(MpM_StallOnSendProblem)
                                 Stall();
 # endif // defined(MpM_StallOnSendProblem)
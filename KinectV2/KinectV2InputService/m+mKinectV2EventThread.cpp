@@ -38,6 +38,8 @@
 
 #include "m+mKinectV2EventThread.hpp"
 
+#include <m+m/m+mNumericArray.hpp>
+
 //#include <odlEnable.h>
 #include <odlInclude.h>
 
@@ -67,6 +69,15 @@ using std::endl;
 
 //#define GENERATE_BONES_ /* */
 
+/*! @brief The number of values sent for each joint: the position (x, y, z), the orientation (x, y,
+ z, w) and the tracking state (0 = not tracked, 1 = inferred, 2 = tracked). */
+#define KINECTV2_VALUES_PER_JOINT_ 8
+
+#if defined(GENERATE_BONES_)
+/*! @brief The number of bones sent for each body. */
+# define KINECTV2_BONE_COUNT_ 24
+#endif // defined(GENERATE_BONES_)
+
 #if defined(__APPLE__)
 # pragma mark Global constants and variables
 #endif // defined(__APPLE__)
@@ -76,114 +87,24 @@ using std::endl;
 #endif // defined(__APPLE__)
 
 #if (! defined(MpM_BuildDummyServices))
-/*! @brief Add a three-dimensional floating-point vector to a dictionary.
- @param[in,out] dictionary The dictionary to be updated.
- @param[in] tag The tag to associate with the vector.
- @param[in] position The vector to be added. */
-static void
-add3VectorToDictionary(yarp::os::Property &     dictionary,
-                       const YarpString &       tag,
-                       const CameraSpacePoint & position)
-{
-    yarp::os::Value    stuff;
-    yarp::os::Bottle * stuffAsList = stuff.asList();
-
-    if (stuffAsList)
-    {
-        stuffAsList->addDouble(position.X);
-        stuffAsList->addDouble(position.Y);
-        stuffAsList->addDouble(position.Z);
-        dictionary.put(tag, stuff);
-    }
-} // add3VectorToDictionary
-#endif // ! defined(MpM_BuildDummyServices)
-
-#if (! defined(MpM_BuildDummyServices))
-/*! @brief Add a four-dimensional floating-point vector to a dictionary.
- @param[in,out] dictionary The dictionary to be updated.
- @param[in] tag The tag to associate with the vector.
- @param[in] orientation The vector to be added. */
-static void
-add4VectorToDictionary(yarp::os::Property & dictionary,
-                       const YarpString &   tag,
-                       const Vector4 &      orientation)
-{
-    yarp::os::Value    stuff;
-    yarp::os::Bottle * stuffAsList = stuff.asList();
-
-    if (stuffAsList)
-    {
-        stuffAsList->addDouble(orientation.x);
-        stuffAsList->addDouble(orientation.y);
-        stuffAsList->addDouble(orientation.z);
-        stuffAsList->addDouble(orientation.w);
-        dictionary.put(tag, stuff);
-    }
-} // add4VectorToDictionary
-#endif // ! defined(MpM_BuildDummyServices)
-
-#if (! defined(MpM_BuildDummyServices))
-# if defined(GENERATE_BONES_)
-/*! @brief Add the description of a bone to a list.
- @param[in,out] listToUpdate The list to be added to.
- @param[in] jointTag The name of the bone.
- @param[in] startJoint The beginning joint of the bone.
- @param[in] endJoint The ending joint of the bone.
- @param[in] startOrientation The orientation of the beginning joint of the bone.
- @param[in] endOrientation The orientation of the ending joint of the bone. */
-static void
-addBoneToList(yarp::os::Bottle &       listToUpdate,
-              const YarpString &       jointTag,
-              const Joint &            startJoint,
-              const Joint &            endJoint,
-              const JointOrientation & startOrientation,
-              const JointOrientation & endOrientation)
-{
-    // If we can't find either of these joints, exit
-    if ((TrackingState_NotTracked != startJoint.TrackingState) &&
-        (TrackingState_NotTracked != endJoint.TrackingState))
-    {
-        // Don't process if both points are inferred
-        if ((TrackingState_Inferred != startJoint.TrackingState) ||
-            (TrackingState_Inferred != endJoint.TrackingState))
-        {
-            yarp::os::Property & boneProps = listToUpdate.addDict();
-
-            boneProps.put("tag", jointTag);
-            add3VectorToDictionary(boneProps, "startposition", startJoint.Position);
-            add3VectorToDictionary(boneProps, "endposition", endJoint.Position);
-            add4VectorToDictionary(boneProps, "startorientation", startOrientation.Orientation);
-            add4VectorToDictionary(boneProps, "endorientation", endOrientation.Orientation);
-        }
-    }
-} // addBoneToList
-# else // ! defined(GENERATE_BONES_)
-/*! @brief Add the description of a joint to a list.
- @param[in,out] listToUpdate The list to be added to.
- @param[in] jointTag The name of the bone.
- @param[in] jointData The joint position.
+/*! @brief Add the position, orientation and tracking state of a joint to a packed array.
+ @param[in,out] jointArray The array to be updated.
+ @param[in] jointData The joint position and tracking state.
  @param[in] orientationData The orientation of the joint. */
 static void
-addJointToList(yarp::os::Bottle &       listToUpdate,
-               const YarpString &       jointTag,
-               const Joint &            jointData,
-               const JointOrientation & orientationData)
+addJointToArray(Common::NumericArray &   jointArray,
+                const Joint &            jointData,
+                const JointOrientation & orientationData)
 {
-    // If we can't find either of these joints, exit
-    if (TrackingState_NotTracked != jointData.TrackingState)
-    {
-        // Don't process if point is inferred
-        if (TrackingState_Inferred != jointData.TrackingState)
-        {
-            yarp::os::Property & jointProps = listToUpdate.addDict();
-
-            jointProps.put("tag", jointTag);
-            add3VectorToDictionary(jointProps, "position", jointData.Position);
-            add4VectorToDictionary(jointProps, "orientation", orientationData.Orientation);
-        }
-    }
-} // addJointToList
-# endif // ! defined(GENERATE_BONES_)
+    jointArray.addValue(jointData.Position.X);
+    jointArray.addValue(jointData.Position.Y);
+    jointArray.addValue(jointData.Position.Z);
+    jointArray.addValue(orientationData.Orientation.x);
+    jointArray.addValue(orientationData.Orientation.y);
+    jointArray.addValue(orientationData.Orientation.z);
+    jointArray.addValue(orientationData.Orientation.w);
+    jointArray.addValue(jointData.TrackingState);
+} // addJointToArray
 #endif // ! defined(MpM_BuildDummyServices)
 
 #if (! defined(MpM_BuildDummyServices))
@@ -248,21 +169,13 @@ handConfidenceToString(const TrackingConfidence theHandConfidence)
 
 #if (! defined(MpM_BuildDummyServices))
 # if defined(GENERATE_BONES_)
-/*! @brief Add a bone to the list that's being built.
- @param[in] str_ The name for the bone.
+/*! @brief Add a bone to the array that's being built.
  @param[in] start_ The starting joint for the bone.
  @param[in] end_ The ending joint for the bone. */
-#  define ADD_BONE_TO_LIST_(str_, start_, end_) \
-        addBoneToList(*bonesList, str_, jointData[start_], jointData[end_],\
-                        orientationData[start_], orientationData[end_])
-
-# else // ! defined(GENERATE_BONES_)
-/*! @brief Add a joint to the list that's being built.
- @param[in] str_ The name for the joint.
- @param[in] index_ The joint index. */
-#  define ADD_JOINT_TO_LIST_(str_, index_) \
-        addJointToList(*jointsList, str_, jointData[index_], orientationData[index_])
-# endif // ! defined(GENERATE_BONES_)
+#  define ADD_BONE_TO_ARRAY_(start_, end_) \
+        addJointToArray(bones, jointData[start_], orientationData[start_]);\
+        addJointToArray(bones, jointData[end_], orientationData[end_])
+# endif // defined(GENERATE_BONES_)
 #endif // ! defined(MpM_BuildDummyServices)
 
 #if (! defined(MpM_BuildDummyServices))
@@ -293,97 +206,59 @@ addBodyToMessage(yarp::os::Bottle &       message,
     bodyProps.put("lefthandconfidence", handConfidenceToString(leftHandConfidence));
     bodyProps.put("righthandconfidence", handConfidenceToString(rightHandConfidence));
 # if defined(GENERATE_BONES_)
-    yarp::os::Value    bones;
-    yarp::os::Bottle * bonesList = bones.asList();
+    Common::NumericArray bones(Common::kNumericArrayKindFloat32,
+                               2 * KINECTV2_BONE_COUNT_ * KINECTV2_VALUES_PER_JOINT_);
+
+    // The bones are always sent in the same order, each as its starting joint followed by its
+    // ending joint.
+    // Torso
+    ADD_BONE_TO_ARRAY_(JointType_Head, JointType_Neck);
+    ADD_BONE_TO_ARRAY_(JointType_Neck, JointType_SpineShoulder);
+    ADD_BONE_TO_ARRAY_(JointType_SpineShoulder, JointType_SpineMid);
+    ADD_BONE_TO_ARRAY_(JointType_SpineMid, JointType_SpineBase);
+    ADD_BONE_TO_ARRAY_(JointType_SpineShoulder, JointType_ShoulderRight);
+    ADD_BONE_TO_ARRAY_(JointType_SpineShoulder, JointType_ShoulderLeft);
+    ADD_BONE_TO_ARRAY_(JointType_SpineBase, JointType_HipRight);
+    ADD_BONE_TO_ARRAY_(JointType_SpineBase, JointType_HipLeft);
+
+    // Right arm
+    ADD_BONE_TO_ARRAY_(JointType_ShoulderRight, JointType_ElbowRight);
+    ADD_BONE_TO_ARRAY_(JointType_ElbowRight, JointType_WristRight);
+    ADD_BONE_TO_ARRAY_(JointType_WristRight, JointType_HandRight);
+    ADD_BONE_TO_ARRAY_(JointType_HandRight, JointType_HandTipRight);
+    ADD_BONE_TO_ARRAY_(JointType_WristRight, JointType_ThumbRight);
+
+    // Left arm
+    ADD_BONE_TO_ARRAY_(JointType_ShoulderLeft, JointType_ElbowLeft);
+    ADD_BONE_TO_ARRAY_(JointType_ElbowLeft, JointType_WristLeft);
+    ADD_BONE_TO_ARRAY_(JointType_WristLeft, JointType_HandLeft);
+    ADD_BONE_TO_ARRAY_(JointType_HandLeft, JointType_HandTipLeft);
+    ADD_BONE_TO_ARRAY_(JointType_WristLeft, JointType_ThumbLeft);
+
+    // Right leg
+    ADD_BONE_TO_ARRAY_(JointType_HipRight, JointType_KneeRight);
+    ADD_BONE_TO_ARRAY_(JointType_KneeRight, JointType_AnkleRight);
+    ADD_BONE_TO_ARRAY_(JointType_AnkleRight, JointType_FootRight);
+
+    // Left leg
+    ADD_BONE_TO_ARRAY_(JointType_HipLeft, JointType_KneeLeft);
+    ADD_BONE_TO_ARRAY_(JointType_KneeLeft, JointType_AnkleLeft);
+    ADD_BONE_TO_ARRAY_(JointType_AnkleLeft, JointType_FootLeft);
+
+    // Add them all
+    bones.addToDictionary(bodyProps, "bones");
 # else // ! defined(GENERATE_BONES_)
-    yarp::os::Value    joints;
-    yarp::os::Bottle * jointsList = joints.asList();
-# endif // ! defined(GENERATE_BONES_)
+    Common::NumericArray joints(Common::kNumericArrayKindFloat32,
+                                JointType_Count * KINECTV2_VALUES_PER_JOINT_);
 
-# if defined(GENERATE_BONES_)
-    if (bonesList)
-    {
-        // Torso
-        ADD_BONE_TO_LIST_("head2neck", JointType_Head, JointType_Neck);
-        ADD_BONE_TO_LIST_("neck2spineshoulder", JointType_Neck, JointType_SpineShoulder);
-        ADD_BONE_TO_LIST_("spineshoulder2spinemid", JointType_SpineShoulder, JointType_SpineMid);
-        ADD_BONE_TO_LIST_("spinemid2spinebase", JointType_SpineMid, JointType_SpineBase);
-        ADD_BONE_TO_LIST_("spineshoulder2shoulderright", JointType_SpineShoulder,
-                          JointType_ShoulderRight);
-        ADD_BONE_TO_LIST_("spineshoulder2shoulderleft", JointType_SpineShoulder,
-                          JointType_ShoulderLeft);
-        ADD_BONE_TO_LIST_("spinebase2hipright", JointType_SpineBase, JointType_HipRight);
-        ADD_BONE_TO_LIST_("spinebase2hipleft", JointType_SpineBase, JointType_HipLeft);
-
-        // Right arm
-        ADD_BONE_TO_LIST_("shoulderright2elbowright", JointType_ShoulderRight,
-                          JointType_ElbowRight);
-        ADD_BONE_TO_LIST_("elbowright2wristright", JointType_ElbowRight, JointType_WristRight);
-        ADD_BONE_TO_LIST_("wristright2handright", JointType_WristRight, JointType_HandRight);
-        ADD_BONE_TO_LIST_("handright2handtipright", JointType_HandRight, JointType_HandTipRight);
-        ADD_BONE_TO_LIST_("wristright2thumbright", JointType_WristRight, JointType_ThumbRight);
-
-        // Left arm
-        ADD_BONE_TO_LIST_("shoulderleft2elbowleft", JointType_ShoulderLeft, JointType_ElbowLeft);
-        ADD_BONE_TO_LIST_("elbowleft2wristleft", JointType_ElbowLeft, JointType_WristLeft);
-        ADD_BONE_TO_LIST_("wristleft2handleft", JointType_WristLeft, JointType_HandLeft);
-        ADD_BONE_TO_LIST_("handleft2handtipleft", JointType_HandLeft, JointType_HandTipLeft);
-        ADD_BONE_TO_LIST_("wristleft2thumbleft", JointType_WristLeft, JointType_ThumbLeft);
-
-        // Right leg
-        ADD_BONE_TO_LIST_("hipright2kneeright", JointType_HipRight, JointType_KneeRight);
-        ADD_BONE_TO_LIST_("kneeright2ankleright", JointType_KneeRight, JointType_AnkleRight);
-        ADD_BONE_TO_LIST_("ankleright2footright", JointType_AnkleRight, JointType_FootRight);
-
-        // Left leg
-        ADD_BONE_TO_LIST_("hipleft2kneeleft", JointType_HipLeft, JointType_KneeLeft);
-        ADD_BONE_TO_LIST_("kneeleft2ankleleft", JointType_KneeLeft, JointType_AnkleLeft);
-        ADD_BONE_TO_LIST_("ankleleft2footleft", JointType_AnkleLeft, JointType_FootLeft);
-
-        // Add them all
-        bodyProps.put("bones", bones);
-    }
-# else // ! defined(GENERATE_BONES_)
-    if (jointsList)
+    // The joints are always sent in the order of the JointType enumeration, so that a receiver
+    // can find a joint from its index; joints that aren't being tracked are included, with their
+    // tracking state.
+    for (int ii = 0; JointType_Count > ii; ++ii)
     {
-        // Torso
-        ADD_JOINT_TO_LIST_("head", JointType_Head);
-        ADD_JOINT_TO_LIST_("neck", JointType_Neck);
-        ADD_JOINT_TO_LIST_("spineshoulder", JointType_SpineShoulder);
-        ADD_JOINT_TO_LIST_("spinemid", JointType_SpineMid);
-        ADD_JOINT_TO_LIST_("spinebase", JointType_SpineBase);
-        ADD_JOINT_TO_LIST_("shoulderright", JointType_ShoulderRight);
-        ADD_JOINT_TO_LIST_("shoulderleft", JointType_ShoulderLeft);
-        ADD_JOINT_TO_LIST_("hipright", JointType_HipRight);
-        ADD_JOINT_TO_LIST_("hipleft", JointType_HipLeft);
-
-        // Right arm
-        ADD_JOINT_TO_LIST_("elbowright", JointType_ElbowRight);
-        ADD_JOINT_TO_LIST_("wristright", JointType_WristRight);
-        ADD_JOINT_TO_LIST_("handright", JointType_HandRight);
-        ADD_JOINT_TO_LIST_("handtipright", JointType_HandTipRight);
-        ADD_JOINT_TO_LIST_("thumbright", JointType_ThumbRight);
-
-        // Left arm
-        ADD_JOINT_TO_LIST_("elbowleft", JointType_ElbowLeft);
-        ADD_JOINT_TO_LIST_("wristleft", JointType_WristLeft);
-        ADD_JOINT_TO_LIST_("handleft", JointType_HandLeft);
-        ADD_JOINT_TO_LIST_("handtipleft", JointType_HandTipLeft);
-        ADD_JOINT_TO_LIST_("thumbleft", JointType_ThumbLeft);
-
-        // Right leg
-        ADD_JOINT_TO_LIST_("kneeright", JointType_KneeRight);
-        ADD_JOINT_TO_LIST_("ankleright", JointType_AnkleRight);
-        ADD_JOINT_TO_LIST_("footright", JointType_FootRight);
-
-        // Left leg
-        ADD_JOINT_TO_LIST_("kneeleft", JointType_KneeLeft);
-        ADD_JOINT_TO_LIST_("ankleleft", JointType_AnkleLeft);
-        ADD_JOINT_TO_LIST_("footleft", JointType_FootLeft);
-
-        // Add them all
-        bodyProps.put("joints", joints);
+        addJointToArray(joints, jointData[ii], orientationData[ii]);
     }
+    joints.addToDictionary(bodyProps, "joints");
 # endif // ! defined(GENERATE_BONES_)
     ODL_EXIT(); //####
 } // addBodyToMessage
@@ -567,9 +442,9 @@ KinectV2EventThread::processEventData(void)
                     {
                         if (0 < message.size())
                         {
-                            if (! _outChannel->write(message))
+                            if (! _outChannel->writeBottle(message))
                             {
-                                ODL_LOG("(! _outChannel->write(message))"); //####
+                                ODL_LOG("(! _outChannel->writeBottle(message))"); //####
 # if defined(MpM_StallOnSendProblem)
                                 Stall();
 # endif // defined(MpM_StallOnSendProblem)
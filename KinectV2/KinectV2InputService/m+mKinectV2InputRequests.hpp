@@ -56,4 +56,10 @@
 /*! @brief The channel-independent name of the Kinect V2 input service. */
 # define MpM_KINECTV2INPUT_CANONICAL_NAME_ "KinectV2Input"
 
+/*! @brief The protocol of the output channel of the Kinect V2 input service.
+
+ The trailing number is the version of the message format; version 2 sends the joints of each
+ body as a single packed numeric array instead of a list of dictionaries. */
+# define MpM_KINECTV2INPUT_PROTOCOL_ "KINECT2"
+
 #endif // ! defined(MpMKinectV2InputRequests_HPP_)
@@ -126,12 +126,14 @@ KinectV2InputService::setUpStreamDescriptions(void)
 
     _outDescriptions.clear();
     description._portName = rootName + "output";
-    description._portProtocol = "KINECT";
+    description._portProtocol = MpM_KINECTV2INPUT_PROTOCOL_;
     description._protocolDescription = T_("A list of bodies\n"
-                                          "Each body being a dictionary with hand state and a list "
-                                          "of joints\n"
-                                          "Each joint being a dictionary with name, position and "
-                                          "orientation");
+                                          "Each body being a dictionary with hand state and a "
+                                          "packed numeric array of joints\n"
+                                          "Each joint being eight values, in the order of the "
+                                          "Kinect joint types: position (3), orientation (4) and "
+                                          "tracking state");
+    description._overflowPolicy = kOverflowPolicyDropOldest;
     _outDescriptions.push_back(description);
     ODL_OBJEXIT_B(result); //####
     return result;
@@ -135,6 +135,7 @@ KinectV2SpecialInputService::setUpStreamDescriptions(void)
                                           "Each body being the hand state, a list of joints\n"
                                           "Each joint being a validity flag, position and "
                                           "orientation");
+    description._overflowPolicy = kOverflowPolicyDropOldest;
     _outDescriptions.push_back(description);
     ODL_OBJEXIT_B(result); //####
     return result;
@@ -418,9 +418,9 @@ LeapBlobInputListener::onFrame(const Leap::Controller & theController)
                 
                 _messageBottle.clear();
                 _messageBottle.add(blobValue);
-                if (! _outChannel->write(_messageBottle))
+                if (! _outChannel->writeBottle(_messageBottle))
                 {
-                    ODL_LOG("(! _outChannel->write(message))"); //####
+                    ODL_LOG("(! _outChannel->writeBottle(message))"); //####
 #if defined(MpM_StallOnSendProblem)
                     Stall();
 #endif // defined(MpM_StallOnSendProblem)
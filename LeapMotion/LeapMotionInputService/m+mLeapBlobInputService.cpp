@@ -196,6 +196,7 @@ LeapBlobInputService::setUpStreamDescriptions(void)
     description._portProtocol = "b";
     description._protocolDescription = T_("A binary blob containing the finger positions and "
                                           "directions");
+    description._overflowPolicy = kOverflowPolicyLatestOnly;
     _outDescriptions.push_back(description);
     ODL_OBJEXIT_B(result); //####
     return result;
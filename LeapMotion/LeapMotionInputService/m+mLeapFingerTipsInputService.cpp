@@ -138,6 +138,7 @@ LeapFingerTipsInputService::setUpStreamDescriptions(void)
     description._protocolDescription = T_("A flag for which fingers have data followed by the tip "
                                           "positions\nof the each finger of each hand, if "
                                           "present");
+    description._overflowPolicy = kOverflowPolicyLatestOnly;
     _outDescriptions.push_back(description);
     ODL_OBJEXIT_B(result); //####
     return result;
@@ -136,6 +136,7 @@ LeapMotionInputService::setUpStreamDescriptions(void)
                                           "Each hand being a dictionary with an arm and a list of "
                                           "fingers\n"
                                           "Each finger being a dictionary with a list of bones");
+    description._overflowPolicy = kOverflowPolicyLatestOnly;
     _outDescriptions.push_back(description);
     ODL_OBJEXIT_B(result); //####
     return result;
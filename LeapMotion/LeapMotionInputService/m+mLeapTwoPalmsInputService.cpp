@@ -136,6 +136,7 @@ LeapTwoPalmsInputService::setUpStreamDescriptions(void)
     description._protocolDescription = T_("A flag for which hand has data followed by the "
                                           "positions, normals\n"
                                           "and velocities of the palm of each hand, if present");
+    description._overflowPolicy = kOverflowPolicyLatestOnly;
     _outDescriptions.push_back(description);
     ODL_OBJEXIT_B(result); //####
     return result;
@@ -140,7 +140,8 @@ bool
 AddFileRequestHandler::processRequest(const YarpString &           request,
                                       const yarp::os::Bottle &     restOfInput,
                                       const YarpString &           senderChannel,
-                                      yarp::os::ConnectionWriter * replyMechanism)
+                                      yarp::os::ConnectionWriter * replyMechanism,
+                                      yarp::os::Bottle &           response)
 {
 #if (! defined(ODL_ENABLE_LOGGING_))
 # if MAC_OR_LINUX_
@@ -150,13 +151,12 @@ AddFileRequestHandler::processRequest(const YarpString &           request,
     ODL_OBJENTER(); //####
     ODL_S3s("request = ", request, "restOfInput = ", restOfInput.toString(), //####
             "senderChannel = ", senderChannel); //####
-    ODL_P1("replyMechanism = ", replyMechanism); //####
+    ODL_P2("replyMechanism = ", replyMechanism, "response = ", &response); //####
     bool result = true;
 
     try
     {
         // Add the file to the backend database
-        _response.clear();
         if (1 == restOfInput.size())
         {
             yarp::os::Value firstValue(restOfInput.get(0));
@@ -168,29 +168,29 @@ AddFileRequestHandler::processRequest(const YarpString &           request,
 
                 if (theService.addFileToDb(senderChannel, filePath))
                 {
-                    _response.addString(MpM_OK_RESPONSE_);
+                    response.addString(MpM_OK_RESPONSE_);
                 }
                 else
                 {
                     ODL_LOG("! (theService.addFileToDb(senderChannel, filePath))"); //####
-                    _response.addString(MpM_FAILED_RESPONSE_);
-                    _response.addString("Could not add file to database");
+                    response.addString(MpM_FAILED_RESPONSE_);
+                    response.addString("Could not add file to database");
                 }
             }
             else
             {
                 ODL_LOG("! (firstValue.isString())"); //####
-                _response.addString(MpM_FAILED_RESPONSE_);
-                _response.addString("Invalid arguments");
+                response.addString(MpM_FAILED_RESPONSE_);
+                response.addString("Invalid arguments");
             }
         }
         else
         {
             ODL_LOG("! (1 == restOfInput.size())"); //####
-            _response.addString(MpM_FAILED_RESPONSE_);
-            _response.addString("Missing or extra arguments to request");
+            response.addString(MpM_FAILED_RESPONSE_);
+            response.addString("Missing or extra arguments to request");
         }
-        sendResponse(replyMechanism);
+        sendResponse(response, replyMechanism);
     }
     catch (...)
     {
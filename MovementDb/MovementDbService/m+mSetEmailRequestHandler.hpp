@@ -109,12 +109,14 @@ namespace MplusM
              @param[in] request The actual request name.
              @param[in] restOfInput The arguments to the operation.
              @param[in] senderChannel The name of the channel used to send the input data.
-             @param[in] replyMechanism non-@c NULL if a reply is expected and @c NULL otherwise. */
+             @param[in] replyMechanism non-@c NULL if a reply is expected and @c NULL otherwise.
+             @param[in,out] response The object to hold the response, which is initially empty. */
             virtual bool
             processRequest(const YarpString &           request,
                            const yarp::os::Bottle &     restOfInput,
                            const YarpString &           senderChannel,
-                           yarp::os::ConnectionWriter * replyMechanism);
+                           yarp::os::ConnectionWriter * replyMechanism,
+                           yarp::os::Bottle &           response);
 
         public :
 
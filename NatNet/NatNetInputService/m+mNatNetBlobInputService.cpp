@@ -220,6 +220,7 @@ NatNetBlobInputService::setUpStreamDescriptions(void)
     description._portProtocol = "b";
     description._protocolDescription = T_("A binary blob containing the segment positions and "
                                           "directions");
+    description._overflowPolicy = kOverflowPolicyDropOldest;
     _outDescriptions.push_back(description);
     ODL_OBJEXIT_B(result); //####
     return result;
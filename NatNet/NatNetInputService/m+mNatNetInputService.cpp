@@ -203,6 +203,7 @@ NatNetInputService::setUpStreamDescriptions(void)
     description._portName = rootName + "output";
     description._portProtocol = "NN";
     description._protocolDescription = "A list of dictionaries with position values";
+    description._overflowPolicy = kOverflowPolicyDropOldest;
     _outDescriptions.push_back(description);
     ODL_OBJEXIT_B(result); //####
     return result;
@@ -272,9 +272,9 @@ NatNetInputThread::sendMessage(yarp::os::Bottle & message)
 
     if (_outChannel)
     {
-        if (! _outChannel->write(message))
+        if (! _outChannel->writeBottle(message))
         {
-            ODL_LOG("(! _outChannel->write(message))"); //####
+            ODL_LOG("(! _outChannel->writeBottle(message))"); //####
 #if defined(MpM_StallOnSendProblem)
             Stall();
 #endif // defined(MpM_StallOnSendProblem)
@@ -264,9 +264,9 @@ OpenStageBlobInputThread::processData(om::sdk2::ActorDataListConstPtr & actorDat
 
                 _messageBottle.clear();
                 _messageBottle.add(blobValue);
-                if (! _outChannel->write(_messageBottle))
+                if (! _outChannel->writeBottle(_messageBottle))
                 {
-                    ODL_LOG("(! _outChannel->write(_messageBottle))"); //####
+                    ODL_LOG("(! _outChannel->writeBottle(_messageBottle))"); //####
 # if defined(MpM_StallOnSendProblem)
                     Stall();
 # endif // defined(MpM_StallOnSendProblem)
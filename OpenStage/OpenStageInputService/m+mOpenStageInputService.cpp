@@ -198,7 +198,9 @@ OpenStageInputService::setUpStreamDescriptions(void)
     _outDescriptions.clear();
     description._portName = rootName + "output";
     description._portProtocol = "OM";
-    description._protocolDescription = "A dictionary with position values";
+    description._protocolDescription = T_("A dictionary with position values\n"
+                                          "Each position and rotation being a packed numeric "
+                                          "array");
     _outDescriptions.push_back(description);
     ODL_OBJEXIT_B(result); //####
     return result;
@@ -39,6 +39,8 @@
 
 #include "m+mOpenStageInputThread.hpp"
 
+#include <m+m/m+mNumericArray.hpp>
+
 //#include <odlEnable.h>
 #include <odlInclude.h>
 
@@ -145,6 +147,8 @@ OpenStageInputThread::processData(om::sdk2::ActorDataListConstPtr & actorData)
 
     if (0 < numActors)
     {
+        NumericArray       positionStuff(kNumericArrayKindFloat64, 3);
+        NumericArray       rotationStuff(kNumericArrayKindFloat64, 4);
         yarp::os::Bottle   message;
         yarp::os::Bottle & actorList = message.addList();
 
@@ -166,76 +170,56 @@ OpenStageInputThread::processData(om::sdk2::ActorDataListConstPtr & actorData)
                 yarp::os::Property & jointProps = anActor.addDict();
                 sdk2::Matrix44       absTransform = jointTreeAbsIt->second->transform;
                 const char *         jointId = static_cast<const char *>(*jointTreeAbsIt->first);
-                yarp::os::Value      absPosStuff;
-                yarp::os::Bottle *   absPosList = absPosStuff.asList();
+                glm::mat3x3          jointAbsTransform(absTransform.m[0][0], absTransform.m[0][1],
+                                                       absTransform.m[0][2], absTransform.m[1][0],
+                                                       absTransform.m[1][1], absTransform.m[1][2],
+                                                       absTransform.m[2][0], absTransform.m[2][1],
+                                                       absTransform.m[2][2]);
+                glm::quat            absRotQuat = glm::quat_cast(jointAbsTransform);
 
                 jointProps.put("id", jointId);
-                if (absPosList)
-                {
-                    absPosList->addDouble(absTransform.m[3][0]);
-                    absPosList->addDouble(absTransform.m[3][1]);
-                    absPosList->addDouble(absTransform.m[3][2]);
-                    jointProps.put("absposition", absPosStuff);
-                }
-                yarp::os::Value    absQuatStuff;
-                yarp::os::Bottle * absQuatList = absQuatStuff.asList();
-
-                if (absQuatList)
-                {
-                    glm::mat3x3 jointAbsTransform(absTransform.m[0][0], absTransform.m[0][1],
-                                                  absTransform.m[0][2], absTransform.m[1][0],
-                                                  absTransform.m[1][1], absTransform.m[1][2],
-                                                  absTransform.m[2][0], absTransform.m[2][1],
-                                                  absTransform.m[2][2]);
-                    glm::quat   absRotQuat = glm::quat_cast(jointAbsTransform);
-
-                    absQuatList->addDouble(absRotQuat.x);
-                    absQuatList->addDouble(absRotQuat.y);
-                    absQuatList->addDouble(absRotQuat.z);
-                    absQuatList->addDouble(absRotQuat.w);
-                    jointProps.put("absrotation", absQuatStuff);
-                }
+                positionStuff.clear();
+                positionStuff.addValue(absTransform.m[3][0]);
+                positionStuff.addValue(absTransform.m[3][1]);
+                positionStuff.addValue(absTransform.m[3][2]);
+                positionStuff.addToDictionary(jointProps, "absposition");
+                rotationStuff.clear();
+                rotationStuff.addValue(absRotQuat.x);
+                rotationStuff.addValue(absRotQuat.y);
+                rotationStuff.addValue(absRotQuat.z);
+                rotationStuff.addValue(absRotQuat.w);
+                rotationStuff.addToDictionary(jointProps, "absrotation");
                 sdk2::JointTreeConstIterator jointTreeRelIt = relJointTree->Find(jointId);
 
                 if (jointTreeRelIt != jointTreeRelItEnd)
                 {
-                    sdk2::Matrix44     relTransform = jointTreeRelIt->second->transform;
-                    yarp::os::Value    relPosStuff;
-                    yarp::os::Bottle * relPosList = relPosStuff.asList();
-
-                    if (relPosList)
-                    {
-                        relPosList->addDouble(relTransform.m[3][0]);
-                        relPosList->addDouble(relTransform.m[3][1]);
-                        relPosList->addDouble(relTransform.m[3][2]);
-                        jointProps.put("relposition", relPosStuff);
-                    }
-                    yarp::os::Value    relQuatStuff;
-                    yarp::os::Bottle * relQuatList = relQuatStuff.asList();
-
-                    if (relQuatList)
-                    {
-                        glm::mat3x3 jointRelTransform(relTransform.m[0][0], relTransform.m[0][1],
-                                                      relTransform.m[0][2], relTransform.m[1][0],
-                                                      relTransform.m[1][1], relTransform.m[1][2],
-                                                      relTransform.m[2][0], relTransform.m[2][1],
-                                                      relTransform.m[2][2]);
-                        glm::quat   relRotQuat = glm::quat_cast(jointRelTransform);
-
-                        relQuatList->addDouble(relRotQuat.x);
-                        relQuatList->addDouble(relRotQuat.y);
-                        relQuatList->addDouble(relRotQuat.z);
-                        relQuatList->addDouble(relRotQuat.w);
-                        jointProps.put("relrotation", relQuatStuff);
-                    }
+                    sdk2::Matrix44 relTransform = jointTreeRelIt->second->transform;
+                    glm::mat3x3    jointRelTransform(relTransform.m[0][0], relTransform.m[0][1],
+                                                     relTransform.m[0][2], relTransform.m[1][0],
+                                                     relTransform.m[1][1], relTransform.m[1][2],
+                                                     relTransform.m[2][0], relTransform.m[2][1],
+                                                     relTransform.m[2][2]);
+                    glm::quat      relRotQuat = glm::quat_cast(jointRelTransform);
+
+                    positionStuff.clear();
+                    positionStuff.addValue(relTransform.m[3][0]);
+                    positionStuff.addValue(relTransform.m[3][1]);
+                    positionStuff.addValue(relTransform.m[3][2]);
+                    positionStuff.addToDictionary(jointProps, "relposition");
+                    rotationStuff.clear();
+                    rotationStuff.addValue(relRotQuat.x);
+                    rotationStuff.addValue(relRotQuat.y);
+                    rotationStuff.addValue(relRotQuat.z);
+                    rotationStuff.addValue(relRotQuat.w);
+                    rotationStuff.addToDictionary(jointProps, "relrotation");
                 }
             }
         }
         if (_outChannel)
         {
-            if (! _outChannel->write(message))
+            if (! _outChannel->writeBottle(message))
             {
-                ODL_LOG("(! _outChannel->write(message))"); //####
+                ODL_LOG("(! _outChannel->writeBottle(message))"); //####
 # if defined(MpM_StallOnSendProblem)
                 Stall();
 # endif // defined(MpM_StallOnSendProblem)
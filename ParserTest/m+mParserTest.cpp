@@ -390,6 +390,58 @@ doTestParseExpression(const bool   expected,
     return result;
 } // doTestParseExpression
 
+#if defined(__APPLE__)
+# pragma mark *** Test Case 07 ***
+#endif // defined(__APPLE__)
+
+/*! @brief Perform a test case.
+ @param[in] expected @c true if the value is expected to match the candidate, and @c false
+ otherwise.
+ @param[in] inString The string to be used for the value.
+ @param[in] candidate The string to be compared with the value.
+ @return @c 0 on success and @c 1 on failure. */
+static int
+doTestMatchValue(const bool   expected,
+                 const char * inString,
+                 const char * candidate) // compare value with a candidate
+{
+    ODL_ENTER(); //####
+    ODL_B1("expected = ", expected); //####
+    ODL_S2("inString = ", inString, "candidate = ", candidate); //####
+    int result = 1;
+
+    try
+    {
+        size_t               endPos;
+        size_t               len = strlen(inString);
+        Parser::MatchValue * didMatch = Parser::MatchValue::CreateMatcher(inString, len, 0, endPos);
+
+        if (didMatch)
+        {
+            if (didMatch->matches(candidate, false) == expected)
+            {
+                result = 0;
+            }
+            else
+            {
+                ODL_LOG("! (didMatch->matches(candidate, false) == expected)"); //####
+            }
+            delete didMatch;
+        }
+        else
+        {
+            ODL_LOG("! (didMatch)"); //####
+        }
+    }
+    catch (...)
+    {
+        ODL_LOG("Exception caught"); //####
+        throw;
+    }
+    ODL_EXIT_I(result); //####
+    return result;
+} // doTestMatchValue
+
 /*! @brief The signal handler to catch requests to stop the service.
  @param[in] signal The signal being handled. */
 static void
@@ -471,6 +523,11 @@ main(int      argc,
                         result = doTestParseExpression(expected, *(argv + 3));
                         break;
 
+                    case 7 :
+                        result = doTestMatchValue(expected, *(argv + 3),
+                                                  (3 < argc) ? *(argv + 4) : "");
+                        break;
+
                     default :
                         break;
 
@@ -37,6 +37,7 @@
 //--------------------------------------------------------------------------------------------------
 
 #include <m+m/m+mBaseClient.hpp>
+#include <m+m/m+mRegistryCache.hpp>
 #include <m+m/m+mRequests.hpp>
 #include <m+m/m+mUtilities.hpp>
 
@@ -81,27 +82,20 @@ using std::endl;
 
 /*! @brief Report the connections for a given port.
  @param[in] flavour The format for the output.
- @param[in] portName The port to be inspected.
- @param[in] checker A function that provides for early exit from loops.
- @param[in] checkStuff The private data for the early exit function. */
+ @param[in] inputs The collected inputs for the port.
+ @param[in] outputs The collected outputs for the port. */
 static void
-reportConnections(const OutputFlavour flavour,
-                  const YarpString &  portName,
-                  CheckFunction       checker,
-                  void *              checkStuff)
+reportConnections(const OutputFlavour   flavour,
+                  const ChannelVector & inputs,
+                  const ChannelVector & outputs)
 {
     ODL_ENTER(); //####
-    ODL_S1s("portName = ", portName); //####
-    ODL_P1("checkStuff = ", checkStuff); //####
+    ODL_P2("inputs = ", &inputs, "outputs = ", &outputs); //####
     bool          sawInputs = false;
     bool          sawOutputs = false;
-    ChannelVector inputs;
-    ChannelVector outputs;
     YarpString    inputsAsString;
     YarpString    outputsAsString;
 
-    Utilities::GatherPortConnections(portName, inputs, outputs, Utilities::kInputAndOutputBoth,
-                                     false, checker, checkStuff);
     if (0 < inputs.size())
     {
         for (ChannelVector::const_iterator walker(inputs.begin()); inputs.end() != walker; ++walker)
@@ -331,21 +325,22 @@ reportConnections(const OutputFlavour flavour,
 
 /*! @brief Print out connection information for a port.
  @param[in] flavour The format for the output.
- @param[in] aDescriptor The attributes of the port of interest.
+ @param[in] anEntry The attributes and connections of the port of interest.
  @param[in] checkWithRegistry @c true if the %Registry Service is available for requests and
  @c false otherwise.
  @return @c true if information was written out and @c false otherwise. */
 static bool
-reportPortStatus(const OutputFlavour               flavour,
-                 const Utilities::PortDescriptor & aDescriptor,
-                 const bool                        checkWithRegistry)
+reportPortStatus(const OutputFlavour                   flavour,
+                 const Utilities::PortInventoryEntry & anEntry,
+                 const bool                            checkWithRegistry)
 {
     ODL_ENTER(); //####
-    ODL_P1("aDescriptor = ", &aDescriptor); //####
+    ODL_P1("anEntry = ", &anEntry); //####
     ODL_B1("checkWithRegistry = ", checkWithRegistry); //####
-    bool       result;
-    YarpString portName;
-    YarpString portClass;
+    const Utilities::PortDescriptor & aDescriptor = anEntry._port;
+    bool                              result;
+    YarpString                        portName;
+    YarpString                        portClass;
 
     portName = SanitizeString(aDescriptor._portName, kOutputFlavourJSON != flavour);
     if (strncmp(portName.c_str(), HIDDEN_CHANNEL_PREFIX_, sizeof(HIDDEN_CHANNEL_PREFIX_) - 1))
@@ -571,7 +566,33 @@ reportPortStatus(const OutputFlavour               flavour,
                 break;
 
         }
-        reportConnections(flavour, aDescriptor._portName, NULL, NULL);
+        if (anEntry._valid)
+        {
+            reportConnections(flavour, anEntry._inputs, anEntry._outputs);
+        }
+        else
+        {
+            // The port didn't answer in time, so whatever was gathered is incomplete.
+            switch (flavour)
+            {
+                case kOutputFlavourTabs :
+                    cout << "unknown\tunknown";
+                    break;
+
+                case kOutputFlavourJSON :
+                    cout << T_(CHAR_DOUBLEQUOTE_ "Inputs" CHAR_DOUBLEQUOTE_ ": null, "
+                               CHAR_DOUBLEQUOTE_ "Outputs" CHAR_DOUBLEQUOTE_ ": null");
+                    break;
+
+                case kOutputFlavourNormal :
+                    cout << "   Connections could not be determined." << endl;
+                    break;
+
+                default :
+                    break;
+
+            }
+        }
         switch (flavour)
         {
             case kOutputFlavourTabs :
@@ -644,8 +665,29 @@ main(int      argc,
                 Utilities::RemoveStalePorts();
                 if (Utilities::GetDetectedPortList(ports, true))
                 {
-                    bool serviceRegistryPresent = Utilities::CheckListForRegistryService(ports);
-
+                    bool                     serviceRegistryPresent =
+                                                Utilities::CheckListForRegistryService(ports);
+                    Utilities::PortInventory inventory;
+                    Utilities::PortVector    visiblePorts;
+
+                    // Each service port is matched against the Registry Service, so the matches are
+                    // answered locally where possible.
+                    if (serviceRegistryPresent && (! RegistryCache::Enable()))
+                    {
+                        ODL_LOG("(serviceRegistryPresent && (! RegistryCache::Enable()))"); //####
+                    }
+                    // Hidden ports aren't reported, so don't examine them; the connections of the
+                    // other ports are gathered together, rather than waiting on each in turn.
+                    for (Utilities::PortVector::const_iterator walker(ports.begin());
+                         ports.end() != walker; ++walker)
+                    {
+                        if (strncmp(walker->_portName.c_str(), HIDDEN_CHANNEL_PREFIX_,
+                                    sizeof(HIDDEN_CHANNEL_PREFIX_) - 1))
+                        {
+                            visiblePorts.push_back(*walker);
+                        }
+                    }
+                    Utilities::GatherPortInventory(visiblePorts, inventory);
                     switch (flavour)
                     {
                         case kOutputFlavourTabs :
@@ -663,10 +705,10 @@ main(int      argc,
                             break;
 
                     }
-                    if (0 < ports.size())
+                    if (0 < inventory.size())
                     {
-                        for (Utilities::PortVector::const_iterator walker(ports.begin());
-                             ports.end() != walker; ++walker)
+                        for (Utilities::PortInventory::const_iterator walker(inventory.begin());
+                             inventory.end() != walker; ++walker)
                         {
                             switch (flavour)
                             {
@@ -225,9 +225,9 @@ ProComp2InputThread::readChannelData(const DWORD time)
     if (sawData && _outChannel)
     {
         props.put("time", static_cast<double>(time));
-        if (! _outChannel->write(message))
+        if (! _outChannel->writeBottle(message))
         {
-            ODL_LOG("(! _outChannel->write(message))"); //####
+            ODL_LOG("(! _outChannel->writeBottle(message))"); //####
 #if defined(MpM_StallOnSendProblem)
             Stall();
 #endif // defined(MpM_StallOnSendProblem)
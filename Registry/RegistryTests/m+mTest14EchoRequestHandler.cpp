@@ -142,7 +142,8 @@ bool
 Test14EchoRequestHandler::processRequest(const YarpString &           request,
                                          const yarp::os::Bottle &     restOfInput,
                                          const YarpString &           senderChannel,
-                                         yarp::os::ConnectionWriter * replyMechanism)
+                                         yarp::os::ConnectionWriter * replyMechanism,
+                                         yarp::os::Bottle &           response)
 {
 #if (! defined(ODL_ENABLE_LOGGING_))
 # if MAC_OR_LINUX_
@@ -152,13 +153,13 @@ Test14EchoRequestHandler::processRequest(const YarpString &           request,
     ODL_OBJENTER(); //####
     ODL_S3s("request = ", request, "restOfInput = ", restOfInput.toString(), //####
             "senderChannel = ", senderChannel); //####
-    ODL_P1("replyMechanism = ", replyMechanism); //####
+    ODL_P2("replyMechanism = ", replyMechanism, "response = ", &response); //####
     bool result = true;
 
     try
     {
-        _response = restOfInput;
-        sendResponse(replyMechanism);
+        response = restOfInput;
+        sendResponse(response, replyMechanism);
     }
     catch (...)
     {
@@ -0,0 +1,216 @@
+//--------------------------------------------------------------------------------------------------
+//
+//  File:       Registry/m+mChangesRequestHandler.cpp
+//
+//  Project:    m+m
+//
+//  Contains:   The class definition for the request handler for the 'changes' request.
+//
+//  Written by: Norman Jaffe
+//
+//  Copyright:  (c) 2026 by OpenDragon.
+//
+//
+//              All rights reserved. Redistribution and use in source and binary forms, with or
+//              without modification, are permitted provided that the following conditions are met:
+//                * Redistributions of source code must retain the above copyright notice, this list
+//                  of conditions and the following disclaimer.
+//                * Redistributions in binary form must reproduce the above copyright notice, this
+//                  list of conditions and the following disclaimer in the documentation and / or
+//                  other materials provided with the distribution.
+//                * Neither the name of the copyright holders nor the names of its contributors may
+//                  be used to endorse or promote products derived from this software without
+//                  specific prior written permission.
+//
+//              THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//              EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//              OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//              SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//              INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//              TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//              BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//              CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//              ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//              DAMAGE.
+//
+//  Created:    2026-10-17
+//
+//--------------------------------------------------------------------------------------------------
+
+#include "m+mChangesRequestHandler.hpp"
+
+#include "m+mRegistryService.hpp"
+
+#include <m+m/m+mRequests.hpp>
+
+//#include <odlEnable.h>
+#include <odlInclude.h>
+
+#if defined(__APPLE__)
+# pragma clang diagnostic push
+# pragma clang diagnostic ignored "-Wunknown-pragmas"
+# pragma clang diagnostic ignored "-Wdocumentation-unknown-command"
+#endif // defined(__APPLE__)
+/*! @file
+ @brief The class definition for the request handler for the 'changes' request. */
+#if defined(__APPLE__)
+# pragma clang diagnostic pop
+#endif // defined(__APPLE__)
+
+#if defined(__APPLE__)
+# pragma mark Namespace references
+#endif // defined(__APPLE__)
+
+using namespace MplusM;
+using namespace MplusM::Common;
+using namespace MplusM::Registry;
+
+#if defined(__APPLE__)
+# pragma mark Private structures, constants and variables
+#endif // defined(__APPLE__)
+
+/*! @brief The protocol version number for the 'changes' request. */
+#define CHANGES_REQUEST_VERSION_NUMBER_ "1.0"
+
+#if defined(__APPLE__)
+# pragma mark Global constants and variables
+#endif // defined(__APPLE__)
+
+#if defined(__APPLE__)
+# pragma mark Local functions
+#endif // defined(__APPLE__)
+
+#if defined(__APPLE__)
+# pragma mark Class methods
+#endif // defined(__APPLE__)
+
+#if defined(__APPLE__)
+# pragma mark Constructors and Destructors
+#endif // defined(__APPLE__)
+
+ChangesRequestHandler::ChangesRequestHandler(RegistryService & service) :
+    inherited(MpM_CHANGES_REQUEST_, service)
+{
+    ODL_ENTER(); //####
+    ODL_P1("service = ", &service); //####
+    ODL_EXIT_P(this); //####
+} // ChangesRequestHandler::ChangesRequestHandler
+
+ChangesRequestHandler::~ChangesRequestHandler(void)
+{
+    ODL_OBJENTER(); //####
+    ODL_OBJEXIT(); //####
+} // ChangesRequestHandler::~ChangesRequestHandler
+
+#if defined(__APPLE__)
+# pragma mark Actions and Accessors
+#endif // defined(__APPLE__)
+
+void
+ChangesRequestHandler::fillInDescription(const YarpString &   request,
+                                         yarp::os::Property & info)
+{
+    ODL_OBJENTER(); //####
+    ODL_S1s("request = ", request); //####
+    ODL_P1("info = ", &info); //####
+    try
+    {
+        info.put(MpM_REQREP_DICT_REQUEST_KEY_, request);
+        info.put(MpM_REQREP_DICT_INPUT_KEY_, MpM_REQREP_INT_ MpM_REQREP_0_OR_1_);
+        info.put(MpM_REQREP_DICT_OUTPUT_KEY_, MpM_REQREP_STRING_ MpM_REQREP_INT_ MpM_REQREP_STRING_
+                 MpM_REQREP_LIST_START_ MpM_REQREP_LIST_START_ MpM_REQREP_ANYTHING_
+                 MpM_REQREP_1_OR_MORE_ MpM_REQREP_LIST_END_ MpM_REQREP_0_OR_MORE_
+                 MpM_REQREP_LIST_END_);
+        info.put(MpM_REQREP_DICT_VERSION_KEY_, CHANGES_REQUEST_VERSION_NUMBER_);
+        info.put(MpM_REQREP_DICT_DETAILS_KEY_, T_("Return the changes to the set of registered "
+                                                  "services\n"
+                                                  "Input: the version of the set of registered "
+                                                  "services that is already known, if any\n"
+                                                  "Output: OK, the current version and either "
+                                                  "'deltas' and a list of the changes since the "
+                                                  "known version or 'snapshot' and a list of the "
+                                                  "registered service channels and names"));
+        yarp::os::Value    keywords;
+        yarp::os::Bottle * asList = keywords.asList();
+
+        asList->addString(request);
+        info.put(MpM_REQREP_DICT_KEYWORDS_KEY_, keywords);
+    }
+    catch (...)
+    {
+        ODL_LOG("Exception caught"); //####
+        throw;
+    }
+    ODL_OBJEXIT(); //####
+} // ChangesRequestHandler::fillInDescription
+
+#if (! MAC_OR_LINUX_)
+# pragma warning(push)
+# pragma warning(disable: 4100)
+#endif // ! MAC_OR_LINUX_
+bool
+ChangesRequestHandler::processRequest(const YarpString &           request,
+                                      const yarp::os::Bottle &     restOfInput,
+                                      const YarpString &           senderChannel,
+                                      yarp::os::ConnectionWriter * replyMechanism,
+                                      yarp::os::Bottle &           response)
+{
+#if (! defined(ODL_ENABLE_LOGGING_))
+# if MAC_OR_LINUX_
+#  pragma unused(request,senderChannel)
+# endif // MAC_OR_LINUX_
+#endif // ! defined(ODL_ENABLE_LOGGING_)
+    ODL_OBJENTER(); //####
+    ODL_S3s("request = ", request, "restOfInput = ", restOfInput.toString(), //####
+            "senderChannel = ", senderChannel); //####
+    ODL_P2("replyMechanism = ", replyMechanism, "response = ", &response); //####
+    bool result = true;
+
+    try
+    {
+        // We are expecting an optional integer as the parameter
+        if (0 == restOfInput.size())
+        {
+            response.addString(MpM_OK_RESPONSE_);
+            static_cast<RegistryService &>(_service).processChangesRequest(-1, response);
+        }
+        else if (1 == restOfInput.size())
+        {
+            yarp::os::Value argument(restOfInput.get(0));
+
+            if (argument.isInt() && (0 <= argument.asInt()))
+            {
+                response.addString(MpM_OK_RESPONSE_);
+                static_cast<RegistryService &>(_service).processChangesRequest(argument.asInt(),
+                                                                               response);
+            }
+            else
+            {
+                ODL_LOG("! (argument.isInt() && (0 <= argument.asInt()))"); //####
+                response.addString(MpM_FAILED_RESPONSE_);
+                response.addString("Invalid version");
+            }
+        }
+        else
+        {
+            ODL_LOG("! (1 == restOfInput.size())"); //####
+            response.addString(MpM_FAILED_RESPONSE_);
+            response.addString("Extra arguments to request");
+        }
+        sendResponse(response, replyMechanism);
+    }
+    catch (...)
+    {
+        ODL_LOG("Exception caught"); //####
+        throw;
+    }
+    ODL_OBJEXIT_B(result); //####
+    return result;
+} // ChangesRequestHandler::processRequest
+#if (! MAC_OR_LINUX_)
+# pragma warning(pop)
+#endif // ! MAC_OR_LINUX_
+
+#if defined(__APPLE__)
+# pragma mark Global functions
+#endif // defined(__APPLE__)
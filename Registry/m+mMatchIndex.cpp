@@ -0,0 +1,609 @@
+//--------------------------------------------------------------------------------------------------
+//
+//  File:       Registry/m+mMatchIndex.cpp
+//
+//  Project:    m+m
+//
+//  Contains:   The class definition for the in-memory index used for Registry Service matches.
+//
+//  Written by: Norman Jaffe
+//
+//  Copyright:  (c) 2026 by OpenDragon.
+//
+//
+//              All rights reserved. Redistribution and use in source and binary forms, with or
+//              without modification, are permitted provided that the following conditions are met:
+//                * Redistributions of source code must retain the above copyright notice, this list
+//                  of conditions and the following disclaimer.
+//                * Redistributions in binary form must reproduce the above copyright notice, this
+//                  list of conditions and the following disclaimer in the documentation and / or
+//                  other materials provided with the distribution.
+//                * Neither the name of the copyright holders nor the names of its contributors may
+//                  be used to endorse or promote products derived from this software without
+//                  specific prior written permission.
+//
+//              THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//              EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//              OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//              SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//              INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//              TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//              BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//              CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//              ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//              DAMAGE.
+//
+//  Created:    2026-10-17
+//
+//--------------------------------------------------------------------------------------------------
+
+
+#include "m+mMatchIndex.hpp"
+#include "m+mColumnNameValidator.hpp"
+
+#include <m+m/m+mMatchConstraint.hpp>
+#include <m+m/m+mMatchExpression.hpp>
+#include <m+m/m+mMatchFieldWithValues.hpp>
+
+//#include <odlEnable.h>
+#include <odlInclude.h>
+
+#include <algorithm>
+#include <iterator>
+
+#if defined(__APPLE__)
+# pragma clang diagnostic push
+# pragma clang diagnostic ignored "-Wunknown-pragmas"
+# pragma clang diagnostic ignored "-Wdocumentation-unknown-command"
+#endif // defined(__APPLE__)
+/*! @file
+ @brief The class definition for the in-memory index used for Registry Service matches. */
+#if defined(__APPLE__)
+# pragma clang diagnostic pop
+#endif // defined(__APPLE__)
+
+#if defined(__APPLE__)
+# pragma mark Namespace references
+#endif // defined(__APPLE__)
+
+using namespace MplusM;
+using namespace MplusM::Common;
+using namespace MplusM::Parser;
+using namespace MplusM::Registry;
+
+#if defined(__APPLE__)
+# pragma mark Private structures, constants and variables
+#endif // defined(__APPLE__)
+
+/*! @brief The description of a field in the index. */
+struct FieldDescription
+{
+    /*! @brief The name of the field, as it appears in a match expression. */
+    const char * _name;
+
+    /*! @brief @c true if the database column for the field is compared without regard to case
+     and @c false otherwise. */
+    bool _ignoreCase;
+
+}; // FieldDescription
+
+/*! @brief The fields in the index, in the same order as the FieldIndex values. The comparisons
+ follow the collations of the corresponding database columns. */
+static const FieldDescription kFields[MatchIndex::kFieldCount] =
+{
+    { CHANNELNAME_C_,         false },
+    { DESCRIPTION_C_,         true  },
+    { DETAILS_C_,             true  },
+    { INPUT_C_,               false },
+    { KEYWORD_C_,             false },
+    { NAME_C_,                true  },
+    { OUTPUT_C_,              false },
+    { REQUEST_C_,             false },
+    { REQUESTSDESCRIPTION_C_, true  },
+    { TAG_C_,                 false },
+    { VERSION_C_,             true  }
+}; // kFields
+
+#if defined(__APPLE__)
+# pragma mark Global constants and variables
+#endif // defined(__APPLE__)
+
+#if defined(__APPLE__)
+# pragma mark Local functions
+#endif // defined(__APPLE__)
+
+/*! @brief Locate a field in the index.
+ @param[in] fieldName The name of the field.
+ @return The index of the field or @c MatchIndex::kFieldCount if the field is not in the index. */
+static MatchIndex::FieldIndex
+findField(const YarpString & fieldName)
+{
+    ODL_ENTER(); //####
+    ODL_S1s("fieldName = ", fieldName); //####
+    MatchIndex::FieldIndex result = MatchIndex::kFieldCount;
+
+    for (int ii = 0; ii < MatchIndex::kFieldCount; ++ii)
+    {
+        if (fieldName == kFields[ii]._name)
+        {
+            result = static_cast<MatchIndex::FieldIndex>(ii);
+            break;
+        }
+
+    }
+    ODL_EXIT_I(result); //####
+    return result;
+} // findField
+
+/*! @brief Return the value of a field as it is stored in the postings for the field.
+ @param[in] field The index of the field.
+ @param[in] value The value of the field.
+ @return The value, in lower-case if the field is compared without regard to case. */
+static YarpString
+postingValue(const MatchIndex::FieldIndex field,
+             const YarpString &           value)
+{
+    YarpString result(value);
+
+    if (kFields[field]._ignoreCase)
+    {
+        for (size_t ii = 0, len = result.length(); ii < len; ++ii)
+        {
+            result[ii] = static_cast<char>(tolower(static_cast<unsigned char>(result[ii])));
+        }
+    }
+    return result;
+} // postingValue
+
+#if defined(__APPLE__)
+# pragma mark Class methods
+#endif // defined(__APPLE__)
+
+#if defined(__APPLE__)
+# pragma mark Constructors and Destructors
+#endif // defined(__APPLE__)
+
+MatchIndex::MatchIndex(void) :
+    _lock(), _requests(), _services(), _nextKey(0)
+{
+    ODL_ENTER(); //####
+    ODL_EXIT_P(this); //####
+} // MatchIndex::MatchIndex
+
+MatchIndex::~MatchIndex(void)
+{
+    ODL_OBJENTER(); //####
+    ODL_OBJEXIT(); //####
+} // MatchIndex::~MatchIndex
+
+#if defined(__APPLE__)
+# pragma mark Actions and Accessors
+#endif // defined(__APPLE__)
+
+void
+MatchIndex::addPostings(const PostingReference & reference,
+                        const RequestKeySet &    keys)
+{
+    ODL_OBJENTER(); //####
+    ODL_P2("reference = ", &reference, "keys = ", &keys); //####
+    if (0 < keys.size())
+    {
+        _postings[reference._field][reference._value].insert(keys.begin(), keys.end());
+    }
+    ODL_OBJEXIT(); //####
+} // MatchIndex::addPostings
+
+void
+MatchIndex::addService(const ServiceRegistration & registration)
+{
+    ODL_OBJENTER(); //####
+    ODL_P1("registration = ", &registration); //####
+    try
+    {
+        lock();
+        try
+        {
+            ServiceRecord & aService = _services[registration._channel];
+            RequestKeySet   newKeys;
+
+            // The service fields might have changed, so they are replaced for all the requests of
+            // the service.
+            for (PostingReferenceVector::const_iterator walker(aService._references.begin());
+                 aService._references.end() != walker; ++walker)
+            {
+                removePostings(*walker, aService._requests);
+            }
+            aService._name = registration._name;
+            aService._references.clear();
+            for (RequestDescriptionVector::const_iterator
+                 walker(registration._requests.begin());
+                 registration._requests.end() != walker; ++walker)
+            {
+                const RequestDescription & aRequest = *walker;
+                RequestKey                 aKey = _nextKey++;
+                RequestRecord &            aRecord = _requests[aKey];
+                RequestKeySet              justThisKey;
+                const FieldIndex           requestFields[] =
+                {
+                    kFieldChannelName, kFieldDetails, kFieldInput, kFieldOutput, kFieldRequest,
+                    kFieldVersion
+                };
+                const YarpString *         requestValues[] =
+                {
+                    &registration._channel, &aRequest._details, &aRequest._inputs,
+                    &aRequest._outputs, &aRequest._request, &aRequest._version
+                };
+                const size_t               numRequestFields = (sizeof(requestFields) /
+                                                               sizeof(*requestFields));
+
+                aRecord._channel = registration._channel;
+                for (size_t ii = 0; ii < numRequestFields; ++ii)
+                {
+                    PostingReference aReference;
+
+                    aReference._field = requestFields[ii];
+                    aReference._value = postingValue(requestFields[ii], *requestValues[ii]);
+                    aRecord._references.push_back(aReference);
+                }
+                for (YarpStringVector::const_iterator walker2(aRequest._keywords.begin());
+                     aRequest._keywords.end() != walker2; ++walker2)
+                {
+                    PostingReference aReference;
+
+                    aReference._field = kFieldKeyword;
+                    aReference._value = postingValue(kFieldKeyword, *walker2);
+                    aRecord._references.push_back(aReference);
+                }
+                justThisKey.insert(aKey);
+                for (PostingReferenceVector::const_iterator walker2(aRecord._references.begin());
+                     aRecord._references.end() != walker2; ++walker2)
+                {
+                    addPostings(*walker2, justThisKey);
+                }
+                newKeys.insert(aKey);
+            }
+            aService._requests.insert(newKeys.begin(), newKeys.end());
+            {
+                const FieldIndex   serviceFields[] =
+                {
+                    kFieldDescription, kFieldName, kFieldRequestsDescription, kFieldTag
+                };
+                const YarpString * serviceValues[] =
+                {
+                    &registration._description, &registration._name,
+                    &registration._requestsDescription, &registration._tag
+                };
+                const size_t       numServiceFields = (sizeof(serviceFields) /
+                                                       sizeof(*serviceFields));
+
+                for (size_t ii = 0; ii < numServiceFields; ++ii)
+                {
+                    PostingReference aReference;
+
+                    aReference._field = serviceFields[ii];
+                    aReference._value = postingValue(serviceFields[ii], *serviceValues[ii]);
+                    aService._references.push_back(aReference);
+                    addPostings(aReference, aService._requests);
+                }
+            }
+        }
+        catch (...)
+        {
+            unlock();
+            throw;
+        }
+        unlock();
+    }
+    catch (...)
+    {
+        ODL_LOG("Exception caught"); //####
+        throw;
+    }
+    ODL_OBJEXIT(); //####
+} // MatchIndex::addService
+
+bool
+MatchIndex::evaluate(const MatchExpression & matcher,
+                     const bool              getNames,
+                     YarpStringVector &      results)
+{
+    ODL_OBJENTER(); //####
+    ODL_P2("matcher = ", &matcher, "results = ", &results); //####
+    ODL_B1("getNames = ", getNames); //####
+    bool okSoFar = true;
+
+    try
+    {
+        // Check that all the fields are in the index before doing any work.
+        for (int ii = 0, maxI = matcher.count(); okSoFar && (ii < maxI); ++ii)
+        {
+            const MatchConstraint * aConstraint = matcher.element(ii);
+
+            for (int jj = 0, maxJ = aConstraint->count(); okSoFar && (jj < maxJ); ++jj)
+            {
+                okSoFar = (kFieldCount != findField(aConstraint->element(jj)->fieldName()));
+            }
+        }
+        if (okSoFar)
+        {
+            lock();
+            try
+            {
+                RequestKeySet        matched;
+                std::set<YarpString> collected;
+
+                // The constraints are alternatives, so their requests are combined.
+                for (int ii = 0, maxI = matcher.count(); ii < maxI; ++ii)
+                {
+                    RequestKeySet constraintKeys;
+
+                    evaluateConstraint(*matcher.element(ii), constraintKeys);
+                    matched.insert(constraintKeys.begin(), constraintKeys.end());
+                }
+                for (RequestKeySet::const_iterator walker(matched.begin());
+                     matched.end() != walker; ++walker)
+                {
+                    RequestRecordMap::const_iterator match(_requests.find(*walker));
+
+                    if (_requests.end() != match)
+                    {
+                        if (getNames)
+                        {
+                            ServiceRecordMap::const_iterator service =
+                                                            _services.find(match->second._channel);
+
+                            if (_services.end() != service)
+                            {
+                                collected.insert(service->second._name);
+                            }
+                        }
+                        else
+                        {
+                            collected.insert(match->second._channel);
+                        }
+                    }
+                }
+                results.clear();
+                results.insert(results.end(), collected.begin(), collected.end());
+            }
+            catch (...)
+            {
+                unlock();
+                throw;
+            }
+            unlock();
+        }
+        else
+        {
+            ODL_LOG("! (okSoFar)"); //####
+        }
+    }
+    catch (...)
+    {
+        ODL_LOG("Exception caught"); //####
+        throw;
+    }
+    ODL_OBJEXIT_B(okSoFar); //####
+    return okSoFar;
+} // MatchIndex::evaluate
+
+void
+MatchIndex::evaluateConstraint(const MatchConstraint & constraint,
+                               RequestKeySet &         keys)
+{
+    ODL_OBJENTER(); //####
+    ODL_P2("constraint = ", &constraint, "keys = ", &keys); //####
+    try
+    {
+        keys.clear();
+        // The fields of a constraint must all be satisfied by the same request.
+        for (int ii = 0, maxI = constraint.count(); ii < maxI; ++ii)
+        {
+            const MatchFieldWithValues * aField = constraint.element(ii);
+            RequestKeySet                fieldKeys;
+
+            evaluateField(*aField, findField(aField->fieldName()), fieldKeys);
+            if (ii)
+            {
+                RequestKeySet common;
+
+                std::set_intersection(keys.begin(), keys.end(), fieldKeys.begin(),
+                                      fieldKeys.end(), std::inserter(common, common.end()));
+                keys.swap(common);
+            }
+            else
+            {
+                keys.swap(fieldKeys);
+            }
+            if (keys.empty())
+            {
+                break;
+            }
+
+        }
+    }
+    catch (...)
+    {
+        ODL_LOG("Exception caught"); //####
+        throw;
+    }
+    ODL_OBJEXIT(); //####
+} // MatchIndex::evaluateConstraint
+
+void
+MatchIndex::evaluateField(const MatchFieldWithValues & fieldWithValues,
+                          const FieldIndex             field,
+                          RequestKeySet &              keys)
+{
+    ODL_OBJENTER(); //####
+    ODL_P2("fieldWithValues = ", &fieldWithValues, "keys = ", &keys); //####
+    ODL_I1("field = ", field); //####
+    try
+    {
+        const PostingsMap & postings = _postings[field];
+        YarpStringVector    literals;
+
+        keys.clear();
+        if ((! fieldWithValues.isNegated()) && fieldWithValues.getLiteralValues(literals))
+        {
+            // Only exact values are being looked for, so they can be found directly.
+            for (YarpStringVector::const_iterator walker(literals.begin());
+                 literals.end() != walker; ++walker)
+            {
+                PostingsMap::const_iterator match(postings.find(postingValue(field, *walker)));
+
+                if (postings.end() != match)
+                {
+                    keys.insert(match->second.begin(), match->second.end());
+                }
+            }
+        }
+        else
+        {
+            // Wildcard and negated values need to be checked against each distinct value of the
+            // field.
+            bool ignoreCase = kFields[field]._ignoreCase;
+
+            for (PostingsMap::const_iterator walker(postings.begin()); postings.end() != walker;
+                 ++walker)
+            {
+                if (fieldWithValues.matches(walker->first, ignoreCase))
+                {
+                    keys.insert(walker->second.begin(), walker->second.end());
+                }
+            }
+        }
+    }
+    catch (...)
+    {
+        ODL_LOG("Exception caught"); //####
+        throw;
+    }
+    ODL_OBJEXIT(); //####
+} // MatchIndex::evaluateField
+
+void
+MatchIndex::fillInServices(yarp::os::Bottle & services)
+{
+    ODL_OBJENTER(); //####
+    ODL_P1("services = ", &services); //####
+    try
+    {
+        lock();
+        try
+        {
+            for (ServiceRecordMap::const_iterator walker(_services.begin());
+                 _services.end() != walker; ++walker)
+            {
+                yarp::os::Bottle & aService = services.addList();
+
+                aService.addString(walker->first);
+                aService.addString(walker->second._name);
+            }
+        }
+        catch (...)
+        {
+            unlock();
+            throw;
+        }
+        unlock();
+    }
+    catch (...)
+    {
+        ODL_LOG("Exception caught"); //####
+        throw;
+    }
+    ODL_OBJEXIT(); //####
+} // MatchIndex::fillInServices
+
+void
+MatchIndex::removePostings(const PostingReference & reference,
+                           const RequestKeySet &    keys)
+{
+    ODL_OBJENTER(); //####
+    ODL_P2("reference = ", &reference, "keys = ", &keys); //####
+    PostingsMap &         postings = _postings[reference._field];
+    PostingsMap::iterator match(postings.find(reference._value));
+
+    if (postings.end() != match)
+    {
+        for (RequestKeySet::const_iterator walker(keys.begin()); keys.end() != walker; ++walker)
+        {
+            match->second.erase(*walker);
+        }
+        if (match->second.empty())
+        {
+            postings.erase(match);
+        }
+    }
+    ODL_OBJEXIT(); //####
+} // MatchIndex::removePostings
+
+bool
+MatchIndex::removeService(const YarpString & channelName,
+                          YarpString &       serviceName)
+{
+    ODL_OBJENTER(); //####
+    ODL_S1s("channelName = ", channelName); //####
+    ODL_P1("serviceName = ", &serviceName); //####
+    bool wasPresent = false;
+
+    try
+    {
+        lock();
+        try
+        {
+            ServiceRecordMap::iterator match(_services.find(channelName));
+
+            if (_services.end() != match)
+            {
+                ServiceRecord & aService = match->second;
+
+                for (PostingReferenceVector::const_iterator walker(aService._references.begin());
+                     aService._references.end() != walker; ++walker)
+                {
+                    removePostings(*walker, aService._requests);
+                }
+                for (RequestKeySet::const_iterator walker(aService._requests.begin());
+                     aService._requests.end() != walker; ++walker)
+                {
+                    RequestRecordMap::iterator aRequest(_requests.find(*walker));
+
+                    if (_requests.end() != aRequest)
+                    {
+                        RequestKeySet justThisKey;
+
+                        justThisKey.insert(*walker);
+                        for (PostingReferenceVector::const_iterator
+                             walker2(aRequest->second._references.begin());
+                             aRequest->second._references.end() != walker2; ++walker2)
+                        {
+                            removePostings(*walker2, justThisKey);
+                        }
+                        _requests.erase(aRequest);
+                    }
+                }
+                serviceName = aService._name;
+                _services.erase(match);
+                wasPresent = true;
+            }
+        }
+        catch (...)
+        {
+            unlock();
+            throw;
+        }
+        unlock();
+    }
+    catch (...)
+    {
+        ODL_LOG("Exception caught"); //####
+        throw;
+    }
+    ODL_OBJEXIT_B(wasPresent); //####
+    return wasPresent;
+} // MatchIndex::removeService
+
+#if defined(__APPLE__)
+# pragma mark Global functions
+#endif // defined(__APPLE__)
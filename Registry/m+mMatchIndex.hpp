@@ -0,0 +1,307 @@
+//--------------------------------------------------------------------------------------------------
+//
+//  File:       Registry/m+mMatchIndex.hpp
+//
+//  Project:    m+m
+//
+//  Contains:   The class declaration for the in-memory index used for Registry Service matches.
+//
+//  Written by: Norman Jaffe
+//
+//  Copyright:  (c) 2026 by OpenDragon.
+//
+//
+//              All rights reserved. Redistribution and use in source and binary forms, with or
+//              without modification, are permitted provided that the following conditions are met:
+//                * Redistributions of source code must retain the above copyright notice, this list
+//                  of conditions and the following disclaimer.
+//                * Redistributions in binary form must reproduce the above copyright notice, this
+//                  list of conditions and the following disclaimer in the documentation and / or
+//                  other materials provided with the distribution.
+//                * Neither the name of the copyright holders nor the names of its contributors may
+//                  be used to endorse or promote products derived from this software without
+//                  specific prior written permission.
+//
+//              THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//              EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//              OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//              SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//              INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//              TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//              BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//              CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//              ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//              DAMAGE.
+//
+//  Created:    2026-10-17
+//
+//--------------------------------------------------------------------------------------------------
+
+#if (! defined(MpMMatchIndex_HPP_))
+# define MpMMatchIndex_HPP_ /* Header guard */
+
+# include "m+mRegistryService.hpp"
+
+# include <set>
+
+# if defined(__APPLE__)
+#  pragma clang diagnostic push
+#  pragma clang diagnostic ignored "-Wunknown-pragmas"
+#  pragma clang diagnostic ignored "-Wdocumentation-unknown-command"
+# endif // defined(__APPLE__)
+/*! @file
+ @brief The class declaration for the in-memory index used for Registry Service matches. */
+# if defined(__APPLE__)
+#  pragma clang diagnostic pop
+# endif // defined(__APPLE__)
+
+namespace MplusM
+{
+    namespace Parser
+    {
+        class MatchConstraint;
+        class MatchExpression;
+        class MatchFieldWithValues;
+    } // Parser
+
+    namespace Registry
+    {
+        /*! @brief An inverted index from the values of the searchable fields to the requests of the
+         registered services.
+
+         The index mirrors the rows of the Registry Service database, so that a match expression
+         can be evaluated with set operations instead of an SQL query. It is updated only after the
+         corresponding database transaction has been committed. */
+        class MatchIndex
+        {
+        public :
+
+            /*! @brief The fields that are present in the index. */
+            enum FieldIndex
+            {
+                /*! @brief The 'channelname' field of a request. */
+                kFieldChannelName,
+
+                /*! @brief The 'description' field of a service. */
+                kFieldDescription,
+
+                /*! @brief The 'details' field of a request. */
+                kFieldDetails,
+
+                /*! @brief The 'input' field of a request. */
+                kFieldInput,
+
+                /*! @brief The 'keyword' field of a request. */
+                kFieldKeyword,
+
+                /*! @brief The 'name' field of a service. */
+                kFieldName,
+
+                /*! @brief The 'output' field of a request. */
+                kFieldOutput,
+
+                /*! @brief The 'request' field of a request. */
+                kFieldRequest,
+
+                /*! @brief The 'requestsdescription' field of a service. */
+                kFieldRequestsDescription,
+
+                /*! @brief The 'tag' field of a service. */
+                kFieldTag,
+
+                /*! @brief The 'version' field of a request. */
+                kFieldVersion,
+
+                /*! @brief The number of fields. */
+                kFieldCount
+
+            }; // FieldIndex
+
+        protected :
+
+        private :
+
+            /*! @brief The key of a request in the index. */
+            typedef size_t RequestKey;
+
+            /*! @brief A set of request keys. */
+            typedef std::set<RequestKey> RequestKeySet;
+
+            /*! @brief The mapping from a field value to the requests that have that value. */
+            typedef std::map<YarpString, RequestKeySet> PostingsMap;
+
+            /*! @brief A reference to an entry in the postings for a field. */
+            struct PostingReference
+            {
+                /*! @brief The field that holds the value. */
+                FieldIndex _field;
+
+                /*! @brief The value, as it is stored in the postings for the field. */
+                YarpString _value;
+
+            }; // PostingReference
+
+            /*! @brief A sequence of references to postings entries. */
+            typedef std::vector<PostingReference> PostingReferenceVector;
+
+            /*! @brief The information retained for a request. */
+            struct RequestRecord
+            {
+                /*! @brief The service channel for the request. */
+                YarpString _channel;
+
+                /*! @brief The postings entries for the fields of the request. */
+                PostingReferenceVector _references;
+
+            }; // RequestRecord
+
+            /*! @brief The information retained for a service. */
+            struct ServiceRecord
+            {
+                /*! @brief The canonical name of the service. */
+                YarpString _name;
+
+                /*! @brief The postings entries for the fields of the service. */
+                PostingReferenceVector _references;
+
+                /*! @brief The requests of the service. */
+                RequestKeySet _requests;
+
+            }; // ServiceRecord
+
+            /*! @brief The mapping from request keys to requests. */
+            typedef std::map<RequestKey, RequestRecord> RequestRecordMap;
+
+            /*! @brief The mapping from service channels to services. */
+            typedef std::map<YarpString, ServiceRecord> ServiceRecordMap;
+
+        public :
+
+            /*! @brief The constructor. */
+            MatchIndex(void);
+
+            /*! @brief The destructor. */
+            virtual
+            ~MatchIndex(void);
+
+            /*! @brief Add a service and its requests to the index.
+
+             If the service channel is already present, the service fields are replaced and the
+             requests are added to the existing ones, as is done for the database.
+             @param[in] registration The service and its requests. */
+            void
+            addService(const ServiceRegistration & registration);
+
+            /*! @brief Evaluate a match expression against the index.
+             @param[in] matcher The match expression.
+             @param[in] getNames @c true if service names are to be returned and @c false if
+             service channels are to be returned.
+             @param[out] results The matching service names or channels.
+             @return @c true if the expression could be evaluated and @c false if it refers to a
+             field that is not in the index. */
+            bool
+            evaluate(const Parser::MatchExpression & matcher,
+                     const bool                      getNames,
+                     YarpStringVector &              results);
+
+            /*! @brief Add the service channels and service names of the services in the index to
+             a list.
+             @param[in,out] services The list to be filled in; each service is added as a list of
+             its service channel and service name. */
+            void
+            fillInServices(yarp::os::Bottle & services);
+
+            /*! @brief Remove a service and its requests from the index.
+             @param[in] channelName The service channel.
+             @param[out] serviceName The name of the service that was removed.
+             @return @c true if the service was in the index and @c false otherwise. */
+            bool
+            removeService(const YarpString & channelName,
+                          YarpString &       serviceName);
+
+        protected :
+
+        private :
+
+            /*! @brief The copy constructor.
+             @param[in] other The object to be copied. */
+            MatchIndex(const MatchIndex & other);
+
+            /*! @brief Add a set of requests to the postings for a field value.
+             @param[in] reference The field value.
+             @param[in] keys The requests to be added. */
+            void
+            addPostings(const PostingReference & reference,
+                        const RequestKeySet &    keys);
+
+            /*! @brief Determine the requests that satisfy a constraint.
+             @param[in] constraint The constraint to be evaluated.
+             @param[out] keys The requests that satisfy all the fields of the constraint. */
+            void
+            evaluateConstraint(const Parser::MatchConstraint & constraint,
+                               RequestKeySet &                 keys);
+
+            /*! @brief Determine the requests that satisfy a field with values.
+             @param[in] fieldWithValues The field to be evaluated.
+             @param[in] field The index of the field.
+             @param[out] keys The requests that satisfy the field. */
+            void
+            evaluateField(const Parser::MatchFieldWithValues & fieldWithValues,
+                          const FieldIndex                     field,
+                          RequestKeySet &                      keys);
+
+            /*! @brief Lock the data. */
+            inline void
+            lock(void)
+            {
+                _lock.lock();
+            } // lock
+
+            /*! @brief The assignment operator.
+             @param[in] other The object to be copied.
+             @return The updated object. */
+            MatchIndex &
+            operator =(const MatchIndex & other);
+
+            /*! @brief Remove a set of requests from the postings for a field value.
+             @param[in] reference The field value.
+             @param[in] keys The requests to be removed. */
+            void
+            removePostings(const PostingReference & reference,
+                           const RequestKeySet &    keys);
+
+            /*! @brief Unlock the data. */
+            inline void
+            unlock(void)
+            {
+                _lock.unlock();
+            } // unlock
+
+        public :
+
+        protected :
+
+        private :
+
+            /*! @brief The contention lock used to avoid inconsistencies. */
+            yarp::os::Mutex _lock;
+
+            /*! @brief The postings for each field. */
+            PostingsMap _postings[kFieldCount];
+
+            /*! @brief The requests in the index. */
+            RequestRecordMap _requests;
+
+            /*! @brief The services in the index. */
+            ServiceRecordMap _services;
+
+            /*! @brief The key to be used for the next request that is added. */
+            RequestKey _nextKey;
+
+        }; // MatchIndex
+
+    } // Registry
+
+} // MplusM
+
+#endif // ! defined(MpMMatchIndex_HPP_)
@@ -160,7 +160,8 @@ bool
 MatchRequestHandler::processRequest(const YarpString &           request,
                                     const yarp::os::Bottle &     restOfInput,
                                     const YarpString &           senderChannel,
-                                    yarp::os::ConnectionWriter * replyMechanism)
+                                    yarp::os::ConnectionWriter * replyMechanism,
+                                    yarp::os::Bottle &           response)
 {
 #if (! defined(ODL_ENABLE_LOGGING_))
 # if MAC_OR_LINUX_
@@ -170,13 +171,12 @@ MatchRequestHandler::processRequest(const YarpString &           request,
     ODL_OBJENTER(); //####
     ODL_S3s("request = ", request, "restOfInput = ", restOfInput.toString(), //####
             "senderChannel = ", senderChannel); //####
-    ODL_P1("replyMechanism = ", replyMechanism); //####
+    ODL_P2("replyMechanism = ", replyMechanism, "response = ", &response); //####
     bool result = true;
 
     try
     {
         // We are expecting an integer and a string as the parameter
-        _response.clear();
         if (2 == restOfInput.size())
         {
             yarp::os::Value condition(restOfInput.get(0));
@@ -200,41 +200,41 @@ MatchRequestHandler::processRequest(const YarpString &           request,
                     ODL_LOG("(matcher)"); //####
                     // Hand off the processing to the Registry Service. First, put the 'OK' response
                     // in the output buffer, as we have successfully parsed the request.
-                    _response.addString(MpM_OK_RESPONSE_);
+                    response.addString(MpM_OK_RESPONSE_);
                     if (! static_cast<RegistryService &>(_service).processMatchRequest(matcher,
                                                                                0 != conditionAsInt,
-                                                                                       _response))
+                                                                                       response))
                     {
                         ODL_LOG("(! static_cast<RegistryService &>(_service)." //####
                                 "processMatchRequest(matcher, 0 != conditionAsInt, " //####
-                                "_response))"); //####
-                        _response.clear();
-                        _response.addString(MpM_FAILED_RESPONSE_);
-                        _response.addString("Invalid criteria");
+                                "response))"); //####
+                        response.clear();
+                        response.addString(MpM_FAILED_RESPONSE_);
+                        response.addString("Invalid criteria");
                     }
                     delete matcher;
                 }
                 else
                 {
                     ODL_LOG("! (matcher)"); //####
-                    _response.addString(MpM_FAILED_RESPONSE_);
-                    _response.addString("Invalid criteria");
+                    response.addString(MpM_FAILED_RESPONSE_);
+                    response.addString("Invalid criteria");
                 }
             }
             else
             {
                 ODL_LOG("! (argument.isString())"); //####
-                _response.addString(MpM_FAILED_RESPONSE_);
-                _response.addString("Invalid criteria");
+                response.addString(MpM_FAILED_RESPONSE_);
+                response.addString("Invalid criteria");
             }
         }
         else
         {
             ODL_LOG("! (1 == restOfInput.size())"); //####
-            _response.addString(MpM_FAILED_RESPONSE_);
-            _response.addString("Missing criteria or extra arguments to request");
+            response.addString(MpM_FAILED_RESPONSE_);
+            response.addString("Missing criteria or extra arguments to request");
         }
-        sendResponse(replyMechanism);
+        sendResponse(response, replyMechanism);
     }
     catch (...)
     {
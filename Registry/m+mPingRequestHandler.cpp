@@ -71,7 +71,7 @@ using namespace MplusM::Registry;
 #endif // defined(__APPLE__)
 
 /*! @brief The protocol version number for the 'ping' request. */
-#define PING_REQUEST_VERSION_NUMBER_ "1.0"
+#define PING_REQUEST_VERSION_NUMBER_ "1.1"
 
 #if defined(__APPLE__)
 # pragma mark Global constants and variables
@@ -124,7 +124,8 @@ PingRequestHandler::fillInDescription(const YarpString &   request,
                                                   "re-register it\n"
                                                   "Input: the channel used by the service\n"
                                                   "Output: OK or FAILED, with a description of the "
-                                                  "problem encountered"));
+                                                  "problem encountered, or BUSY, with the number "
+                                                  "of seconds to wait before trying again"));
         yarp::os::Value    keywords;
         yarp::os::Bottle * asList = keywords.asList();
 
@@ -147,7 +148,8 @@ bool
 PingRequestHandler::processRequest(const YarpString &           request,
                                    const yarp::os::Bottle &     restOfInput,
                                    const YarpString &           senderChannel,
-                                   yarp::os::ConnectionWriter * replyMechanism)
+                                   yarp::os::ConnectionWriter * replyMechanism,
+                                   yarp::os::Bottle &           response)
 {
 #if (! defined(ODL_ENABLE_LOGGING_))
 # if MAC_OR_LINUX_
@@ -157,13 +159,12 @@ PingRequestHandler::processRequest(const YarpString &           request,
     ODL_OBJENTER(); //####
     ODL_S3s("request = ", request, "restOfInput = ", restOfInput.toString(), //####
             "senderChannel = ", senderChannel); //####
-    ODL_P1("replyMechanism = ", replyMechanism); //####
+    ODL_P2("replyMechanism = ", replyMechanism, "response = ", &response); //####
     bool result = true;
 
     try
     {
         // Validate the name as a channel name
-        _response.clear();
         if (1 == restOfInput.size())
         {
             yarp::os::Value argument(restOfInput.get(0));
@@ -175,6 +176,7 @@ PingRequestHandler::processRequest(const YarpString &           request,
                 if (Endpoint::CheckEndpointName(argAsString))
                 {
                     RegistryService & theService = static_cast<RegistryService &>(_service);
+                    double            retryAfter;
 
                     theService.reportStatusChange(argAsString,
                                                   RegistryService::kRegistryPingFromService);
@@ -189,8 +191,18 @@ PingRequestHandler::processRequest(const YarpString &           request,
                         // This service is already known, so just update the last-checked time.
                         theService.updateCheckedTimeForChannel(argAsString);
                     }
+                    else if (! theService.admitRegistration(retryAfter))
+                    {
+                        // Too many registrations are in progress, so have the service try again
+                        // later rather than letting it time out.
+                        ODL_LOG("! (theService.admitRegistration(retryAfter))"); //####
+                        response.addString(MpM_BUSY_RESPONSE_);
+                        response.addDouble(retryAfter);
+                    }
                     else
                     {
+                        double startTime = yarp::os::Time::now();
+
                         // Send a 'name' request to the channel
                         YarpString      aName = GetRandomChannelName(HIDDEN_CHANNEL_PREFIX_
                                                                      BUILD_NAME_("ping_",
@@ -204,40 +216,43 @@ PingRequestHandler::processRequest(const YarpString &           request,
                                 if (outChannel->addOutputWithRetries(argAsString,
                                                                      STANDARD_WAIT_TIME_))
                                 {
-                                    yarp::os::Bottle message1(MpM_NAME_REQUEST_);
-                                    yarp::os::Bottle reply;
+                                    yarp::os::Bottle    message1(MpM_NAME_REQUEST_);
+                                    yarp::os::Bottle    reply;
+                                    ServiceRegistration registration;
 
                                     if (outChannel->writeBottle(message1, reply))
                                     {
                                         if (theService.processNameResponse(argAsString,
-                                                                           ServiceResponse(reply)))
+                                                                           ServiceResponse(reply),
+                                                                           registration))
                                         {
                                             yarp::os::Bottle message2(MpM_LIST_REQUEST_);
 
                                             if (outChannel->writeBottle(message2, reply))
                                             {
                                                 if (theService.processListResponse(argAsString,
-                                                                           ServiceResponse(reply)))
+                                                                           ServiceResponse(reply),
+                                                                           registration))
                                                 {
                                                     // Remember the response
-                                                    _response.addString(MpM_OK_RESPONSE_);
+                                                    response.addString(MpM_OK_RESPONSE_);
                                                 theService.updateCheckedTimeForChannel(argAsString);
                                                 }
                                                 else
                                                 {
                                                     ODL_LOG("! (theService.processList" //####
                                                             "Response(argAsString, reply))"); //####
-                                                    _response.addString(MpM_FAILED_RESPONSE_);
-                                                    _response.addString("Invalid response to "
-                                                                        "'list' request");
+                                                    response.addString(MpM_FAILED_RESPONSE_);
+                                                    response.addString("Invalid response to "
+                                                                       "'list' request");
                                                 }
                                             }
                                             else
                                             {
                                                 ODL_LOG("! (outChannel->" //####
                                                         "writeBottle(message2, reply))"); //####
-                                                _response.addString(MpM_FAILED_RESPONSE_);
-                                                _response.addString("Could not write to channel");
+                                                response.addString(MpM_FAILED_RESPONSE_);
+                                                response.addString("Could not write to channel");
 #if defined(MpM_StallOnSendProblem)
                                                 Stall();
 #endif // defined(MpM_StallOnSendProblem)
@@ -247,17 +262,17 @@ PingRequestHandler::processRequest(const YarpString &           request,
                                         {
                                             ODL_LOG("! (theService.processNameResponse(" //####
                                                     "argAsString, reply))"); //####
-                                            _response.addString(MpM_FAILED_RESPONSE_);
-                                            _response.addString("Invalid response to 'name' "
-                                                                "request");
+                                            response.addString(MpM_FAILED_RESPONSE_);
+                                            response.addString("Invalid response to 'name' "
+                                                               "request");
                                         }
                                     }
                                     else
                                     {
                                         ODL_LOG("! (outChannel->writeBottle(message1, " //####
                                                 "reply))"); //####
-                                        _response.addString(MpM_FAILED_RESPONSE_);
-                                        _response.addString("Could not write to channel");
+                                        response.addString(MpM_FAILED_RESPONSE_);
+                                        response.addString("Could not write to channel");
 #if defined(MpM_StallOnSendProblem)
                                         Stall();
 #endif // defined(MpM_StallOnSendProblem)
@@ -277,9 +292,9 @@ PingRequestHandler::processRequest(const YarpString &           request,
                                 {
                                     ODL_LOG("! (outChannel->addOutputWithRetries(" //####
                                             "argAsString, STANDARD_WAIT_TIME_))"); //####
-                                    _response.addString(MpM_FAILED_RESPONSE_);
-                                    _response.addString("Could not connect to channel");
-                                    _response.addString(argAsString);
+                                    response.addString(MpM_FAILED_RESPONSE_);
+                                    response.addString("Could not connect to channel");
+                                    response.addString(argAsString);
                                 }
 #if defined(MpM_DoExplicitClose)
                                 outChannel->close();
@@ -289,8 +304,8 @@ PingRequestHandler::processRequest(const YarpString &           request,
                             {
                                 ODL_LOG("! (outChannel->openWithRetries(aName, " //####
                                         "STANDARD_WAIT_TIME_))"); //####
-                                _response.addString(MpM_FAILED_RESPONSE_);
-                                _response.addString("Channel could not be opened");
+                                response.addString(MpM_FAILED_RESPONSE_);
+                                response.addString("Channel could not be opened");
                             }
                             BaseChannel::RelinquishChannel(outChannel);
                         }
@@ -298,29 +313,30 @@ PingRequestHandler::processRequest(const YarpString &           request,
                         {
                             ODL_LOG("! (outChannel)");
                         }
+                        theService.completeRegistration(startTime);
                     }
                 }
                 else
                 {
                     ODL_LOG("! (Endpoint::CheckEndpointName(argAsString))"); //####
-                    _response.addString(MpM_FAILED_RESPONSE_);
-                    _response.addString("Invalid channel name");
+                    response.addString(MpM_FAILED_RESPONSE_);
+                    response.addString("Invalid channel name");
                 }
             }
             else
             {
                 ODL_LOG("! (argument.isString())"); //####
-                _response.addString(MpM_FAILED_RESPONSE_);
-                _response.addString("Invalid channel name");
+                response.addString(MpM_FAILED_RESPONSE_);
+                response.addString("Invalid channel name");
             }
         }
         else
         {
             ODL_LOG("! (1 == restOfInput.size())"); //####
-            _response.addString(MpM_FAILED_RESPONSE_);
-            _response.addString("Missing channel name or extra arguments to request");
+            response.addString(MpM_FAILED_RESPONSE_);
+            response.addString("Missing channel name or extra arguments to request");
         }
-        sendResponse(replyMechanism);
+        sendResponse(response, replyMechanism);
     }
     catch (...)
     {
@@ -71,7 +71,7 @@ using namespace MplusM::Registry;
 #endif // defined(__APPLE__)
 
 /*! @brief The protocol version number for the 'register' request. */
-#define REGISTER_REQUEST_VERSION_NUMBER_ "1.0"
+#define REGISTER_REQUEST_VERSION_NUMBER_ "1.2"
 
 #if defined(__APPLE__)
 # pragma mark Global constants and variables
@@ -81,6 +81,189 @@ using namespace MplusM::Registry;
 # pragma mark Local functions
 #endif // defined(__APPLE__)
 
+/*! @brief Register a service by asking it for its name and requests.
+ @param[in] theService The %Registry Service that is recording the service.
+ @param[in] channelName The service channel for the service.
+ @param[in,out] response The response to the 'register' request. */
+static void
+registerFromCallback(RegistryService &  theService,
+                     const YarpString & channelName,
+                     yarp::os::Bottle & response)
+{
+    ODL_ENTER(); //####
+    ODL_P2("theService = ", &theService, "response = ", &response); //####
+    ODL_S1s("channelName = ", channelName); //####
+    // Send a 'name' request to the channel
+    YarpString      aName = GetRandomChannelName(HIDDEN_CHANNEL_PREFIX_
+                                                 BUILD_NAME_("register_", DEFAULT_CHANNEL_ROOT_));
+    ClientChannel * outChannel = new ClientChannel;
+
+    if (outChannel)
+    {
+        if (outChannel->openWithRetries(aName, STANDARD_WAIT_TIME_))
+        {
+            if (outChannel->addOutputWithRetries(channelName, STANDARD_WAIT_TIME_))
+            {
+                yarp::os::Bottle    message1(MpM_NAME_REQUEST_);
+                yarp::os::Bottle    reply;
+                ServiceRegistration registration;
+
+                if (outChannel->writeBottle(message1, reply))
+                {
+                    if (theService.processNameResponse(channelName, ServiceResponse(reply),
+                                                       registration))
+                    {
+                        yarp::os::Bottle message2(MpM_LIST_REQUEST_);
+
+                        if (outChannel->writeBottle(message2, reply))
+                        {
+                            if (theService.processListResponse(channelName,
+                                                               ServiceResponse(reply),
+                                                               registration))
+                            {
+                                // Remember the response
+                                response.addString(MpM_OK_RESPONSE_);
+                                // If we're registering the Registry Service, we don't care about
+                                // timeouts!
+                                if (channelName != MpM_REGISTRY_ENDPOINT_NAME_)
+                                {
+                                    theService.updateCheckedTimeForChannel(channelName);
+                                }
+                            }
+                            else
+                            {
+                                ODL_LOG("! (theService.processList" //####
+                                        "Response(channelName, reply))"); //####
+                                response.addString(MpM_FAILED_RESPONSE_);
+                                response.addString("Invalid response to '"
+                                                   MpM_LIST_REQUEST_ "' request");
+                            }
+                        }
+                        else
+                        {
+                            ODL_LOG("! (outChannel->writeBottle(message2, reply))"); //####
+                            response.addString(MpM_FAILED_RESPONSE_);
+                            response.addString("Could not write to channel");
+#if defined(MpM_StallOnSendProblem)
+                            Stall();
+#endif // defined(MpM_StallOnSendProblem)
+                        }
+                    }
+                    else
+                    {
+                        ODL_LOG("! (theService.processNameResponse(channelName, " //####
+                                "reply))"); //####
+                        response.addString(MpM_FAILED_RESPONSE_);
+                        response.addString("Invalid response to '" MpM_NAME_REQUEST_ "' request");
+                    }
+                }
+                else
+                {
+                    ODL_LOG("! (outChannel->writeBottle(message1, reply))"); //####
+                    response.addString(MpM_FAILED_RESPONSE_);
+                    response.addString("Could not write to channel");
+#if defined(MpM_StallOnSendProblem)
+                    Stall();
+#endif // defined(MpM_StallOnSendProblem)
+                }
+#if defined(MpM_DoExplicitDisconnect)
+                if (! Utilities::NetworkDisconnectWithRetries(outChannel->name(), channelName,
+                                                              STANDARD_WAIT_TIME_))
+                {
+                    ODL_LOG("(! Utilities::NetworkDisconnectWithRetries(" //####
+                            "outChannel->name(), channelName, " //####
+                            "STANDARD_WAIT_TIME_))"); //####
+                }
+#endif // defined(MpM_DoExplicitDisconnect)
+            }
+            else
+            {
+                ODL_LOG("! (outChannel->addOutputWithRetries(channelName, " //####
+                        "STANDARD_WAIT_TIME_))"); //####
+                response.addString(MpM_FAILED_RESPONSE_);
+                response.addString("Could not connect to channel");
+                response.addString(channelName);
+            }
+#if defined(MpM_DoExplicitClose)
+            outChannel->close();
+#endif // defined(MpM_DoExplicitClose)
+        }
+        else
+        {
+            ODL_LOG("! (outChannel->openWithRetries(aName, STANDARD_WAIT_TIME_))"); //####
+            response.addString(MpM_FAILED_RESPONSE_);
+            response.addString("Channel could not be opened");
+        }
+        BaseChannel::RelinquishChannel(outChannel);
+    }
+    else
+    {
+        ODL_LOG("! (outChannel)"); //####
+    }
+
+    ODL_EXIT(); //####
+} // registerFromCallback
+
+/*! @brief Register a service from the description that it provided with the 'register' request.
+ @param[in] theService The %Registry Service that is recording the service.
+ @param[in] channelName The service channel for the service.
+ @param[in] nameValue The response that the service would give to a 'name' request.
+ @param[in] listValue The response that the service would give to a 'list' request.
+ @param[in,out] response The response to the 'register' request. */
+static void
+registerFromDescription(RegistryService &       theService,
+                        const YarpString &      channelName,
+                        const yarp::os::Value & nameValue,
+                        const yarp::os::Value & listValue,
+                        yarp::os::Bottle &      response)
+{
+    ODL_ENTER(); //####
+    ODL_P4("theService = ", &theService, "nameValue = ", &nameValue, "listValue = ", //####
+           &listValue, "response = ", &response); //####
+    ODL_S1s("channelName = ", channelName); //####
+    if (nameValue.isList() && listValue.isList())
+    {
+        ServiceRegistration registration;
+
+        if (theService.processNameResponse(channelName, ServiceResponse(*nameValue.asList()),
+                                           registration))
+        {
+            if (theService.processListResponse(channelName, ServiceResponse(*listValue.asList()),
+                                               registration))
+            {
+                // Remember the response
+                response.addString(MpM_OK_RESPONSE_);
+                // If we're registering the Registry Service, we don't care about timeouts!
+                if (channelName != MpM_REGISTRY_ENDPOINT_NAME_)
+                {
+                    theService.updateCheckedTimeForChannel(channelName);
+                }
+            }
+            else
+            {
+                ODL_LOG("! (theService.processListResponse(channelName, " //####
+                        "ServiceResponse(*listValue.asList()), registration))"); //####
+                response.addString(MpM_FAILED_RESPONSE_);
+                response.addString("Invalid description of requests");
+            }
+        }
+        else
+        {
+            ODL_LOG("! (theService.processNameResponse(channelName, " //####
+                    "ServiceResponse(*nameValue.asList()), registration))"); //####
+            response.addString(MpM_FAILED_RESPONSE_);
+            response.addString("Invalid description of service");
+        }
+    }
+    else
+    {
+        ODL_LOG("! (nameValue.isList() && listValue.isList())"); //####
+        response.addString(MpM_FAILED_RESPONSE_);
+        response.addString("Invalid service description");
+    }
+    ODL_EXIT(); //####
+} // registerFromDescription
+
 #if defined(__APPLE__)
 # pragma mark Class methods
 #endif // defined(__APPLE__)
@@ -126,13 +309,20 @@ RegisterRequestHandler::fillInDescription(const YarpString &   request,
     try
     {
         info.put(MpM_REQREP_DICT_REQUEST_KEY_, request);
-        info.put(MpM_REQREP_DICT_INPUT_KEY_, MpM_REQREP_STRING_);
+        info.put(MpM_REQREP_DICT_INPUT_KEY_, MpM_REQREP_STRING_ MpM_REQREP_LIST_START_
+                 MpM_REQREP_STRING_ MpM_REQREP_1_OR_MORE_ MpM_REQREP_LIST_END_
+                 MpM_REQREP_0_OR_1_ MpM_REQREP_LIST_START_ MpM_REQREP_DICT_START_
+                 MpM_REQREP_DICT_END_ MpM_REQREP_1_OR_MORE_ MpM_REQREP_LIST_END_
+                 MpM_REQREP_0_OR_1_);
         info.put(MpM_REQREP_DICT_OUTPUT_KEY_, MpM_REQREP_STRING_);
         info.put(MpM_REQREP_DICT_VERSION_KEY_, REGISTER_REQUEST_VERSION_NUMBER_);
         info.put(MpM_REQREP_DICT_DETAILS_KEY_, T_("Register the service and its requests\n"
-                                                  "Input: the channel used by the service\n"
+                                                  "Input: the channel used by the service, "
+                                                  "optionally followed by the responses of the "
+                                                  "service to the 'name' and 'list' requests\n"
                                                   "Output: OK or FAILED, with a description of the "
-                                                  "problem encountered"));
+                                                  "problem encountered, or BUSY, with the number "
+                                                  "of seconds to wait before trying again"));
         yarp::os::Value    keywords;
         yarp::os::Bottle * asList = keywords.asList();
 
@@ -156,7 +346,8 @@ bool
 RegisterRequestHandler::processRequest(const YarpString &           request,
                                        const yarp::os::Bottle &     restOfInput,
                                        const YarpString &           senderChannel,
-                                       yarp::os::ConnectionWriter * replyMechanism)
+                                       yarp::os::ConnectionWriter * replyMechanism,
+                                       yarp::os::Bottle &           response)
 {
 #if (! defined(ODL_ENABLE_LOGGING_))
 # if MAC_OR_LINUX_
@@ -166,14 +357,13 @@ RegisterRequestHandler::processRequest(const YarpString &           request,
     ODL_OBJENTER(); //####
     ODL_S3s("request = ", request, "restOfInput = ", restOfInput.toString(), //####
             "senderChannel = ", senderChannel); //####
-    ODL_P1("replyMechanism = ", replyMechanism); //####
+    ODL_P2("replyMechanism = ", replyMechanism, "response = ", &response); //####
     bool result = true;
 
     try
     {
         // Validate the name as a channel name
-        _response.clear();
-        if (1 == restOfInput.size())
+        if ((1 == restOfInput.size()) || (3 == restOfInput.size()))
         {
             yarp::os::Value argument(restOfInput.get(0));
 
@@ -184,142 +374,56 @@ RegisterRequestHandler::processRequest(const YarpString &           request,
                 if (Endpoint::CheckEndpointName(argAsString))
                 {
                     RegistryService & theService = static_cast<RegistryService &>(_service);
+                    double            retryAfter;
 
-                    theService.reportStatusChange(argAsString,
-                                                  RegistryService::kRegistryRegisterService);
-                    // Send a 'name' request to the channel
-                    YarpString      aName = GetRandomChannelName(HIDDEN_CHANNEL_PREFIX_
-                                                                 BUILD_NAME_("register_",
-                                                                          DEFAULT_CHANNEL_ROOT_));
-                    ClientChannel * outChannel = new ClientChannel;
-
-                    if (outChannel)
+                    if (theService.admitRegistration(retryAfter))
                     {
-                        if (outChannel->openWithRetries(aName, STANDARD_WAIT_TIME_))
-                        {
-                            if (outChannel->addOutputWithRetries(argAsString,
-                                                                 STANDARD_WAIT_TIME_))
-                            {
-                                yarp::os::Bottle message1(MpM_NAME_REQUEST_);
-                                yarp::os::Bottle reply;
+                        double startTime = yarp::os::Time::now();
 
-                                if (outChannel->writeBottle(message1, reply))
-                                {
-                                    if (theService.processNameResponse(argAsString,
-                                                                       ServiceResponse(reply)))
-                                    {
-                                        yarp::os::Bottle message2(MpM_LIST_REQUEST_);
-
-                                        if (outChannel->writeBottle(message2, reply))
-                                        {
-                                            if (theService.processListResponse(argAsString,
-                                                                           ServiceResponse(reply)))
-                                            {
-                                                // Remember the response
-                                                _response.addString(MpM_OK_RESPONSE_);
-                                                // If we're registering the Registry Service, we
-                                                // don't care about timeouts!
-                                                if (argAsString != MpM_REGISTRY_ENDPOINT_NAME_)
-                                                {
-                                                theService.updateCheckedTimeForChannel(argAsString);
-                                                }
-                                            }
-                                            else
-                                            {
-                                                ODL_LOG("! (theService.processList" //####
-                                                        "Response(argAsString, reply))"); //####
-                                                _response.addString(MpM_FAILED_RESPONSE_);
-                                                _response.addString("Invalid response to '"
-                                                                    MpM_LIST_REQUEST_ "' request");
-                                            }
-                                        }
-                                        else
-                                        {
-                                            ODL_LOG("! (outChannel->writeBottle(message2, " //####
-                                                    "reply))"); //####
-                                            _response.addString(MpM_FAILED_RESPONSE_);
-                                            _response.addString("Could not write to channel");
-#if defined(MpM_StallOnSendProblem)
-                                            Stall();
-#endif // defined(MpM_StallOnSendProblem)
-                                        }
-                                    }
-                                    else
-                                    {
-                                        ODL_LOG("! (theService.processNameResponse(" //####
-                                                "argAsString, reply))"); //####
-                                        _response.addString(MpM_FAILED_RESPONSE_);
-                                        _response.addString("Invalid response to '"
-                                                            MpM_NAME_REQUEST_ "' request");
-                                    }
-                                }
-                                else
-                                {
-                                    ODL_LOG("! (outChannel->writeBottle(message1, reply))"); //####
-                                    _response.addString(MpM_FAILED_RESPONSE_);
-                                    _response.addString("Could not write to channel");
-#if defined(MpM_StallOnSendProblem)
-                                    Stall();
-#endif // defined(MpM_StallOnSendProblem)
-                                }
-#if defined(MpM_DoExplicitDisconnect)
-                                if (! Utilities::NetworkDisconnectWithRetries(outChannel->name(),
-                                                                              argAsString,
-                                                                              STANDARD_WAIT_TIME_))
-                                {
-                                    ODL_LOG("(! Utilities::NetworkDisconnectWithRetries(" //####
-                                            "outChannel->name(), argAsString, " //####
-                                            "STANDARD_WAIT_TIME_))"); //####
-                                }
-#endif // defined(MpM_DoExplicitDisconnect)
-                            }
-                            else
-                            {
-                                ODL_LOG("! (outChannel->addOutputWithRetries(" //####
-                                        "argAsString, STANDARD_WAIT_TIME_))"); //####
-                                _response.addString(MpM_FAILED_RESPONSE_);
-                                _response.addString("Could not connect to channel");
-                                _response.addString(argAsString);
-                            }
-#if defined(MpM_DoExplicitClose)
-                            outChannel->close();
-#endif // defined(MpM_DoExplicitClose)
+                        theService.reportStatusChange(argAsString,
+                                                      RegistryService::kRegistryRegisterService);
+                        if (3 == restOfInput.size())
+                        {
+                            // The service has described itself, so it doesn't need to be asked.
+                            registerFromDescription(theService, argAsString, restOfInput.get(1),
+                                                    restOfInput.get(2), response);
                         }
                         else
                         {
-                            ODL_LOG("! (outChannel->openWithRetries(aName, " //####
-                                    "STANDARD_WAIT_TIME_))"); //####
-                            _response.addString(MpM_FAILED_RESPONSE_);
-                            _response.addString("Channel could not be opened");
+                            registerFromCallback(theService, argAsString, response);
                         }
-                        BaseChannel::RelinquishChannel(outChannel);
+                        theService.completeRegistration(startTime);
                     }
                     else
                     {
-                        ODL_LOG("! (outChannel)");
+                        // Too many registrations are in progress, so have the service try again
+                        // later rather than letting it time out.
+                        ODL_LOG("! (theService.admitRegistration(retryAfter))"); //####
+                        response.addString(MpM_BUSY_RESPONSE_);
+                        response.addDouble(retryAfter);
                     }
                 }
                 else
                 {
                     ODL_LOG("! (Endpoint::CheckEndpointName(argAsString))"); //####
-                    _response.addString(MpM_FAILED_RESPONSE_);
-                    _response.addString("Invalid channel name");
+                    response.addString(MpM_FAILED_RESPONSE_);
+                    response.addString("Invalid channel name");
                 }
             }
             else
             {
                 ODL_LOG("! (argument.isString())"); //####
-                _response.addString(MpM_FAILED_RESPONSE_);
-                _response.addString("Invalid channel name");
+                response.addString(MpM_FAILED_RESPONSE_);
+                response.addString("Invalid channel name");
             }
         }
         else
         {
-            ODL_LOG("! (1 == restOfInput.size())"); //####
-            _response.addString(MpM_FAILED_RESPONSE_);
-            _response.addString("Missing channel name or extra arguments to request");
+            ODL_LOG("! ((1 == restOfInput.size()) || (3 == restOfInput.size()))"); //####
+            response.addString(MpM_FAILED_RESPONSE_);
+            response.addString("Missing channel name or extra arguments to request");
         }
-        sendResponse(replyMechanism);
+        sendResponse(response, replyMechanism);
     }
     catch (...)
     {
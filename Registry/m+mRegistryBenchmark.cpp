@@ -0,0 +1,492 @@
+//--------------------------------------------------------------------------------------------------
+//
+//  File:       Registry/m+mRegistryBenchmark.cpp
+//
+//  Project:    m+m
+//
+//  Contains:   A load-generating benchmark for the Registry Service.
+//
+//  Written by: Norman Jaffe
+//
+//  Copyright:  (c) 2026 by OpenDragon.
+//
+//
+//              All rights reserved. Redistribution and use in source and binary forms, with or
+//              without modification, are permitted provided that the following conditions are met:
+//                * Redistributions of source code must retain the above copyright notice, this list
+//                  of conditions and the following disclaimer.
+//                * Redistributions in binary form must reproduce the above copyright notice, this
+//                  list of conditions and the following disclaimer in the documentation and / or
+//                  other materials provided with the distribution.
+//                * Neither the name of the copyright holders nor the names of its contributors may
+//                  be used to endorse or promote products derived from this software without
+//                  specific prior written permission.
+//
+//              THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//              EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//              OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//              SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//              INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//              TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//              BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//              CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//              ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//              DAMAGE.
+//
+//  Created:    2026-10-17
+//
+//--------------------------------------------------------------------------------------------------
+
+#include "m+mRegistryBenchmarkThread.hpp"
+#include "m+mRegistryService.hpp"
+
+#include <m+m/m+mIntArgumentDescriptor.hpp>
+#include <m+m/m+mRequests.hpp>
+#include <m+m/m+mUtilities.hpp>
+
+#include <algorithm>
+
+//#include <odlEnable.h>
+#include <odlInclude.h>
+
+#if defined(__APPLE__)
+# pragma clang diagnostic push
+# pragma clang diagnostic ignored "-Wunknown-pragmas"
+# pragma clang diagnostic ignored "-Wdocumentation-unknown-command"
+#endif // defined(__APPLE__)
+/*! @file
+ @brief A load-generating benchmark for the m+m %Registry Service. */
+#if defined(__APPLE__)
+# pragma clang diagnostic pop
+#endif // defined(__APPLE__)
+
+#if defined(__APPLE__)
+# pragma mark Namespace references
+#endif // defined(__APPLE__)
+
+using namespace MplusM;
+using namespace MplusM::Common;
+using namespace MplusM::Registry;
+using std::cerr;
+using std::cout;
+using std::endl;
+
+#if defined(__APPLE__)
+# pragma mark Private structures, constants and variables
+#endif // defined(__APPLE__)
+
+/*! @brief The accumulated results for one kind of request. */
+struct BenchmarkResult
+{
+    /*! @brief The latencies of the successful requests, in seconds. */
+    RegistryBenchmarkThread::LatencyVector _latencies;
+
+    /*! @brief The elapsed time for the phase that issued the requests, in seconds. */
+    double _elapsedTime;
+
+    /*! @brief The number of requests that failed. */
+    int _failures;
+
+}; // BenchmarkResult
+
+/*! @brief The description of the benchmark. */
+#define REGISTRY_BENCHMARK_DESCRIPTION_ T_("Measure the throughput and latency of the " \
+                                           "Registry Service")
+
+#if defined(__APPLE__)
+# pragma mark Global constants and variables
+#endif // defined(__APPLE__)
+
+#if defined(__APPLE__)
+# pragma mark Local functions
+#endif // defined(__APPLE__)
+
+/*! @brief Return a latency at a given fraction of the sorted latencies.
+ @param[in] latencies The sorted latencies.
+ @param[in] fraction The position within the latencies, from @c 0 to @c 1.
+ @return The latency at the given position, in milliseconds. */
+static double
+getPercentile(const RegistryBenchmarkThread::LatencyVector & latencies,
+              const double                                   fraction)
+{
+    ODL_ENTER(); //####
+    ODL_P1("latencies = ", &latencies); //####
+    ODL_D1("fraction = ", fraction); //####
+    double result = 0;
+    size_t howMany = latencies.size();
+
+    if (0 < howMany)
+    {
+        size_t index = static_cast<size_t>(fraction * howMany);
+
+        if (howMany <= index)
+        {
+            index = howMany - 1;
+        }
+        result = latencies[index] * 1000.0;
+    }
+    ODL_EXIT_D(result); //####
+    return result;
+} // getPercentile
+
+/*! @brief Report the results for one kind of request.
+ @param[in] flavour The format for the output.
+ @param[in] requestName The name of the kind of request.
+ @param[in] result The results for the kind of request.
+ @param[in] isFirst @c true if this is the first kind of request being reported and @c false
+ otherwise. */
+static void
+reportResult(const OutputFlavour     flavour,
+             const char *            requestName,
+             const BenchmarkResult & result,
+             const bool              isFirst)
+{
+    ODL_ENTER(); //####
+    ODL_S1("requestName = ", requestName); //####
+    ODL_P1("result = ", &result); //####
+    ODL_B1("isFirst = ", isFirst); //####
+    size_t howMany = result._latencies.size();
+    double throughput;
+    double p50 = getPercentile(result._latencies, 0.5);
+    double p99 = getPercentile(result._latencies, 0.99);
+    double p999 = getPercentile(result._latencies, 0.999);
+
+    if (0 < result._elapsedTime)
+    {
+        throughput = howMany / result._elapsedTime;
+    }
+    else
+    {
+        throughput = 0;
+    }
+    switch (flavour)
+    {
+        case kOutputFlavourTabs :
+            cout << requestName << "\t" << howMany << "\t" << result._failures << "\t" <<
+                    throughput << "\t" << p50 << "\t" << p99 << "\t" << p999 << endl;
+            break;
+
+        case kOutputFlavourJSON :
+            if (! isFirst)
+            {
+                cout << "," << endl;
+            }
+            cout << T_("{ " CHAR_DOUBLEQUOTE_ "Request" CHAR_DOUBLEQUOTE_ ": " CHAR_DOUBLEQUOTE_) <<
+                    requestName << T_(CHAR_DOUBLEQUOTE_ ", " CHAR_DOUBLEQUOTE_ "Count"
+                                      CHAR_DOUBLEQUOTE_ ": ") << howMany <<
+                    T_(", " CHAR_DOUBLEQUOTE_ "Failures" CHAR_DOUBLEQUOTE_ ": ") <<
+                    result._failures << T_(", " CHAR_DOUBLEQUOTE_ "Throughput" CHAR_DOUBLEQUOTE_
+                                           ": ") << throughput <<
+                    T_(", " CHAR_DOUBLEQUOTE_ "P50" CHAR_DOUBLEQUOTE_ ": ") << p50 <<
+                    T_(", " CHAR_DOUBLEQUOTE_ "P99" CHAR_DOUBLEQUOTE_ ": ") << p99 <<
+                    T_(", " CHAR_DOUBLEQUOTE_ "P999" CHAR_DOUBLEQUOTE_ ": ") << p999 << " }";
+            break;
+
+        case kOutputFlavourNormal :
+            cout << "Request:    " << requestName << endl;
+            cout << "Count:      " << howMany << endl;
+            cout << "Failures:   " << result._failures << endl;
+            cout << "Throughput: " << throughput << " requests/second" << endl;
+            cout << "Latency:    p50 " << p50 << " ms, p99 " << p99 << " ms, p99.9 " << p999 <<
+                    " ms" << endl << endl;
+            break;
+
+        default :
+            break;
+
+    }
+    ODL_EXIT(); //####
+} // reportResult
+
+/*! @brief Run one phase of the benchmark.
+ @param[in] service The %Registry Service being measured.
+ @param[in] phase The phase to be run.
+ @param[in] serviceChannels The names of the simulated services.
+ @param[in] threadCount The number of load-generating threads.
+ @param[in] pingsPerService The number of 'ping' requests to send for each service.
+ @param[in] matchesPerService The number of 'match' requests to send for each service.
+ @param[in,out] results The accumulated results, indexed by the kind of request.
+ @return @c true if all the threads were started and @c false otherwise. */
+static bool
+runPhase(RegistryService &                             service,
+         const RegistryBenchmarkThread::BenchmarkPhase phase,
+         const YarpStringVector &                      serviceChannels,
+         const size_t                                  threadCount,
+         const int                                     pingsPerService,
+         const int                                     matchesPerService,
+         BenchmarkResult *                             results)
+{
+    ODL_ENTER(); //####
+    ODL_P3("service = ", &service, "serviceChannels = ", &serviceChannels, //####
+           "results = ", results); //####
+    ODL_I4("phase = ", phase, "threadCount = ", threadCount, "pingsPerService = ", //####
+           pingsPerService, "matchesPerService = ", matchesPerService); //####
+    bool                                   okSoFar = true;
+    double                                 startTime = yarp::os::Time::now();
+    std::vector<RegistryBenchmarkThread *> threads;
+
+    for (size_t ii = 0; threadCount > ii; ++ii)
+    {
+        RegistryBenchmarkThread * aThread = new RegistryBenchmarkThread(service, phase,
+                                                                        serviceChannels, ii,
+                                                                        threadCount,
+                                                                        pingsPerService,
+                                                                        matchesPerService);
+
+        if (aThread->start())
+        {
+            threads.push_back(aThread);
+        }
+        else
+        {
+            ODL_LOG("! (aThread->start())"); //####
+            delete aThread;
+            okSoFar = false;
+        }
+    }
+    for (size_t ii = 0, mm = threads.size(); mm > ii; ++ii)
+    {
+        threads[ii]->join();
+    }
+    double elapsedTime = yarp::os::Time::now() - startTime;
+
+    for (size_t ii = 0, mm = threads.size(); mm > ii; ++ii)
+    {
+        RegistryBenchmarkThread * aThread = threads[ii];
+
+        for (int jj = 0; RegistryBenchmarkThread::kBenchmarkRequestCount > jj; ++jj)
+        {
+            RegistryBenchmarkThread::BenchmarkRequest      which =
+                                    static_cast<RegistryBenchmarkThread::BenchmarkRequest>(jj);
+            const RegistryBenchmarkThread::LatencyVector & latencies = aThread->latencies(which);
+
+            results[jj]._latencies.insert(results[jj]._latencies.end(), latencies.begin(),
+                                          latencies.end());
+            results[jj]._failures += aThread->failureCount(which);
+        }
+        delete aThread;
+    }
+    switch (phase)
+    {
+        case RegistryBenchmarkThread::kBenchmarkPhaseRegister :
+            results[RegistryBenchmarkThread::kBenchmarkRequestRegister]._elapsedTime = elapsedTime;
+            break;
+
+        case RegistryBenchmarkThread::kBenchmarkPhaseTraffic :
+            // The 'ping' and 'match' requests are interleaved, so they share the elapsed time.
+            results[RegistryBenchmarkThread::kBenchmarkRequestPing]._elapsedTime = elapsedTime;
+            results[RegistryBenchmarkThread::kBenchmarkRequestMatch]._elapsedTime = elapsedTime;
+            break;
+
+        case RegistryBenchmarkThread::kBenchmarkPhaseUnregister :
+            results[RegistryBenchmarkThread::kBenchmarkRequestUnregister]._elapsedTime =
+                                                                                    elapsedTime;
+            break;
+
+        default :
+            break;
+
+    }
+    ODL_EXIT_B(okSoFar); //####
+    return okSoFar;
+} // runPhase
+
+/*! @brief Set up the environment and perform the operation.
+ @param[in] progName The path to the executable.
+ @param[in] argc The number of arguments in 'argv'.
+ @param[in] argv The arguments to be used with the %Registry service.
+ @param[in] flavour The format for the output.
+ @param[in] serviceCount The number of simulated services.
+ @param[in] threadCount The number of load-generating threads.
+ @param[in] pingsPerService The number of 'ping' requests to send for each service.
+ @param[in] matchesPerService The number of 'match' requests to send for each service. */
+static void
+setUpAndGo(const YarpString &  progName,
+           const int           argc,
+           char * *            argv,
+           const OutputFlavour flavour,
+           const int           serviceCount,
+           const int           threadCount,
+           const int           pingsPerService,
+           const int           matchesPerService)
+{
+    ODL_ENTER(); //####
+    ODL_S1s("progName = ", progName); //####
+    ODL_I4("argc = ", argc, "serviceCount = ", serviceCount, "threadCount = ", //####
+           threadCount, "pingsPerService = ", pingsPerService); //####
+    ODL_I1("matchesPerService = ", matchesPerService); //####
+    ODL_P1("argv = ", argv); //####
+    // The benchmark uses an in-memory database, so that the measurements are not affected by
+    // the speed of the disk.
+    RegistryService * aService = new RegistryService(progName, argc, argv, true);
+
+    if (aService)
+    {
+        if (aService->startService())
+        {
+            BenchmarkResult  results[RegistryBenchmarkThread::kBenchmarkRequestCount];
+            YarpStringVector serviceChannels;
+
+            for (int ii = 0; RegistryBenchmarkThread::kBenchmarkRequestCount > ii; ++ii)
+            {
+                results[ii]._elapsedTime = 0;
+                results[ii]._failures = 0;
+            }
+            for (int ii = 0; serviceCount > ii; ++ii)
+            {
+                std::stringstream buff;
+
+                buff << ii;
+                serviceChannels.push_back(BUILD_NAME_(MpM_SERVICE_BASE_NAME_, "benchmark") +
+                                          YarpString("/") + buff.str());
+            }
+            if (runPhase(*aService, RegistryBenchmarkThread::kBenchmarkPhaseRegister,
+                         serviceChannels, threadCount, pingsPerService, matchesPerService,
+                         results) &&
+                runPhase(*aService, RegistryBenchmarkThread::kBenchmarkPhaseTraffic,
+                         serviceChannels, threadCount, pingsPerService, matchesPerService,
+                         results) &&
+                runPhase(*aService, RegistryBenchmarkThread::kBenchmarkPhaseUnregister,
+                         serviceChannels, threadCount, pingsPerService, matchesPerService,
+                         results))
+            {
+                static const char * requestNames[RegistryBenchmarkThread::kBenchmarkRequestCount] =
+                {
+                    MpM_REGISTER_REQUEST_, MpM_PING_REQUEST_, MpM_MATCH_REQUEST_,
+                    MpM_UNREGISTER_REQUEST_
+                };
+
+                switch (flavour)
+                {
+                    case kOutputFlavourJSON :
+                        cout << "[ ";
+                        break;
+
+                    case kOutputFlavourTabs :
+                        break;
+
+                    default :
+                        cout << serviceCount << " services, " << threadCount << " threads." <<
+                                endl << endl;
+                        break;
+
+                }
+                for (int ii = 0; RegistryBenchmarkThread::kBenchmarkRequestCount > ii; ++ii)
+                {
+                    std::sort(results[ii]._latencies.begin(), results[ii]._latencies.end());
+                    reportResult(flavour, requestNames[ii], results[ii], 0 == ii);
+                }
+                if (kOutputFlavourJSON == flavour)
+                {
+                    cout << " ]" << endl;
+                }
+            }
+            else
+            {
+                ODL_LOG("! (runPhase(...))"); //####
+                MpM_FAIL_("Could not start the load-generating threads.");
+            }
+            aService->stopService();
+        }
+        else
+        {
+            ODL_LOG("! (aService->startService())"); //####
+            MpM_FAIL_("Could not start the Registry Service.");
+        }
+        delete aService;
+    }
+    else
+    {
+        ODL_LOG("! (aService)"); //####
+    }
+    ODL_EXIT(); //####
+} // setUpAndGo
+
+#if defined(__APPLE__)
+# pragma mark Global functions
+#endif // defined(__APPLE__)
+
+/*! @brief The entry point for the %Registry Service benchmark.
+
+ The optional arguments are the number of simulated services, the number of load-generating threads,
+ the number of 'ping' requests for each service and the number of 'match' requests for each
+ service. The simulated services are registered, sent the 'ping' and 'match' requests and then
+ unregistered, with the throughput and latency percentiles of each kind of request being reported.
+ @param[in] argc The number of arguments in 'argv'.
+ @param[in] argv The arguments to be used with the benchmark.
+ @return @c 0 on a successful benchmark and @c 1 on failure. */
+int
+main(int      argc,
+     char * * argv)
+{
+    YarpString progName(*argv);
+
+    ODL_INIT(progName.c_str(), kODLoggingOptionIncludeProcessID | //####
+             kODLoggingOptionIncludeThreadID | kODLoggingOptionEnableThreadSupport | //####
+             kODLoggingOptionWriteToStderr); //####
+    ODL_ENTER(); //####
+#if MAC_OR_LINUX_
+    SetUpLogger(progName);
+#endif // MAC_OR_LINUX_
+    try
+    {
+        Utilities::IntArgumentDescriptor firstArg("services", T_("Number of simulated services"),
+                                                  Utilities::kArgModeOptional, 1000, true, 1,
+                                                  false, 0);
+        Utilities::IntArgumentDescriptor secondArg("threads",
+                                                   T_("Number of load-generating threads"),
+                                                   Utilities::kArgModeOptional, 8, true, 1, false,
+                                                   0);
+        Utilities::IntArgumentDescriptor thirdArg("pings", T_("Number of pings per service"),
+                                                  Utilities::kArgModeOptional, 5, true, 0, false,
+                                                  0);
+        Utilities::IntArgumentDescriptor fourthArg("matches", T_("Number of matches per service"),
+                                                   Utilities::kArgModeOptional, 2, true, 0, false,
+                                                   0);
+        Utilities::DescriptorVector      argumentList;
+        OutputFlavour                    flavour;
+
+        argumentList.push_back(&firstArg);
+        argumentList.push_back(&secondArg);
+        argumentList.push_back(&thirdArg);
+        argumentList.push_back(&fourthArg);
+        if (Utilities::ProcessStandardUtilitiesOptions(argc, argv, argumentList,
+                                                       REGISTRY_BENCHMARK_DESCRIPTION_, 2026,
+                                                       STANDARD_COPYRIGHT_NAME_, flavour))
+        {
+            Utilities::SetUpGlobalStatusReporter();
+            Utilities::CheckForNameServerReporter();
+            if (Utilities::CheckForValidNetwork())
+            {
+                yarp::os::Network yarp; // This is necessary to establish any connections to the
+                                        // YARP infrastructure
+
+                Initialize(progName);
+                if (Utilities::CheckForRegistryService())
+                {
+                    ODL_LOG("Utilities::CheckForRegistryService()"); //####
+                    MpM_FAIL_("Registry Service already running.");
+                }
+                else
+                {
+                    setUpAndGo(progName, argc, argv, flavour, firstArg.getCurrentValue(),
+                               secondArg.getCurrentValue(), thirdArg.getCurrentValue(),
+                               fourthArg.getCurrentValue());
+                }
+            }
+            else
+            {
+                ODL_LOG("! (Utilities::CheckForValidNetwork())"); //####
+                MpM_FAIL_(MSG_YARP_NOT_RUNNING);
+            }
+            Utilities::ShutDownGlobalStatusReporter();
+        }
+    }
+    catch (...)
+    {
+        ODL_LOG("Exception caught"); //####
+    }
+    yarp::os::Network::fini();
+    ODL_EXIT_I(0); //####
+    return 0;
+} // main
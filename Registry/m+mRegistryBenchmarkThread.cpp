@@ -0,0 +1,421 @@
+//--------------------------------------------------------------------------------------------------
+//
+//  File:       Registry/m+mRegistryBenchmarkThread.cpp
+//
+//  Project:    m+m
+//
+//  Contains:   The class definition for a load-generating thread for the registry benchmark.
+//
+//  Written by: Norman Jaffe
+//
+//  Copyright:  (c) 2026 by OpenDragon.
+//
+//
+//              All rights reserved. Redistribution and use in source and binary forms, with or
+//              without modification, are permitted provided that the following conditions are met:
+//                * Redistributions of source code must retain the above copyright notice, this list
+//                  of conditions and the following disclaimer.
+//                * Redistributions in binary form must reproduce the above copyright notice, this
+//                  list of conditions and the following disclaimer in the documentation and / or
+//                  other materials provided with the distribution.
+//                * Neither the name of the copyright holders nor the names of its contributors may
+//                  be used to endorse or promote products derived from this software without
+//                  specific prior written permission.
+//
+//              THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//              EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//              OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//              SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//              INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//              TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//              BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//              CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//              ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//              DAMAGE.
+//
+//  Created:    2026-10-17
+//
+//--------------------------------------------------------------------------------------------------
+
+#include "m+mRegistryBenchmarkThread.hpp"
+#include "m+mRegistryService.hpp"
+
+#include <m+m/m+mClientChannel.hpp>
+#include <m+m/m+mEndpoint.hpp>
+#include <m+m/m+mRequests.hpp>
+#include <m+m/m+mServiceRequest.hpp>
+#include <m+m/m+mServiceResponse.hpp>
+#include <m+m/m+mUtilities.hpp>
+
+//#include <odlEnable.h>
+#include <odlInclude.h>
+
+#if defined(__APPLE__)
+# pragma clang diagnostic push
+# pragma clang diagnostic ignored "-Wunknown-pragmas"
+# pragma clang diagnostic ignored "-Wdocumentation-unknown-command"
+#endif // defined(__APPLE__)
+/*! @file
+ @brief The class definition for a load-generating thread for the %Registry Service benchmark. */
+#if defined(__APPLE__)
+# pragma clang diagnostic pop
+#endif // defined(__APPLE__)
+
+#if defined(__APPLE__)
+# pragma mark Namespace references
+#endif // defined(__APPLE__)
+
+using namespace MplusM;
+using namespace MplusM::Common;
+using namespace MplusM::Registry;
+
+#if defined(__APPLE__)
+# pragma mark Private structures, constants and variables
+#endif // defined(__APPLE__)
+
+/*! @brief The number of groups that the simulated services are divided into, so that a 'match'
+ request returns more than one service. */
+#define BENCHMARK_GROUP_COUNT_ 16
+
+#if defined(__APPLE__)
+# pragma mark Global constants and variables
+#endif // defined(__APPLE__)
+
+#if defined(__APPLE__)
+# pragma mark Local functions
+#endif // defined(__APPLE__)
+
+/*! @brief Return the keyword that identifies the group of a simulated service.
+ @param[in] serviceIndex The position of the service among all the simulated services.
+ @return The keyword for the group of the service. */
+static YarpString
+groupKeyword(const size_t serviceIndex)
+{
+    std::stringstream buff;
+
+    buff << "group_" << (serviceIndex % BENCHMARK_GROUP_COUNT_);
+    return buff.str();
+} // groupKeyword
+
+/*! @brief Fill in the response that a simulated service would give to a 'list' request.
+ @param[in] serviceIndex The position of the service among all the simulated services.
+ @param[in,out] response The response to be filled in. */
+static void
+fillInListResponse(const size_t       serviceIndex,
+                   yarp::os::Bottle & response)
+{
+    ODL_ENTER(); //####
+    ODL_I1("serviceIndex = ", serviceIndex); //####
+    ODL_P1("response = ", &response); //####
+    static const char * requestNames[] =
+    {
+        "benchmark_echo", "benchmark_reset", "benchmark_status"
+    };
+    static const size_t numRequests = (sizeof(requestNames) / sizeof(*requestNames));
+
+    for (size_t ii = 0; numRequests > ii; ++ii)
+    {
+        yarp::os::Property & info = response.addDict();
+        yarp::os::Value      keywords;
+        yarp::os::Bottle *   asList = keywords.asList();
+
+        info.put(MpM_REQREP_DICT_REQUEST_KEY_, requestNames[ii]);
+        info.put(MpM_REQREP_DICT_INPUT_KEY_, MpM_REQREP_ANYTHING_ MpM_REQREP_0_OR_MORE_);
+        info.put(MpM_REQREP_DICT_OUTPUT_KEY_, MpM_REQREP_ANYTHING_ MpM_REQREP_0_OR_MORE_);
+        info.put(MpM_REQREP_DICT_VERSION_KEY_, "1.0");
+        info.put(MpM_REQREP_DICT_DETAILS_KEY_, "A request of a simulated service");
+        asList->addString(requestNames[ii]);
+        asList->addString("benchmark");
+        asList->addString(groupKeyword(serviceIndex));
+        info.put(MpM_REQREP_DICT_KEYWORDS_KEY_, keywords);
+    }
+    ODL_EXIT(); //####
+} // fillInListResponse
+
+/*! @brief Fill in the response that a simulated service would give to a 'name' request.
+ @param[in,out] response The response to be filled in. */
+static void
+fillInNameResponse(yarp::os::Bottle & response)
+{
+    ODL_ENTER(); //####
+    ODL_P1("response = ", &response); //####
+    response.addString("Benchmark");
+    response.addString("A simulated service for the registry benchmark");
+    response.addString("");
+    response.addString(Utilities::MapServiceKindToString(kServiceKindNormal));
+    response.addString("");
+    response.addString("benchmark_echo - echo the input\n"
+                       "benchmark_reset - do nothing\n"
+                       "benchmark_status - do nothing");
+    response.addString("");
+    ODL_EXIT(); //####
+} // fillInNameResponse
+
+/*! @brief Return the criteria used by a 'match' request for a simulated service.
+ @param[in] serviceIndex The position of the service among all the simulated services.
+ @param[in] matchIndex The position of the request among the 'match' requests for the service.
+ @return The criteria for the 'match' request. */
+static YarpString
+matchCriteria(const size_t serviceIndex,
+              const int    matchIndex)
+{
+    YarpString result;
+
+    // Alternate between a keyword that is shared by a group of services and a request name
+    // that is shared by all of them.
+    if (matchIndex % 2)
+    {
+        result = "request:benchmark_status";
+    }
+    else
+    {
+        result = YarpString("keyword:") + groupKeyword(serviceIndex);
+    }
+    return result;
+} // matchCriteria
+
+#if defined(__APPLE__)
+# pragma mark Class methods
+#endif // defined(__APPLE__)
+
+#if defined(__APPLE__)
+# pragma mark Constructors and Destructors
+#endif // defined(__APPLE__)
+
+RegistryBenchmarkThread::RegistryBenchmarkThread(RegistryService &        service,
+                                                 const BenchmarkPhase     phase,
+                                                 const YarpStringVector & serviceChannels,
+                                                 const size_t             threadIndex,
+                                                 const size_t             threadCount,
+                                                 const int                pingsPerService,
+                                                 const int                matchesPerService) :
+    inherited(), _service(service), _serviceChannels(serviceChannels), _channel(NULL),
+    _threadCount(threadCount), _threadIndex(threadIndex), _phase(phase),
+    _matchesPerService(matchesPerService), _pingsPerService(pingsPerService)
+{
+    ODL_ENTER(); //####
+    ODL_P2("service = ", &service, "serviceChannels = ", &serviceChannels); //####
+    ODL_I4("phase = ", phase, "threadIndex = ", threadIndex, "threadCount = ", //####
+           threadCount, "pingsPerService = ", pingsPerService); //####
+    ODL_I1("matchesPerService = ", matchesPerService); //####
+    for (int ii = 0; kBenchmarkRequestCount > ii; ++ii)
+    {
+        _failures[ii] = 0;
+    }
+    ODL_EXIT_P(this); //####
+} // RegistryBenchmarkThread::RegistryBenchmarkThread
+
+RegistryBenchmarkThread::~RegistryBenchmarkThread(void)
+{
+    ODL_OBJENTER(); //####
+    ODL_OBJEXIT(); //####
+} // RegistryBenchmarkThread::~RegistryBenchmarkThread
+
+#if defined(__APPLE__)
+# pragma mark Actions and Accessors
+#endif // defined(__APPLE__)
+
+bool
+RegistryBenchmarkThread::doRegister(const size_t serviceIndex)
+{
+    ODL_OBJENTER(); //####
+    ODL_I1("serviceIndex = ", serviceIndex); //####
+    bool                okSoFar = false;
+    const YarpString &  channelName = _serviceChannels[serviceIndex];
+    yarp::os::Bottle    nameReply;
+    yarp::os::Bottle    listReply;
+    ServiceRegistration registration;
+
+    fillInNameResponse(nameReply);
+    fillInListResponse(serviceIndex, listReply);
+    // This follows the steps of the 'register' request, once the responses have been received.
+    if (_service.processNameResponse(channelName, ServiceResponse(nameReply), registration))
+    {
+        okSoFar = _service.processListResponse(channelName, ServiceResponse(listReply),
+                                               registration);
+        if (okSoFar)
+        {
+            _service.updateCheckedTimeForChannel(channelName);
+        }
+    }
+    ODL_OBJEXIT_B(okSoFar); //####
+    return okSoFar;
+} // RegistryBenchmarkThread::doRegister
+
+bool
+RegistryBenchmarkThread::doRequest(const char *             requestName,
+                                   const yarp::os::Bottle & parameters,
+                                   const int                expectedSize)
+{
+    ODL_OBJENTER(); //####
+    ODL_S1("requestName = ", requestName); //####
+    ODL_P1("parameters = ", &parameters); //####
+    ODL_I1("expectedSize = ", expectedSize); //####
+    bool okSoFar = false;
+
+    if (_channel)
+    {
+        ServiceRequest  request(requestName, parameters);
+        ServiceResponse response;
+
+        if (request.send(*_channel, response))
+        {
+            if (expectedSize == response.count())
+            {
+                yarp::os::Value theValue(response.element(0));
+
+                okSoFar = (theValue.isString() && (theValue.toString() == MpM_OK_RESPONSE_));
+            }
+            else
+            {
+                ODL_LOG("! (expectedSize == response.count())"); //####
+                ODL_S1s("response = ", response.asString()); //####
+            }
+        }
+        else
+        {
+            ODL_LOG("! (request.send(*_channel, response))"); //####
+        }
+    }
+    else
+    {
+        ODL_LOG("! (_channel)"); //####
+    }
+    ODL_OBJEXIT_B(okSoFar); //####
+    return okSoFar;
+} // RegistryBenchmarkThread::doRequest
+
+void
+RegistryBenchmarkThread::recordRequest(const BenchmarkRequest which,
+                                       const double           startTime,
+                                       const bool             succeeded)
+{
+    ODL_OBJENTER(); //####
+    ODL_I1("which = ", which); //####
+    ODL_D1("startTime = ", startTime); //####
+    ODL_B1("succeeded = ", succeeded); //####
+    if (succeeded)
+    {
+        _latencies[which].push_back(yarp::os::Time::now() - startTime);
+    }
+    else
+    {
+        ++_failures[which];
+    }
+    ODL_OBJEXIT(); //####
+} // RegistryBenchmarkThread::recordRequest
+
+void
+RegistryBenchmarkThread::run(void)
+{
+    ODL_OBJENTER(); //####
+    for (size_t ii = _threadIndex, mm = _serviceChannels.size(); (mm > ii) && (! isStopping());
+         ii += _threadCount)
+    {
+        const YarpString & channelName = _serviceChannels[ii];
+        yarp::os::Bottle   channelParameters;
+        double             startTime;
+
+        channelParameters.addString(channelName);
+
+        switch (_phase)
+        {
+            case kBenchmarkPhaseRegister :
+                startTime = yarp::os::Time::now();
+                recordRequest(kBenchmarkRequestRegister, startTime, doRegister(ii));
+                break;
+
+            case kBenchmarkPhaseTraffic :
+                for (int jj = 0; _pingsPerService > jj; ++jj)
+                {
+                    startTime = yarp::os::Time::now();
+                    recordRequest(kBenchmarkRequestPing, startTime,
+                                  doRequest(MpM_PING_REQUEST_, channelParameters,
+                                            MpM_EXPECTED_PING_RESPONSE_SIZE_));
+                }
+                for (int jj = 0; _matchesPerService > jj; ++jj)
+                {
+                    yarp::os::Bottle matchParameters;
+
+                    matchParameters.addInt(0);
+                    matchParameters.addString(matchCriteria(ii, jj));
+                    startTime = yarp::os::Time::now();
+                    recordRequest(kBenchmarkRequestMatch, startTime,
+                                  doRequest(MpM_MATCH_REQUEST_, matchParameters,
+                                            MpM_EXPECTED_MATCH_RESPONSE_SIZE_));
+                }
+                break;
+
+            case kBenchmarkPhaseUnregister :
+                startTime = yarp::os::Time::now();
+                recordRequest(kBenchmarkRequestUnregister, startTime,
+                              doRequest(MpM_UNREGISTER_REQUEST_, channelParameters,
+                                        MpM_EXPECTED_UNREGISTER_RESPONSE_SIZE_));
+                break;
+
+            default :
+                break;
+
+        }
+    }
+    ODL_OBJEXIT(); //####
+} // RegistryBenchmarkThread::run
+
+bool
+RegistryBenchmarkThread::threadInit(void)
+{
+    ODL_OBJENTER(); //####
+    bool result = true;
+
+    // The registration of a simulated service is performed directly, so no channel is needed.
+    if (kBenchmarkPhaseRegister != _phase)
+    {
+        YarpString aName(GetRandomChannelName(HIDDEN_CHANNEL_PREFIX_
+                                              BUILD_NAME_("benchmark_", DEFAULT_CHANNEL_ROOT_)));
+
+        result = false;
+        _channel = new ClientChannel;
+        if (_channel)
+        {
+            if (_channel->openWithRetries(aName, STANDARD_WAIT_TIME_))
+            {
+                result = _channel->addOutputWithRetries(MpM_REGISTRY_ENDPOINT_NAME_,
+                                                        STANDARD_WAIT_TIME_);
+                if (! result)
+                {
+                    ODL_LOG("! (_channel->addOutputWithRetries(MpM_REGISTRY_ENDPOINT_NAME_, " //####
+                            "STANDARD_WAIT_TIME_))"); //####
+                }
+            }
+            else
+            {
+                ODL_LOG("! (_channel->openWithRetries(aName, STANDARD_WAIT_TIME_))"); //####
+            }
+        }
+        else
+        {
+            ODL_LOG("! (_channel)"); //####
+        }
+    }
+    ODL_OBJEXIT_B(result); //####
+    return result;
+} // RegistryBenchmarkThread::threadInit
+
+void
+RegistryBenchmarkThread::threadRelease(void)
+{
+    ODL_OBJENTER(); //####
+    if (_channel)
+    {
+#if defined(MpM_DoExplicitClose)
+        _channel->close();
+#endif // defined(MpM_DoExplicitClose)
+        BaseChannel::RelinquishChannel(_channel);
+        _channel = NULL;
+    }
+    ODL_OBJEXIT(); //####
+} // RegistryBenchmarkThread::threadRelease
+
+#if defined(__APPLE__)
+# pragma mark Global functions
+#endif // defined(__APPLE__)
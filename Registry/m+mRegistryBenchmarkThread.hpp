@@ -0,0 +1,270 @@
+//--------------------------------------------------------------------------------------------------
+//
+//  File:       Registry/m+mRegistryBenchmarkThread.hpp
+//
+//  Project:    m+m
+//
+//  Contains:   The class declaration for a load-generating thread for the registry benchmark.
+//
+//  Written by: Norman Jaffe
+//
+//  Copyright:  (c) 2026 by OpenDragon.
+//
+//
+//              All rights reserved. Redistribution and use in source and binary forms, with or
+//              without modification, are permitted provided that the following conditions are met:
+//                * Redistributions of source code must retain the above copyright notice, this list
+//                  of conditions and the following disclaimer.
+//                * Redistributions in binary form must reproduce the above copyright notice, this
+//                  list of conditions and the following disclaimer in the documentation and / or
+//                  other materials provided with the distribution.
+//                * Neither the name of the copyright holders nor the names of its contributors may
+//                  be used to endorse or promote products derived from this software without
+//                  specific prior written permission.
+//
+//              THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//              EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//              OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//              SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//              INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//              TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//              BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//              CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//              ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//              DAMAGE.
+//
+//  Created:    2026-10-17
+//
+//--------------------------------------------------------------------------------------------------
+
+#if (! defined(MpMRegistryBenchmarkThread_HPP_))
+# define MpMRegistryBenchmarkThread_HPP_ /* Header guard */
+
+# include <m+m/m+mBaseThread.hpp>
+
+# if defined(__APPLE__)
+#  pragma clang diagnostic push
+#  pragma clang diagnostic ignored "-Wunknown-pragmas"
+#  pragma clang diagnostic ignored "-Wdocumentation-unknown-command"
+# endif // defined(__APPLE__)
+/*! @file
+ @brief The class declaration for a load-generating thread for the %Registry Service benchmark. */
+# if defined(__APPLE__)
+#  pragma clang diagnostic pop
+# endif // defined(__APPLE__)
+
+namespace MplusM
+{
+    namespace Common
+    {
+        class ClientChannel;
+    } // Common
+
+    namespace Registry
+    {
+        class RegistryService;
+
+        /*! @brief A thread that sends a share of the benchmark requests to the %Registry Service
+         and records how long each one took. */
+        class RegistryBenchmarkThread : public Common::BaseThread
+        {
+        public :
+
+            /*! @brief The stages of the benchmark. */
+            enum BenchmarkPhase
+            {
+                /*! @brief The services are registered. */
+                kBenchmarkPhaseRegister,
+
+                /*! @brief The services are pinged and matched. */
+                kBenchmarkPhaseTraffic,
+
+                /*! @brief The services are unregistered. */
+                kBenchmarkPhaseUnregister
+
+            }; // BenchmarkPhase
+
+            /*! @brief The kinds of request that are measured. */
+            enum BenchmarkRequest
+            {
+                /*! @brief A 'register' request. */
+                kBenchmarkRequestRegister,
+
+                /*! @brief A 'ping' request. */
+                kBenchmarkRequestPing,
+
+                /*! @brief A 'match' request. */
+                kBenchmarkRequestMatch,
+
+                /*! @brief An 'unregister' request. */
+                kBenchmarkRequestUnregister,
+
+                /*! @brief The number of kinds of request. */
+                kBenchmarkRequestCount
+
+            }; // BenchmarkRequest
+
+            /*! @brief The time taken by each request, in seconds. */
+            typedef std::vector<double> LatencyVector;
+
+        protected :
+
+        private :
+
+            /*! @brief The class that this class is derived from. */
+            typedef BaseThread inherited;
+
+        public :
+
+            /*! @brief The constructor.
+             @param[in] service The %Registry Service that is being measured.
+             @param[in] phase The phase of the benchmark that the thread performs.
+             @param[in] serviceChannels The service channels of all the simulated services.
+             @param[in] threadIndex The position of the thread among the threads for the phase;
+             the thread is responsible for every 'threadCount'th service, starting with this
+             position.
+             @param[in] threadCount The number of threads for the phase.
+             @param[in] pingsPerService The number of 'ping' requests to send for each service.
+             @param[in] matchesPerService The number of 'match' requests to send for each
+             service. */
+            RegistryBenchmarkThread(RegistryService &        service,
+                                    const BenchmarkPhase     phase,
+                                    const YarpStringVector & serviceChannels,
+                                    const size_t             threadIndex,
+                                    const size_t             threadCount,
+                                    const int                pingsPerService,
+                                    const int                matchesPerService);
+
+            /*! @brief The destructor. */
+            virtual
+            ~RegistryBenchmarkThread(void);
+
+            /*! @brief Return the number of requests of a particular kind that did not succeed.
+             @param[in] which The kind of request.
+             @return The number of requests of the given kind that did not succeed. */
+            inline int
+            failureCount(const BenchmarkRequest which)
+            const
+            {
+                return _failures[which];
+            } // failureCount
+
+            /*! @brief Return the times taken by the successful requests of a particular kind.
+             @param[in] which The kind of request.
+             @return The times taken by the successful requests of the given kind. */
+            inline const LatencyVector &
+            latencies(const BenchmarkRequest which)
+            const
+            {
+                return _latencies[which];
+            } // latencies
+
+        protected :
+
+        private :
+
+            /*! @brief The copy constructor.
+             @param[in] other The object to be copied. */
+            RegistryBenchmarkThread(const RegistryBenchmarkThread & other);
+
+            /*! @brief Register a simulated service with the %Registry Service.
+
+             The responses to the 'name' and 'list' requests that the %Registry Service would send
+             to the service are constructed locally, as the simulated service has no channel.
+             @param[in] serviceIndex The position of the simulated service among all the simulated
+             services.
+             @return @c true if the service was registered and @c false otherwise. */
+            bool
+            doRegister(const size_t serviceIndex);
+
+            /*! @brief Send a request to the %Registry Service.
+             @param[in] requestName The request to be sent.
+             @param[in] parameters The parameters for the request.
+             @param[in] expectedSize The number of values expected in the response.
+             @return @c true if the request succeeded and @c false otherwise. */
+            bool
+            doRequest(const char *             requestName,
+                      const yarp::os::Bottle & parameters,
+                      const int                expectedSize);
+
+            /*! @brief The assignment operator.
+             @param[in] other The object to be copied.
+             @return The updated object. */
+            RegistryBenchmarkThread &
+            operator =(const RegistryBenchmarkThread & other);
+
+            /*! @brief Record the time taken by a request.
+             @param[in] which The kind of request.
+             @param[in] startTime The time at which the request was started.
+             @param[in] succeeded @c true if the request succeeded and @c false otherwise. */
+            void
+            recordRequest(const BenchmarkRequest which,
+                          const double           startTime,
+                          const bool             succeeded);
+
+            /*! @brief The thread main body. */
+            virtual void
+            run(void);
+
+            /*! @brief The thread initialization method.
+             @return @c true if the thread is ready to run. */
+            virtual bool
+            threadInit(void);
+
+            /*! @brief The thread termination method. */
+            virtual void
+            threadRelease(void);
+
+        public :
+
+        protected :
+
+        private :
+
+            /*! @brief The times taken by the successful requests, by kind of request. */
+            LatencyVector _latencies[kBenchmarkRequestCount];
+
+            /*! @brief The %Registry Service that is being measured. */
+            RegistryService & _service;
+
+            /*! @brief The service channels of all the simulated services. */
+            const YarpStringVector & _serviceChannels;
+
+            /*! @brief The channel used to send requests to the %Registry Service. */
+            Common::ClientChannel * _channel;
+
+            /*! @brief The number of threads for the phase. */
+            size_t _threadCount;
+
+            /*! @brief The position of the thread among the threads for the phase. */
+            size_t _threadIndex;
+
+            /*! @brief The phase of the benchmark that the thread performs. */
+            BenchmarkPhase _phase;
+
+            /*! @brief The number of requests that did not succeed, by kind of request. */
+            int _failures[kBenchmarkRequestCount];
+
+            /*! @brief The number of 'match' requests to send for each service. */
+            int _matchesPerService;
+
+            /*! @brief The number of 'ping' requests to send for each service. */
+            int _pingsPerService;
+
+# if defined(__APPLE__)
+#  pragma clang diagnostic push
+#  pragma clang diagnostic ignored "-Wunused-private-field"
+# endif // defined(__APPLE__)
+            /*! @brief Filler to pad to alignment boundary */
+            char _filler[4];
+# if defined(__APPLE__)
+#  pragma clang diagnostic pop
+# endif // defined(__APPLE__)
+
+        }; // RegistryBenchmarkThread
+
+    } // Registry
+
+} // MplusM
+
+#endif // ! defined(MpMRegistryBenchmarkThread_HPP_)
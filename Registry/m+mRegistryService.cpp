@@ -37,7 +37,9 @@
 //--------------------------------------------------------------------------------------------------
 
 #include "m+mRegistryService.hpp"
+#include "m+mChangesRequestHandler.hpp"
 #include "m+mColumnNameValidator.hpp"
+#include "m+mMatchIndex.hpp"
 #include "m+mMatchRequestHandler.hpp"
 #include "m+mPingRequestHandler.hpp"
 #include "m+mRegisterRequestHandler.hpp"
@@ -52,6 +54,30 @@
 //#include <odlEnable.h>
 #include <odlInclude.h>
 
+#if defined(__APPLE__)
+# pragma clang diagnostic push
+# pragma clang diagnostic ignored "-Wunknown-pragmas"
+# pragma clang diagnostic ignored "-Wconversion"
+# pragma clang diagnostic ignored "-Wdeprecated-declarations"
+# pragma clang diagnostic ignored "-Wdocumentation-unknown-command"
+# pragma clang diagnostic ignored "-Wextern-c-compat"
+# pragma clang diagnostic ignored "-Wsign-conversion"
+#endif // defined(__APPLE__)
+#if (! MAC_OR_LINUX_)
+# pragma warning(push)
+# pragma warning(disable: 4996)
+#endif // ! MAC_OR_LINUX_
+#include <ace/ACE.h>
+#if (! MAC_OR_LINUX_)
+# pragma warning(pop)
+#endif // ! MAC_OR_LINUX_
+#if defined(__APPLE__)
+# pragma clang diagnostic pop
+#endif // defined(__APPLE__)
+
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
 #include <ctime>
 #if defined(__APPLE__)
 # pragma clang diagnostic push
@@ -110,57 +136,170 @@ using namespace MplusM::Registry;
 /*! @brief A shortcut for the case-insensitive form of a 'Text' column. */
 #define NOCASE_                         "COLLATE NOCASE"
 
+/*! @brief The number of changes to the set of registered services that are retained for the
+ 'changes' request. */
+#define CHANGE_LOG_SIZE_                256
+
+/*! @brief The length of time covered by a slot of the expiry wheel. */
+#define EXPIRY_WHEEL_INTERVAL_          PING_CHECK_INTERVAL_
+
+/*! @brief The number of slots in the expiry wheel; the wheel must cover more than the time that a
+ service channel can go without a ping, so that a slot is not revisited before it comes due. */
+#define EXPIRY_WHEEL_SLOTS_             16
+
+/*! @brief The maximum number of registrations that can be in progress at once; a registration
+ that would exceed this is turned away with a hint as to when to try again. */
+#define MAX_PENDING_REGISTRATIONS_      16
+
+/*! @brief The maximum number of parameters in a prepared statement. */
+#define MAX_STATEMENT_PARAMETERS_       7
+
+/*! @brief The name of the file that holds the persistent database, in the temporary directory. */
+#define PERSISTENT_DATABASE_NAME_       "m+mRegistry.db"
+
+/*! @brief The version of the layout of the tables in the persistent database; a database with a
+ different version is rebuilt. */
+#define REGISTRY_SCHEMA_VERSION_        "1"
+
+/*! @brief The weight given to the most recent registration time in the smoothed registration
+ time. */
+#define REGISTRATION_TIME_WEIGHT_       0.2
+
+/*! @brief The number of rows that are added by each of the batched insert statements; the
+ remaining rows are added one at a time. */
+#define ROWS_PER_BATCHED_INSERT_        8
+
 namespace MplusM
 {
     namespace Registry
     {
         /*! @brief A function that provides bindings for parameters in an SQL statement.
          @param[in] statement The prepared statement that is to be updated.
+         @param[in] indices The indices of the parameters of the statement, in the order in which
+         they are listed in the description of the statement.
          @param[in] stuff The source of data that is to be bound.
          @return The SQLite error from the bind operation. */
         typedef int (*BindFunction)
             (sqlite3_stmt * statement,
+            const int *     indices,
             const void *    stuff);
 
-        /*! @brief The data needed to add a request-keyword entry into the database. */
-        struct RequestKeywordData
+        /*! @brief The identifiers for the SQL statements that are prepared once for a database. */
+        enum StatementId
+        {
+            /*! @brief Abandon a transaction. */
+            kStatementAbortTransaction,
+
+            /*! @brief Start a transaction. */
+            kStatementBeginTransaction,
+
+            /*! @brief Retrieve the name of the service for a channel. */
+            kStatementCheckService,
+
+            /*! @brief Complete a transaction. */
+            kStatementCommitTransaction,
+
+            /*! @brief Add a keyword. */
+            kStatementInsertIntoKeywords,
+
+            /*! @brief Add a batch of keywords. */
+            kStatementInsertIntoKeywordsBatch,
+
+            /*! @brief Add a request. */
+            kStatementInsertIntoRequests,
+
+            /*! @brief Add a batch of requests. */
+            kStatementInsertIntoRequestsBatch,
+
+            /*! @brief Link a request to a keyword. */
+            kStatementInsertIntoRequestsKeywords,
+
+            /*! @brief Link a batch of requests to keywords. */
+            kStatementInsertIntoRequestsKeywordsBatch,
+
+            /*! @brief Add a service. */
+            kStatementInsertIntoServices,
+
+            /*! @brief Remove the requests for a channel. */
+            kStatementRemoveFromRequests,
+
+            /*! @brief Remove the request-keyword links for a channel. */
+            kStatementRemoveFromRequestsKeywords,
+
+            /*! @brief Remove the service for a channel. */
+            kStatementRemoveFromServices,
+
+            /*! @brief The number of statements. */
+            kStatementCount
+
+        }; // StatementId
+
+        /*! @brief The text of an SQL statement and the names of its parameters. */
+        struct StatementDescription
+        {
+            /*! @brief The text of the statement. */
+            const char * _text;
+
+            /*! @brief The names of the parameters of the statement; unused entries are @c NULL. */
+            const char * _parameters[MAX_STATEMENT_PARAMETERS_];
+
+            /*! @brief The parameters for a single row of values, for a statement that adds rows,
+             or @c NULL; the parameters of such a statement are bound by position. */
+            const char * _rowText;
+
+            /*! @brief The end of a statement that adds rows, following the rows of values. */
+            const char * _suffix;
+
+            /*! @brief The number of rows of values in a statement that adds rows. */
+            size_t _rowCount;
+
+        }; // StatementDescription
+
+        /*! @brief A prepared SQL statement. */
+        struct PreparedStatement
         {
-            /*! @brief The name of the request. */
-            YarpString _request;
+            /*! @brief The statement, or @c NULL if it has not been prepared. */
+            sqlite3_stmt * _statement;
 
-            /*! @brief The service channel for the request. */
-            YarpString _channel;
+            /*! @brief The indices of the parameters of the statement. */
+            int _indices[MAX_STATEMENT_PARAMETERS_];
 
-            /*! @brief A keyword for the request. */
-            YarpString _key;
+            /*! @brief @c true if the statement is being executed and @c false otherwise. */
+            bool _inUse;
 
-        }; // RequestKeywordData
+        }; // PreparedStatement
 
-        /*! @brief The data needed to add a service entry into the database. */
-        struct ServiceData
+        /*! @brief The prepared SQL statements for a database. */
+        struct PreparedStatements
         {
-            /*! @brief The service channel for the service. */
-            YarpString _channel;
+            /*! @brief The database that the statements were prepared for. */
+            sqlite3 * _database;
 
-            /*! @brief The description of the service. */
-            YarpString _description;
+            /*! @brief The contention lock used to protect the statements. */
+            yarp::os::Mutex _lock;
 
-            /*! @brief The path to the executable for the service. */
-            YarpString _executable;
+            /*! @brief The contention lock used to allow only one transaction at a time, as the
+             connection to the database is shared by the request handlers. */
+            yarp::os::Mutex _transactionLock;
 
-            /*! @brief The extra information for the service. */
-            YarpString _extraInfo;
+            /*! @brief The statements, indexed by their identifiers. */
+            PreparedStatement _entries[kStatementCount];
 
-            /*! @brief The name of the service. */
-            YarpString _name;
+        }; // PreparedStatements
+
+        /*! @brief The rows of values to be bound to a statement that adds rows to a table. */
+        struct RowsOfValues
+        {
+            /*! @brief The values to be added, one row after another. */
+            const YarpStringVector * _values;
 
-            /*! @brief The description of the requests for the service. */
-            YarpString _requestsDescription;
+            /*! @brief The position of the first value to be bound. */
+            size_t _firstValue;
 
-            /*! @brief The tag modifier for the service. */
-            YarpString _tag;
+            /*! @brief The number of values to be bound. */
+            size_t _numValues;
 
-        }; // ServiceData
+        }; // RowsOfValues
 
     } // Registry
 
@@ -170,6 +309,59 @@ namespace MplusM
 # pragma mark Global constants and variables
 #endif // defined(__APPLE__)
 
+/*! @brief The SQL statements that are prepared once for a database, indexed by their
+ identifiers. */
+static const StatementDescription kStatements[kStatementCount] =
+{
+    // kStatementAbortTransaction
+    { "ROLLBACK TRANSACTION", { NULL } },
+    // kStatementBeginTransaction
+    { "BEGIN TRANSACTION", { NULL } },
+    // kStatementCheckService
+    { T_("SELECT DISTINCT " NAME_C_ " FROM " SERVICES_T_ " WHERE " CHANNELNAME_C_ " = @"
+         CHANNELNAME_C_), { "@" CHANNELNAME_C_, NULL } },
+    // kStatementCommitTransaction
+    { "END TRANSACTION", { NULL } },
+    // kStatementInsertIntoKeywords
+    { T_("INSERT INTO " KEYWORDS_T_ "(" KEYWORD_C_ ") VALUES "), { NULL }, "(?)", "", 1 },
+    // kStatementInsertIntoKeywordsBatch
+    { T_("INSERT INTO " KEYWORDS_T_ "(" KEYWORD_C_ ") VALUES "), { NULL }, "(?)", "",
+      ROWS_PER_BATCHED_INSERT_ },
+    // kStatementInsertIntoRequests
+    { T_("INSERT INTO " REQUESTS_T_ "(" CHANNELNAME_C_ "," REQUEST_C_ "," INPUT_C_ "," OUTPUT_C_
+         "," VERSION_C_ "," DETAILS_C_ ") VALUES "), { NULL }, "(?,?,?,?,?,?)", "", 1 },
+    // kStatementInsertIntoRequestsBatch
+    { T_("INSERT INTO " REQUESTS_T_ "(" CHANNELNAME_C_ "," REQUEST_C_ "," INPUT_C_ "," OUTPUT_C_
+         "," VERSION_C_ "," DETAILS_C_ ") VALUES "), { NULL }, "(?,?,?,?,?,?)", "",
+      ROWS_PER_BATCHED_INSERT_ },
+    // kStatementInsertIntoRequestsKeywords
+    { T_("INSERT INTO " REQUESTSKEYWORDS_T_ "(" KEYWORDS_ID_C_ "," REQUESTS_ID_C_ ") SELECT "
+         "V.column1, R." KEY_C_ " FROM " REQUESTS_T_ " AS R, (VALUES "), { NULL }, "(?,?,?)",
+      T_(") AS V WHERE R." REQUEST_C_ " = V.column2 AND R." CHANNELNAME_C_ " = V.column3"), 1 },
+    // kStatementInsertIntoRequestsKeywordsBatch
+    { T_("INSERT INTO " REQUESTSKEYWORDS_T_ "(" KEYWORDS_ID_C_ "," REQUESTS_ID_C_ ") SELECT "
+         "V.column1, R." KEY_C_ " FROM " REQUESTS_T_ " AS R, (VALUES "), { NULL }, "(?,?,?)",
+      T_(") AS V WHERE R." REQUEST_C_ " = V.column2 AND R." CHANNELNAME_C_ " = V.column3"),
+      ROWS_PER_BATCHED_INSERT_ },
+    // kStatementInsertIntoServices
+    { T_("INSERT INTO " SERVICES_T_ "(" CHANNELNAME_C_ "," NAME_C_ "," DESCRIPTION_C_ ","
+         EXECUTABLE_C_ "," EXTRAINFO_C_ "," REQUESTSDESCRIPTION_C_ "," TAG_C_ ") VALUES(@"
+         CHANNELNAME_C_ ",@" NAME_C_ ",@" DESCRIPTION_C_ ",@" EXECUTABLE_C_ ",@" EXTRAINFO_C_
+         ",@" REQUESTSDESCRIPTION_C_ ",@" TAG_C_ ")"),
+      { "@" CHANNELNAME_C_, "@" DESCRIPTION_C_, "@" EXECUTABLE_C_, "@" EXTRAINFO_C_, "@" NAME_C_,
+        "@" REQUESTSDESCRIPTION_C_, "@" TAG_C_ } },
+    // kStatementRemoveFromRequests
+    { T_("DELETE FROM " REQUESTS_T_ " WHERE " CHANNELNAME_C_ " = @" CHANNELNAME_C_),
+      { "@" CHANNELNAME_C_, NULL } },
+    // kStatementRemoveFromRequestsKeywords
+    { T_("DELETE FROM " REQUESTSKEYWORDS_T_ " WHERE " REQUESTS_ID_C_ " IN (SELECT " KEY_C_
+         " FROM " REQUESTS_T_ " WHERE " CHANNELNAME_C_ " = @" CHANNELNAME_C_ ")"),
+      { "@" CHANNELNAME_C_, NULL } },
+    // kStatementRemoveFromServices
+    { T_("DELETE FROM " SERVICES_T_ " WHERE " CHANNELNAME_C_ " = @" CHANNELNAME_C_),
+      { "@" CHANNELNAME_C_, NULL } }
+}; // kStatements
+
 #if defined(__APPLE__)
 # pragma mark Local functions
 #endif // defined(__APPLE__)
@@ -318,39 +510,209 @@ mapStatusToStringForSQL(const int sqlRes)
 } // mapStatusToStringForSQL
 #endif // defined(ODL_ENABLE_LOGGING_)
 
+/*! @brief Retrieve a prepared statement, preparing it if this has not already been done.
+
+ If the statement is already being executed, a separate copy is prepared, which is discarded when
+ it is released.
+ @param[in] statements The prepared statements for the database.
+ @param[in] which The statement to be retrieved.
+ @param[out] indices The indices of the parameters of the statement.
+ @return The prepared statement or @c NULL if it could not be prepared. */
+static sqlite3_stmt *
+acquireStatement(PreparedStatements & statements,
+                 const StatementId    which,
+                 int *                indices)
+{
+    ODL_ENTER(); //####
+    ODL_P2("statements = ", &statements, "indices = ", indices); //####
+    ODL_I1("which = ", which); //####
+    const StatementDescription & description = kStatements[which];
+    PreparedStatement &          anEntry = statements._entries[which];
+    sqlite3_stmt *               result = NULL;
+    bool                         useEntry;
+
+    statements._lock.lock();
+    useEntry = (! anEntry._inUse);
+    if (useEntry)
+    {
+        anEntry._inUse = true;
+        result = anEntry._statement;
+    }
+    statements._lock.unlock();
+    if (! result)
+    {
+        std::string sqlStatement(description._text);
+
+        if (description._rowText)
+        {
+            for (size_t ii = 0; description._rowCount > ii; ++ii)
+            {
+                if (0 < ii)
+                {
+                    sqlStatement += ",";
+                }
+                sqlStatement += description._rowText;
+            }
+            sqlStatement += description._suffix;
+        }
+        int sqlRes = sqlite3_prepare_v2(statements._database, sqlStatement.c_str(),
+                                        static_cast<int>(sqlStatement.length()), &result, NULL);
+
+        ODL_I1("sqlRes <- ", sqlRes); //####
+        ODL_S1("sqlRes <- ", mapStatusToStringForSQL(sqlRes)); //####
+        if ((SQLITE_OK == sqlRes) && result)
+        {
+            // The parameter indices are only looked up when the statement is prepared.
+            int * newIndices = (useEntry ? anEntry._indices : indices);
+
+            for (size_t ii = 0; MAX_STATEMENT_PARAMETERS_ > ii; ++ii)
+            {
+                const char * parameterName = description._parameters[ii];
+
+                newIndices[ii] = (parameterName ? sqlite3_bind_parameter_index(result,
+                                                                               parameterName) :
+                                  0);
+            }
+            if (useEntry)
+            {
+                statements._lock.lock();
+                anEntry._statement = result;
+                statements._lock.unlock();
+            }
+        }
+        else
+        {
+            ODL_LOG("! ((SQLITE_OK == sqlRes) && result)"); //####
+            result = NULL;
+            if (useEntry)
+            {
+                statements._lock.lock();
+                anEntry._inUse = false;
+                statements._lock.unlock();
+            }
+        }
+    }
+    if (result && useEntry)
+    {
+        memcpy(indices, anEntry._indices, sizeof(anEntry._indices));
+    }
+    ODL_EXIT_P(result); //####
+    return result;
+} // acquireStatement
+
+/*! @brief Create the prepared statements for a database.
+
+ The statements are prepared when they are first used.
+ @param[in] database The database that the statements are for.
+ @return The prepared statements for the database. */
+static PreparedStatements *
+createPreparedStatements(sqlite3 * database)
+{
+    ODL_ENTER(); //####
+    ODL_P1("database = ", database); //####
+    PreparedStatements * result = new PreparedStatements;
+
+    result->_database = database;
+    for (size_t ii = 0; kStatementCount > ii; ++ii)
+    {
+        PreparedStatement & anEntry = result->_entries[ii];
+
+        anEntry._statement = NULL;
+        anEntry._inUse = false;
+    }
+    ODL_EXIT_P(result); //####
+    return result;
+} // createPreparedStatements
+
+/*! @brief Discard the prepared statements for a database.
+
+ This must be done before the database is closed.
+ @param[in] statements The prepared statements for the database. */
+static void
+destroyPreparedStatements(PreparedStatements * statements)
+{
+    ODL_ENTER(); //####
+    ODL_P1("statements = ", statements); //####
+    if (statements)
+    {
+        for (size_t ii = 0; kStatementCount > ii; ++ii)
+        {
+            sqlite3_stmt * prepared = statements->_entries[ii]._statement;
+
+            if (prepared)
+            {
+                sqlite3_finalize(prepared);
+            }
+        }
+        delete statements;
+    }
+    ODL_EXIT(); //####
+} // destroyPreparedStatements
+
+/*! @brief Return a prepared statement, so that it can be executed again.
+ @param[in] statements The prepared statements for the database.
+ @param[in] which The statement that was retrieved.
+ @param[in] prepared The statement that was returned by acquireStatement(). */
+static void
+releaseStatement(PreparedStatements & statements,
+                 const StatementId    which,
+                 sqlite3_stmt *       prepared)
+{
+    ODL_ENTER(); //####
+    ODL_P2("statements = ", &statements, "prepared = ", prepared); //####
+    ODL_I1("which = ", which); //####
+    PreparedStatement & anEntry = statements._entries[which];
+    bool                isEntry;
+
+    statements._lock.lock();
+    isEntry = (anEntry._inUse && (anEntry._statement == prepared));
+    statements._lock.unlock();
+    if (isEntry)
+    {
+        sqlite3_reset(prepared);
+        sqlite3_clear_bindings(prepared);
+        statements._lock.lock();
+        anEntry._inUse = false;
+        statements._lock.unlock();
+    }
+    else
+    {
+        sqlite3_finalize(prepared);
+    }
+    ODL_EXIT(); //####
+} // releaseStatement
+
 /*! @brief Perform a simple operation on the database.
- @param[in] database The database to be modified.
- @param[in] sqlStatement The operation to be performed.
+ @param[in] statements The prepared statements for the database to be modified.
+ @param[in] which The operation to be performed.
  @param[in] doBinds A function that will fill in any parameters in the statement.
  @param[in] data The custom information used with the binding function.
  @return @c true if the operation was successfully performed and @c false otherwise. */
 static bool
-performSQLstatementWithNoResults(sqlite3 *    database,
-                                 const char * sqlStatement,
-                                 BindFunction doBinds,
-                                 const void * data)
+performSQLstatementWithNoResults(PreparedStatements * statements,
+                                 const StatementId    which,
+                                 BindFunction         doBinds = NULL,
+                                 const void *         data = NULL)
 {
     ODL_ENTER(); //####
-    ODL_P2("database = ", database, "data = ", data); //####
-    ODL_S1("sqlStatement = ", sqlStatement); //####
+    ODL_P2("statements = ", statements, "data = ", data); //####
+    ODL_I1("which = ", which); //####
     bool okSoFar = true;
 
     try
     {
-        if (database)
+        if (statements)
         {
-            sqlite3_stmt * prepared = NULL;
-            int            sqlRes = sqlite3_prepare_v2(database, sqlStatement,
-                                                       static_cast<int>(strlen(sqlStatement)),
-                                                       &prepared, NULL);
+            int            indices[MAX_STATEMENT_PARAMETERS_];
+            sqlite3_stmt * prepared = acquireStatement(*statements, which, indices);
 
-            ODL_I1("sqlRes <- ", sqlRes); //####
-            ODL_S1("sqlRes <- ", mapStatusToStringForSQL(sqlRes)); //####
-            if ((SQLITE_OK == sqlRes) && prepared)
+            if (prepared)
             {
+                int sqlRes;
+
                 if (doBinds)
                 {
-                    sqlRes = doBinds(prepared, data);
+                    sqlRes = doBinds(prepared, indices, data);
                     ODL_I1("sqlRes <- ", sqlRes); //####
                     ODL_S1("sqlRes <- ", mapStatusToStringForSQL(sqlRes)); //####
                     okSoFar = (SQLITE_OK == sqlRes);
@@ -374,17 +736,17 @@ performSQLstatementWithNoResults(sqlite3 *    database,
                         okSoFar = false;
                     }
                 }
-                sqlite3_finalize(prepared);
+                releaseStatement(*statements, which, prepared);
             }
             else
             {
-                ODL_LOG("! ((SQLITE_OK == sqlRes) && prepared)"); //####
+                ODL_LOG("! (prepared)"); //####
                 okSoFar = false;
             }
         }
         else
         {
-            ODL_LOG("! (database)"); //####
+            ODL_LOG("! (statements)"); //####
             okSoFar = false;
         }
     }
@@ -398,6 +760,9 @@ performSQLstatementWithNoResults(sqlite3 *    database,
 } // performSQLstatementWithNoResults
 
 /*! @brief Perform a simple operation on the database.
+
+ The operation is prepared each time that it is performed, so this should only be used for
+ operations that are performed rarely.
  @param[in] database The database to be modified.
  @param[in] sqlStatement The operation to be performed.
  @return @c true if the operation was successfully performed and @c false otherwise. */
@@ -467,38 +832,36 @@ performSQLstatementWithNoResultsNoArgs(sqlite3 *    database,
 
 #if 0
 /*! @brief Perform a simple operation on the database, ignoring constraint errors.
- @param[in] database The database to be modified.
- @param[in] sqlStatement The operation to be performed.
+ @param[in] statements The prepared statements for the database to be modified.
+ @param[in] which The operation to be performed.
  @param[in] doBinds A function that will fill in any parameters in the statement.
  @param[in] data The custom information used with the binding function.
  @return @c true if the operation was successfully performed and @c false otherwise. */
 static bool
-performSQLstatementWithNoResultsAllowConstraint(sqlite3 *    database,
-                                                const char * sqlStatement,
-                                                BindFunction doBinds,
-                                                const void * data)
+performSQLstatementWithNoResultsAllowConstraint(PreparedStatements * statements,
+                                                const StatementId    which,
+                                                BindFunction         doBinds,
+                                                const void *         data)
 {
     ODL_ENTER(); //####
-    ODL_P2("database = ", database, "data = ", data); //####
-    ODL_S1("sqlStatement = ", sqlStatement); //####
+    ODL_P2("statements = ", statements, "data = ", data); //####
+    ODL_I1("which = ", which); //####
     bool okSoFar = true;
 
     try
     {
-        if (database)
+        if (statements)
         {
-            sqlite3_stmt * prepared = NULL;
-            int            sqlRes = sqlite3_prepare_v2(database, sqlStatement,
-                                                       static_cast<int>(strlen(sqlStatement)),
-                                                       &prepared, NULL);
+            int            indices[MAX_STATEMENT_PARAMETERS_];
+            sqlite3_stmt * prepared = acquireStatement(*statements, which, indices);
 
-            ODL_I1("sqlRes <- ", sqlRes); //####
-            ODL_S1("sqlRes <- ", mapStatusToStringForSQL(sqlRes)); //####
-            if ((SQLITE_OK == sqlRes) && prepared)
+            if (prepared)
             {
+                int sqlRes;
+
                 if (doBinds)
                 {
-                    sqlRes = doBinds(prepared, data);
+                    sqlRes = doBinds(prepared, indices, data);
                     ODL_I1("sqlRes <- ", sqlRes); //####
                     ODL_S1("sqlRes <- ", mapStatusToStringForSQL(sqlRes)); //####
                     okSoFar = (SQLITE_OK == sqlRes);
@@ -523,17 +886,17 @@ performSQLstatementWithNoResultsAllowConstraint(sqlite3 *    database,
                         okSoFar = false;
                     }
                 }
-                sqlite3_finalize(prepared);
+                releaseStatement(*statements, which, prepared);
             }
             else
             {
-                ODL_LOG("! ((SQLITE_OK == sqlRes) && prepared)"); //####
+                ODL_LOG("! (prepared)"); //####
                 okSoFar = false;
             }
         }
         else
         {
-            ODL_LOG("! (database)"); //####
+            ODL_LOG("! (statements)"); //####
             okSoFar = false;
         }
     }
@@ -549,46 +912,44 @@ performSQLstatementWithNoResultsAllowConstraint(sqlite3 *    database,
 
 #if 0
 /*! @brief Perform an operation that can return multiple rows of results.
- @param[in] database The database to be modified.
+ @param[in] statements The prepared statements for the database to be modified.
  @param[in,out] resultList The list to be filled in with the values from the column of interest.
- @param[in] sqlStatement The operation to be performed.
+ @param[in] which The operation to be performed.
  @param[in] columnOfInterest1 The column containing the first value of interest.
  @param[in] columnOfInterest2 The column containing the second value of interest.
  @param[in] doBinds A function that will fill in any parameters in the statement.
  @param[in] data The custom information used with the binding function.
  @return @c true if the operation was successfully performed and @c false otherwise. */
 static bool
-performSQLstatementWithDoubleColumnResults(sqlite3 *          database,
-                                           yarp::os::Bottle & resultList,
-                                           const char *       sqlStatement,
-                                           const int          columnOfInterest1,
-                                           const int          columnOfInterest2,
-                                           BindFunction       doBinds,
-                                           const void *       data)
+performSQLstatementWithDoubleColumnResults(PreparedStatements * statements,
+                                           yarp::os::Bottle &   resultList,
+                                           const StatementId    which,
+                                           const int            columnOfInterest1,
+                                           const int            columnOfInterest2,
+                                           BindFunction         doBinds,
+                                           const void *         data)
 {
     ODL_ENTER(); //####
-    ODL_P3("database = ", database, "resultList = ", &resultList, "data = ", data); //####
+    ODL_P3("statements = ", statements, "resultList = ", &resultList, "data = ", data); //####
     ODL_I2("columnOfInterest1 = ", columnOfInterest1, "columnOfInterest2 = ", //####
             columnOfInterest2); //####
-    ODL_S1("sqlStatement = ", sqlStatement); //####
+    ODL_I1("which = ", which); //####
     bool okSoFar = true;
 
     try
     {
-        if (database && (0 <= columnOfInterest1) && (0 <= columnOfInterest2))
+        if (statements && (0 <= columnOfInterest1) && (0 <= columnOfInterest2))
         {
-            sqlite3_stmt * prepared = NULL;
-            int            sqlRes = sqlite3_prepare_v2(database, sqlStatement,
-                                                       static_cast<int>(strlen(sqlStatement)),
-                                                       &prepared, NULL);
+            int            indices[MAX_STATEMENT_PARAMETERS_];
+            sqlite3_stmt * prepared = acquireStatement(*statements, which, indices);
 
-            ODL_I1("sqlRes <- ", sqlRes); //####
-            ODL_S1("sqlRes <- ", mapStatusToStringForSQL(sqlRes)); //####
-            if ((SQLITE_OK == sqlRes) && prepared)
+            if (prepared)
             {
+                int sqlRes;
+
                 if (doBinds)
                 {
-                    sqlRes = doBinds(prepared, data);
+                    sqlRes = doBinds(prepared, indices, data);
                     ODL_I1("sqlRes <- ", sqlRes); //####
                     ODL_S1("sqlRes <- ", mapStatusToStringForSQL(sqlRes)); //####
                     okSoFar = (SQLITE_OK == sqlRes);
@@ -644,17 +1005,18 @@ performSQLstatementWithDoubleColumnResults(sqlite3 *          database,
                         okSoFar = false;
                     }
                 }
-                sqlite3_finalize(prepared);
+                releaseStatement(*statements, which, prepared);
             }
             else
             {
-                ODL_LOG("! ((SQLITE_OK == sqlRes) && prepared)"); //####
+                ODL_LOG("! (prepared)"); //####
                 okSoFar = false;
             }
         }
         else
         {
-            ODL_LOG("! (database && (0 <= columnOfInterest1) && (0 <= columnOfInterest2))"); //####
+            ODL_LOG("! (statements && (0 <= columnOfInterest1) && " //####
+                    "(0 <= columnOfInterest2))"); //####
             okSoFar = false;
         }
     }
@@ -670,43 +1032,41 @@ performSQLstatementWithDoubleColumnResults(sqlite3 *          database,
 #endif // 0
 
 /*! @brief Perform an operation that can return multiple rows of results.
- @param[in] database The database to be modified.
+ @param[in] statements The prepared statements for the database to be modified.
  @param[in,out] resultList The list to be filled in with the values from the column of interest.
- @param[in] sqlStatement The operation to be performed.
+ @param[in] which The operation to be performed.
  @param[in] columnOfInterest The column containing the value of interest.
  @param[in] doBinds A function that will fill in any parameters in the statement.
  @param[in] data The custom information used with the binding function.
  @return @c true if the operation was successfully performed and @c false otherwise. */
 static bool
-performSQLstatementWithSingleColumnResults(sqlite3 *          database,
-                                           yarp::os::Bottle & resultList,
-                                           const char *       sqlStatement,
-                                           const int          columnOfInterest = 0,
-                                           BindFunction       doBinds = NULL,
-                                           const void *       data = NULL)
+performSQLstatementWithSingleColumnResults(PreparedStatements * statements,
+                                           yarp::os::Bottle &   resultList,
+                                           const StatementId    which,
+                                           const int            columnOfInterest = 0,
+                                           BindFunction         doBinds = NULL,
+                                           const void *         data = NULL)
 {
     ODL_ENTER(); //####
-    ODL_P3("database = ", database, "resultList = ", &resultList, "data = ", data); //####
+    ODL_P3("statements = ", statements, "resultList = ", &resultList, "data = ", data); //####
     ODL_I1("columnOfInterest = ", columnOfInterest); //####
-    ODL_S1("sqlStatement = ", sqlStatement); //####
+    ODL_I1("which = ", which); //####
     bool okSoFar = true;
 
     try
     {
-        if (database && (0 <= columnOfInterest))
+        if (statements && (0 <= columnOfInterest))
         {
-            sqlite3_stmt * prepared = NULL;
-            int            sqlRes = sqlite3_prepare_v2(database, sqlStatement,
-                                                       static_cast<int>(strlen(sqlStatement)),
-                                                       &prepared, NULL);
+            int            indices[MAX_STATEMENT_PARAMETERS_];
+            sqlite3_stmt * prepared = acquireStatement(*statements, which, indices);
 
-            ODL_I1("sqlRes <- ", sqlRes); //####
-            ODL_S1("sqlRes <- ", mapStatusToStringForSQL(sqlRes)); //####
-            if ((SQLITE_OK == sqlRes) && prepared)
+            if (prepared)
             {
+                int sqlRes;
+
                 if (doBinds)
                 {
-                    sqlRes = doBinds(prepared, data);
+                    sqlRes = doBinds(prepared, indices, data);
                     ODL_I1("sqlRes <- ", sqlRes); //####
                     ODL_S1("sqlRes <- ", mapStatusToStringForSQL(sqlRes)); //####
                     okSoFar = (SQLITE_OK == sqlRes);
@@ -752,17 +1112,17 @@ performSQLstatementWithSingleColumnResults(sqlite3 *          database,
                         okSoFar = false;
                     }
                 }
-                sqlite3_finalize(prepared);
+                releaseStatement(*statements, which, prepared);
             }
             else
             {
-                ODL_LOG("! ((SQLITE_OK == sqlRes) && prepared)"); //####
+                ODL_LOG("! (prepared)"); //####
                 okSoFar = false;
             }
         }
         else
         {
-            ODL_LOG("! (database && (0 <= columnOfInterest))"); //####
+            ODL_LOG("! (statements && (0 <= columnOfInterest))"); //####
             okSoFar = false;
         }
     }
@@ -776,27 +1136,92 @@ performSQLstatementWithSingleColumnResults(sqlite3 *          database,
     return okSoFar;
 } // performSQLstatementWithSingleColumnResults
 
-/*! @brief Start a transaction.
+/*! @brief Perform an operation that can return multiple rows of results.
+
+ The operation is prepared each time that it is performed, so this should be used for operations
+ that are constructed as they are needed.
  @param[in] database The database to be modified.
- @return @c true if the transaction was initiated and @c false otherwise. */
+ @param[in,out] resultList The list to be filled in with the values from the column of interest.
+ @param[in] sqlStatement The operation to be performed.
+ @param[in] columnOfInterest The column containing the value of interest.
+ @return @c true if the operation was successfully performed and @c false otherwise. */
 static bool
-doBeginTransaction(sqlite3 * database)
+performSQLstatementWithSingleColumnResultsNoArgs(sqlite3 *          database,
+                                                 yarp::os::Bottle & resultList,
+                                                 const char *       sqlStatement,
+                                                 const int          columnOfInterest = 0)
 {
     ODL_ENTER(); //####
-    ODL_P1("database = ", database); //####
+    ODL_P2("database = ", database, "resultList = ", &resultList); //####
+    ODL_I1("columnOfInterest = ", columnOfInterest); //####
+    ODL_S1("sqlStatement = ", sqlStatement); //####
     bool okSoFar = true;
 
     try
     {
-        if (database)
+        if (database && (0 <= columnOfInterest))
         {
-            static const char * beginTransaction = "BEGIN TRANSACTION";
+            sqlite3_stmt * prepared = NULL;
+            int            sqlRes = sqlite3_prepare_v2(database, sqlStatement,
+                                                       static_cast<int>(strlen(sqlStatement)),
+                                                       &prepared, NULL);
+
+            ODL_I1("sqlRes <- ", sqlRes); //####
+            ODL_S1("sqlRes <- ", mapStatusToStringForSQL(sqlRes)); //####
+            if ((SQLITE_OK == sqlRes) && prepared)
+            {
+                if (okSoFar)
+                {
+                    for (sqlRes = SQLITE_ROW; SQLITE_ROW == sqlRes; )
+                    {
+                        do
+                        {
+                            sqlRes = sqlite3_step(prepared);
+                            ODL_I1("sqlRes <- ", sqlRes); //####
+                            ODL_S1("sqlRes <- ", mapStatusToStringForSQL(sqlRes)); //####
+                            if (SQLITE_BUSY == sqlRes)
+                            {
+                                ConsumeSomeTime(10.0);
+                            }
+                        }
+                        while (SQLITE_BUSY == sqlRes);
+                        if (SQLITE_ROW == sqlRes)
+                        {
+                            // Gather the column data...
+                            int colCount = sqlite3_column_count(prepared);
+
+                            ODL_I1("colCount <- ", colCount); //####
+                            if ((0 < colCount) && (columnOfInterest < colCount))
+                            {
+                                const char * value =
+                                    reinterpret_cast<const char *>(sqlite3_column_text(prepared,
+                                                                                columnOfInterest));
 
-            okSoFar = performSQLstatementWithNoResultsNoArgs(database, beginTransaction);
+                                ODL_S1("value <- ", value); //####
+                                if (value)
+                                {
+                                    resultList.addString(value);
+                                }
+                            }
+                        }
+                    }
+                    if (SQLITE_DONE != sqlRes)
+                    {
+                        ODL_LOG("(SQLITE_DONE != sqlRes)"); //####
+                        okSoFar = false;
+                    }
+                }
+                sqlite3_finalize(prepared);
+            }
+            else
+            {
+                ODL_LOG("! ((SQLITE_OK == sqlRes) && prepared)"); //####
+                okSoFar = false;
+            }
         }
         else
         {
-            ODL_LOG("! (database)"); //####
+            ODL_LOG("! (database && (0 <= columnOfInterest))"); //####
             okSoFar = false;
         }
     }
@@ -805,36 +1230,173 @@ doBeginTransaction(sqlite3 * database)
         ODL_LOG("Exception caught"); //####
         throw;
     }
+
     ODL_EXIT_B(okSoFar); //####
     return okSoFar;
-} // doBeginTransaction
+} // performSQLstatementWithSingleColumnResultsNoArgs
 
-/*! @brief End a transaction.
- @param[in] database The database to be modified.
- @param[in] wasOK @c true if the transaction was successful and @c false otherwise.
- @return @c true if the transaction was closed successfully and @c false otherwise. */
+/*! @brief Perform an operation that can return multiple rows of results.
+
+ The operation is prepared each time that it is performed, so this should only be used for
+ operations that are performed rarely.
+ @param[in] database The database to be used.
+ @param[in,out] values The values of the columns of each row, one row after another; a missing value
+ is returned as an empty string.
+ @param[in] sqlStatement The operation to be performed.
+ @param[in] columnCount The number of columns of interest, starting with the first column.
+ @return @c true if the operation was successfully performed and @c false otherwise. */
 static bool
-doEndTransaction(sqlite3 *  database,
-                 const bool wasOK)
+performSQLstatementWithRowResultsNoArgs(sqlite3 *          database,
+                                        YarpStringVector & values,
+                                        const char *       sqlStatement,
+                                        const int          columnCount)
 {
     ODL_ENTER(); //####
-    ODL_P1("database = ", database); //####
-    ODL_B1("wasOK = ", wasOK); //####
+    ODL_P2("database = ", database, "values = ", &values); //####
+    ODL_S1("sqlStatement = ", sqlStatement); //####
+    ODL_I1("columnCount = ", columnCount); //####
     bool okSoFar = true;
 
     try
     {
-        if (database)
+        if (database && (0 < columnCount))
         {
-            static const char * abortTransaction = "ROLLBACK TRANSACTION";
-            static const char * commitTransaction = "END TRANSACTION";
+            sqlite3_stmt * prepared = NULL;
+            int            sqlRes = sqlite3_prepare_v2(database, sqlStatement,
+                                                       static_cast<int>(strlen(sqlStatement)),
+                                                       &prepared, NULL);
 
-            okSoFar = performSQLstatementWithNoResultsNoArgs(database, wasOK ? commitTransaction :
-                                                             abortTransaction);
-        }
+            ODL_I1("sqlRes <- ", sqlRes); //####
+            ODL_S1("sqlRes <- ", mapStatusToStringForSQL(sqlRes)); //####
+            if ((SQLITE_OK == sqlRes) && prepared)
+            {
+                for (sqlRes = SQLITE_ROW; okSoFar && (SQLITE_ROW == sqlRes); )
+                {
+                    do
+                    {
+                        sqlRes = sqlite3_step(prepared);
+                        ODL_I1("sqlRes <- ", sqlRes); //####
+                        ODL_S1("sqlRes <- ", mapStatusToStringForSQL(sqlRes)); //####
+                        if (SQLITE_BUSY == sqlRes)
+                        {
+                            ConsumeSomeTime(10.0);
+                        }
+                    }
+                    while (SQLITE_BUSY == sqlRes);
+                    if (SQLITE_ROW == sqlRes)
+                    {
+                        if (columnCount <= sqlite3_column_count(prepared))
+                        {
+                            for (int ii = 0; columnCount > ii; ++ii)
+                            {
+                                const char * value =
+                                        reinterpret_cast<const char *>(sqlite3_column_text(prepared,
+                                                                                           ii));
+
+                                values.push_back(value ? value : "");
+                            }
+                        }
+                        else
+                        {
+                            ODL_LOG("! (columnCount <= sqlite3_column_count(prepared))"); //####
+                            okSoFar = false;
+                        }
+                    }
+                }
+                if (okSoFar && (SQLITE_DONE != sqlRes))
+                {
+                    ODL_LOG("(okSoFar && (SQLITE_DONE != sqlRes))"); //####
+                    okSoFar = false;
+                }
+                sqlite3_finalize(prepared);
+            }
+            else
+            {
+                ODL_LOG("! ((SQLITE_OK == sqlRes) && prepared)"); //####
+                okSoFar = false;
+            }
+        }
         else
         {
-            ODL_LOG("! (database)"); //####
+            ODL_LOG("! (database && (0 < columnCount))"); //####
+            okSoFar = false;
+        }
+    }
+    catch (...)
+    {
+        ODL_LOG("Exception caught"); //####
+        throw;
+    }
+    ODL_EXIT_B(okSoFar); //####
+    return okSoFar;
+} // performSQLstatementWithRowResultsNoArgs
+
+/*! @brief Start a transaction.
+
+ Only one transaction can be in progress at a time, so a transaction that was started must be
+ ended with doEndTransaction().
+ @param[in] statements The prepared statements for the database to be modified.
+ @return @c true if the transaction was initiated and @c false otherwise. */
+static bool
+doBeginTransaction(PreparedStatements * statements)
+{
+    ODL_ENTER(); //####
+    ODL_P1("statements = ", statements); //####
+    bool okSoFar = true;
+
+    try
+    {
+        if (statements)
+        {
+            // The lock is held until the transaction is ended.
+            statements->_transactionLock.lock();
+            okSoFar = performSQLstatementWithNoResults(statements, kStatementBeginTransaction);
+            if (! okSoFar)
+            {
+                ODL_LOG("(! okSoFar)"); //####
+                statements->_transactionLock.unlock();
+            }
+        }
+        else
+        {
+            ODL_LOG("! (statements)"); //####
+            okSoFar = false;
+        }
+    }
+    catch (...)
+    {
+        ODL_LOG("Exception caught"); //####
+        throw;
+    }
+    ODL_EXIT_B(okSoFar); //####
+    return okSoFar;
+} // doBeginTransaction
+
+/*! @brief End a transaction.
+ @param[in] statements The prepared statements for the database to be modified.
+ @param[in] wasOK @c true if the transaction was successful and @c false otherwise.
+ @return @c true if the transaction was closed successfully and @c false otherwise. */
+static bool
+doEndTransaction(PreparedStatements * statements,
+                 const bool           wasOK)
+{
+    ODL_ENTER(); //####
+    ODL_P1("statements = ", statements); //####
+    ODL_B1("wasOK = ", wasOK); //####
+    bool okSoFar = true;
+
+    try
+    {
+        if (statements)
+        {
+            okSoFar = performSQLstatementWithNoResults(statements,
+                                                       wasOK ? kStatementCommitTransaction :
+                                                       kStatementAbortTransaction);
+            statements->_transactionLock.unlock();
+        }
+        else
+        {
+            ODL_LOG("! (statements)"); //####
             okSoFar = false;
         }
     }
@@ -847,25 +1409,87 @@ doEndTransaction(sqlite3 *  database,
     return okSoFar;
 } // doCommitTransaction
 
-/*! @brief Construct the tables needed in the database.
- @param[in] database The database to be modified.
- @return @c true if the tables were successfully built and @c false otherwise. */
+/*! @brief Check that a persistent database is intact and has the current layout.
+ @param[in] database The database to be checked.
+ @param[out] schemaIsCurrent @c true if the tables have the current layout or have not yet been
+ created and @c false if they were created with an earlier layout.
+ @return @c true if the database is intact and @c false if it is damaged. */
 static bool
-constructTables(sqlite3 * database)
+checkDatabase(sqlite3 * database,
+              bool &    schemaIsCurrent)
 {
     ODL_ENTER(); //####
-    ODL_P1("database = ", database); //####
+    ODL_P2("database = ", database, "schemaIsCurrent = ", &schemaIsCurrent); //####
+    bool             okSoFar;
+    yarp::os::Bottle checkResults;
+
+    schemaIsCurrent = false;
+    okSoFar = performSQLstatementWithSingleColumnResultsNoArgs(database, checkResults,
+                                                               "PRAGMA quick_check");
+    if (okSoFar && (1 == checkResults.size()) && (checkResults.get(0).toString() == "ok"))
+    {
+        yarp::os::Bottle versionResults;
+
+        okSoFar = performSQLstatementWithSingleColumnResultsNoArgs(database, versionResults,
+                                                                   "PRAGMA user_version");
+        if (okSoFar && (1 == versionResults.size()))
+        {
+            if (versionResults.get(0).toString() == REGISTRY_SCHEMA_VERSION_)
+            {
+                schemaIsCurrent = true;
+            }
+            else
+            {
+                yarp::os::Bottle tableResults;
+
+                // A new database has no version and no tables.
+                okSoFar = performSQLstatementWithSingleColumnResultsNoArgs(database, tableResults,
+                                                          "SELECT COUNT(*) FROM sqlite_master");
+                if (okSoFar && (1 == tableResults.size()))
+                {
+                    schemaIsCurrent = (tableResults.get(0).toString() == "0");
+                }
+                else
+                {
+                    ODL_LOG("! (okSoFar && (1 == tableResults.size()))"); //####
+                    okSoFar = false;
+                }
+            }
+        }
+        else
+        {
+            ODL_LOG("! (okSoFar && (1 == versionResults.size()))"); //####
+            okSoFar = false;
+        }
+    }
+    else
+    {
+        ODL_LOG("! (okSoFar && (1 == checkResults.size()) && " //####
+                "(checkResults.get(0).toString() == \"ok\"))"); //####
+        okSoFar = false;
+    }
+    ODL_EXIT_B(okSoFar); //####
+    return okSoFar;
+} // checkDatabase
+
+/*! @brief Remove the tables from the database, so that they can be constructed again.
+ @param[in] statements The prepared statements for the database to be modified.
+ @return @c true if the tables were successfully removed and @c false otherwise. */
+static bool
+dropTables(PreparedStatements * statements)
+{
+    ODL_ENTER(); //####
+    ODL_P1("statements = ", statements); //####
     bool okSoFar = true;
 
     try
     {
-        if (database)
+        if (statements)
         {
-            if (doBeginTransaction(database))
+            if (doBeginTransaction(statements))
             {
-                static const char * tableSQL[] =
+                static const char * dropSQL[] =
                 {
-#if defined(MpM_UseTestDatabase)
                     T_("DROP INDEX IF EXISTS " REQUESTS_REQUEST_I_),
                     T_("DROP INDEX IF EXISTS " REQUESTS_CHANNELNAME_I_),
                     T_("DROP INDEX IF EXISTS " REQUESTSKEYWORDS_KEYWORDS_ID_I_),
@@ -874,8 +1498,59 @@ constructTables(sqlite3 * database)
                     T_("DROP TABLE IF EXISTS " REQUESTSKEYWORDS_T_),
                     T_("DROP TABLE IF EXISTS " REQUESTS_T_),
                     T_("DROP TABLE IF EXISTS " KEYWORDS_T_),
-                    T_("DROP TABLE IF EXISTS " SERVICES_T_),
+                    T_("DROP TABLE IF EXISTS " SERVICES_T_)
+                };
+                static const size_t numDrops = (sizeof(dropSQL) / sizeof(*dropSQL));
+
+                for (size_t ii = 0; okSoFar && (ii < numDrops); ++ii)
+                {
+                    okSoFar = performSQLstatementWithNoResultsNoArgs(statements->_database,
+                                                                     dropSQL[ii]);
+                }
+                okSoFar = doEndTransaction(statements, okSoFar);
+            }
+            else
+            {
+                ODL_LOG("! (doBeginTransaction(statements))"); //####
+                okSoFar = false;
+            }
+        }
+        else
+        {
+            ODL_LOG("! (statements)"); //####
+            okSoFar = false;
+        }
+    }
+    catch (...)
+    {
+        ODL_LOG("Exception caught"); //####
+        throw;
+    }
+    ODL_EXIT_B(okSoFar); //####
+    return okSoFar;
+} // dropTables
+
+/*! @brief Construct the tables needed in the database.
+ @param[in] statements The prepared statements for the database to be modified.
+ @return @c true if the tables were successfully built and @c false otherwise. */
+static bool
+constructTables(PreparedStatements * statements)
+{
+    ODL_ENTER(); //####
+    ODL_P1("statements = ", statements); //####
+    bool okSoFar = true;
+
+    try
+    {
+        if (statements)
+        {
+#if defined(MpM_UseTestDatabase)
+            okSoFar = dropTables(statements);
 #endif // defined(MpM_UseTestDatabase)
+            if (okSoFar && doBeginTransaction(statements))
+            {
+                static const char * tableSQL[] =
+                {
                     T_("CREATE TABLE IF NOT EXISTS " SERVICES_T_ "( " CHANNELNAME_C_ " "
                        TEXTNOTNULL_ " " BINARY_ " PRIMARY KEY ON CONFLICT REPLACE, " NAME_C_ " "
                        TEXTNOTNULL_ " " NOCASE_ ", " DESCRIPTION_C_ " " TEXTNOTNULL_ " " NOCASE_
@@ -908,14 +1583,15 @@ constructTables(sqlite3 * database)
                 okSoFar = true;
                 for (size_t ii = 0; okSoFar && (ii < numTables); ++ii)
                 {
-                    okSoFar = performSQLstatementWithNoResultsNoArgs(database, tableSQL[ii]);
+                    okSoFar = performSQLstatementWithNoResultsNoArgs(statements->_database,
+                                                                     tableSQL[ii]);
                 }
-                okSoFar = doEndTransaction(database, okSoFar);
+                okSoFar = doEndTransaction(statements, okSoFar);
             }
         }
         else
         {
-            ODL_LOG("! (database)"); //####
+            ODL_LOG("! (statements)"); //####
             okSoFar = false;
         }
     }
@@ -930,19 +1606,21 @@ constructTables(sqlite3 * database)
 
 /*! @brief Bind the values that are to be gathered from the Services table.
  @param[in] statement The prepared statement that is to be updated.
+ @param[in] indices The indices of the parameters of the statement.
  @param[in] stuff The source of data that is to be bound.
  @return The SQLite error from the bind operation. */
 static int
 setupCheckService(sqlite3_stmt * statement,
+                  const int *    indices,
                   const void *   stuff)
 {
     ODL_ENTER(); //####
-    ODL_P2("statement = ", statement, "stuff = ", stuff); //####
+    ODL_P3("statement = ", statement, "indices = ", indices, "stuff = ", stuff); //####
     int result = SQLITE_MISUSE;
 
     try
     {
-        int channelNameIndex = sqlite3_bind_parameter_index(statement, "@" CHANNELNAME_C_);
+        int channelNameIndex = indices[0];
 
         if (0 < channelNameIndex)
         {
@@ -974,19 +1652,21 @@ setupCheckService(sqlite3_stmt * statement,
 #if 0
 /*! @brief Bind the values that are to be inserted into the Channels table.
  @param[in] statement The prepared statement that is to be updated.
+ @param[in] indices The indices of the parameters of the statement.
  @param[in] stuff The source of data that is to be bound.
  @return The SQLite error from the bind operation. */
 static int
 setupInsertIntoChannels(sqlite3_stmt * statement,
+                        const int *    indices,
                         const void *   stuff)
 {
     ODL_ENTER(); //####
-    ODL_P2("statement = ", statement, "stuff = ", stuff); //####
+    ODL_P3("statement = ", statement, "indices = ", indices, "stuff = ", stuff); //####
     int result = SQLITE_MISUSE;
 
     try
     {
-        int channelIndex = sqlite3_bind_parameter_index(statement, "@" CHANNELNAME_C_);
+        int channelIndex = indices[0];
 
         if (0 < channelIndex)
         {
@@ -1015,117 +1695,91 @@ setupInsertIntoChannels(sqlite3_stmt * statement,
 } // setupInsertIntoChannels
 #endif // 0
 
-/*! @brief Bind the values that are to be inserted into the Keywords table.
- @param[in] statement The prepared statement that is to be updated.
- @param[in] stuff The source of data that is to be bound.
- @return The SQLite error from the bind operation. */
-static int
-setupInsertIntoKeywords(sqlite3_stmt * statement,
-                        const void *   stuff)
-{
-    ODL_ENTER(); //####
-    ODL_P2("statement = ", statement, "stuff = ", stuff); //####
-    int result = SQLITE_MISUSE;
-
-    try
-    {
-        int keywordIndex = sqlite3_bind_parameter_index(statement, "@" KEYWORD_C_);
-
-        if (0 < keywordIndex)
-        {
-            const char * nameString = static_cast<const char *>(stuff);
-
-            ODL_S1("nameString <- ", nameString); //####
-            result = sqlite3_bind_text(statement, keywordIndex, nameString,
-                                       static_cast<int>(strlen(nameString)), SQLITE_TRANSIENT);
-            if (SQLITE_OK != result)
-            {
-                ODL_S1("error description: ", sqlite3_errstr(result)); //####
-            }
-        }
-        else
-        {
-            ODL_LOG("! (0 < keywordIndex)"); //####
-        }
-    }
-    catch (...)
-    {
-        ODL_LOG("Exception caught"); //####
-        throw;
-    }
-    ODL_EXIT_I(result);
-    return result;
-} // setupInsertIntoKeywords
-
-/*! @brief Bind the values that are to be inserted into the Requests table.
+/*! @brief Bind the values that are to be inserted into the Services table.
  @param[in] statement The prepared statement that is to be updated.
+ @param[in] indices The indices of the parameters of the statement.
  @param[in] stuff The source of data that is to be bound.
  @return The SQLite error from the bind operation. */
 static int
-setupInsertIntoRequests(sqlite3_stmt * statement,
+setupInsertIntoServices(sqlite3_stmt * statement,
+                        const int *    indices,
                         const void *   stuff)
 {
     ODL_ENTER(); //####
-    ODL_P2("statement = ", statement, "stuff = ", stuff); //####
+    ODL_P3("statement = ", statement, "indices = ", indices, "stuff = ", stuff); //####
     int result = SQLITE_MISUSE;
 
     try
     {
-        int channelNameIndex = sqlite3_bind_parameter_index(statement, "@" CHANNELNAME_C_);
-        int detailsIndex = sqlite3_bind_parameter_index(statement, "@" DETAILS_C_);
-        int inputIndex = sqlite3_bind_parameter_index(statement, "@" INPUT_C_);
-        int outputIndex = sqlite3_bind_parameter_index(statement, "@" OUTPUT_C_);
-        int requestIndex = sqlite3_bind_parameter_index(statement, "@" REQUEST_C_);
-        int versionIndex = sqlite3_bind_parameter_index(statement, "@" VERSION_C_);
+        int channelNameIndex = indices[0];
+        int descriptionIndex = indices[1];
+        int executableIndex = indices[2];
+        int extraInfoIndex = indices[3];
+        int nameIndex = indices[4];
+        int requestsDescriptionIndex = indices[5];
+        int tagIndex = indices[6];
 
-        if ((0 < channelNameIndex) && (0 < detailsIndex) && (0 < inputIndex) && (0 < outputIndex) &&
-            (0 < requestIndex) && (0 < versionIndex))
+        if ((0 < channelNameIndex) && (0 < descriptionIndex) && (0 < executableIndex) &&
+            (0 < extraInfoIndex) && (0 < nameIndex) && (0 < requestsDescriptionIndex) &&
+            (0 < tagIndex))
         {
-            const RequestDescription * descriptor = static_cast<const RequestDescription *>(stuff);
-            const char *               channelName = descriptor->_channel.c_str();
+            const ServiceRegistration * descriptor =
+                                                static_cast<const ServiceRegistration *>(stuff);
+            const char *                channelName = descriptor->_channel.c_str();
 
             ODL_S1("channelName <- ", channelName); //####
             result = sqlite3_bind_text(statement, channelNameIndex, channelName,
                                        static_cast<int>(strlen(channelName)), SQLITE_TRANSIENT);
             if (SQLITE_OK == result)
             {
-                const char * request = descriptor->_request.c_str();
+                const char * name = descriptor->_name.c_str();
+
+                ODL_S1("name <- ", name); //####
+                result = sqlite3_bind_text(statement, nameIndex, name,
+                                           static_cast<int>(strlen(name)), SQLITE_TRANSIENT);
+            }
+            if (SQLITE_OK == result)
+            {
+                const char * description = descriptor->_description.c_str();
 
-                ODL_S1("request <- ", request); //####
-                result = sqlite3_bind_text(statement, requestIndex, request,
-                                           static_cast<int>(strlen(request)), SQLITE_TRANSIENT);
+                ODL_S1("description <- ", description); //####
+                result = sqlite3_bind_text(statement, descriptionIndex, description,
+                                           static_cast<int>(strlen(description)),
+                                           SQLITE_TRANSIENT);
             }
             if (SQLITE_OK == result)
             {
-                const char * input = descriptor->_inputs.c_str();
+                const char * executable = descriptor->_executable.c_str();
 
-                ODL_S1("input <- ", input); //####
-                result = sqlite3_bind_text(statement, inputIndex, input,
-                                           static_cast<int>(strlen(input)), SQLITE_TRANSIENT);
+                ODL_S1("executable <- ", executable); //####
+                result = sqlite3_bind_text(statement, executableIndex, executable,
+                                           static_cast<int>(strlen(executable)),
+                                           SQLITE_TRANSIENT);
             }
             if (SQLITE_OK == result)
             {
-                const char * output = descriptor->_outputs.c_str();
+                const char * extraInfo = descriptor->_extraInfo.c_str();
 
-                ODL_S1("output <- ", output); //####
-                result = sqlite3_bind_text(statement, outputIndex, output,
-                                           static_cast<int>(strlen(output)), SQLITE_TRANSIENT);
+                ODL_S1("extraInfo <- ", extraInfo); //####
+                result = sqlite3_bind_text(statement, extraInfoIndex, extraInfo,
+                                           static_cast<int>(strlen(extraInfo)), SQLITE_TRANSIENT);
             }
             if (SQLITE_OK == result)
             {
-                const char * version = descriptor->_version.c_str();
+                const char * requestsDescription = descriptor->_requestsDescription.c_str();
 
-                ODL_S1("version <- ", version); //####
-                result = sqlite3_bind_text(statement, versionIndex, version,
-                                           static_cast<int>(strlen(version)), SQLITE_TRANSIENT);
+                ODL_S1("requestsDescription <- ", requestsDescription); //####
+                result = sqlite3_bind_text(statement, requestsDescriptionIndex, requestsDescription,
+                                           static_cast<int>(strlen(requestsDescription)),
+                                           SQLITE_TRANSIENT);
             }
             if (SQLITE_OK == result)
             {
-                const char * details = descriptor->_details.c_str();
+                const char * tag = descriptor->_tag.c_str();
 
-                ODL_S1("details <- ", details); //####
-                result = sqlite3_bind_text(statement, detailsIndex, details,
-                                           static_cast<int>(strlen(details)), SQLITE_TRANSIENT);
+                ODL_S1("tag <- ", tag); //####
+                result = sqlite3_bind_text(statement, tagIndex, tag, static_cast<int>(strlen(tag)),
+                                           SQLITE_TRANSIENT);
             }
             if (SQLITE_OK != result)
             {
@@ -1134,8 +1788,9 @@ setupInsertIntoRequests(sqlite3_stmt * statement,
         }
         else
         {
-            ODL_LOG("! ((0 < channelNameIndex) && (0 < detailsIndex) && (0 < inputIndex) && " //####
-                    "(0 < outputIndex) && (0 < requestIndex) && (0 < versionIndex))"); //####
+            ODL_LOG("! ((0 < channelNameIndex) && (0 < descriptionIndex) && " //####
+                    "(0 < executableIndex) && (0 < extraInfoIndex) && (0 < nameIndex) && " //####
+                    "(0 < requestsDescriptionIndex) && (0 < tagIndex))"); //####
         }
     }
     catch (...)
@@ -1145,60 +1800,41 @@ setupInsertIntoRequests(sqlite3_stmt * statement,
     }
     ODL_EXIT_I(result);
     return result;
-} // setupInsertIntoRequests
+} // setupInsertIntoServices
 
-/*! @brief Bind the values that are to be inserted into the RequestsKeywords table.
+#if 0
+/*! @brief Bind the values that are to be removed from the Channels table.
  @param[in] statement The prepared statement that is to be updated.
+ @param[in] indices The indices of the parameters of the statement.
  @param[in] stuff The source of data that is to be bound.
  @return The SQLite error from the bind operation. */
 static int
-setupInsertIntoRequestsKeywords(sqlite3_stmt * statement,
-                                const void *   stuff)
+setupRemoveFromChannels(sqlite3_stmt * statement,
+                        const int *    indices,
+                        const void *   stuff)
 {
     ODL_ENTER(); //####
-    ODL_P2("statement = ", statement, "stuff = ", stuff); //####
+    ODL_P3("statement = ", statement, "indices = ", indices, "stuff = ", stuff); //####
     int result = SQLITE_MISUSE;
 
     try
     {
-        int channelNameIndex = sqlite3_bind_parameter_index(statement, "@" CHANNELNAME_C_);
-        int keywordIndex = sqlite3_bind_parameter_index(statement, "@" KEYWORD_C_);
-        int requestIndex = sqlite3_bind_parameter_index(statement, "@" REQUEST_C_);
+        int channelNameIndex = indices[0];
 
-        if ((0 < channelNameIndex) && (0 < keywordIndex) && (0 < requestIndex))
+        if (0 < channelNameIndex)
         {
-            const RequestKeywordData * descriptor = static_cast<const RequestKeywordData *>(stuff);
-            const char *               keyword = descriptor->_key.c_str();
+            const char * channelName = static_cast<const char *>(stuff);
 
-            ODL_S1("keyword <- ", keyword); //####
-            result = sqlite3_bind_text(statement, keywordIndex, keyword,
-                                       static_cast<int>(strlen(keyword)), SQLITE_TRANSIENT);
-            if (SQLITE_OK == result)
+            result = sqlite3_bind_text(statement, channelNameIndex, channelName,
+                                       static_cast<int>(strlen(channelName)), SQLITE_TRANSIENT);
+            if (SQLITE_OK != result)
             {
-                const char * request = descriptor->_request.c_str();
-
-                ODL_S1("request <- ", request); //####
-                result = sqlite3_bind_text(statement, requestIndex, request,
-                                           static_cast<int>(strlen(request)), SQLITE_TRANSIENT);
-            }
-            if (SQLITE_OK == result)
-            {
-                const char * channelName = descriptor->_channel.c_str();
-
-                ODL_S1("channelName <- ", channelName); //####
-                result = sqlite3_bind_text(statement, channelNameIndex, channelName,
-                                           static_cast<int>(strlen(channelName)),
-                                           SQLITE_TRANSIENT);
-            }
-            if (SQLITE_OK != result)
-            {
-                ODL_S1("error description: ", sqlite3_errstr(result)); //####
+                ODL_S1("error description: ", sqlite3_errstr(result)); //####
             }
         }
         else
         {
-            ODL_LOG("! ((0 < channelNameIndex) && (0 < keywordIndex) && " //####
-                    "(0 < requestIndex))"); //####
+            ODL_LOG("! (0 < channelNameIndex)"); //####
         }
     }
     catch (...)
@@ -1208,92 +1844,33 @@ setupInsertIntoRequestsKeywords(sqlite3_stmt * statement,
     }
     ODL_EXIT_I(result);
     return result;
-} // setupInsertIntoRequestsKeywords
+} // setupRemoveFromChannels
+#endif // 0
 
-/*! @brief Bind the values that are to be inserted into the Services table.
+/*! @brief Bind the values that are to be removed from the Requests table.
  @param[in] statement The prepared statement that is to be updated.
+ @param[in] indices The indices of the parameters of the statement.
  @param[in] stuff The source of data that is to be bound.
  @return The SQLite error from the bind operation. */
 static int
-setupInsertIntoServices(sqlite3_stmt * statement,
+setupRemoveFromRequests(sqlite3_stmt * statement,
+                        const int *    indices,
                         const void *   stuff)
 {
     ODL_ENTER(); //####
-    ODL_P2("statement = ", statement, "stuff = ", stuff); //####
+    ODL_P3("statement = ", statement, "indices = ", indices, "stuff = ", stuff); //####
     int result = SQLITE_MISUSE;
 
     try
     {
-        int channelNameIndex = sqlite3_bind_parameter_index(statement, "@" CHANNELNAME_C_);
-        int descriptionIndex = sqlite3_bind_parameter_index(statement, "@" DESCRIPTION_C_);
-        int executableIndex = sqlite3_bind_parameter_index(statement, "@" EXECUTABLE_C_);
-        int extraInfoIndex = sqlite3_bind_parameter_index(statement, "@" EXTRAINFO_C_);
-        int nameIndex = sqlite3_bind_parameter_index(statement, "@" NAME_C_);
-        int requestsDescriptionIndex = sqlite3_bind_parameter_index(statement,
-                                                                    "@" REQUESTSDESCRIPTION_C_);
-        int tagIndex = sqlite3_bind_parameter_index(statement, "@" TAG_C_);
+        int channelNameIndex = indices[0];
 
-        if ((0 < channelNameIndex) && (0 < descriptionIndex) && (0 < executableIndex) &&
-            (0 < extraInfoIndex) && (0 < nameIndex) && (0 < requestsDescriptionIndex) &&
-            (0 < tagIndex))
+        if (0 < channelNameIndex)
         {
-            const ServiceData * descriptor = static_cast<const ServiceData *>(stuff);
-            const char *        channelName = descriptor->_channel.c_str();
+            const char * channelName = static_cast<const char *>(stuff);
 
-            ODL_S1("channelName <- ", channelName); //####
             result = sqlite3_bind_text(statement, channelNameIndex, channelName,
                                        static_cast<int>(strlen(channelName)), SQLITE_TRANSIENT);
-            if (SQLITE_OK == result)
-            {
-                const char * name = descriptor->_name.c_str();
-
-                ODL_S1("name <- ", name); //####
-                result = sqlite3_bind_text(statement, nameIndex, name,
-                                           static_cast<int>(strlen(name)), SQLITE_TRANSIENT);
-            }
-            if (SQLITE_OK == result)
-            {
-                const char * description = descriptor->_description.c_str();
-
-                ODL_S1("description <- ", description); //####
-                result = sqlite3_bind_text(statement, descriptionIndex, description,
-                                           static_cast<int>(strlen(description)),
-                                           SQLITE_TRANSIENT);
-            }
-            if (SQLITE_OK == result)
-            {
-                const char * executable = descriptor->_executable.c_str();
-
-                ODL_S1("executable <- ", executable); //####
-                result = sqlite3_bind_text(statement, executableIndex, executable,
-                                           static_cast<int>(strlen(executable)),
-                                           SQLITE_TRANSIENT);
-            }
-            if (SQLITE_OK == result)
-            {
-                const char * extraInfo = descriptor->_extraInfo.c_str();
-
-                ODL_S1("extraInfo <- ", extraInfo); //####
-                result = sqlite3_bind_text(statement, extraInfoIndex, extraInfo,
-                                           static_cast<int>(strlen(extraInfo)), SQLITE_TRANSIENT);
-            }
-            if (SQLITE_OK == result)
-            {
-                const char * requestsDescription = descriptor->_requestsDescription.c_str();
-
-                ODL_S1("requestsDescription <- ", requestsDescription); //####
-                result = sqlite3_bind_text(statement, requestsDescriptionIndex, requestsDescription,
-                                           static_cast<int>(strlen(requestsDescription)),
-                                           SQLITE_TRANSIENT);
-            }
-            if (SQLITE_OK == result)
-            {
-                const char * tag = descriptor->_tag.c_str();
-
-                ODL_S1("tag <- ", tag); //####
-                result = sqlite3_bind_text(statement, tagIndex, tag, static_cast<int>(strlen(tag)),
-                                           SQLITE_TRANSIENT);
-            }
             if (SQLITE_OK != result)
             {
                 ODL_S1("error description: ", sqlite3_errstr(result)); //####
@@ -1301,9 +1878,7 @@ setupInsertIntoServices(sqlite3_stmt * statement,
         }
         else
         {
-            ODL_LOG("! ((0 < channelNameIndex) && (0 < descriptionIndex) && " //####
-                    "(0 < executableIndex) && (0 < extraInfoIndex) && (0 < nameIndex) && " //####
-                    "(0 < requestsDescriptionIndex) && (0 < tagIndex))"); //####
+            ODL_LOG("! (0 < channelNameIndex)"); //####
         }
     }
     catch (...)
@@ -1313,24 +1888,25 @@ setupInsertIntoServices(sqlite3_stmt * statement,
     }
     ODL_EXIT_I(result);
     return result;
-} // setupInsertIntoServices
+} // setupRemoveFromRequests
 
-#if 0
-/*! @brief Bind the values that are to be removed from the Channels table.
+/*! @brief Bind the values that are to be removed from the RequestsKeywords table.
  @param[in] statement The prepared statement that is to be updated.
+ @param[in] indices The indices of the parameters of the statement.
  @param[in] stuff The source of data that is to be bound.
  @return The SQLite error from the bind operation. */
 static int
-setupRemoveFromChannels(sqlite3_stmt * statement,
-                        const void *   stuff)
+setupRemoveFromRequestsKeywords(sqlite3_stmt * statement,
+                                const int *    indices,
+                                const void *   stuff)
 {
     ODL_ENTER(); //####
-    ODL_P2("statement = ", statement, "stuff = ", stuff); //####
+    ODL_P3("statement = ", statement, "indices = ", indices, "stuff = ", stuff); //####
     int result = SQLITE_MISUSE;
 
     try
     {
-        int channelNameIndex = sqlite3_bind_parameter_index(statement, "@" CHANNELNAME_C_);
+        int channelNameIndex = indices[0];
 
         if (0 < channelNameIndex)
         {
@@ -1355,24 +1931,25 @@ setupRemoveFromChannels(sqlite3_stmt * statement,
     }
     ODL_EXIT_I(result);
     return result;
-} // setupRemoveFromChannels
-#endif // 0
+} // setupRemoveFromRequestsKeywords
 
-/*! @brief Bind the values that are to be removed from the Requests table.
+/*! @brief Bind the values that are to be removed from the Services table.
  @param[in] statement The prepared statement that is to be updated.
+ @param[in] indices The indices of the parameters of the statement.
  @param[in] stuff The source of data that is to be bound.
  @return The SQLite error from the bind operation. */
 static int
-setupRemoveFromRequests(sqlite3_stmt * statement,
+setupRemoveFromServices(sqlite3_stmt * statement,
+                        const int *    indices,
                         const void *   stuff)
 {
     ODL_ENTER(); //####
-    ODL_P2("statement = ", statement, "stuff = ", stuff); //####
+    ODL_P3("statement = ", statement, "indices = ", indices, "stuff = ", stuff); //####
     int result = SQLITE_MISUSE;
 
     try
     {
-        int channelNameIndex = sqlite3_bind_parameter_index(statement, "@" CHANNELNAME_C_);
+        int channelNameIndex = indices[0];
 
         if (0 < channelNameIndex)
         {
@@ -1397,38 +1974,47 @@ setupRemoveFromRequests(sqlite3_stmt * statement,
     }
     ODL_EXIT_I(result);
     return result;
-} // setupRemoveFromRequests
+} // setupRemoveFromServices
 
-/*! @brief Bind the values that are to be removed from the RequestsKeywords table.
+#if (! MAC_OR_LINUX_)
+# pragma warning(push)
+# pragma warning(disable: 4100)
+#endif // ! MAC_OR_LINUX_
+/*! @brief Bind the rows of values that are to be added to a table.
  @param[in] statement The prepared statement that is to be updated.
+ @param[in] indices The indices of the parameters of the statement.
  @param[in] stuff The source of data that is to be bound.
  @return The SQLite error from the bind operation. */
 static int
-setupRemoveFromRequestsKeywords(sqlite3_stmt * statement,
-                                const void *   stuff)
+setupRowsOfValues(sqlite3_stmt * statement,
+                  const int *    indices,
+                  const void *   stuff)
 {
+#if (! defined(ODL_ENABLE_LOGGING_))
+# if MAC_OR_LINUX_
+#  pragma unused(indices)
+# endif // MAC_OR_LINUX_
+#endif // ! defined(ODL_ENABLE_LOGGING_)
     ODL_ENTER(); //####
-    ODL_P2("statement = ", statement, "stuff = ", stuff); //####
-    int result = SQLITE_MISUSE;
+    ODL_P3("statement = ", statement, "indices = ", indices, "stuff = ", stuff); //####
+    int result = SQLITE_OK;
 
     try
     {
-        int channelNameIndex = sqlite3_bind_parameter_index(statement, "@" CHANNELNAME_C_);
+        const RowsOfValues *     rows = static_cast<const RowsOfValues *>(stuff);
+        const YarpStringVector & values = *rows->_values;
 
-        if (0 < channelNameIndex)
+        // The parameters are numbered in the order in which they appear.
+        for (size_t ii = 0; (SQLITE_OK == result) && (rows->_numValues > ii); ++ii)
         {
-            const char * channelName = static_cast<const char *>(stuff);
+            const YarpString & aValue = values[rows->_firstValue + ii];
 
-            result = sqlite3_bind_text(statement, channelNameIndex, channelName,
-                                       static_cast<int>(strlen(channelName)), SQLITE_TRANSIENT);
-            if (SQLITE_OK != result)
-            {
-                ODL_S1("error description: ", sqlite3_errstr(result)); //####
-            }
+            result = sqlite3_bind_text(statement, static_cast<int>(ii + 1), aValue.c_str(),
+                                       static_cast<int>(aValue.length()), SQLITE_TRANSIENT);
         }
-        else
+        if (SQLITE_OK != result)
         {
-            ODL_LOG("! (0 < channelNameIndex)"); //####
+            ODL_S1("error description: ", sqlite3_errstr(result)); //####
         }
     }
     catch (...)
@@ -1438,38 +2024,58 @@ setupRemoveFromRequestsKeywords(sqlite3_stmt * statement,
     }
     ODL_EXIT_I(result);
     return result;
-} // setupRemoveFromRequestsKeywords
-
-/*! @brief Bind the values that are to be removed from the Services table.
- @param[in] statement The prepared statement that is to be updated.
- @param[in] stuff The source of data that is to be bound.
- @return The SQLite error from the bind operation. */
-static int
-setupRemoveFromServices(sqlite3_stmt * statement,
-                        const void *   stuff)
+} // setupRowsOfValues
+#if (! MAC_OR_LINUX_)
+# pragma warning(pop)
+#endif // ! MAC_OR_LINUX_
+
+/*! @brief Add rows to a table, using the batched form of the operation for as many rows as
+ possible and the single-row form for the remainder.
+ @param[in] statements The prepared statements for the database to be modified.
+ @param[in] batchStatement The operation that adds a batch of rows.
+ @param[in] singleStatement The operation that adds a single row.
+ @param[in] values The values to be added, one row after another.
+ @param[in] valuesPerRow The number of values in each row.
+ @return @c true if the operation was successfully performed and @c false otherwise. */
+static bool
+performSQLstatementWithRowsOfValues(PreparedStatements *     statements,
+                                    const StatementId        batchStatement,
+                                    const StatementId        singleStatement,
+                                    const YarpStringVector & values,
+                                    const size_t             valuesPerRow)
 {
     ODL_ENTER(); //####
-    ODL_P2("statement = ", statement, "stuff = ", stuff); //####
-    int result = SQLITE_MISUSE;
+    ODL_P2("statements = ", statements, "values = ", &values); //####
+    ODL_I3("batchStatement = ", batchStatement, "singleStatement = ", singleStatement, //####
+           "valuesPerRow = ", valuesPerRow); //####
+    bool okSoFar = true;
 
     try
     {
-        int channelNameIndex = sqlite3_bind_parameter_index(statement, "@" CHANNELNAME_C_);
-
-        if (0 < channelNameIndex)
+        if (0 < valuesPerRow)
         {
-            const char * channelName = static_cast<const char *>(stuff);
+            RowsOfValues rows;
+            size_t       numRows = (values.size() / valuesPerRow);
 
-            result = sqlite3_bind_text(statement, channelNameIndex, channelName,
-                                       static_cast<int>(strlen(channelName)), SQLITE_TRANSIENT);
-            if (SQLITE_OK != result)
+            rows._values = &values;
+            rows._firstValue = rows._numValues = 0;
+            for (size_t firstRow = 0; okSoFar && (numRows > firstRow); )
             {
-                ODL_S1("error description: ", sqlite3_errstr(result)); //####
+                bool        useBatch = ((numRows - firstRow) >= ROWS_PER_BATCHED_INSERT_);
+                StatementId which = (useBatch ? batchStatement : singleStatement);
+                size_t      rowCount = (useBatch ? ROWS_PER_BATCHED_INSERT_ : 1);
+
+                rows._firstValue = (firstRow * valuesPerRow);
+                rows._numValues = (rowCount * valuesPerRow);
+                okSoFar = performSQLstatementWithNoResults(statements, which, setupRowsOfValues,
+                                                           static_cast<const void *>(&rows));
+                firstRow += rowCount;
             }
         }
         else
         {
-            ODL_LOG("! (0 < channelNameIndex)"); //####
+            ODL_LOG("! (0 < valuesPerRow)"); //####
+            okSoFar = false;
         }
     }
     catch (...)
@@ -1477,14 +2083,119 @@ setupRemoveFromServices(sqlite3_stmt * statement,
         ODL_LOG("Exception caught"); //####
         throw;
     }
-    ODL_EXIT_I(result);
-    return result;
-} // setupRemoveFromServices
+    ODL_EXIT_B(okSoFar); //####
+    return okSoFar;
+} // performSQLstatementWithRowsOfValues
+
+/*! @brief Record the layout of the tables in a persistent database.
+ @param[in] database The database to be updated.
+ @return @c true if the version was recorded and @c false otherwise. */
+static bool
+setSchemaVersion(sqlite3 * database)
+{
+    ODL_ENTER(); //####
+    ODL_P1("database = ", database); //####
+    bool okSoFar = performSQLstatementWithNoResultsNoArgs(database,
+                                                 "PRAGMA user_version = " REGISTRY_SCHEMA_VERSION_);
+
+    ODL_EXIT_B(okSoFar); //####
+    return okSoFar;
+} // setSchemaVersion
+
+/*! @brief Set up a persistent database for a low cost per transaction and a quick recovery.
+
+ Write-ahead logging lets the registry be read while it is being updated, and only the log needs
+ to be synchronized for each transaction; a transaction that is lost in a crash is recovered when
+ the service pings the restarted registry.
+ @param[in] database The database to be set up.
+ @return @c true if the database was set up and @c false otherwise. */
+static bool
+tuneDatabase(sqlite3 * database)
+{
+    ODL_ENTER(); //####
+    ODL_P1("database = ", database); //####
+    bool okSoFar = true;
+
+    try
+    {
+        static const char * pragmaSQL[] =
+        {
+            "PRAGMA journal_mode = WAL",
+            "PRAGMA synchronous = NORMAL",
+            "PRAGMA mmap_size = 268435456",
+            "PRAGMA cache_size = -8192",
+            "PRAGMA temp_store = MEMORY"
+        };
+        static const size_t numPragmas = (sizeof(pragmaSQL) / sizeof(*pragmaSQL));
+
+        for (size_t ii = 0; okSoFar && (ii < numPragmas); ++ii)
+        {
+            yarp::os::Bottle dummy;
+
+            // Some of the pragmas return their new value, so the results are discarded.
+            okSoFar = performSQLstatementWithSingleColumnResultsNoArgs(database, dummy,
+                                                                       pragmaSQL[ii]);
+        }
+    }
+    catch (...)
+    {
+        ODL_LOG("Exception caught"); //####
+        throw;
+    }
+    ODL_EXIT_B(okSoFar); //####
+    return okSoFar;
+} // tuneDatabase
+
+/*! @brief Return the interval of the expiry wheel that contains a time.
+ @param[in] when The time of interest.
+ @return The interval of the expiry wheel that contains the time. */
+static long
+wheelTick(const double when)
+{
+    return static_cast<long>(floor(when / EXPIRY_WHEEL_INTERVAL_));
+} // wheelTick
 
 #if defined(__APPLE__)
 # pragma mark Class methods
 #endif // defined(__APPLE__)
 
+YarpString
+RegistryService::GetPersistentDatabasePath(void)
+{
+    ODL_ENTER(); //####
+    YarpString result;
+
+#if defined(MpM_UseTestDatabase)
+    result = "/tmp/test.db";
+#else // ! defined(MpM_UseTestDatabase)
+    char tempDir[PATH_MAX + 1];
+
+    // The database is kept between runs, so that the registered services can be recovered.
+    if (-1 == ACE::get_temp_dir(tempDir, sizeof(tempDir)))
+    {
+        ODL_LOG("(-1 == ACE::get_temp_dir(tempDir, sizeof(tempDir)))"); //####
+        tempDir[0] = '\0';
+    }
+    result = tempDir;
+    result += PERSISTENT_DATABASE_NAME_;
+#endif // ! defined(MpM_UseTestDatabase)
+    ODL_EXIT_s(result); //####
+    return result;
+} // RegistryService::GetPersistentDatabasePath
+
+void
+RegistryService::RemovePersistentDatabase(void)
+{
+    ODL_ENTER(); //####
+    YarpString dbFileName(GetPersistentDatabasePath());
+
+    // The write-ahead log and its index belong to the database, so they are removed as well.
+    remove(dbFileName.c_str());
+    remove((dbFileName + "-wal").c_str());
+    remove((dbFileName + "-shm").c_str());
+    ODL_EXIT(); //####
+} // RegistryService::RemovePersistentDatabase
+
 #if defined(__APPLE__)
 # pragma mark Constructors and Destructors
 #endif // defined(__APPLE__)
@@ -1496,15 +2207,21 @@ RegistryService::RegistryService(const YarpString & launchPath,
                                  const YarpString & servicePortNumber) :
     inherited(kServiceKindRegistry, launchPath, argc, argv, "", true, MpM_REGISTRY_CANONICAL_NAME_,
               REGISTRY_SERVICE_DESCRIPTION_,
+              "changes - return the changes to the set of registered services since a version\n"
               "match - return the channels for services matching the criteria provided\n"
               "ping - update the last-pinged information for a channel or record the information "
               "for a service on the given channel\n"
               "register - record the information for a service on the given channel\n"
               "unregister - remove the information for a service on the given channel",
-              MpM_REGISTRY_ENDPOINT_NAME_, servicePortNumber), _db(NULL),
-    _validator(new ColumnNameValidator), _matchHandler(NULL), _pingHandler(NULL),
+              MpM_REGISTRY_ENDPOINT_NAME_, servicePortNumber), _expiryWheel(EXPIRY_WHEEL_SLOTS_),
+    _nextWheelTick(wheelTick(yarp::os::Time::now())), _nextWheelSequence(0), _db(NULL),
+    _statements(NULL),
+    _matchIndex(new MatchIndex), _validator(new ColumnNameValidator), _changes(),
+    _changesChannel(NULL), _changesHandler(NULL), _matchHandler(NULL), _pingHandler(NULL),
     _statusChannel(NULL), _registerHandler(NULL), _unregisterHandler(NULL),
-    _checker(NULL), _inMemory(useInMemoryDb), _isActive(false)
+    _checker(NULL), _recoveryTime(0), _averageRegistrationTime(0), _herdRecoveryTime(0),
+    _overloadStartTime(0), _changesVersion(0), _overloadEpisodes(0), _pendingRegistrations(0),
+    _recoveredServices(0), _rejectedRequests(0), _inMemory(useInMemoryDb), _isActive(false)
 {
     ODL_ENTER(); //####
     ODL_S2s("launchPath = ", launchPath, "servicePortNumber = ", servicePortNumber); //####
@@ -1521,11 +2238,17 @@ RegistryService::~RegistryService(void)
     ODL_OBJENTER(); //####
     detachRequestHandlers();
     _lastCheckedTime.clear();
-    if (_db)
+    closeDatabase();
+    delete _matchIndex;
+    delete _validator;
+    if (_changesChannel)
     {
-        sqlite3_close(_db);
+#if defined(MpM_DoExplicitClose)
+        _changesChannel->close();
+#endif // defined(MpM_DoExplicitClose)
+        BaseChannel::RelinquishChannel(_changesChannel);
+        _changesChannel = NULL;
     }
-    delete _validator;
     if (_statusChannel)
     {
 #if defined(MpM_DoExplicitClose)
@@ -1542,76 +2265,90 @@ RegistryService::~RegistryService(void)
 #endif // defined(__APPLE__)
 
 bool
-RegistryService::addRequestRecord(const yarp::os::Bottle &   keywordList,
-                                  const RequestDescription & description)
+RegistryService::addServiceRegistration(const ServiceRegistration & registration)
 {
     ODL_OBJENTER(); //####
+    ODL_P1("registration = ", &registration); //####
+    ODL_S4s("channel = ", registration._channel, "name = ", registration._name, //####
+            "description = ", registration._description, "extraInfo = ", //####
+            registration._extraInfo); //####
     bool okSoFar = false;
 
     try
     {
-        if (doBeginTransaction(_db))
+        if (doBeginTransaction(_statements))
         {
-            static const char * insertIntoRequests = T_("INSERT INTO " REQUESTS_T_ "("
-                                                        CHANNELNAME_C_ "," REQUEST_C_ "," INPUT_C_
-                                                        "," OUTPUT_C_ "," VERSION_C_ "," DETAILS_C_
-                                                        ") VALUES(@" CHANNELNAME_C_ ",@" REQUEST_C_
-                                                        ",@" INPUT_C_ ",@" OUTPUT_C_ ",@" VERSION_C_
-                                                        ",@" DETAILS_C_ ")");
+            const char * serviceChannelName = registration._channel.c_str();
 
-            // Add the request.
-            okSoFar = performSQLstatementWithNoResults(_db, insertIntoRequests,
-                                                       setupInsertIntoRequests,
-                                                       static_cast<const void *>(&description));
+            // Remove any requests from an earlier registration of the service channel, such as one
+            // that was recovered from the persistent database.
+            okSoFar = performSQLstatementWithNoResults(_statements,
+                                                       kStatementRemoveFromRequestsKeywords,
+                                                       setupRemoveFromRequestsKeywords,
+                                                   static_cast<const void *>(serviceChannelName));
+            if (okSoFar)
+            {
+                okSoFar = performSQLstatementWithNoResults(_statements,
+                                                           kStatementRemoveFromRequests,
+                                                           setupRemoveFromRequests,
+                                                   static_cast<const void *>(serviceChannelName));
+            }
             if (okSoFar)
             {
-                // Add the keywords.
-                int                numKeywords = keywordList.size();
-                RequestKeywordData reqKeyData;
+                // Add the service channel name.
+                okSoFar = performSQLstatementWithNoResults(_statements,
+                                                           kStatementInsertIntoServices,
+                                                           setupInsertIntoServices,
+                                                       static_cast<const void *>(&registration));
+            }
+            if (okSoFar && (0 < registration._requests.size()))
+            {
+                YarpStringVector keywordValues;
+                YarpStringVector linkValues;
+                YarpStringVector requestValues;
 
-                reqKeyData._request = description._request;
-                reqKeyData._channel = description._channel;
-                for (int ii = 0; okSoFar && (ii < numKeywords); ++ii)
+                for (RequestDescriptionVector::const_iterator
+                     walker(registration._requests.begin());
+                     registration._requests.end() != walker; ++walker)
                 {
-                    yarp::os::Value & aKeyword(keywordList.get(ii));
-
-                    if (aKeyword.isString())
+                    const RequestDescription & aRequest = *walker;
+
+                    requestValues.push_back(aRequest._channel);
+                    requestValues.push_back(aRequest._request);
+                    requestValues.push_back(aRequest._inputs);
+                    requestValues.push_back(aRequest._outputs);
+                    requestValues.push_back(aRequest._version);
+                    requestValues.push_back(aRequest._details);
+                    for (YarpStringVector::const_iterator walker2(aRequest._keywords.begin());
+                         aRequest._keywords.end() != walker2; ++walker2)
                     {
-                        static const char * insertIntoKeywords = T_("INSERT INTO " KEYWORDS_T_ "("
-                                                                    KEYWORD_C_ ") VALUES(@"
-                                                                    KEYWORD_C_ ")");
-                        static const char * insertIntoRequestsKeywords = T_("INSERT INTO "
-                                                                            REQUESTSKEYWORDS_T_ "("
-                                                                            KEYWORDS_ID_C_ ","
-                                                                            REQUESTS_ID_C_
-                                                                            ") SELECT @" KEYWORD_C_
-                                                                            ", " KEY_C_ " FROM "
-                                                                            REQUESTS_T_ " WHERE "
-                                                                            REQUEST_C_ " = @"
-                                                                            REQUEST_C_ " AND "
-                                                                            CHANNELNAME_C_ " = @"
-                                                                            CHANNELNAME_C_);
-
-                        reqKeyData._key = aKeyword.toString();
-                        okSoFar = performSQLstatementWithNoResults(_db, insertIntoKeywords,
-                                                                   setupInsertIntoKeywords,
-                                               static_cast<const void *>(reqKeyData._key.c_str()));
-                        if (okSoFar)
-                        {
-                            okSoFar = performSQLstatementWithNoResults(_db,
-                                                                       insertIntoRequestsKeywords,
-                                                                   setupInsertIntoRequestsKeywords,
-                                                                       &reqKeyData);
-                        }
+                        keywordValues.push_back(*walker2);
+                        linkValues.push_back(*walker2);
+                        linkValues.push_back(aRequest._request);
+                        linkValues.push_back(aRequest._channel);
                     }
-                    else
+                }
+                // Add the requests, then the keywords and finally the links between them.
+                okSoFar = performSQLstatementWithRowsOfValues(_statements,
+                                                              kStatementInsertIntoRequestsBatch,
+                                                              kStatementInsertIntoRequests,
+                                                              requestValues, 6);
+                if (okSoFar && (0 < keywordValues.size()))
+                {
+                    okSoFar = performSQLstatementWithRowsOfValues(_statements,
+                                                              kStatementInsertIntoKeywordsBatch,
+                                                                  kStatementInsertIntoKeywords,
+                                                                  keywordValues, 1);
+                    if (okSoFar)
                     {
-                        ODL_LOG("! (aKeyword.isString())"); //####
-                        okSoFar = false;
+                        okSoFar = performSQLstatementWithRowsOfValues(_statements,
+                                                      kStatementInsertIntoRequestsKeywordsBatch,
+                                                          kStatementInsertIntoRequestsKeywords,
+                                                                      linkValues, 3);
                     }
                 }
             }
-            okSoFar = doEndTransaction(_db, okSoFar);
+            okSoFar = doEndTransaction(_statements, okSoFar);
         }
     }
     catch (...)
@@ -1619,72 +2356,65 @@ RegistryService::addRequestRecord(const yarp::os::Bottle &   keywordList,
         ODL_LOG("Exception caught"); //####
         throw;
     }
-    if (! okSoFar)
+    if (okSoFar)
     {
-        reportStatusChange(description._channel, kRegistryProblemAddingRequest,
-                           description._request);
+        _changesLock.lock();
+        try
+        {
+            _matchIndex->addService(registration);
+            recordServiceChange(MpM_REGISTRY_CHANGE_ADDED_, registration._channel,
+                                registration._name);
+        }
+        catch (...)
+        {
+            _changesLock.unlock();
+            throw;
+        }
+        _changesLock.unlock();
+        reportStatusChange(registration._channel, kRegistryAddService,
+                           Utilities::GetPortLocation(registration._channel));
+    }
+    else
+    {
+        reportStatusChange(registration._channel, kRegistryProblemAddingService,
+                           registration._name);
     }
     ODL_OBJEXIT_B(okSoFar); //####
     return okSoFar;
-} // RegistryService::addRequestRecord
+} // RegistryService::addServiceRegistration
 
 bool
-RegistryService::addServiceRecord(const YarpString & channelName,
-                                  const YarpString & name,
-                                  const YarpString & tag,
-                                  const YarpString & description,
-                                  const YarpString & extraInfo,
-                                  const YarpString & executable,
-                                  const YarpString & requestsDescription)
+RegistryService::admitRegistration(double & retryAfter)
 {
     ODL_OBJENTER(); //####
-    ODL_S4s("channelName = ", channelName, "name = ", name, "description = ", description, //####
-            "extraInfo = ", extraInfo); //####
-    ODL_S2s("executable = ", executable, "requestsDescription = ", requestsDescription); //####
-    bool okSoFar = false;
+    ODL_P1("retryAfter = ", &retryAfter); //####
+    bool result;
 
-    try
-    {
-        if (doBeginTransaction(_db))
-        {
-            // Add the service channel name.
-            static const char * insertIntoServices = T_("INSERT INTO " SERVICES_T_ "("
-                                                        CHANNELNAME_C_ "," NAME_C_ ","
-                                                        DESCRIPTION_C_ "," EXECUTABLE_C_ ","
-                                                        EXTRAINFO_C_ "," REQUESTSDESCRIPTION_C_ ","
-                                                        TAG_C_ ") VALUES(@" CHANNELNAME_C_ ",@"
-                                                        NAME_C_ ",@" DESCRIPTION_C_ ",@"
-                                                        EXECUTABLE_C_ ",@" EXTRAINFO_C_ ",@"
-                                                        REQUESTSDESCRIPTION_C_ ",@" TAG_C_ ")");
-            ServiceData         servData;
-
-            servData._channel = channelName;
-            servData._name = name;
-            servData._description = description;
-            servData._executable = executable;
-            servData._extraInfo = extraInfo;
-            servData._requestsDescription = requestsDescription;
-            servData._tag = tag;
-            okSoFar = performSQLstatementWithNoResults(_db, insertIntoServices,
-                                                       setupInsertIntoServices,
-                                                       static_cast<const void *>(&servData));
-            okSoFar = doEndTransaction(_db, okSoFar);
-            reportStatusChange(channelName, kRegistryAddService,
-                               Utilities::GetPortLocation(channelName));
-        }
-    }
-    catch (...)
+    _admissionLock.lock();
+    if (MAX_PENDING_REGISTRATIONS_ > _pendingRegistrations)
     {
-        ODL_LOG("Exception caught"); //####
-        throw;
+        ++_pendingRegistrations;
+        retryAfter = 0;
+        result = true;
     }
-    if (! okSoFar)
+    else
     {
-        reportStatusChange(channelName, kRegistryProblemAddingService, name);
+        // Suggest waiting long enough for the registrations in progress to finish.
+        retryAfter = std::max(INITIAL_RETRY_INTERVAL_,
+                              _averageRegistrationTime * _pendingRegistrations);
+        ++_rejectedRequests;
+        if (0 >= _overloadStartTime)
+        {
+            _overloadStartTime = yarp::os::Time::now();
+            ++_overloadEpisodes;
+        }
+        result = false;
     }
-    ODL_OBJEXIT_B(okSoFar); //####
-    return okSoFar;
-} // RegistryService::addServiceRecord
+    _admissionLock.unlock();
+    ODL_D1("retryAfter <- ", retryAfter); //####
+    ODL_OBJEXIT_B(result); //####
+    return result;
+} // RegistryService::admitRegistration
 
 void
 RegistryService::attachRequestHandlers(void)
@@ -1692,12 +2422,15 @@ RegistryService::attachRequestHandlers(void)
     ODL_OBJENTER(); //####
     try
     {
+        _changesHandler = new ChangesRequestHandler(*this);
         _matchHandler = new MatchRequestHandler(*this, _validator);
         _pingHandler = new PingRequestHandler(*this);
         _registerHandler = new RegisterRequestHandler(*this);
         _unregisterHandler = new UnregisterRequestHandler(*this);
-        if (_matchHandler && _pingHandler && _registerHandler && _unregisterHandler)
+        if (_changesHandler && _matchHandler && _pingHandler && _registerHandler &&
+            _unregisterHandler)
         {
+            registerRequestHandler(_changesHandler);
             registerRequestHandler(_matchHandler);
             registerRequestHandler(_pingHandler);
             registerRequestHandler(_registerHandler);
@@ -1705,8 +2438,8 @@ RegistryService::attachRequestHandlers(void)
         }
         else
         {
-            ODL_LOG("! (_matchHandler && _pingHandler && _registerHandler && " //####
-                    "_unregisterHandler)"); //####
+            ODL_LOG("! (_changesHandler && _matchHandler && _pingHandler && " //####
+                    "_registerHandler && _unregisterHandler)"); //####
         }
     }
     catch (...)
@@ -1726,16 +2459,15 @@ RegistryService::checkForExistingService(const YarpString & channelName)
 
     try
     {
-        if (doBeginTransaction(_db))
+        if (doBeginTransaction(_statements))
         {
-            yarp::os::Bottle    dummy;
-            static const char * checkService = T_("SELECT DISTINCT " NAME_C_ " FROM " SERVICES_T_
-                                                  " WHERE " CHANNELNAME_C_ " = @" CHANNELNAME_C_);
+            yarp::os::Bottle dummy;
 
-            okSoFar = performSQLstatementWithSingleColumnResults(_db, dummy, checkService, 0,
+            okSoFar = performSQLstatementWithSingleColumnResults(_statements, dummy,
+                                                                 kStatementCheckService, 0,
                                                                  setupCheckService,
                                                  static_cast<const void *>(channelName.c_str()));
-            okSoFar = doEndTransaction(_db, okSoFar);
+            okSoFar = doEndTransaction(_statements, okSoFar);
             if (okSoFar)
             {
                 okSoFar = (1 <= dummy.size());
@@ -1760,47 +2492,155 @@ RegistryService::checkServiceTimes(void)
 {
     ODL_OBJENTER(); //####
     double           now = yarp::os::Time::now();
+    long             currentTick = wheelTick(now);
     YarpStringVector expired;
 
-    // Build a list of expired services.
+    // Build a list of expired services, from the slots of the expiry wheel that have come due.
     _checkedTimeLock.lock();
-    if (0 < _lastCheckedTime.size())
+    try
     {
-        for (TimeMap::const_iterator walker(_lastCheckedTime.begin());
-             _lastCheckedTime.end() != walker; ++walker)
+        long firstTick = std::max(_nextWheelTick, currentTick - EXPIRY_WHEEL_SLOTS_ + 1);
+
+        _nextWheelTick = currentTick + 1;
+        for (long tick = firstTick; tick <= currentTick; ++tick)
         {
-            double check = walker->second;
+            WheelSlot dueEntries;
 
-            if (now > check)
+            dueEntries.swap(_expiryWheel[static_cast<size_t>(tick % EXPIRY_WHEEL_SLOTS_)]);
+            for (WheelSlot::const_iterator walker(dueEntries.begin()); dueEntries.end() != walker;
+                 ++walker)
             {
-                expired.push_back(walker->first);
+                TimeMap::const_iterator match(_lastCheckedTime.find(walker->first));
+
+                // Entries for channels that were removed, or removed and then added again, are
+                // discarded.
+                if ((_lastCheckedTime.end() != match) &&
+                    (match->second._sequence == walker->second))
+                {
+                    if (now > match->second._deadline)
+                    {
+                        expired.push_back(walker->first);
+                    }
+                    else
+                    {
+                        // The channel was pinged after it was placed in the wheel.
+                        placeInExpiryWheel(walker->first, match->second);
+                    }
+                }
             }
         }
     }
+    catch (...)
+    {
+        _checkedTimeLock.unlock();
+        throw;
+    }
     _checkedTimeLock.unlock();
     if (0 < expired.size())
     {
         for (YarpStringVector::const_iterator walker(expired.begin()); expired.end() != walker;
              ++walker)
         {
-            YarpString channelName(*walker);
+            reportStatusChange(*walker, kRegistryStaleService);
+        }
+        if (removeServiceRecords(expired, true))
+        {
+            for (YarpStringVector::const_iterator walker(expired.begin());
+                 expired.end() != walker; ++walker)
+            {
+                removeCheckedTimeForChannel(*walker);
+            }
+        }
+        else
+        {
+            // Try again at the next check.
+            _checkedTimeLock.lock();
+            try
+            {
+                for (YarpStringVector::const_iterator walker(expired.begin());
+                     expired.end() != walker; ++walker)
+                {
+                    TimeMap::const_iterator match(_lastCheckedTime.find(*walker));
 
-            reportStatusChange(channelName, kRegistryStaleService);
-            if (removeServiceRecord(channelName))
+                    if (_lastCheckedTime.end() != match)
+                    {
+                        placeInExpiryWheel(*walker, match->second);
+                    }
+                }
+            }
+            catch (...)
             {
-                removeCheckedTimeForChannel(channelName);
+                _checkedTimeLock.unlock();
+                throw;
             }
+            _checkedTimeLock.unlock();
         }
     }
     ODL_OBJEXIT(); //####
 } // RegistryService::checkServiceTimes
 
+void
+RegistryService::closeDatabase(void)
+{
+    ODL_OBJENTER(); //####
+    if (_statements)
+    {
+        destroyPreparedStatements(_statements);
+        _statements = NULL;
+    }
+    if (_db)
+    {
+        sqlite3_close(_db);
+        _db = NULL;
+    }
+    ODL_OBJEXIT(); //####
+} // RegistryService::closeDatabase
+
+void
+RegistryService::completeRegistration(const double startTime)
+{
+    ODL_OBJENTER(); //####
+    ODL_D1("startTime = ", startTime); //####
+    double now = yarp::os::Time::now();
+    double elapsed = now - startTime;
+
+    _admissionLock.lock();
+    if (0 < _pendingRegistrations)
+    {
+        --_pendingRegistrations;
+    }
+    if (0 < _averageRegistrationTime)
+    {
+        _averageRegistrationTime += (REGISTRATION_TIME_WEIGHT_ *
+                                     (elapsed - _averageRegistrationTime));
+    }
+    else
+    {
+        _averageRegistrationTime = elapsed;
+    }
+    // The surge has been absorbed once there are no more registrations in progress.
+    if ((0 < _overloadStartTime) && (! _pendingRegistrations))
+    {
+        _herdRecoveryTime = now - _overloadStartTime;
+        _overloadStartTime = 0;
+        ODL_D1("_herdRecoveryTime <- ", _herdRecoveryTime); //####
+    }
+    _admissionLock.unlock();
+    ODL_OBJEXIT(); //####
+} // RegistryService::completeRegistration
+
 void
 RegistryService::detachRequestHandlers(void)
 {
     ODL_OBJENTER(); //####
     try
     {
+        if (_changesHandler)
+        {
+            unregisterRequestHandler(_changesHandler);
+            delete _changesHandler;
+            _changesHandler = NULL;
+        }
         if (_matchHandler)
         {
             unregisterRequestHandler(_matchHandler);
@@ -1831,81 +2671,345 @@ RegistryService::detachRequestHandlers(void)
         ODL_LOG("Exception caught"); //####
         throw;
     }
-    ODL_OBJEXIT(); //####
-} // RegistryService::detachRequestHandlers
+    ODL_OBJEXIT(); //####
+} // RegistryService::detachRequestHandlers
+
+void
+RegistryService::disableMetrics(void)
+{
+    ODL_OBJENTER(); //####
+    inherited::disableMetrics();
+    if (_changesChannel)
+    {
+        _changesChannel->disableMetrics();
+    }
+    if (_statusChannel)
+    {
+        _statusChannel->disableMetrics();
+    }
+    ODL_OBJEXIT(); //####
+} // RegistryService::disableMetrics
+
+void
+RegistryService::enableMetrics(void)
+{
+    ODL_OBJENTER(); //####
+    inherited::enableMetrics();
+    if (_changesChannel)
+    {
+        _changesChannel->enableMetrics();
+    }
+    if (_statusChannel)
+    {
+        _statusChannel->enableMetrics();
+    }
+    ODL_OBJEXIT(); //####
+} // RegistryService::enableMetrics
+
+void
+RegistryService::fillInSecondaryOutputChannelsList(ChannelVector & channels)
+{
+    ODL_OBJENTER(); //####
+    ODL_P1("channels = ", &channels); //####
+    inherited::fillInSecondaryOutputChannelsList(channels);
+    if (_changesChannel)
+    {
+        ChannelDescription descriptor;
+
+        descriptor._portName = _changesChannel->name();
+        descriptor._portProtocol = _changesChannel->protocol();
+        descriptor._portMode = kChannelModeTCP;
+        descriptor._protocolDescription = _changesChannel->protocolDescription();
+        channels.push_back(descriptor);
+    }
+    if (_statusChannel)
+    {
+        ChannelDescription descriptor;
+
+        descriptor._portName = _statusChannel->name();
+        descriptor._portProtocol = _statusChannel->protocol();
+        descriptor._portMode = kChannelModeTCP;
+        descriptor._protocolDescription = _statusChannel->protocolDescription();
+        channels.push_back(descriptor);
+    }
+    ODL_OBJEXIT(); //####
+} // RegistryService::fillInSecondaryOutputChannelsList
+
+void
+RegistryService::gatherMetrics(yarp::os::Bottle & metrics)
+{
+    ODL_OBJENTER(); //####
+    ODL_P1("metrics = ", &metrics); //####
+    inherited::gatherMetrics(metrics);
+    if (_changesChannel)
+    {
+        SendReceiveCounters counters;
+
+        _changesChannel->getSendReceiveCounters(counters);
+        counters.addToList(metrics, _changesChannel->name());
+    }
+    if (_statusChannel)
+    {
+        SendReceiveCounters counters;
+
+        _statusChannel->getSendReceiveCounters(counters);
+        counters.addToList(metrics, _statusChannel->name());
+    }
+    yarp::os::Property & props = metrics.addDict();
+
+    props.put(MpM_SENDRECEIVE_CHANNEL_, MpM_REGISTRY_ENDPOINT_NAME_);
+    if (! _inMemory)
+    {
+        props.put(MpM_REGISTRY_RECOVERED_SERVICES_, _recoveredServices);
+        props.put(MpM_REGISTRY_RECOVERY_TIME_, _recoveryTime);
+    }
+    _admissionLock.lock();
+    props.put(MpM_REGISTRY_REJECTED_REQUESTS_, _rejectedRequests);
+    props.put(MpM_REGISTRY_OVERLOAD_EPISODES_, _overloadEpisodes);
+    props.put(MpM_REGISTRY_HERD_RECOVERY_TIME_, _herdRecoveryTime);
+    _admissionLock.unlock();
+    ODL_OBJEXIT(); //####
+} // RegistryService::gatherMetrics
+
+bool
+RegistryService::loadServiceRegistrations(void)
+{
+    ODL_OBJENTER(); //####
+    bool okSoFar = false;
+
+    try
+    {
+        static const char * selectServices = T_("SELECT " CHANNELNAME_C_ "," NAME_C_ ","
+                                                DESCRIPTION_C_ "," EXECUTABLE_C_ ","
+                                                EXTRAINFO_C_ "," REQUESTSDESCRIPTION_C_ ","
+                                                TAG_C_ " FROM " SERVICES_T_);
+        static const char * selectRequests = T_("SELECT " CHANNELNAME_C_ "," REQUEST_C_ ","
+                                                INPUT_C_ "," OUTPUT_C_ "," VERSION_C_ ","
+                                                DETAILS_C_ "," KEY_C_ " FROM " REQUESTS_T_
+                                                " ORDER BY " KEY_C_);
+        static const char * selectLinks = T_("SELECT " KEYWORDS_ID_C_ "," REQUESTS_ID_C_ " FROM "
+                                             REQUESTSKEYWORDS_T_);
+        YarpStringVector    serviceValues;
+        YarpStringVector    requestValues;
+        YarpStringVector    linkValues;
+
+        if (doBeginTransaction(_statements))
+        {
+            okSoFar = performSQLstatementWithRowResultsNoArgs(_db, serviceValues, selectServices,
+                                                              7);
+            if (okSoFar)
+            {
+                okSoFar = performSQLstatementWithRowResultsNoArgs(_db, requestValues,
+                                                                  selectRequests, 7);
+            }
+            if (okSoFar)
+            {
+                okSoFar = performSQLstatementWithRowResultsNoArgs(_db, linkValues, selectLinks, 2);
+            }
+            okSoFar = doEndTransaction(_statements, okSoFar);
+        }
+        if (okSoFar)
+        {
+            typedef std::map<YarpString, ServiceRegistration> RegistrationMap;
+            typedef std::map<YarpString, size_t>              RequestKeyMap;
+
+            RegistrationMap          registrations;
+            RequestDescriptionVector requests;
+            RequestKeyMap            requestKeys;
+
+            for (size_t ii = 0, mm = serviceValues.size(); mm > ii; ii += 7)
+            {
+                ServiceRegistration & aRegistration = registrations[serviceValues[ii]];
+
+                aRegistration._channel = serviceValues[ii];
+                aRegistration._name = serviceValues[ii + 1];
+                aRegistration._description = serviceValues[ii + 2];
+                aRegistration._executable = serviceValues[ii + 3];
+                aRegistration._extraInfo = serviceValues[ii + 4];
+                aRegistration._requestsDescription = serviceValues[ii + 5];
+                aRegistration._tag = serviceValues[ii + 6];
+            }
+            for (size_t ii = 0, mm = requestValues.size(); mm > ii; ii += 7)
+            {
+                RequestDescription aRequest;
+
+                aRequest._channel = requestValues[ii];
+                aRequest._request = requestValues[ii + 1];
+                aRequest._inputs = requestValues[ii + 2];
+                aRequest._outputs = requestValues[ii + 3];
+                aRequest._version = requestValues[ii + 4];
+                aRequest._details = requestValues[ii + 5];
+                requestKeys[requestValues[ii + 6]] = requests.size();
+                requests.push_back(aRequest);
+            }
+            for (size_t ii = 0, mm = linkValues.size(); mm > ii; ii += 2)
+            {
+                RequestKeyMap::const_iterator match(requestKeys.find(linkValues[ii + 1]));
+
+                if (requestKeys.end() != match)
+                {
+                    requests[match->second]._keywords.push_back(linkValues[ii]);
+                }
+            }
+            for (RequestDescriptionVector::const_iterator walker(requests.begin());
+                 requests.end() != walker; ++walker)
+            {
+                RegistrationMap::iterator match(registrations.find(walker->_channel));
+
+                if (registrations.end() != match)
+                {
+                    match->second._requests.push_back(*walker);
+                }
+            }
+            // The recovered services are not recorded as changes; a subscriber is disconnected by
+            // the restart and so will request the registered services when it reconnects.
+            _changesLock.lock();
+            try
+            {
+                for (RegistrationMap::const_iterator walker(registrations.begin());
+                     registrations.end() != walker; ++walker)
+                {
+                    _matchIndex->addService(walker->second);
+                }
+            }
+            catch (...)
+            {
+                _changesLock.unlock();
+                throw;
+            }
+            _changesLock.unlock();
+            for (RegistrationMap::const_iterator walker(registrations.begin());
+                 registrations.end() != walker; ++walker)
+            {
+                // The registry is not checked for liveness, as it does not ping itself.
+                if (walker->first != MpM_REGISTRY_ENDPOINT_NAME_)
+                {
+                    updateCheckedTimeForChannel(walker->first);
+                }
+            }
+            _recoveredServices = static_cast<int>(registrations.size());
+            ODL_I1("_recoveredServices <- ", _recoveredServices); //####
+        }
+    }
+    catch (...)
+    {
+        ODL_LOG("Exception caught"); //####
+        throw;
+    }
+    ODL_OBJEXIT_B(okSoFar); //####
+    return okSoFar;
+} // RegistryService::loadServiceRegistrations
 
-void
-RegistryService::disableMetrics(void)
+bool
+RegistryService::openDatabase(const YarpString & dbFileName)
 {
     ODL_OBJENTER(); //####
-    inherited::disableMetrics();
-    if (_statusChannel)
+    ODL_S1s("dbFileName = ", dbFileName); //####
+    bool okSoFar;
+    int  sqlRes = sqlite3_open_v2(dbFileName.c_str(), &_db,
+                                  SQLITE_OPEN_READWRITE | SQLITE_OPEN_CREATE, NULL);
+
+    if (SQLITE_OK == sqlRes)
     {
-        _statusChannel->disableMetrics();
+        okSoFar = (_inMemory || tuneDatabase(_db));
+        if (! okSoFar)
+        {
+            ODL_LOG("(! okSoFar)"); //####
+        }
     }
-    ODL_OBJEXIT(); //####
-} // RegistryService::disableMetrics
-
-void
-RegistryService::enableMetrics(void)
-{
-    ODL_OBJENTER(); //####
-    inherited::enableMetrics();
-    if (_statusChannel)
+    else
     {
-        _statusChannel->enableMetrics();
+        ODL_LOG("! (SQLITE_OK == sqlRes)"); //####
+        okSoFar = false;
     }
-    ODL_OBJEXIT(); //####
-} // RegistryService::enableMetrics
+    if (! okSoFar)
+    {
+        sqlite3_close(_db);
+        _db = NULL;
+    }
+    ODL_OBJEXIT_B(okSoFar); //####
+    return okSoFar;
+} // RegistryService::openDatabase
 
 void
-RegistryService::fillInSecondaryOutputChannelsList(ChannelVector & channels)
+RegistryService::placeInExpiryWheel(const YarpString &  serviceChannelName,
+                                    const CheckedTime & info)
 {
     ODL_OBJENTER(); //####
-    ODL_P1("channels = ", &channels); //####
-    inherited::fillInSecondaryOutputChannelsList(channels);
-    if (_statusChannel)
-    {
-        ChannelDescription descriptor;
+    ODL_S1s("serviceChannelName = ", serviceChannelName); //####
+    ODL_P1("info = ", &info); //####
+    // A deadline that falls in an interval that has already been checked is placed in the next
+    // interval to be checked.
+    long        tick = std::max(wheelTick(info._deadline), _nextWheelTick);
+    WheelSlot & aSlot = _expiryWheel[static_cast<size_t>(tick % EXPIRY_WHEEL_SLOTS_)];
 
-        descriptor._portName = _statusChannel->name();
-        descriptor._portProtocol = _statusChannel->protocol();
-        descriptor._portMode = kChannelModeTCP;
-        descriptor._protocolDescription = _statusChannel->protocolDescription();
-        channels.push_back(descriptor);
-    }
+    aSlot.push_back(WheelEntry(serviceChannelName, info._sequence));
     ODL_OBJEXIT(); //####
-} // RegistryService::fillInSecondaryOutputChannelsList
+} // RegistryService::placeInExpiryWheel
 
 void
-RegistryService::gatherMetrics(yarp::os::Bottle & metrics)
+RegistryService::processChangesRequest(const int          sinceVersion,
+                                       yarp::os::Bottle & reply)
 {
     ODL_OBJENTER(); //####
-    ODL_P1("metrics = ", &metrics); //####
-    inherited::gatherMetrics(metrics);
-    if (_statusChannel)
+    ODL_I1("sinceVersion = ", sinceVersion); //####
+    ODL_P1("reply = ", &reply); //####
+    _changesLock.lock();
+    try
     {
-        SendReceiveCounters counters;
+        // The retained changes have consecutive versions, ending with the current version.
+        int oldestKnown = _changesVersion - static_cast<int>(_changes.size());
 
-        _statusChannel->getSendReceiveCounters(counters);
-        counters.addToList(metrics, _statusChannel->name());
+        reply.addInt(_changesVersion);
+        if ((0 <= sinceVersion) && (oldestKnown <= sinceVersion) &&
+            (_changesVersion >= sinceVersion))
+        {
+            reply.addString(MpM_REGISTRY_CHANGES_DELTAS_);
+            yarp::os::Bottle & changes = reply.addList();
+
+            for (ServiceChangeLog::const_iterator walker(_changes.begin());
+                 _changes.end() != walker; ++walker)
+            {
+                if (sinceVersion < walker->_version)
+                {
+                    yarp::os::Bottle & aChange = changes.addList();
+
+                    aChange.addInt(walker->_version);
+                    aChange.addString(walker->_kind);
+                    aChange.addString(walker->_channel);
+                    aChange.addString(walker->_name);
+                }
+            }
+        }
+        else
+        {
+            reply.addString(MpM_REGISTRY_CHANGES_SNAPSHOT_);
+            _matchIndex->fillInServices(reply.addList());
+        }
+    }
+    catch (...)
+    {
+        _changesLock.unlock();
+        ODL_LOG("Exception caught"); //####
+        throw;
     }
+    _changesLock.unlock();
     ODL_OBJEXIT(); //####
-} // RegistryService::gatherMetrics
+} // RegistryService::processChangesRequest
 
 bool
-RegistryService::processDictionaryEntry(yarp::os::Property & asDict,
-                                        const YarpString &   channelName)
+RegistryService::processDictionaryEntry(yarp::os::Property &  asDict,
+                                        const YarpString &    channelName,
+                                        ServiceRegistration & registration)
 {
     ODL_ENTER(); //####
-    ODL_P1("asDict = ", &asDict); //####
+    ODL_P2("asDict = ", &asDict, "registration = ", &registration); //####
     ODL_S1s("channelName = ", channelName); //####
     bool result = true;
 
     if (asDict.check(MpM_REQREP_DICT_REQUEST_KEY_))
     {
         YarpString         theRequest(asDict.find(MpM_REQREP_DICT_REQUEST_KEY_).asString());
-        yarp::os::Bottle   keywordList;
         RequestDescription requestDescriptor;
 
         ODL_S1s("theRequest <- ", theRequest); //####
@@ -1948,7 +3052,23 @@ RegistryService::processDictionaryEntry(yarp::os::Property & asDict,
             ODL_S1s("theKeywords <- ", theKeywords.toString()); //####
             if (theKeywords.isList())
             {
-                keywordList = *theKeywords.asList();
+                yarp::os::Bottle * keywordList = theKeywords.asList();
+
+                for (int ii = 0, numKeywords = keywordList->size();
+                     result && (ii < numKeywords); ++ii)
+                {
+                    yarp::os::Value & aKeyword(keywordList->get(ii));
+
+                    if (aKeyword.isString())
+                    {
+                        requestDescriptor._keywords.push_back(aKeyword.toString());
+                    }
+                    else
+                    {
+                        ODL_LOG("! (aKeyword.isString())"); //####
+                        result = false;
+                    }
+                }
             }
             else
             {
@@ -1994,13 +3114,7 @@ RegistryService::processDictionaryEntry(yarp::os::Property & asDict,
         {
             requestDescriptor._channel = channelName;
             requestDescriptor._request = theRequest;
-            result = addRequestRecord(keywordList, requestDescriptor);
-            ODL_B1("result <- ", result); //####
-            if (! result)
-            {
-                // We need to remove any values that we've recorded for this channel!
-                removeServiceRecord(channelName);
-            }
+            registration._requests.push_back(requestDescriptor);
         }
     }
     else
@@ -2015,10 +3129,12 @@ RegistryService::processDictionaryEntry(yarp::os::Property & asDict,
 
 bool
 RegistryService::processListResponse(const YarpString &      channelName,
-                                     const ServiceResponse & response)
+                                     const ServiceResponse & response,
+                                     ServiceRegistration &   registration)
 {
     ODL_OBJENTER(); //####
     ODL_S2s("channelName = ", channelName, "response = ", response.asString()); //####
+    ODL_P1("registration = ", &registration); //####
     bool result = false;
 
     try
@@ -2038,7 +3154,7 @@ RegistryService::processListResponse(const YarpString &      channelName,
 
                     if (asDict)
                     {
-                        result = processDictionaryEntry(*asDict, channelName);
+                        result = processDictionaryEntry(*asDict, channelName, registration);
                     }
                 }
                 else if (anElement.isList())
@@ -2051,7 +3167,7 @@ RegistryService::processListResponse(const YarpString &      channelName,
 
                         if (ListIsReallyDictionary(*asList, asDict))
                         {
-                            result = processDictionaryEntry(asDict, channelName);;
+                            result = processDictionaryEntry(asDict, channelName, registration);
                         }
                         else
                         {
@@ -2069,6 +3185,10 @@ RegistryService::processListResponse(const YarpString &      channelName,
                     result = false;
                 }
             }
+            if (result)
+            {
+                result = addServiceRegistration(registration);
+            }
         }
         else
         {
@@ -2100,8 +3220,22 @@ RegistryService::processMatchRequest(Parser::MatchExpression * matcher,
     {
         if (matcher)
         {
-            if (doBeginTransaction(_db))
+            YarpStringVector matches;
+
+            if (_matchIndex->evaluate(*matcher, getNames, matches))
+            {
+                yarp::os::Bottle & subList = reply.addList();
+
+                for (YarpStringVector::const_iterator walker(matches.begin());
+                     matches.end() != walker; ++walker)
+                {
+                    subList.addString(*walker);
+                }
+                okSoFar = true;
+            }
+            else if (doBeginTransaction(_statements))
             {
+                // The expression refers to a field that is not in the index.
                 yarp::os::Bottle &  subList = reply.addList();
                 static const char * sqlStartGetNames = T_("SELECT DISTINCT " NAME_C_ " FROM "
                                                           SERVICES_T_ " WHERE " CHANNELNAME_C_
@@ -2114,9 +3248,9 @@ RegistryService::processMatchRequest(Parser::MatchExpression * matcher,
                 YarpString          requestAsSQL(matcher->asSQLString(sqlStart, sqlEnd));
 
                 ODL_S1s("requestAsSQL <- ", requestAsSQL); //####
-                okSoFar = performSQLstatementWithSingleColumnResults(_db, subList,
-                                                                     requestAsSQL.c_str());
-                okSoFar = doEndTransaction(_db, okSoFar);
+                okSoFar = performSQLstatementWithSingleColumnResultsNoArgs(_db, subList,
+                                                                           requestAsSQL.c_str());
+                okSoFar = doEndTransaction(_statements, okSoFar);
             }
         }
         else
@@ -2135,10 +3269,12 @@ RegistryService::processMatchRequest(Parser::MatchExpression * matcher,
 
 bool
 RegistryService::processNameResponse(const YarpString &      channelName,
-                                     const ServiceResponse & response)
+                                     const ServiceResponse & response,
+                                     ServiceRegistration &   registration)
 {
     ODL_OBJENTER(); //####
     ODL_S2s("channelName = ", channelName, "response = ", response.asString()); //####
+    ODL_P1("registration = ", &registration); //####
     bool result = false;
 
     try
@@ -2157,15 +3293,15 @@ RegistryService::processNameResponse(const YarpString &      channelName,
                 theExtraInformation.isString() && theKind.isString() && thePath.isString() &&
                 theRequestsDescription.isString())
             {
-                result = addServiceRecord(channelName, theCanonicalName.toString(),
-                                          theTag.toString(), theDescription.toString(),
-                                          theExtraInformation.toString(), thePath.toString(),
-                                          theRequestsDescription.toString());
-                if (! result)
-                {
-                    // We need to remove any values that we've recorded for this channel!
-                    removeServiceRecord(channelName);
-                }
+                registration._channel = channelName;
+                registration._name = theCanonicalName.toString();
+                registration._tag = theTag.toString();
+                registration._description = theDescription.toString();
+                registration._extraInfo = theExtraInformation.toString();
+                registration._executable = thePath.toString();
+                registration._requestsDescription = theRequestsDescription.toString();
+                registration._requests.clear();
+                result = true;
             }
             else
             {
@@ -2192,6 +3328,45 @@ RegistryService::processNameResponse(const YarpString &      channelName,
     return result;
 } // RegistryService::processNameResponse
 
+void
+RegistryService::recordServiceChange(const char *       kind,
+                                     const YarpString & channelName,
+                                     const YarpString & serviceName)
+{
+    ODL_OBJENTER(); //####
+    ODL_S1("kind = ", kind); //####
+    ODL_S2s("channelName = ", channelName, "serviceName = ", serviceName); //####
+    ServiceChange aChange;
+
+    aChange._version = ++_changesVersion;
+    aChange._kind = kind;
+    aChange._channel = channelName;
+    aChange._name = serviceName;
+    _changes.push_back(aChange);
+    if (CHANGE_LOG_SIZE_ < _changes.size())
+    {
+        _changes.pop_front();
+    }
+    // The change is sent while the lock is held, so that the subscribers see the changes in order.
+    if (_changesChannel)
+    {
+        yarp::os::Bottle message;
+
+        message.addInt(aChange._version);
+        message.addString(kind);
+        message.addString(channelName);
+        message.addString(serviceName);
+        if (! _changesChannel->writeBottle(message))
+        {
+            ODL_LOG("(! _changesChannel->writeBottle(message))"); //####
+#if defined(MpM_StallOnSendProblem)
+            Stall();
+#endif // defined(MpM_StallOnSendProblem)
+        }
+    }
+    ODL_OBJEXIT(); //####
+} // RegistryService::recordServiceChange
+
 void
 RegistryService::removeCheckedTimeForChannel(const YarpString & serviceChannelName)
 {
@@ -2207,44 +3382,87 @@ RegistryService::removeServiceRecord(const YarpString & serviceChannelName)
 {
     ODL_OBJENTER(); //####
     ODL_S1s("serviceChannelName = ", serviceChannelName); //####
+    bool             okSoFar;
+    YarpStringVector serviceChannelNames;
+
+    serviceChannelNames.push_back(serviceChannelName);
+    okSoFar = removeServiceRecords(serviceChannelNames);
+    ODL_OBJEXIT_B(okSoFar); //####
+    return okSoFar;
+} // RegistryService::removeServiceRecord
+
+bool
+RegistryService::removeServiceRecords(const YarpStringVector & serviceChannelNames,
+                                      const bool               areStale)
+{
+    ODL_OBJENTER(); //####
+    ODL_P1("serviceChannelNames = ", &serviceChannelNames); //####
+    ODL_B1("areStale = ", areStale); //####
     bool okSoFar = false;
 
     try
     {
-        if (doBeginTransaction(_db))
+        if (doBeginTransaction(_statements))
         {
-            // Remove the service channel requests.
-            static const char * removeFromRequestsKeywords = T_("DELETE FROM " REQUESTSKEYWORDS_T_
-                                                                " WHERE " REQUESTS_ID_C_
-                                                                " IN (SELECT " KEY_C_ " FROM "
-                                                                REQUESTS_T_ " WHERE " CHANNELNAME_C_
-                                                                " = @" CHANNELNAME_C_ ")");
-
-            okSoFar = performSQLstatementWithNoResults(_db, removeFromRequestsKeywords,
-                                                       setupRemoveFromRequestsKeywords,
-                                           static_cast<const void *>(serviceChannelName.c_str()));
-            if (okSoFar)
+            okSoFar = true;
+            for (YarpStringVector::const_iterator walker(serviceChannelNames.begin());
+                 okSoFar && (serviceChannelNames.end() != walker); ++walker)
             {
-                // Remove the service channel requests.
-                static const char * removeFromRequests = T_("DELETE FROM " REQUESTS_T_ " WHERE "
-                                                            CHANNELNAME_C_ " = @" CHANNELNAME_C_);
+                const char * serviceChannelName = walker->c_str();
 
-                okSoFar = performSQLstatementWithNoResults(_db, removeFromRequests,
-                                                           setupRemoveFromRequests,
-                                           static_cast<const void *>(serviceChannelName.c_str()));
+                // Remove the service channel requests.
+                okSoFar = performSQLstatementWithNoResults(_statements,
+                                                           kStatementRemoveFromRequestsKeywords,
+                                                           setupRemoveFromRequestsKeywords,
+                                                   static_cast<const void *>(serviceChannelName));
+                if (okSoFar)
+                {
+                    // Remove the service channel requests.
+                    okSoFar = performSQLstatementWithNoResults(_statements,
+                                                               kStatementRemoveFromRequests,
+                                                               setupRemoveFromRequests,
+                                                   static_cast<const void *>(serviceChannelName));
+                }
+                if (okSoFar)
+                {
+                    // Remove the service channel name.
+                    okSoFar = performSQLstatementWithNoResults(_statements,
+                                                               kStatementRemoveFromServices,
+                                                               setupRemoveFromServices,
+                                                   static_cast<const void *>(serviceChannelName));
+                }
             }
+            okSoFar = doEndTransaction(_statements, okSoFar);
             if (okSoFar)
             {
-                // Remove the service channel name.
-                static const char * removeFromServices = T_("DELETE FROM " SERVICES_T_ " WHERE "
-                                                            CHANNELNAME_C_ " = @" CHANNELNAME_C_);
+                _changesLock.lock();
+                try
+                {
+                    for (YarpStringVector::const_iterator walker(serviceChannelNames.begin());
+                         serviceChannelNames.end() != walker; ++walker)
+                    {
+                        YarpString serviceName;
 
-                okSoFar = performSQLstatementWithNoResults(_db, removeFromServices,
-                                                           setupRemoveFromServices,
-                                           static_cast<const void *>(serviceChannelName.c_str()));
+                        if (_matchIndex->removeService(*walker, serviceName))
+                        {
+                            recordServiceChange(areStale ? MpM_REGISTRY_CHANGE_STALE_ :
+                                                MpM_REGISTRY_CHANGE_REMOVED_, *walker,
+                                                serviceName);
+                        }
+                    }
+                }
+                catch (...)
+                {
+                    _changesLock.unlock();
+                    throw;
+                }
+                _changesLock.unlock();
+            }
+            for (YarpStringVector::const_iterator walker(serviceChannelNames.begin());
+                 serviceChannelNames.end() != walker; ++walker)
+            {
+                reportStatusChange(*walker, kRegistryRemoveService);
             }
-            okSoFar = doEndTransaction(_db, okSoFar);
-            reportStatusChange(serviceChannelName, kRegistryRemoveService);
         }
     }
     catch (...)
@@ -2254,7 +3472,7 @@ RegistryService::removeServiceRecord(const YarpString & serviceChannelName)
     }
     ODL_OBJEXIT_B(okSoFar); //####
     return okSoFar;
-} // RegistryService::removeServiceRecord
+} // RegistryService::removeServiceRecords
 
 void
 RegistryService::reportStatusChange(const YarpString &  channelName,
@@ -2311,6 +3529,11 @@ RegistryService::reportStatusChange(const YarpString &  channelName,
                 message.addString(channelName);
                 break;
 
+            case kRegistryRecoveredServices :
+                message.addString(MpM_REGISTRY_STATUS_RECOVERED_);
+                message.addString(details);
+                break;
+
             case kRegistryRegisterService :
                 message.addString(MpM_REGISTRY_STATUS_REGISTERING_);
                 message.addString(channelName);
@@ -2356,49 +3579,145 @@ RegistryService::reportStatusChange(const YarpString &  channelName,
 } // RegistryService::reportStatusChange
 
 bool
-RegistryService::setUpDatabase(void)
+RegistryService::setUpChangesChannel(void)
 {
     ODL_OBJENTER(); //####
-    bool okSoFar = true;
+    bool okSoFar = false;
 
     try
     {
-        int sqlRes;
-
-        if (! _db)
+        _changesChannel = new GeneralChannel(true);
+        if (_changesChannel)
         {
-            const char * dbFileName;
+            YarpString              outputName(MpM_REGISTRY_CHANGES_NAME_);
+#if defined(MpM_ReportOnConnections)
+            ChannelStatusReporter * reporter = Utilities::GetGlobalStatusReporter();
+#endif // defined(MpM_ReportOnConnections)
 
-#if defined(MpM_UseTestDatabase)
-            dbFileName = "/tmp/test.db";
-#else // ! defined(MpM_UseTestDatabase)
-            if (_inMemory)
+#if defined(MpM_ReportOnConnections)
+            _changesChannel->setReporter(*reporter);
+            _changesChannel->getReport(*reporter);
+#endif // defined(MpM_ReportOnConnections)
+            if (metricsAreEnabled())
+            {
+                _changesChannel->enableMetrics();
+            }
+            else
+            {
+                _changesChannel->disableMetrics();
+            }
+            if (_changesChannel->openWithRetries(outputName, STANDARD_WAIT_TIME_))
             {
-                dbFileName = ":memory:";
+                _changesChannel->setProtocol("isss", "A version, the kind of change, the service "
+                                             "channel and the service name");
+                invalidateCachedReplies();
+                okSoFar = true;
             }
             else
             {
-                dbFileName = "";
+                ODL_LOG("! (_changesChannel->openWithRetries(outputName, " //####
+                        "STANDARD_WAIT_TIME_))"); //####
             }
+        }
+        else
+        {
+            ODL_LOG("! (_changesChannel)"); //####
+        }
+    }
+    catch (...)
+    {
+        ODL_LOG("Exception caught"); //####
+        throw;
+    }
+    ODL_OBJEXIT_B(okSoFar); //####
+    return okSoFar;
+} // RegistryService::setUpChangesChannel
+
+bool
+RegistryService::setUpDatabase(void)
+{
+    ODL_OBJENTER(); //####
+    bool okSoFar = true;
+
+    try
+    {
+        double     startTime = yarp::os::Time::now();
+        YarpString dbFileName;
+
+#if defined(MpM_UseTestDatabase)
+        dbFileName = GetPersistentDatabasePath();
+#else // ! defined(MpM_UseTestDatabase)
+        if (_inMemory)
+        {
+            dbFileName = ":memory:";
+        }
+        else
+        {
+            dbFileName = GetPersistentDatabasePath();
+        }
 #endif // ! defined(MpM_UseTestDatabase)
-            sqlRes = sqlite3_open_v2(dbFileName, &_db, SQLITE_OPEN_READWRITE | SQLITE_OPEN_CREATE,
-                                     NULL);
-            if (SQLITE_OK != sqlRes)
+        ODL_S1s("dbFileName <- ", dbFileName); //####
+        if (! _db)
+        {
+            okSoFar = openDatabase(dbFileName);
+            if ((! okSoFar) && (! _inMemory))
             {
-                ODL_LOG("(SQLITE_OK != sqlRes)"); //####
-                okSoFar = false;
-                sqlite3_close(_db);
-                _db = NULL;
+                // A file that is not a usable database is replaced; the services are recorded
+                // again when they next ping the registry.
+                MpM_WARNING_("The registry database could not be opened; a new one is being "
+                             "started.");
+                RemovePersistentDatabase();
+                okSoFar = openDatabase(dbFileName);
             }
         }
         if (_db)
         {
-            okSoFar = constructTables(_db);
+            bool schemaIsCurrent = true;
+
+            if (! _inMemory)
+            {
+                if (! checkDatabase(_db, schemaIsCurrent))
+                {
+                    MpM_WARNING_("The registry database is damaged; a new one is being started.");
+                    closeDatabase();
+                    RemovePersistentDatabase();
+                    okSoFar = openDatabase(dbFileName);
+                    schemaIsCurrent = true;
+                }
+                else if (! schemaIsCurrent)
+                {
+                    MpM_WARNING_("The registry database has an earlier layout; its tables are "
+                                 "being rebuilt.");
+                }
+            }
+            if (okSoFar && (! _statements))
+            {
+                _statements = createPreparedStatements(_db);
+            }
+            if (okSoFar && (! schemaIsCurrent))
+            {
+                okSoFar = dropTables(_statements);
+            }
+            if (okSoFar)
+            {
+                okSoFar = constructTables(_statements);
+            }
+            if (okSoFar && (! _inMemory))
+            {
+                okSoFar = setSchemaVersion(_db);
+                if (okSoFar && (! loadServiceRegistrations()))
+                {
+                    MpM_WARNING_("The registered services could not be recovered from the registry "
+                                 "database; its tables are being rebuilt.");
+                    okSoFar = (dropTables(_statements) && constructTables(_statements));
+                }
+                _recoveryTime = yarp::os::Time::now() - startTime;
+                ODL_D1("_recoveryTime <- ", _recoveryTime); //####
+            }
             if (! okSoFar)
             {
                 ODL_LOG("(! okSoFar)"); //####
-                sqlite3_close(_db);
-                _db = NULL;
+                closeDatabase();
             }
         }
     }
@@ -2442,6 +3761,7 @@ RegistryService::setUpStatusChannel(void)
             if (_statusChannel->openWithRetries(outputName, STANDARD_WAIT_TIME_))
             {
                 _statusChannel->setProtocol("s+", "One or more strings");
+                invalidateCachedReplies();
                 okSoFar = true;
             }
             else
@@ -2475,7 +3795,8 @@ RegistryService::startService(void)
         if ((! isActive()) && (! isStarted()))
         {
             inherited::startService();
-            if (isStarted() && setUpDatabase() && setUpStatusChannel())
+            if (isStarted() && setUpDatabase() && setUpStatusChannel() &&
+                setUpChangesChannel())
             {
                 // Register ourselves!!!
                 YarpString      aName(GetRandomChannelName(HIDDEN_CHANNEL_PREFIX_ "temp_"
@@ -2497,7 +3818,12 @@ RegistryService::startService(void)
                         if (Utilities::NetworkConnectWithRetries(aName, MpM_REGISTRY_ENDPOINT_NAME_,
                                                                  STANDARD_WAIT_TIME_))
                         {
-                            yarp::os::Bottle parameters(MpM_REGISTRY_ENDPOINT_NAME_);
+                            yarp::os::Bottle parameters;
+
+                            // Describe ourselves, so that we aren't asked for the details.
+                            parameters.addString(MpM_REGISTRY_ENDPOINT_NAME_);
+                            fillInNameReply(parameters.addList());
+                            fillInListReply(parameters.addList());
                             ServiceRequest   request(MpM_REGISTER_REQUEST_, parameters);
                             ServiceResponse  response;
 
@@ -2554,13 +3880,21 @@ RegistryService::startService(void)
             }
             else
             {
-                ODL_LOG("! (isStarted() && setUpDatabase() && setUpStatusChannel())"); //####
+                ODL_LOG("! (isStarted() && setUpDatabase() && setUpStatusChannel() && " //####
+                        "setUpChangesChannel())"); //####
             }
         }
         result = isStarted();
         if (result)
         {
             reportStatusChange("", kRegistryStarted);
+            if (0 < _recoveredServices)
+            {
+                std::stringstream buff;
+
+                buff << _recoveredServices << " services in " << _recoveryTime << " seconds";
+                reportStatusChange("", kRegistryRecoveredServices, buff.str());
+            }
         }
     }
     catch (...)
@@ -2630,9 +3964,33 @@ void
 RegistryService::updateCheckedTimeForChannel(const YarpString & serviceChannelName)
 {
     ODL_OBJENTER(); //####
+    ODL_S1s("serviceChannelName = ", serviceChannelName); //####
+    double deadline = yarp::os::Time::now() + (PING_COUNT_MAX_ * PING_INTERVAL_);
+
     _checkedTimeLock.lock();
-    _lastCheckedTime[serviceChannelName] = yarp::os::Time::now() +
-                                            (PING_COUNT_MAX_ * PING_INTERVAL_);
+    try
+    {
+        TimeMap::iterator match(_lastCheckedTime.find(serviceChannelName));
+
+        if (_lastCheckedTime.end() == match)
+        {
+            CheckedTime & info = _lastCheckedTime[serviceChannelName];
+
+            info._deadline = deadline;
+            info._sequence = _nextWheelSequence++;
+            placeInExpiryWheel(serviceChannelName, info);
+        }
+        else
+        {
+            // The channel will be moved to the right slot when its current slot comes due.
+            match->second._deadline = deadline;
+        }
+    }
+    catch (...)
+    {
+        _checkedTimeLock.unlock();
+        throw;
+    }
     _checkedTimeLock.unlock();
     ODL_OBJEXIT(); //####
 } // RegistryService::updateCheckedTimeForChannel
@@ -44,6 +44,8 @@
 # include <m+m/m+mMatchExpression.hpp>
 # include <m+m/m+mServiceResponse.hpp>
 
+# include <deque>
+
 # if defined(__APPLE__)
 #  pragma clang diagnostic push
 #  pragma clang diagnostic ignored "-Wunknown-pragmas"
@@ -67,13 +69,17 @@ namespace MplusM
 {
     namespace Registry
     {
+        class ChangesRequestHandler;
         class ColumnNameValidator;
+        class MatchIndex;
         class MatchRequestHandler;
         class PingRequestHandler;
         class RegisterRequestHandler;
         class RegistryCheckThread;
         class UnregisterRequestHandler;
 
+        struct PreparedStatements;
+
         /*! @brief The characteristics of a request. */
         struct RequestDescription
         {
@@ -83,6 +89,9 @@ namespace MplusM
             /*! @brief The inputs descriptor for the request. */
             YarpString _inputs;
 
+            /*! @brief The keywords for the request. */
+            YarpStringVector _keywords;
+
             /*! @brief The outputs descriptor for the request. */
             YarpString _outputs;
 
@@ -97,6 +106,38 @@ namespace MplusM
 
         }; // RequestDescription
 
+        /*! @brief A sequence of request descriptions. */
+        typedef std::vector<RequestDescription> RequestDescriptionVector;
+
+        /*! @brief The characteristics of a service that is being registered. */
+        struct ServiceRegistration
+        {
+            /*! @brief The service channel for the service. */
+            YarpString _channel;
+
+            /*! @brief The description of the service. */
+            YarpString _description;
+
+            /*! @brief The path to the executable for the service. */
+            YarpString _executable;
+
+            /*! @brief The extra information for the service. */
+            YarpString _extraInfo;
+
+            /*! @brief The name of the service. */
+            YarpString _name;
+
+            /*! @brief The description of the requests for the service. */
+            YarpString _requestsDescription;
+
+            /*! @brief The tag modifier for the service. */
+            YarpString _tag;
+
+            /*! @brief The requests for the service. */
+            RequestDescriptionVector _requests;
+
+        }; // ServiceRegistration
+
         /*! @brief The m+m %Registry Service. */
         class RegistryService : public Common::BaseService
         {
@@ -109,8 +150,46 @@ namespace MplusM
             /*! @brief The class that this class is derived from. */
             typedef BaseService inherited;
 
-            /*! @brief A mapping from strings to time values. */
-            typedef std::map<YarpString, double> TimeMap;
+            /*! @brief The liveness information for a service channel. */
+            struct CheckedTime
+            {
+                /*! @brief The time after which the service channel is considered stale. */
+                double _deadline;
+
+                /*! @brief The sequence number of the service channel in the expiry wheel. */
+                size_t _sequence;
+
+            }; // CheckedTime
+
+            /*! @brief A mapping from strings to liveness information. */
+            typedef std::map<YarpString, CheckedTime> TimeMap;
+
+            /*! @brief A service channel in a slot of the expiry wheel, along with its sequence
+             number when it was placed in the slot. */
+            typedef std::pair<YarpString, size_t> WheelEntry;
+
+            /*! @brief The service channels that are due to be checked during a single interval. */
+            typedef std::vector<WheelEntry> WheelSlot;
+
+            /*! @brief A change to the set of registered services. */
+            struct ServiceChange
+            {
+                /*! @brief The version of the set of registered services after the change. */
+                int _version;
+
+                /*! @brief The kind of change. */
+                const char * _kind;
+
+                /*! @brief The service channel that was changed. */
+                YarpString _channel;
+
+                /*! @brief The name of the service that was changed. */
+                YarpString _name;
+
+            }; // ServiceChange
+
+            /*! @brief The most recent changes to the set of registered services, oldest first. */
+            typedef std::deque<ServiceChange> ServiceChangeLog;
 
         public :
 
@@ -132,6 +211,9 @@ namespace MplusM
                 /*! @brief A service could not be added to the registry. */
                 kRegistryProblemAddingService,
 
+                /*! @brief Services were recovered from the persistent database. */
+                kRegistryRecoveredServices,
+
                 /*! @brief A service is being registered in the registry. */
                 kRegistryRegisterService,
 
@@ -160,7 +242,8 @@ namespace MplusM
              @param[in] argc The number of arguments in 'argv'.
              @param[in] argv The arguments passed to the executable used to launch the service.
              @param[in] useInMemoryDb @c true if the database is in-memory and @c false if a
-             temporary disk file is to be used.
+             persistent disk file is to be used, so that the registered services survive a restart
+             of the service.
              @param[in] servicePortNumber The port being used by the service. */
             RegistryService(const YarpString & launchPath,
                             const int          argc,
@@ -172,6 +255,16 @@ namespace MplusM
             virtual
             ~RegistryService(void);
 
+            /*! @brief Decide whether there is room for another registration to be performed.
+
+             A registration that is admitted must be followed by a call to completeRegistration().
+             @param[out] retryAfter The number of seconds that the requesting service should wait
+             before trying again, if the registration is not admitted.
+             @return @c true if the registration can be performed and @c false if the %Registry
+             Service is overloaded. */
+            bool
+            admitRegistration(double & retryAfter);
+
             /*! @brief Check if a service is already in the registry.
              @param[in] channelName The service channel for the service.
              @return @c true if the service is present and @c false otherwise. */
@@ -182,6 +275,11 @@ namespace MplusM
             void
             checkServiceTimes(void);
 
+            /*! @brief Record that an admitted registration has finished.
+             @param[in] startTime The time at which the registration started. */
+            void
+            completeRegistration(const double startTime);
+
             /*! @brief Turn off the send / receive metrics collecting. */
             virtual void
             disableMetrics(void);
@@ -200,6 +298,11 @@ namespace MplusM
             virtual void
             gatherMetrics(yarp::os::Bottle & metrics);
 
+            /*! @brief Return the path of the file that holds the persistent database.
+             @return The path of the file that holds the persistent database. */
+            static YarpString
+            GetPersistentDatabasePath(void);
+
             /*! @brief Return @c true if the service is active.
              @return @c true if the service is active and @c false otherwise. */
             inline bool
@@ -209,16 +312,33 @@ namespace MplusM
                 return _isActive;
             } // isActive
 
-            /*! @brief Check the response from the 'list' request.
+            /*! @brief Add the current version of the set of registered services to a reply,
+             followed by either the changes since a version or the registered services.
+             @param[in] sinceVersion The version that is already known or a negative value if the
+             registered services are to be added.
+             @param[in,out] reply The reply to the 'changes' request. */
+            void
+            processChangesRequest(const int          sinceVersion,
+                                  yarp::os::Bottle & reply);
+
+            /*! @brief Check the response from the 'list' request and add the service to the
+             registry.
+
+             The service and all of its requests are added in a single transaction.
              @param[in] channelName The channel that sent the response.
              @param[in] response The response to be analyzed.
-             @return @c true if the expected values are all present and @c false if they are not or
-             if unexpected values appear. */
+             @param[in,out] registration The characteristics of the service, as set by
+             processNameResponse().
+             @return @c true if the expected values are all present and the service was added and
+             @c false if they are not, if unexpected values appear or the service could not be
+             added. */
             bool
             processListResponse(const YarpString &              channelName,
-                                const Common::ServiceResponse & response);
+                                const Common::ServiceResponse & response,
+                                ServiceRegistration &           registration);
 
-            /*! @brief Convert a match expression into SQL and process it.
+            /*! @brief Process a match expression, using the in-memory index if possible and
+             converting the expression into SQL otherwise.
              @param[in] matcher The match expression to be processed.
              @param[in] getNames @c true if service names are to be returned and @c false if service
              ports are to be returned.
@@ -232,13 +352,26 @@ namespace MplusM
                                 yarp::os::Bottle &        reply);
 
             /*! @brief Check the response from the 'name' request.
+
+             The service is not added to the registry until the response from the 'list' request
+             has been processed.
              @param[in] channelName The channel that sent the response.
              @param[in] response The response to be analyzed.
+             @param[out] registration The characteristics of the service.
              @return @c true if the expected values are all present and @c false if they are not or
              if unexpected values appear. */
             bool
             processNameResponse(const YarpString &              channelName,
-                                const Common::ServiceResponse & response);
+                                const Common::ServiceResponse & response,
+                                ServiceRegistration &           registration);
+
+            /*! @brief Place a service channel in the slot of the expiry wheel for its deadline.
+             The lock must be held by the caller.
+             @param[in] serviceChannelName The service channel to be placed.
+             @param[in] info The liveness information for the service channel. */
+            void
+            placeInExpiryWheel(const YarpString &  serviceChannelName,
+                               const CheckedTime & info);
 
             /*! @brief Remove the last checked time for a service channel.
              @param[in] serviceChannelName The service channel that is being removed. */
@@ -251,6 +384,20 @@ namespace MplusM
             bool
             removeServiceRecord(const YarpString & serviceChannelName);
 
+            /*! @brief Remove a set of service entries from the registry, in a single transaction.
+             @param[in] serviceChannelNames The service channels that are being removed.
+             @param[in] areStale @c true if the services are being removed because they have not
+             pinged the registry recently and @c false otherwise.
+             @return @c true if the services were successfully removed and @c false otherwise. */
+            bool
+            removeServiceRecords(const YarpStringVector & serviceChannelNames,
+                                 const bool               areStale = false);
+
+            /*! @brief Remove the file that holds the persistent database, along with its
+             write-ahead log. */
+            static void
+            RemovePersistentDatabase(void);
+
             /*! @brief Report a change to a service.
              @param[in] channelName The service channel for the service.
              @param[in] newStatus The updated state of the service.
@@ -292,40 +439,39 @@ namespace MplusM
              @param[in] other The object to be copied. */
             RegistryService(const RegistryService & other);
 
-            /*! @brief Add a request to the registry.
-             @param[in] keywordList The list of keywords associated with the request.
-             @param[in] description The attributes of the request.
-             @return @c true if the request was successfully added and @c false otherwise. */
+            /*! @brief Add a service and its requests to the registry, in a single transaction.
+             @param[in] registration The characteristics of the service.
+             @return @c true if the service was successfully added and @c false otherwise. */
             bool
-            addRequestRecord(const yarp::os::Bottle &   keywordList,
-                             const RequestDescription & description);
-
-            /*! @brief Add a service to the registry.
-             @param[in] channelName The service channel for the service.
-             @param[in] name The canonical name for the service.
-             @param[in] tag The modifier tag for the service.
-             @param[in] description The description of the service.
-             @param[in] extraInfo The extra information for the service.
-             @param[in] executable The path to the executable for the service.
-             @param[in] requestsDescription The description of the requests for the service.
-             @return @c true if the request was successfully added and @c false otherwise. */
-            bool
-            addServiceRecord(const YarpString & channelName,
-                             const YarpString & name,
-                             const YarpString & tag,
-                             const YarpString & description,
-                             const YarpString & extraInfo,
-                             const YarpString & executable,
-                             const YarpString & requestsDescription);
+            addServiceRegistration(const ServiceRegistration & registration);
 
             /*! @brief Enable the standard request handlers. */
             void
             attachRequestHandlers(void);
 
+            /*! @brief Release the prepared statements and close the database. */
+            void
+            closeDatabase(void);
+
             /*! @brief Disable the standard request handlers. */
             void
             detachRequestHandlers(void);
 
+            /*! @brief Add the services recorded in the persistent database to the in-memory index.
+
+             Each recovered service is given the usual time to ping the registry, after which it is
+             removed as stale; its requests are not requested again.
+             @return @c true if the services were successfully recovered and @c false otherwise. */
+            bool
+            loadServiceRegistrations(void);
+
+            /*! @brief Open the database and, if it is persistent, set it up for a low cost per
+             transaction.
+             @param[in] dbFileName The path of the file that holds the database.
+             @return @c true if the database was opened and @c false otherwise. */
+            bool
+            openDatabase(const YarpString & dbFileName);
+
             /*! @brief The assignment operator.
              @param[in] other The object to be copied.
              @return The updated object. */
@@ -335,12 +481,33 @@ namespace MplusM
             /*! @brief Check the dictionary entry from the 'list' response.
              @param[in] asDict The dictionary to be checked.
              @param[in] channelName The channel that sent the response.
+             @param[in,out] registration The characteristics of the service, which will have the
+             request described by the dictionary entry added.
              @return @c false if an unexpected value appears and @c true otherwise. */
             bool
-            processDictionaryEntry(yarp::os::Property & asDict,
-                                   const YarpString &   channelName);
+            processDictionaryEntry(yarp::os::Property &  asDict,
+                                   const YarpString &    channelName,
+                                   ServiceRegistration & registration);
+
+            /*! @brief Record a change to the set of registered services and send it to the
+             changes channel. The changes lock must be held by the caller.
+             @param[in] kind The kind of change.
+             @param[in] channelName The service channel that was changed.
+             @param[in] serviceName The name of the service that was changed. */
+            void
+            recordServiceChange(const char *       kind,
+                                const YarpString & channelName,
+                                const YarpString & serviceName);
+
+            /*! @brief Set up the channel for the changes to the set of registered services.
+             @return @c true if the channel was set up and @c false otherwise. */
+            bool
+            setUpChangesChannel(void);
 
             /*! @brief Set up the %Registry Service database.
+
+             A persistent database that is damaged, or whose tables have an earlier layout, is
+             rebuilt rather than being treated as a failure.
              @return @c true if the database was set up and @c false otherwise. */
             bool
             setUpDatabase(void);
@@ -356,18 +523,52 @@ namespace MplusM
 
         private :
 
-            /*! @brief The last time that a channel 'checked-in'. */
+            /*! @brief The deadlines for the channels that have 'checked-in'. */
             TimeMap _lastCheckedTime;
 
+            /*! @brief The service channels, grouped by the interval in which their deadlines fall.
+             A service channel is placed in a slot when it is first seen and is moved to a later
+             slot only when its slot comes due, so a ping does not touch the wheel. */
+            std::vector<WheelSlot> _expiryWheel;
+
+            /*! @brief The next interval of the expiry wheel to be checked. */
+            long _nextWheelTick;
+
+            /*! @brief The sequence number to be given to the next service channel that is placed in
+             the expiry wheel. */
+            size_t _nextWheelSequence;
+
             /*! @brief The contention lock used to avoid inconsistencies. */
             yarp::os::Mutex _checkedTimeLock;
 
+            /*! @brief The contention lock used to keep the admission counts consistent. */
+            yarp::os::Mutex _admissionLock;
+
             /*! @brief The %Registry Service database. */
             sqlite3 * _db;
 
+            /*! @brief The prepared statements for the %Registry Service database. */
+            PreparedStatements * _statements;
+
+            /*! @brief The in-memory index used to evaluate match requests. */
+            MatchIndex * _matchIndex;
+
             /*! @brief The validator function object that the %Registry Service will use. */
             ColumnNameValidator * _validator;
 
+            /*! @brief The most recent changes to the set of registered services. */
+            ServiceChangeLog _changes;
+
+            /*! @brief The contention lock used to keep the changes in the same order as the updates
+             to the in-memory index. */
+            yarp::os::Mutex _changesLock;
+
+            /*! @brief The channel to send the changes to the set of registered services to. */
+            Common::GeneralChannel * _changesChannel;
+
+            /*! @brief The request handler for the 'changes' request. */
+            ChangesRequestHandler * _changesHandler;
+
             /*! @brief The request handler for the 'match' request. */
             MatchRequestHandler * _matchHandler;
 
@@ -386,6 +587,38 @@ namespace MplusM
             /*! @brief The object used to generate 'checks' for the service. */
             RegistryCheckThread * _checker;
 
+            /*! @brief The number of seconds taken to recover the services from the persistent
+             database. */
+            double _recoveryTime;
+
+            /*! @brief The smoothed number of seconds taken by a registration. */
+            double _averageRegistrationTime;
+
+            /*! @brief The number of seconds taken to absorb the most recent surge of
+             registrations. */
+            double _herdRecoveryTime;
+
+            /*! @brief The time at which the %Registry Service became overloaded, or zero if it is
+             not overloaded. */
+            double _overloadStartTime;
+
+            /*! @brief The version of the set of registered services, which is incremented for each
+             change. */
+            int _changesVersion;
+
+            /*! @brief The number of times that the %Registry Service became overloaded. */
+            int _overloadEpisodes;
+
+            /*! @brief The number of registrations that are in progress. */
+            int _pendingRegistrations;
+
+            /*! @brief The number of services recovered from the persistent database. */
+            int _recoveredServices;
+
+            /*! @brief The number of requests that were turned away because the %Registry Service
+             was overloaded. */
+            int _rejectedRequests;
+
             /*! @brief @c true if the database is in-memory and @c false if it is disk-based. */
             bool _inMemory;
 
@@ -398,7 +631,7 @@ namespace MplusM
 #  pragma clang diagnostic ignored "-Wunused-private-field"
 # endif // defined(__APPLE__)
             /*! @brief Filler to pad to alignment boundary */
-            char _filler[6];
+            char _filler[2];
 # if defined(__APPLE__)
 #  pragma clang diagnostic pop
 # endif // defined(__APPLE__)
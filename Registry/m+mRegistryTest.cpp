@@ -40,12 +40,16 @@
 #include "RegistryTests/m+mTest14Service.hpp"
 #include "RegistryTests/m+mTest15Service.hpp"
 #include "RegistryTests/m+mTest16Service.hpp"
+#include "RegistryTests/m+mTest22RegisterThread.hpp"
 
 #include <m+m/m+mBaseClient.hpp>
 #include <m+m/m+mBaseRequestHandler.hpp>
+#include <m+m/m+mClientChannelPool.hpp>
 #include <m+m/m+mEndpoint.hpp>
+#include <m+m/m+mRegistryCache.hpp>
 #include <m+m/m+mRequests.hpp>
 #include <m+m/m+mServiceRequest.hpp>
+#include <m+m/m+mServiceResponse.hpp>
 #include <m+m/m+mUtilities.hpp>
 
 //#include <odlEnable.h>
@@ -82,6 +86,26 @@ using std::endl;
 /*! @brief Set to @c true to use an in-memory database and @c false to use a disk-based database. */
 #define TEST_INMEMORY_ true
 
+/*! @brief The number of entries that are examined at the same time when gathering an inventory. */
+#define TEST_INVENTORY_FAN_OUT_ 2
+
+/*! @brief The data used to watch the progress of an inventory. */
+struct InventoryCheck
+{
+    /*! @brief The contention lock used to update the counts. */
+    yarp::os::Mutex _lock;
+
+    /*! @brief The number of seconds that each check is made to take. */
+    double _delay;
+
+    /*! @brief The number of checks that are under way. */
+    int _active;
+
+    /*! @brief The largest number of checks that were under way at the same time. */
+    int _peak;
+
+}; // InventoryCheck
+
 #if defined(__APPLE__)
 # pragma mark Global constants and variables
 #endif // defined(__APPLE__)
@@ -638,91 +662,1505 @@ doTestRequestSearchService(const char * launchPath,
     return result;
 } // doTestRequestSearchService
 
-/*! @brief The signal handler to catch requests to stop the service.
- @param[in] signal The signal being handled. */
-static void
-catchSignal(int signal)
+#if defined(__APPLE__)
+# pragma mark *** Test Case 17 ***
+#endif // defined(__APPLE__)
+
+/*! @brief Check if the reply to a 'changes' request has a service channel in its list.
+ @param[in] reply The reply to be checked.
+ @param[in] expectedKind The kind of reply that is expected.
+ @param[in] channelName The service channel to be found.
+ @param[in] channelPosition The position of the service channel in each entry of the list.
+ @return @c true if the reply is of the expected kind and the service channel is in its list and
+ @c false otherwise. */
+static bool
+checkChangesReply(const yarp::os::Bottle & reply,
+                  const char *             expectedKind,
+                  const YarpString &       channelName,
+                  const int                channelPosition)
 {
     ODL_ENTER(); //####
-    ODL_I1("signal = ", signal); //####
-    std::stringstream buff;
-    YarpString        message("Exiting due to signal ");
+    ODL_P1("reply = ", &reply); //####
+    ODL_S1("expectedKind = ", expectedKind); //####
+    ODL_S1s("channelName = ", channelName); //####
+    ODL_I1("channelPosition = ", channelPosition); //####
+    bool result = false;
 
-    buff << signal;
-    message += buff.str();
-    message += " = ";
-    message += NameOfSignal(signal);
-    MpM_ERROR_(message.c_str());
-    ODL_EXIT_EXIT(1); //####
-    yarp::os::exit(1);
-} // catchSignal
+    if ((3 == reply.size()) && (reply.get(1).toString() == expectedKind))
+    {
+        yarp::os::Bottle * entries = reply.get(2).asList();
 
-#if defined(__APPLE__)
-# pragma mark Global functions
-#endif // defined(__APPLE__)
+        if (entries)
+        {
+            for (int ii = 0, mm = entries->size(); (! result) && (mm > ii); ++ii)
+            {
+                yarp::os::Bottle * anEntry = entries->get(ii).asList();
 
-/*! @brief The entry point for unit tests of the %Registry Service classes.
+                if (anEntry && (channelPosition < anEntry->size()))
+                {
+                    result = (anEntry->get(channelPosition).toString() == channelName);
+                }
+            }
+        }
+        else
+        {
+            ODL_LOG("! (entries)"); //####
+        }
+    }
+    else
+    {
+        ODL_LOG("! ((3 == reply.size()) && (reply.get(1).toString() == expectedKind))"); //####
+    }
+    ODL_EXIT_B(result); //####
+    return result;
+} // checkChangesReply
 
- The first argument is the test number, the second argument is the name of the channel to be used
- with the test, the optional third argument is the machine to connect to and the optional fourth
- argument is the port number to be used.
- Output depends on the test being run.
+/*! @brief Perform a test case.
+ @param[in] launchPath The command-line name used to launch the service.
  @param[in] argc The number of arguments in 'argv'.
- @param[in] argv The arguments to be used with the unit tests.
- @return @c 0 on a successful test and @c 1 on failure. */
-int
-main(int      argc,
-     char * * argv)
+ @param[in] argv The arguments to be used for the test.
+ @return @c 0 on success and @c 1 on failure. */
+static int
+doTestRequestChanges(const char * launchPath,
+                     const int    argc,
+                     char * *     argv) // send 'changes' request
 {
-    YarpString progName(*argv);
-
-    ODL_INIT(progName.c_str(), kODLoggingOptionIncludeProcessID | //####
-             kODLoggingOptionIncludeThreadID | kODLoggingOptionEnableThreadSupport | //####
-             kODLoggingOptionWriteToStderr); //####
     ODL_ENTER(); //####
-#if MAC_OR_LINUX_
-    SetUpLogger(progName);
-#endif // MAC_OR_LINUX_
+    ODL_S1("launchPath = ", launchPath); //####
+    ODL_I1("argc = ", argc); //####
+    ODL_P1("argv = ", argv); //####
     int result = 1;
 
     try
     {
-        // We normally call CheckForNameServerReporter() here, but we should only run the tests with
-        // a valid YARP configuration.
-        Utilities::SetUpGlobalStatusReporter();
-Utilities::CheckForNameServerReporter();
-        if (Utilities::CheckForValidNetwork())
-        {
-            yarp::os::Network yarp; // This is necessary to establish any connections to the YARP
-                                    // infrastructure
+        const char *                secondServiceChannel;
+        Registry::RegistryService * registry = NULL;
 
-            Initialize(progName);
-            if (0 < --argc)
+        if (0 <= argc)
+        {
+            switch (argc)
             {
-                const char * startPtr = argv[1];
-                char *       endPtr;
-                int          selector = strtol(startPtr, &endPtr, 10);
+                    // Argument order for tests = [IP address / name [, port]]
+                case 0 :
+                    registry = new Registry::RegistryService(launchPath, argc, argv,
+                                                             TEST_INMEMORY_);
+                    secondServiceChannel = BUILD_NAME_(MpM_SERVICE_BASE_NAME_,
+                                                       BUILD_NAME_("test",
+                                                                   "requestchanges_1"));
+                    break;
 
-                ODL_I1("selector <- ", selector); //####
-                if ((startPtr != endPtr) && (! *endPtr) && (0 < selector))
+                case 1 :
+                    registry = new Registry::RegistryService(launchPath, argc, argv, TEST_INMEMORY_,
+                                                             *argv);
+                    secondServiceChannel = BUILD_NAME_(MpM_SERVICE_BASE_NAME_,
+                                                       BUILD_NAME_("test",
+                                                                   "requestchanges_2"));
+                    break;
+
+                default :
+                    break;
+
+            }
+        }
+        if (registry)
+        {
+            if (registry->startService())
+            {
+                if (registry->isActive())
                 {
-                    SetSignalHandlers(catchSignal);
-                    switch (selector)
+                    // Now we start up another service (Test15Service) and register it
+                    Test15Service * aService = new Test15Service(launchPath, 1,
+                                                      const_cast<char * *>(&secondServiceChannel));
+
+                    if (aService)
                     {
-                        case 13 :
-                            result = doTestCreateRegistryService(*argv, argc - 1, argv + 2);
-                            break;
+                        if (aService->startService())
+                        {
+                            YarpString channelName(aService->getEndpoint().getName());
 
-                        case 14 :
-                            result = doTestRequestRegistryService(*argv, argc - 1, argv + 2);
-                            break;
+                            if (RegisterLocalService(channelName, *aService))
+                            {
+                                yarp::os::Bottle snapshot;
 
-                        case 15 :
-                            result = doTestRequestUnregisterService(*argv, argc - 1, argv + 2);
-                            break;
+                                // The registered service should be in the snapshot.
+                                registry->processChangesRequest(-1, snapshot);
+                                ODL_S1s("snapshot <- ", snapshot.toString()); //####
+                                if (checkChangesReply(snapshot, MpM_REGISTRY_CHANGES_SNAPSHOT_,
+                                                      channelName, 0))
+                                {
+                                    int version = snapshot.get(0).asInt();
 
-                        case 16 :
-                            result = doTestRequestSearchService(*argv, argc - 1, argv + 2);
+                                    if (UnregisterLocalService(channelName, *aService))
+                                    {
+                                        yarp::os::Bottle deltas;
+
+                                        // The removal should be the only change since the
+                                        // snapshot.
+                                        registry->processChangesRequest(version, deltas);
+                                        ODL_S1s("deltas <- ", deltas.toString()); //####
+                                        if (checkChangesReply(deltas, MpM_REGISTRY_CHANGES_DELTAS_,
+                                                              channelName, 2) &&
+                                            ((version + 1) == deltas.get(0).asInt()))
+                                        {
+                                            result = 0;
+                                        }
+                                        else
+                                        {
+                                            ODL_LOG("! (checkChangesReply(deltas, " //####
+                                                    "MpM_REGISTRY_CHANGES_DELTAS_, " //####
+                                                    "channelName, 2) && ((version + 1) == " //####
+                                                    "deltas.get(0).asInt()))"); //####
+                                        }
+                                    }
+                                    else
+                                    {
+                                        ODL_LOG("! (UnregisterLocalService(channelName, " //####
+                                                "*aService))"); //####
+                                    }
+                                }
+                                else
+                                {
+                                    ODL_LOG("! (checkChangesReply(snapshot, " //####
+                                            "MpM_REGISTRY_CHANGES_SNAPSHOT_, channelName, " //####
+                                            "0))"); //####
+                                    if (! UnregisterLocalService(channelName, *aService))
+                                    {
+                                        ODL_LOG("(! UnregisterLocalService(channelName, " //####
+                                                "*aService))"); //####
+                                    }
+                                }
+                            }
+                            else
+                            {
+                                ODL_LOG("! (RegisterLocalService(channelName, *aService))"); //####
+                            }
+                            aService->stopService();
+                        }
+                        else
+                        {
+                            ODL_LOG("! (aService->startService())"); //####
+                        }
+                        delete aService;
+                    }
+                    else
+                    {
+                        ODL_LOG("! (aService)"); //####
+                    }
+                }
+                else
+                {
+                    ODL_LOG("! (registry->isActive())"); //####
+                }
+                registry->stopService();
+            }
+            else
+            {
+                ODL_LOG("! (registry->startService())"); //####
+            }
+            delete registry;
+        }
+        else
+        {
+            ODL_LOG("! (registry)"); //####
+        }
+    }
+    catch (...)
+    {
+        ODL_LOG("Exception caught"); //####
+        throw;
+    }
+    ODL_EXIT_I(result); //####
+    return result;
+} // doTestRequestChanges
+
+#if defined(__APPLE__)
+# pragma mark *** Test Case 18 ***
+#endif // defined(__APPLE__)
+
+/*! @brief Perform a test case.
+ @param[in] launchPath The command-line name used to launch the service.
+ @param[in] argc The number of arguments in 'argv'.
+ @param[in] argv The arguments to be used for the test.
+ @return @c 0 on success and @c 1 on failure. */
+static int
+doTestRequestRegisterByCallback(const char * launchPath,
+                                const int    argc,
+                                char * *     argv) // send 'register' request with only a channel
+{
+    ODL_ENTER(); //####
+    ODL_S1("launchPath = ", launchPath); //####
+    ODL_I1("argc = ", argc); //####
+    ODL_P1("argv = ", argv); //####
+    int result = 1;
+
+    try
+    {
+        const char *                secondServiceChannel;
+        Registry::RegistryService * registry = NULL;
+
+        if (0 <= argc)
+        {
+            switch (argc)
+            {
+                    // Argument order for tests = [IP address / name [, port]]
+                case 0 :
+                    registry = new Registry::RegistryService(launchPath, argc, argv,
+                                                             TEST_INMEMORY_);
+                    secondServiceChannel = BUILD_NAME_(MpM_SERVICE_BASE_NAME_,
+                                                       BUILD_NAME_("test",
+                                                                   "requestregistercallback_1"));
+                    break;
+
+                case 1 :
+                    registry = new Registry::RegistryService(launchPath, argc, argv, TEST_INMEMORY_,
+                                                             *argv);
+                    secondServiceChannel = BUILD_NAME_(MpM_SERVICE_BASE_NAME_,
+                                                       BUILD_NAME_("test",
+                                                                   "requestregistercallback_2"));
+                    break;
+
+                default :
+                    break;
+
+            }
+        }
+        if (registry)
+        {
+            if (registry->startService())
+            {
+                if (registry->isActive())
+                {
+                    // Now we start up another service (Test14Service) and register it the way
+                    // that older services do, with the Registry Service asking for the details
+                    Test14Service * aService = new Test14Service(launchPath, 1,
+                                                      const_cast<char * *>(&secondServiceChannel));
+
+                    if (aService)
+                    {
+                        if (aService->startService())
+                        {
+                            YarpString       channelName(aService->getEndpoint().getName());
+                            yarp::os::Bottle parameters;
+                            ServiceResponse  response;
+
+                            parameters.addString(channelName);
+                            ServiceRequest request(MpM_REGISTER_REQUEST_, parameters);
+
+                            if (ClientChannelPool::SendRequest(MpM_REGISTRY_ENDPOINT_NAME_,
+                                                               request, response, false,
+                                                               false))
+                            {
+                                ODL_S1s("response <- ", response.asString()); //####
+                                if ((MpM_EXPECTED_REGISTER_RESPONSE_SIZE_ == response.count()) &&
+                                    (response.element(0).toString() == MpM_OK_RESPONSE_) &&
+                                    registry->checkForExistingService(channelName))
+                                {
+                                    result = 0;
+                                }
+                                else
+                                {
+                                    ODL_LOG("! ((MpM_EXPECTED_REGISTER_RESPONSE_SIZE_ == " //####
+                                            "response.count()) && " //####
+                                            "(response.element(0).toString() == " //####
+                                            "MpM_OK_RESPONSE_) && " //####
+                                            "registry->checkForExistingService(" //####
+                                            "channelName))"); //####
+                                }
+                                if (! UnregisterLocalService(channelName, *aService))
+                                {
+                                    ODL_LOG("(! UnregisterLocalService(channelName, " //####
+                                            "*aService))"); //####
+                                }
+                            }
+                            else
+                            {
+                                ODL_LOG("! (ClientChannelPool::SendRequest(" //####
+                                        "MpM_REGISTRY_ENDPOINT_NAME_, request, response, " //####
+                                        "false, false))"); //####
+                            }
+                            aService->stopService();
+                        }
+                        else
+                        {
+                            ODL_LOG("! (aService->startService())"); //####
+                        }
+                        delete aService;
+                    }
+                    else
+                    {
+                        ODL_LOG("! (aService)"); //####
+                    }
+                }
+                else
+                {
+                    ODL_LOG("! (registry->isActive())"); //####
+                }
+                registry->stopService();
+            }
+            else
+            {
+                ODL_LOG("! (registry->startService())"); //####
+            }
+            delete registry;
+        }
+        else
+        {
+            ODL_LOG("! (registry)"); //####
+        }
+    }
+    catch (...)
+    {
+        ODL_LOG("Exception caught"); //####
+        throw;
+    }
+    ODL_EXIT_I(result); //####
+    return result;
+} // doTestRequestRegisterByCallback
+
+#if defined(__APPLE__)
+# pragma mark *** Test Case 19 ***
+#endif // defined(__APPLE__)
+
+/*! @brief Check that the local cache of 'match' responses is used and is invalidated by a change.
+ @param[in] channelName The service channel that is registered.
+ @param[in] aService The service that is registered.
+ @param[out] stillRegistered Set to @c false if the service was unregistered.
+ @return @c true if the cache behaved as expected and @c false otherwise. */
+static bool
+checkRegistryCache(const YarpString & channelName,
+                   BaseService &      aService,
+                   bool &             stillRegistered)
+{
+    ODL_ENTER(); //####
+    ODL_S1s("channelName = ", channelName); //####
+    ODL_P2("aService = ", &aService, "stillRegistered = ", &stillRegistered); //####
+    bool             result = false;
+    int              version;
+    yarp::os::Bottle cached;
+    YarpString       criteria(MpM_REQREP_DICT_CHANNELNAME_KEY_ ":");
+
+    criteria += channelName;
+    // Nothing has been remembered yet, so the first lookup has to go to the Registry Service.
+    if ((! RegistryCache::Lookup(criteria, false, cached, version)) && (0 <= version))
+    {
+        int              rememberedVersion = version;
+        yarp::os::Bottle expected;
+
+        // The response is not the one that the Registry Service would return, so that a hit can
+        // only come from the cache.
+        expected.addString(MpM_OK_RESPONSE_);
+        expected.addList().addString(channelName + "_cached");
+        RegistryCache::Remember(criteria, false, expected, version);
+        if (RegistryCache::Lookup(criteria, false, cached, version) &&
+            (cached.toString() == expected.toString()))
+        {
+            if (UnregisterLocalService(channelName, aService))
+            {
+                bool   invalidated = false;
+                double limit = yarp::os::Time::now() + STANDARD_WAIT_TIME_;
+
+                // The removal is announced on the changes channel, which discards the remembered
+                // responses and advances the version of the cache.
+                stillRegistered = false;
+                for ( ; (! invalidated) && (yarp::os::Time::now() < limit); )
+                {
+                    invalidated = ((! RegistryCache::Lookup(criteria, false, cached, version)) &&
+                                   (rememberedVersion < version));
+                    if (! invalidated)
+                    {
+                        yarp::os::Time::delay(INITIAL_RETRY_INTERVAL_);
+                    }
+                }
+                if (invalidated)
+                {
+                    result = true;
+                }
+                else
+                {
+                    ODL_LOG("! (invalidated)"); //####
+                }
+            }
+            else
+            {
+                ODL_LOG("! (UnregisterLocalService(channelName, aService))"); //####
+            }
+        }
+        else
+        {
+            ODL_LOG("! (RegistryCache::Lookup(criteria, false, cached, version) && " //####
+                    "(cached.toString() == expected.toString()))"); //####
+        }
+    }
+    else
+    {
+        ODL_LOG("! ((! RegistryCache::Lookup(criteria, false, cached, version)) && " //####
+                "(0 <= version))"); //####
+    }
+    ODL_EXIT_B(result); //####
+    return result;
+} // checkRegistryCache
+
+/*! @brief Perform a test case.
+ @param[in] launchPath The command-line name used to launch the service.
+ @param[in] argc The number of arguments in 'argv'.
+ @param[in] argv The arguments to be used for the test.
+ @return @c 0 on success and @c 1 on failure. */
+static int
+doTestRegistryCache(const char * launchPath,
+                    const int    argc,
+                    char * *     argv) // use the local cache of 'match' responses
+{
+    ODL_ENTER(); //####
+    ODL_S1("launchPath = ", launchPath); //####
+    ODL_I1("argc = ", argc); //####
+    ODL_P1("argv = ", argv); //####
+    int result = 1;
+
+    try
+    {
+        const char *                secondServiceChannel;
+        Registry::RegistryService * registry = NULL;
+
+        if (0 <= argc)
+        {
+            switch (argc)
+            {
+                    // Argument order for tests = [IP address / name [, port]]
+                case 0 :
+                    registry = new Registry::RegistryService(launchPath, argc, argv,
+                                                             TEST_INMEMORY_);
+                    secondServiceChannel = BUILD_NAME_(MpM_SERVICE_BASE_NAME_,
+                                                       BUILD_NAME_("test", "registrycache_1"));
+                    break;
+
+                case 1 :
+                    registry = new Registry::RegistryService(launchPath, argc, argv, TEST_INMEMORY_,
+                                                             *argv);
+                    secondServiceChannel = BUILD_NAME_(MpM_SERVICE_BASE_NAME_,
+                                                       BUILD_NAME_("test", "registrycache_2"));
+                    break;
+
+                default :
+                    break;
+
+            }
+        }
+        if (registry)
+        {
+            if (registry->startService())
+            {
+                if (registry->isActive())
+                {
+                    // Now we start up another service (Test15Service) and register it
+                    Test15Service * aService = new Test15Service(launchPath, 1,
+                                                      const_cast<char * *>(&secondServiceChannel));
+
+                    if (aService)
+                    {
+                        if (aService->startService())
+                        {
+                            YarpString channelName(aService->getEndpoint().getName());
+
+                            if (RegisterLocalService(channelName, *aService))
+                            {
+                                bool stillRegistered = true;
+
+                                if (RegistryCache::Enable())
+                                {
+                                    if (checkRegistryCache(channelName, *aService,
+                                                           stillRegistered))
+                                    {
+                                        result = 0;
+                                    }
+                                    else
+                                    {
+                                        ODL_LOG("! (checkRegistryCache(channelName, " //####
+                                                "*aService, stillRegistered))"); //####
+                                    }
+                                    RegistryCache::Disable();
+                                }
+                                else
+                                {
+                                    ODL_LOG("! (RegistryCache::Enable())"); //####
+                                }
+                                if (stillRegistered &&
+                                    (! UnregisterLocalService(channelName, *aService)))
+                                {
+                                    ODL_LOG("(stillRegistered && (! " //####
+                                            "UnregisterLocalService(channelName, " //####
+                                            "*aService)))"); //####
+                                }
+                            }
+                            else
+                            {
+                                ODL_LOG("! (RegisterLocalService(channelName, *aService))"); //####
+                            }
+                            aService->stopService();
+                        }
+                        else
+                        {
+                            ODL_LOG("! (aService->startService())"); //####
+                        }
+                        delete aService;
+                    }
+                    else
+                    {
+                        ODL_LOG("! (aService)"); //####
+                    }
+                }
+                else
+                {
+                    ODL_LOG("! (registry->isActive())"); //####
+                }
+                registry->stopService();
+            }
+            else
+            {
+                ODL_LOG("! (registry->startService())"); //####
+            }
+            delete registry;
+        }
+        else
+        {
+            ODL_LOG("! (registry)"); //####
+        }
+    }
+    catch (...)
+    {
+        ODL_LOG("Exception caught"); //####
+        throw;
+    }
+    ODL_EXIT_I(result); //####
+    return result;
+} // doTestRegistryCache
+
+#if defined(__APPLE__)
+# pragma mark *** Test Case 20 ***
+#endif // defined(__APPLE__)
+
+/*! @brief Create a %Registry Service that uses the persistent database.
+ @param[in] launchPath The command-line name used to launch the service.
+ @param[in] argc The number of arguments in 'argv'.
+ @param[in] argv The arguments to be used for the test.
+ @return The new service or @c NULL if the arguments are not valid. */
+static Registry::RegistryService *
+createPersistentRegistry(const char * launchPath,
+                         const int    argc,
+                         char * *     argv)
+{
+    ODL_ENTER(); //####
+    ODL_S1("launchPath = ", launchPath); //####
+    ODL_I1("argc = ", argc); //####
+    ODL_P1("argv = ", argv); //####
+    Registry::RegistryService * registry = NULL;
+
+    switch (argc)
+    {
+            // Argument order for tests = [IP address / name [, port]]
+        case 0 :
+            registry = new Registry::RegistryService(launchPath, argc, argv, false);
+            break;
+
+        case 1 :
+            registry = new Registry::RegistryService(launchPath, argc, argv, false, *argv);
+            break;
+
+        default :
+            break;
+
+    }
+    ODL_EXIT_P(registry); //####
+    return registry;
+} // createPersistentRegistry
+
+/*! @brief Register two services with a %Registry Service that uses the persistent database, and
+ then stop the %Registry Service.
+ @param[in] launchPath The command-line name used to launch the service.
+ @param[in] argc The number of arguments in 'argv'.
+ @param[in] argv The arguments to be used for the test.
+ @param[in] keptService The service that will keep pinging after the restart.
+ @param[in] staleService The service that will not ping after the restart.
+ @return @c true if both services were registered and @c false otherwise. */
+static bool
+registerBeforeRestart(const char *    launchPath,
+                      const int       argc,
+                      char * *        argv,
+                      Test15Service & keptService,
+                      Test15Service & staleService)
+{
+    ODL_ENTER(); //####
+    ODL_S1("launchPath = ", launchPath); //####
+    ODL_I1("argc = ", argc); //####
+    ODL_P3("argv = ", argv, "keptService = ", &keptService, "staleService = ", //####
+           &staleService); //####
+    bool                        result = false;
+    Registry::RegistryService * registry = createPersistentRegistry(launchPath, argc, argv);
+
+    if (registry)
+    {
+        if (registry->startService())
+        {
+            if (registry->isActive())
+            {
+                // The services are left registered, so that they are in the database when the
+                // Registry Service is restarted.
+                if (RegisterLocalService(keptService.getEndpoint().getName(), keptService) &&
+                    RegisterLocalService(staleService.getEndpoint().getName(), staleService))
+                {
+                    result = true;
+                }
+                else
+                {
+                    ODL_LOG("! (RegisterLocalService(keptService.getEndpoint().getName(), " //####
+                            "keptService) && RegisterLocalService(" //####
+                            "staleService.getEndpoint().getName(), staleService))"); //####
+                }
+            }
+            else
+            {
+                ODL_LOG("! (registry->isActive())"); //####
+            }
+            registry->stopService();
+        }
+        else
+        {
+            ODL_LOG("! (registry->startService())"); //####
+        }
+        delete registry;
+    }
+    else
+    {
+        ODL_LOG("! (registry)"); //####
+    }
+    ODL_EXIT_B(result); //####
+    return result;
+} // registerBeforeRestart
+
+/*! @brief Restart a %Registry Service that uses the persistent database, and check that the
+ registered services were restored and that the service that does not ping is removed.
+ @param[in] launchPath The command-line name used to launch the service.
+ @param[in] argc The number of arguments in 'argv'.
+ @param[in] argv The arguments to be used for the test.
+ @param[in] keptService The service that keeps pinging after the restart.
+ @param[in] staleService The service that does not ping after the restart.
+ @return @c true if the services were restored and pruned as expected and @c false otherwise. */
+static bool
+checkAfterRestart(const char *    launchPath,
+                  const int       argc,
+                  char * *        argv,
+                  Test15Service & keptService,
+                  Test15Service & staleService)
+{
+    ODL_ENTER(); //####
+    ODL_S1("launchPath = ", launchPath); //####
+    ODL_I1("argc = ", argc); //####
+    ODL_P3("argv = ", argv, "keptService = ", &keptService, "staleService = ", //####
+           &staleService); //####
+    bool                        result = false;
+    Registry::RegistryService * registry = createPersistentRegistry(launchPath, argc, argv);
+
+    if (registry)
+    {
+        if (registry->startService())
+        {
+            if (registry->isActive())
+            {
+                YarpString keptChannel(keptService.getEndpoint().getName());
+                YarpString staleChannel(staleService.getEndpoint().getName());
+
+                // Both services should have been restored without registering again.
+                if (registry->checkForExistingService(keptChannel) &&
+                    registry->checkForExistingService(staleChannel))
+                {
+                    bool   pruned = false;
+                    double limit = yarp::os::Time::now() + (PING_COUNT_MAX_ * PING_INTERVAL_) +
+                                   (2 * PING_CHECK_INTERVAL_) + STANDARD_WAIT_TIME_;
+
+                    // Only one of the services pings the restarted Registry Service, so the other
+                    // one is removed once its deadline has passed.
+                    keptService.startPinger();
+                    for ( ; (! pruned) && (yarp::os::Time::now() < limit); )
+                    {
+                        pruned = (! registry->checkForExistingService(staleChannel));
+                        if (! pruned)
+                        {
+                            yarp::os::Time::delay(PING_CHECK_INTERVAL_ / 10.0);
+                        }
+                    }
+                    if (pruned && registry->checkForExistingService(keptChannel))
+                    {
+                        result = true;
+                    }
+                    else
+                    {
+                        ODL_LOG("! (pruned && registry->checkForExistingService(" //####
+                                "keptChannel))"); //####
+                    }
+                    if (! UnregisterLocalService(keptChannel, keptService))
+                    {
+                        ODL_LOG("(! UnregisterLocalService(keptChannel, keptService))"); //####
+                    }
+                }
+                else
+                {
+                    ODL_LOG("! (registry->checkForExistingService(keptChannel) && " //####
+                            "registry->checkForExistingService(staleChannel))"); //####
+                }
+            }
+            else
+            {
+                ODL_LOG("! (registry->isActive())"); //####
+            }
+            registry->stopService();
+        }
+        else
+        {
+            ODL_LOG("! (registry->startService())"); //####
+        }
+        delete registry;
+    }
+    else
+    {
+        ODL_LOG("! (registry)"); //####
+    }
+    ODL_EXIT_B(result); //####
+    return result;
+} // checkAfterRestart
+
+/*! @brief Perform a test case.
+ @param[in] launchPath The command-line name used to launch the service.
+ @param[in] argc The number of arguments in 'argv'.
+ @param[in] argv The arguments to be used for the test.
+ @return @c 0 on success and @c 1 on failure. */
+static int
+doTestRegistryWarmRestart(const char * launchPath,
+                          const int    argc,
+                          char * *     argv) // restart with the persistent database
+{
+    ODL_ENTER(); //####
+    ODL_S1("launchPath = ", launchPath); //####
+    ODL_I1("argc = ", argc); //####
+    ODL_P1("argv = ", argv); //####
+    int result = 1;
+
+    try
+    {
+        const char * keptServiceChannel = NULL;
+        const char * staleServiceChannel = NULL;
+
+        switch (argc)
+        {
+                // Argument order for tests = [IP address / name [, port]]
+            case 0 :
+                keptServiceChannel = BUILD_NAME_(MpM_SERVICE_BASE_NAME_,
+                                                 BUILD_NAME_("test", "warmrestartkept_1"));
+                staleServiceChannel = BUILD_NAME_(MpM_SERVICE_BASE_NAME_,
+                                                  BUILD_NAME_("test", "warmrestartstale_1"));
+                break;
+
+            case 1 :
+                keptServiceChannel = BUILD_NAME_(MpM_SERVICE_BASE_NAME_,
+                                                 BUILD_NAME_("test", "warmrestartkept_2"));
+                staleServiceChannel = BUILD_NAME_(MpM_SERVICE_BASE_NAME_,
+                                                  BUILD_NAME_("test", "warmrestartstale_2"));
+                break;
+
+            default :
+                break;
+
+        }
+        if (keptServiceChannel && staleServiceChannel)
+        {
+            Test15Service * keptService = new Test15Service(launchPath, 1,
+                                                      const_cast<char * *>(&keptServiceChannel));
+            Test15Service * staleService = new Test15Service(launchPath, 1,
+                                                      const_cast<char * *>(&staleServiceChannel));
+
+            // Start from an empty database, so that only the services of this test are restored.
+            Registry::RegistryService::RemovePersistentDatabase();
+            if (keptService->startService() && staleService->startService())
+            {
+                if (registerBeforeRestart(launchPath, argc, argv, *keptService, *staleService) &&
+                    checkAfterRestart(launchPath, argc, argv, *keptService, *staleService))
+                {
+                    result = 0;
+                }
+                else
+                {
+                    ODL_LOG("! (registerBeforeRestart(launchPath, argc, argv, " //####
+                            "*keptService, *staleService) && checkAfterRestart(" //####
+                            "launchPath, argc, argv, *keptService, *staleService))"); //####
+                }
+            }
+            else
+            {
+                ODL_LOG("! (keptService->startService() && " //####
+                        "staleService->startService())"); //####
+            }
+            keptService->stopService();
+            staleService->stopService();
+            delete keptService;
+            delete staleService;
+            Registry::RegistryService::RemovePersistentDatabase();
+        }
+        else
+        {
+            ODL_LOG("! (keptServiceChannel && staleServiceChannel)"); //####
+        }
+    }
+    catch (...)
+    {
+        ODL_LOG("Exception caught"); //####
+        throw;
+    }
+    ODL_EXIT_I(result); //####
+    return result;
+} // doTestRegistryWarmRestart
+
+#if defined(__APPLE__)
+# pragma mark *** Test Case 21 ***
+#endif // defined(__APPLE__)
+
+/*! @brief Perform a test case.
+ @param[in] launchPath The command-line name used to launch the service.
+ @param[in] argc The number of arguments in 'argv'.
+ @param[in] argv The arguments to be used for the test.
+ @return @c 0 on success and @c 1 on failure. */
+static int
+doTestRegistryDamagedDatabase(const char * launchPath,
+                              const int    argc,
+                              char * *     argv) // start with a damaged persistent database
+{
+    ODL_ENTER(); //####
+    ODL_S1("launchPath = ", launchPath); //####
+    ODL_I1("argc = ", argc); //####
+    ODL_P1("argv = ", argv); //####
+    int result = 1;
+
+    try
+    {
+        YarpString dbFileName(Registry::RegistryService::GetPersistentDatabasePath());
+        FILE *     dbFile;
+
+        // Replace the database with a file that is not a database.
+        Registry::RegistryService::RemovePersistentDatabase();
+        dbFile = fopen(dbFileName.c_str(), "w");
+        if (dbFile)
+        {
+            fputs("This is not an SQLite database.\n", dbFile);
+            fclose(dbFile);
+            Registry::RegistryService * registry = createPersistentRegistry(launchPath, argc,
+                                                                            argv);
+
+            if (registry)
+            {
+                // The damaged database should be replaced, rather than stopping the service.
+                if (registry->startService())
+                {
+                    if (registry->isActive() &&
+                        registry->checkForExistingService(MpM_REGISTRY_ENDPOINT_NAME_))
+                    {
+                        result = 0;
+                    }
+                    else
+                    {
+                        ODL_LOG("! (registry->isActive() && " //####
+                                "registry->checkForExistingService(" //####
+                                "MpM_REGISTRY_ENDPOINT_NAME_))"); //####
+                    }
+                    registry->stopService();
+                }
+                else
+                {
+                    ODL_LOG("! (registry->startService())"); //####
+                }
+                delete registry;
+            }
+            else
+            {
+                ODL_LOG("! (registry)"); //####
+            }
+            Registry::RegistryService::RemovePersistentDatabase();
+        }
+        else
+        {
+            ODL_LOG("! (dbFile)"); //####
+        }
+    }
+    catch (...)
+    {
+        ODL_LOG("Exception caught"); //####
+        throw;
+    }
+    ODL_EXIT_I(result); //####
+    return result;
+} // doTestRegistryDamagedDatabase
+
+#if defined(__APPLE__)
+# pragma mark *** Test Case 22 ***
+#endif // defined(__APPLE__)
+
+/*! @brief Check that a registration is turned away while the %Registry Service is overloaded, and
+ that the service registers once the overload clears.
+ @param[in] registry The %Registry Service.
+ @param[in] aService The service to be registered.
+ @return @c true if the registration was turned away and then succeeded and @c false otherwise. */
+static bool
+checkRegistrationFlood(Registry::RegistryService & registry,
+                       BaseService &               aService)
+{
+    ODL_ENTER(); //####
+    ODL_P2("registry = ", &registry, "aService = ", &aService); //####
+    bool             result = false;
+    double           retryAfter;
+    size_t           held = 0;
+    yarp::os::Bottle parameters;
+    ServiceResponse  response;
+    YarpString       channelName(aService.getEndpoint().getName());
+
+    // Take every registration slot, as a flood of registrations would.
+    for ( ; registry.admitRegistration(retryAfter); ++held)
+    {
+    }
+    parameters.addString(channelName);
+    ServiceRequest request(MpM_REGISTER_REQUEST_, parameters);
+
+    if (ClientChannelPool::SendRequest(MpM_REGISTRY_ENDPOINT_NAME_, request, response, false,
+                                       false) &&
+        (MpM_EXPECTED_BUSY_RESPONSE_SIZE_ == response.count()) &&
+        (response.element(0).toString() == MpM_BUSY_RESPONSE_) &&
+        (0 < response.element(1).asDouble()))
+    {
+        bool                   stillWaiting;
+        Test22RegisterThread * registrar = new Test22RegisterThread(aService);
+
+        // The service keeps retrying, after a random delay based on the hint, until a slot is
+        // released.
+        registrar->start();
+        yarp::os::Time::delay(2 * INITIAL_RETRY_INTERVAL_);
+        stillWaiting = (! registry.checkForExistingService(channelName));
+        for ( ; 0 < held; --held)
+        {
+            registry.completeRegistration(yarp::os::Time::now());
+        }
+        registrar->stop();
+        if (stillWaiting && registrar->succeeded() &&
+            registry.checkForExistingService(channelName))
+        {
+            result = true;
+        }
+        else
+        {
+            ODL_LOG("! (stillWaiting && registrar->succeeded() && " //####
+                    "registry.checkForExistingService(channelName))"); //####
+        }
+        if (registrar->succeeded() && (! UnregisterLocalService(channelName, aService)))
+        {
+            ODL_LOG("(registrar->succeeded() && (! UnregisterLocalService(channelName, " //####
+                    "aService)))"); //####
+        }
+        delete registrar;
+    }
+    else
+    {
+        ODL_LOG("! (ClientChannelPool::SendRequest(MpM_REGISTRY_ENDPOINT_NAME_, request, " //####
+                "response, false, false) && (MpM_EXPECTED_BUSY_RESPONSE_SIZE_ == " //####
+                "response.count()) && (response.element(0).toString() == " //####
+                "MpM_BUSY_RESPONSE_) && (0 < response.element(1).asDouble()))"); //####
+    }
+    for ( ; 0 < held; --held)
+    {
+        registry.completeRegistration(yarp::os::Time::now());
+    }
+    ODL_EXIT_B(result); //####
+    return result;
+} // checkRegistrationFlood
+
+/*! @brief Perform a test case.
+ @param[in] launchPath The command-line name used to launch the service.
+ @param[in] argc The number of arguments in 'argv'.
+ @param[in] argv The arguments to be used for the test.
+ @return @c 0 on success and @c 1 on failure. */
+static int
+doTestRegistrationFlood(const char * launchPath,
+                        const int    argc,
+                        char * *     argv) // send 'register' requests to an overloaded registry
+{
+    ODL_ENTER(); //####
+    ODL_S1("launchPath = ", launchPath); //####
+    ODL_I1("argc = ", argc); //####
+    ODL_P1("argv = ", argv); //####
+    int result = 1;
+
+    try
+    {
+        const char *                secondServiceChannel;
+        Registry::RegistryService * registry = NULL;
+
+        if (0 <= argc)
+        {
+            switch (argc)
+            {
+                    // Argument order for tests = [IP address / name [, port]]
+                case 0 :
+                    registry = new Registry::RegistryService(launchPath, argc, argv,
+                                                             TEST_INMEMORY_);
+                    secondServiceChannel = BUILD_NAME_(MpM_SERVICE_BASE_NAME_,
+                                                       BUILD_NAME_("test", "registrationflood_1"));
+                    break;
+
+                case 1 :
+                    registry = new Registry::RegistryService(launchPath, argc, argv, TEST_INMEMORY_,
+                                                             *argv);
+                    secondServiceChannel = BUILD_NAME_(MpM_SERVICE_BASE_NAME_,
+                                                       BUILD_NAME_("test", "registrationflood_2"));
+                    break;
+
+                default :
+                    break;
+
+            }
+        }
+        if (registry)
+        {
+            if (registry->startService())
+            {
+                if (registry->isActive())
+                {
+                    Test15Service * aService = new Test15Service(launchPath, 1,
+                                                      const_cast<char * *>(&secondServiceChannel));
+
+                    if (aService)
+                    {
+                        if (aService->startService())
+                        {
+                            if (checkRegistrationFlood(*registry, *aService))
+                            {
+                                result = 0;
+                            }
+                            else
+                            {
+                                ODL_LOG("! (checkRegistrationFlood(*registry, *aService))"); //####
+                            }
+                            aService->stopService();
+                        }
+                        else
+                        {
+                            ODL_LOG("! (aService->startService())"); //####
+                        }
+                        delete aService;
+                    }
+                    else
+                    {
+                        ODL_LOG("! (aService)"); //####
+                    }
+                }
+                else
+                {
+                    ODL_LOG("! (registry->isActive())"); //####
+                }
+                registry->stopService();
+            }
+            else
+            {
+                ODL_LOG("! (registry->startService())"); //####
+            }
+            delete registry;
+        }
+        else
+        {
+            ODL_LOG("! (registry)"); //####
+        }
+    }
+    catch (...)
+    {
+        ODL_LOG("Exception caught"); //####
+        throw;
+    }
+    ODL_EXIT_I(result); //####
+    return result;
+} // doTestRegistrationFlood
+
+#if defined(__APPLE__)
+# pragma mark *** Test Case 23 ***
+#endif // defined(__APPLE__)
+
+/*! @brief Record a check made while gathering an inventory, taking a fixed time to do so.
+ @param[in] stuff The private data for the function.
+ @return @c false, as the inventory is never to be abandoned. */
+static bool
+checkInventoryProgress(void * stuff)
+{
+    ODL_ENTER(); //####
+    ODL_P1("stuff = ", stuff); //####
+    InventoryCheck * check = reinterpret_cast<InventoryCheck *>(stuff);
+
+    check->_lock.lock();
+    ++check->_active;
+    check->_peak = std::max(check->_peak, check->_active);
+    check->_lock.unlock();
+    yarp::os::Time::delay(check->_delay);
+    check->_lock.lock();
+    --check->_active;
+    check->_lock.unlock();
+    ODL_EXIT_B(false); //####
+    return false;
+} // checkInventoryProgress
+
+/*! @brief Check that the details of a set of services are gathered in order, with a bounded
+ number of services being examined at the same time.
+ @param[in] channelName The channel for a running service.
+ @return @c true if the inventory was gathered as expected and @c false otherwise. */
+static bool
+checkServiceInventory(const YarpString & channelName)
+{
+    ODL_ENTER(); //####
+    ODL_S1s("channelName = ", channelName); //####
+    bool                        result = false;
+    InventoryCheck              check;
+    YarpStringVector            services;
+    Utilities::ServiceInventory inventory;
+
+    // The missing service sits between two live ones, so that its failure can't disturb the
+    // order of the others.
+    services.push_back(channelName);
+    services.push_back(BUILD_NAME_(MpM_SERVICE_BASE_NAME_,
+                                   BUILD_NAME_("test", "inventory_missing")));
+    services.push_back(MpM_REGISTRY_ENDPOINT_NAME_);
+    check._delay = INITIAL_RETRY_INTERVAL_;
+    check._active = check._peak = 0;
+    Utilities::GatherServiceInventory(services, inventory, STANDARD_WAIT_TIME_,
+                                      TEST_INVENTORY_FAN_OUT_, checkInventoryProgress, &check);
+    ODL_I1("peak = ", check._peak); //####
+    if ((services.size() == inventory.size()) && (1 < check._peak) &&
+        (TEST_INVENTORY_FAN_OUT_ >= check._peak))
+    {
+        result = true;
+        for (size_t ii = 0, mm = inventory.size(); result && (mm > ii); ++ii)
+        {
+            const Utilities::ServiceInventoryEntry & anEntry = inventory[ii];
+
+            if (anEntry._channelName != services[ii])
+            {
+                ODL_LOG("(anEntry._channelName != services[ii])"); //####
+                result = false;
+            }
+            else if (anEntry._valid != (1 != ii))
+            {
+                ODL_LOG("(anEntry._valid != (1 != ii))"); //####
+                result = false;
+            }
+            else if (anEntry._valid && (anEntry._descriptor._channelName != services[ii]))
+            {
+                ODL_LOG("(anEntry._valid && (anEntry._descriptor._channelName != " //####
+                        "services[ii]))"); //####
+                result = false;
+            }
+        }
+    }
+    else
+    {
+        ODL_LOG("! ((services.size() == inventory.size()) && (1 < check._peak) && " //####
+                "(TEST_INVENTORY_FAN_OUT_ >= check._peak))"); //####
+    }
+    ODL_EXIT_B(result); //####
+    return result;
+} // checkServiceInventory
+
+/*! @brief Check that the connections of a set of ports are gathered in order, and that a port
+ that takes too long is abandoned.
+ @param[in] channelName The channel for a running service.
+ @return @c true if the inventory was gathered as expected and @c false otherwise. */
+static bool
+checkPortInventory(const YarpString & channelName)
+{
+    ODL_ENTER(); //####
+    ODL_S1s("channelName = ", channelName); //####
+    bool                      result = false;
+    Utilities::PortDescriptor aPort;
+    Utilities::PortVector     ports;
+    Utilities::PortInventory  inventory;
+
+    aPort._portName = channelName;
+    ports.push_back(aPort);
+    aPort._portName = MpM_REGISTRY_ENDPOINT_NAME_;
+    ports.push_back(aPort);
+    Utilities::GatherPortInventory(ports, inventory, true, STANDARD_WAIT_TIME_,
+                                   TEST_INVENTORY_FAN_OUT_);
+    if (ports.size() == inventory.size())
+    {
+        result = true;
+        for (size_t ii = 0, mm = inventory.size(); result && (mm > ii); ++ii)
+        {
+            if ((inventory[ii]._port._portName != ports[ii]._portName) ||
+                (! inventory[ii]._valid))
+            {
+                ODL_LOG("((inventory[ii]._port._portName != ports[ii]._portName) || " //####
+                        "(! inventory[ii]._valid))"); //####
+                result = false;
+            }
+        }
+    }
+    else
+    {
+        ODL_LOG("! (ports.size() == inventory.size())"); //####
+    }
+    if (result)
+    {
+        InventoryCheck check;
+        double         timeToWait = 5 * INITIAL_RETRY_INTERVAL_;
+
+        // Each check outlasts the time allowed for a port, so every port runs out of time while
+        // its connections are being read.
+        check._delay = 2 * timeToWait;
+        check._active = check._peak = 0;
+        Utilities::GatherPortInventory(ports, inventory, true, timeToWait,
+                                       TEST_INVENTORY_FAN_OUT_, checkInventoryProgress, &check);
+        if (ports.size() == inventory.size())
+        {
+            for (size_t ii = 0, mm = inventory.size(); result && (mm > ii); ++ii)
+            {
+                if ((inventory[ii]._port._portName != ports[ii]._portName) ||
+                    inventory[ii]._valid)
+                {
+                    ODL_LOG("((inventory[ii]._port._portName != ports[ii]._portName) || " //####
+                            "inventory[ii]._valid)"); //####
+                    result = false;
+                }
+            }
+        }
+        else
+        {
+            ODL_LOG("! (ports.size() == inventory.size())"); //####
+            result = false;
+        }
+    }
+    ODL_EXIT_B(result); //####
+    return result;
+} // checkPortInventory
+
+/*! @brief Perform a test case.
+ @param[in] launchPath The command-line name used to launch the service.
+ @param[in] argc The number of arguments in 'argv'.
+ @param[in] argv The arguments to be used for the test.
+ @return @c 0 on success and @c 1 on failure. */
+static int
+doTestInventory(const char * launchPath,
+                const int    argc,
+                char * *     argv) // gather the details of services and ports concurrently
+{
+    ODL_ENTER(); //####
+    ODL_S1("launchPath = ", launchPath); //####
+    ODL_I1("argc = ", argc); //####
+    ODL_P1("argv = ", argv); //####
+    int result = 1;
+
+    try
+    {
+        const char *                secondServiceChannel;
+        Registry::RegistryService * registry = NULL;
+
+        if (0 <= argc)
+        {
+            switch (argc)
+            {
+                    // Argument order for tests = [IP address / name [, port]]
+                case 0 :
+                    registry = new Registry::RegistryService(launchPath, argc, argv,
+                                                             TEST_INMEMORY_);
+                    secondServiceChannel = BUILD_NAME_(MpM_SERVICE_BASE_NAME_,
+                                                       BUILD_NAME_("test", "inventory_1"));
+                    break;
+
+                case 1 :
+                    registry = new Registry::RegistryService(launchPath, argc, argv, TEST_INMEMORY_,
+                                                             *argv);
+                    secondServiceChannel = BUILD_NAME_(MpM_SERVICE_BASE_NAME_,
+                                                       BUILD_NAME_("test", "inventory_2"));
+                    break;
+
+                default :
+                    break;
+
+            }
+        }
+        if (registry)
+        {
+            if (registry->startService())
+            {
+                if (registry->isActive())
+                {
+                    Test15Service * aService = new Test15Service(launchPath, 1,
+                                                      const_cast<char * *>(&secondServiceChannel));
+
+                    if (aService)
+                    {
+                        if (aService->startService())
+                        {
+                            YarpString channelName(aService->getEndpoint().getName());
+
+                            if (checkServiceInventory(channelName) &&
+                                checkPortInventory(channelName))
+                            {
+                                result = 0;
+                            }
+                            else
+                            {
+                                ODL_LOG("! (checkServiceInventory(channelName) && " //####
+                                        "checkPortInventory(channelName))"); //####
+                            }
+                            aService->stopService();
+                        }
+                        else
+                        {
+                            ODL_LOG("! (aService->startService())"); //####
+                        }
+                        delete aService;
+                    }
+                    else
+                    {
+                        ODL_LOG("! (aService)"); //####
+                    }
+                }
+                else
+                {
+                    ODL_LOG("! (registry->isActive())"); //####
+                }
+                registry->stopService();
+            }
+            else
+            {
+                ODL_LOG("! (registry->startService())"); //####
+            }
+            delete registry;
+        }
+        else
+        {
+            ODL_LOG("! (registry)"); //####
+        }
+    }
+    catch (...)
+    {
+        ODL_LOG("Exception caught"); //####
+        throw;
+    }
+    ODL_EXIT_I(result); //####
+    return result;
+} // doTestInventory
+
+/*! @brief The signal handler to catch requests to stop the service.
+ @param[in] signal The signal being handled. */
+static void
+catchSignal(int signal)
+{
+    ODL_ENTER(); //####
+    ODL_I1("signal = ", signal); //####
+    std::stringstream buff;
+    YarpString        message("Exiting due to signal ");
+
+    buff << signal;
+    message += buff.str();
+    message += " = ";
+    message += NameOfSignal(signal);
+    MpM_ERROR_(message.c_str());
+    ODL_EXIT_EXIT(1); //####
+    yarp::os::exit(1);
+} // catchSignal
+
+#if defined(__APPLE__)
+# pragma mark Global functions
+#endif // defined(__APPLE__)
+
+/*! @brief The entry point for unit tests of the %Registry Service classes.
+
+ The first argument is the test number, the second argument is the name of the channel to be used
+ with the test, the optional third argument is the machine to connect to and the optional fourth
+ argument is the port number to be used.
+ Output depends on the test being run.
+ @param[in] argc The number of arguments in 'argv'.
+ @param[in] argv The arguments to be used with the unit tests.
+ @return @c 0 on a successful test and @c 1 on failure. */
+int
+main(int      argc,
+     char * * argv)
+{
+    YarpString progName(*argv);
+
+    ODL_INIT(progName.c_str(), kODLoggingOptionIncludeProcessID | //####
+             kODLoggingOptionIncludeThreadID | kODLoggingOptionEnableThreadSupport | //####
+             kODLoggingOptionWriteToStderr); //####
+    ODL_ENTER(); //####
+#if MAC_OR_LINUX_
+    SetUpLogger(progName);
+#endif // MAC_OR_LINUX_
+    int result = 1;
+
+    try
+    {
+        // We normally call CheckForNameServerReporter() here, but we should only run the tests with
+        // a valid YARP configuration.
+        Utilities::SetUpGlobalStatusReporter();
+Utilities::CheckForNameServerReporter();
+        if (Utilities::CheckForValidNetwork())
+        {
+            yarp::os::Network yarp; // This is necessary to establish any connections to the YARP
+                                    // infrastructure
+
+            Initialize(progName);
+            if (0 < --argc)
+            {
+                const char * startPtr = argv[1];
+                char *       endPtr;
+                int          selector = strtol(startPtr, &endPtr, 10);
+
+                ODL_I1("selector <- ", selector); //####
+                if ((startPtr != endPtr) && (! *endPtr) && (0 < selector))
+                {
+                    SetSignalHandlers(catchSignal);
+                    switch (selector)
+                    {
+                        case 13 :
+                            result = doTestCreateRegistryService(*argv, argc - 1, argv + 2);
+                            break;
+
+                        case 14 :
+                            result = doTestRequestRegistryService(*argv, argc - 1, argv + 2);
+                            break;
+
+                        case 15 :
+                            result = doTestRequestUnregisterService(*argv, argc - 1, argv + 2);
+                            break;
+
+                        case 16 :
+                            result = doTestRequestSearchService(*argv, argc - 1, argv + 2);
+                            break;
+
+                        case 17 :
+                            result = doTestRequestChanges(*argv, argc - 1, argv + 2);
+                            break;
+
+                        case 18 :
+                            result = doTestRequestRegisterByCallback(*argv, argc - 1, argv + 2);
+                            break;
+
+                        case 19 :
+                            result = doTestRegistryCache(*argv, argc - 1, argv + 2);
+                            break;
+
+                        case 20 :
+                            result = doTestRegistryWarmRestart(*argv, argc - 1, argv + 2);
+                            break;
+
+                        case 21 :
+                            result = doTestRegistryDamagedDatabase(*argv, argc - 1, argv + 2);
+                            break;
+
+                        case 22 :
+                            result = doTestRegistrationFlood(*argv, argc - 1, argv + 2);
+                            break;
+
+                        case 23 :
+                            result = doTestInventory(*argv, argc - 1, argv + 2);
                             break;
 
                         default :
@@ -154,7 +154,8 @@ bool
 UnregisterRequestHandler::processRequest(const YarpString &           request,
                                          const yarp::os::Bottle &     restOfInput,
                                          const YarpString &           senderChannel,
-                                         yarp::os::ConnectionWriter * replyMechanism)
+                                         yarp::os::ConnectionWriter * replyMechanism,
+                                         yarp::os::Bottle &           response)
 {
 #if (! defined(ODL_ENABLE_LOGGING_))
 # if MAC_OR_LINUX_
@@ -164,13 +165,12 @@ UnregisterRequestHandler::processRequest(const YarpString &           request,
     ODL_OBJENTER(); //####
     ODL_S3s("request = ", request, "restOfInput = ", restOfInput.toString(), //####
             "senderChannel = ", senderChannel); //####
-    ODL_P1("replyMechanism = ", replyMechanism); //####
+    ODL_P2("replyMechanism = ", replyMechanism, "response = ", &response); //####
     bool result = true;
 
     try
     {
         // Validate the name as a channel name
-        _response.clear();
         if (1 == restOfInput.size())
         {
             yarp::os::Value argument(restOfInput.get(0));
@@ -188,7 +188,7 @@ UnregisterRequestHandler::processRequest(const YarpString &           request,
                     // Forget the information associated with the channel name
                     if (theService.removeServiceRecord(argAsString))
                     {
-                        _response.addString(MpM_OK_RESPONSE_);
+                        response.addString(MpM_OK_RESPONSE_);
                         if (argAsString != MpM_REGISTRY_ENDPOINT_NAME_)
                         {
                             theService.removeCheckedTimeForChannel(argAsString);
@@ -197,31 +197,31 @@ UnregisterRequestHandler::processRequest(const YarpString &           request,
                     else
                     {
                         ODL_LOG("! (theService.removeServiceRecord(argAsString))"); //####
-                        _response.addString(MpM_FAILED_RESPONSE_);
-                        _response.addString("Could not remove service");
+                        response.addString(MpM_FAILED_RESPONSE_);
+                        response.addString("Could not remove service");
                     }
                 }
                 else
                 {
                     ODL_LOG("! (Endpoint::CheckEndpointName(argAsString))"); //####
-                    _response.addString(MpM_FAILED_RESPONSE_);
-                    _response.addString("Invalid channel name");
+                    response.addString(MpM_FAILED_RESPONSE_);
+                    response.addString("Invalid channel name");
                 }
             }
             else
             {
                 ODL_LOG("! (argument.isString())"); //####
-                _response.addString(MpM_FAILED_RESPONSE_);
-                _response.addString("Invalid channel name");
+                response.addString(MpM_FAILED_RESPONSE_);
+                response.addString("Invalid channel name");
             }
         }
         else
         {
             ODL_LOG("! (1 == restOfInput.size())"); //####
-            _response.addString(MpM_FAILED_RESPONSE_);
-            _response.addString("Missing channel name or extra arguments to request");
+            response.addString(MpM_FAILED_RESPONSE_);
+            response.addString("Missing channel name or extra arguments to request");
         }
-        sendResponse(replyMechanism);
+        sendResponse(response, replyMechanism);
     }
     catch (...)
     {
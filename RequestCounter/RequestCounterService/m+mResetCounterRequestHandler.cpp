@@ -139,17 +139,18 @@ bool
 ResetCounterRequestHandler::processRequest(const YarpString &           request,
                                            const yarp::os::Bottle &     restOfInput,
                                            const YarpString &           senderChannel,
-                                           yarp::os::ConnectionWriter * replyMechanism)
+                                           yarp::os::ConnectionWriter * replyMechanism,
+                                           yarp::os::Bottle &           response)
 {
 #if (! defined(ODL_ENABLE_LOGGING_))
 # if MAC_OR_LINUX_
-#  pragma unused(request,restOfInput)
+#  pragma unused(request,restOfInput,response)
 # endif // MAC_OR_LINUX_
 #endif // ! defined(ODL_ENABLE_LOGGING_)
     ODL_OBJENTER(); //####
     ODL_S3s("request = ", request, "restOfInput = ", restOfInput.toString(), //####
             "senderChannel = ", senderChannel); //####
-    ODL_P1("replyMechanism = ", replyMechanism); //####
+    ODL_P2("replyMechanism = ", replyMechanism, "response = ", &response); //####
     bool result = true;
 
     try
@@ -142,7 +142,8 @@ bool
 StatsRequestHandler::processRequest(const YarpString &           request,
                                     const yarp::os::Bottle &     restOfInput,
                                     const YarpString &           senderChannel,
-                                    yarp::os::ConnectionWriter * replyMechanism)
+                                    yarp::os::ConnectionWriter * replyMechanism,
+                                    yarp::os::Bottle &           response)
 {
 #if (! defined(ODL_ENABLE_LOGGING_))
 # if MAC_OR_LINUX_
@@ -152,7 +153,7 @@ StatsRequestHandler::processRequest(const YarpString &           request,
     ODL_OBJENTER(); //####
     ODL_S3s("request = ", request, "restOfInput = ", restOfInput.toString(), //####
             "senderChannel = ", senderChannel); //####
-    ODL_P1("replyMechanism = ", replyMechanism); //####
+    ODL_P2("replyMechanism = ", replyMechanism, "response = ", &response); //####
     bool result = true;
 
     try
@@ -162,10 +163,9 @@ StatsRequestHandler::processRequest(const YarpString &           request,
 
         static_cast<RequestCounterService &>(_service).getStatistics(senderChannel, counter,
                                                                      elapsedTime);
-        _response.clear();
-        _response.addInt(static_cast<int>(counter));
-        _response.addDouble(elapsedTime);
-        sendResponse(replyMechanism);
+        response.addInt(static_cast<int>(counter));
+        response.addDouble(elapsedTime);
+        sendResponse(response, replyMechanism);
     }
     catch (...)
     {
@@ -36,6 +36,7 @@
 //
 //--------------------------------------------------------------------------------------------------
 
+#include <m+m/m+mRegistryCache.hpp>
 #include <m+m/m+mUtilities.hpp>
 
 //#include <odlEnable.h>
@@ -94,13 +95,16 @@ setUpAndGo(const OutputFlavour flavour)
         }
         if (0 < services.size())
         {
-            for (YarpStringVector::const_iterator walker(services.begin());
-                 services.end() != walker; ++walker)
+            Utilities::ServiceInventory inventory;
+
+            // Gather all the descriptions first, rather than waiting on each service in turn.
+            Utilities::GatherServiceInventory(services, inventory, STANDARD_WAIT_TIME_);
+            for (Utilities::ServiceInventory::iterator walker(inventory.begin());
+                 inventory.end() != walker; ++walker)
             {
-                Utilities::ServiceDescriptor descriptor;
+                Utilities::ServiceDescriptor & descriptor = walker->_descriptor;
 
-                if (Utilities::GetNameAndDescriptionForService(*walker, descriptor,
-                                                               STANDARD_WAIT_TIME_))
+                if (walker->_valid)
                 {
                     bool       sawClients = false;
                     bool       sawInputs = false;
@@ -275,7 +279,8 @@ setUpAndGo(const OutputFlavour flavour)
                         clientChannelNames += " ]";
                     }
                     kind = SanitizeString(descriptor._kind, kOutputFlavourJSON != flavour);
-                    servicePortName = SanitizeString(*walker, kOutputFlavourJSON != flavour);
+                    servicePortName = SanitizeString(walker->_channelName,
+                                                     kOutputFlavourJSON != flavour);
                     serviceName = SanitizeString(descriptor._serviceName,
                                                  kOutputFlavourJSON != flavour);
                     tag = SanitizeString(descriptor._tag, kOutputFlavourJSON != flavour);
@@ -441,6 +446,11 @@ main(int      argc,
                 Initialize(progName);
                 if (Utilities::CheckForRegistryService())
                 {
+                    // Repeated matches are answered locally, rather than by the Registry Service.
+                    if (! RegistryCache::Enable())
+                    {
+                        ODL_LOG("! (RegistryCache::Enable())"); //####
+                    }
                     setUpAndGo(flavour);
                 }
                 else
@@ -139,7 +139,8 @@ bool
 WhereRequestHandler::processRequest(const YarpString &           request,
                                     const yarp::os::Bottle &     restOfInput,
                                     const YarpString &           senderChannel,
-                                    yarp::os::ConnectionWriter * replyMechanism)
+                                    yarp::os::ConnectionWriter * replyMechanism,
+                                    yarp::os::Bottle &           response)
 {
 #if (! defined(ODL_ENABLE_LOGGING_))
 # if MAC_OR_LINUX_
@@ -149,7 +150,7 @@ WhereRequestHandler::processRequest(const YarpString &           request,
     ODL_OBJENTER(); //####
     ODL_S3s("request = ", request, "restOfInput = ", restOfInput.toString(), //####
             "senderChannel = ", senderChannel); //####
-    ODL_P1("replyMechanism = ", replyMechanism); //####
+    ODL_P2("replyMechanism = ", replyMechanism, "response = ", &response); //####
     bool result = true;
 
     try
@@ -158,10 +159,9 @@ WhereRequestHandler::processRequest(const YarpString &           request,
         int        port;
 
         static_cast<TunnelService &>(_service).getAddress(address, port);
-        _response.clear();
-        _response.addString(address);
-        _response.addInt(port);
-        sendResponse(replyMechanism);
+        response.addString(address);
+        response.addInt(port);
+        sendResponse(response, replyMechanism);
     }
     catch (...)
     {
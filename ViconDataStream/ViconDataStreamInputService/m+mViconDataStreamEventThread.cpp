@@ -284,9 +284,9 @@ ViconDataStreamEventThread::processEventData(const unsigned int subjectCount)
     {
         if (0 < message.size())
         {
-            if (! _outChannel->write(message))
+            if (! _outChannel->writeBottle(message))
             {
-                ODL_LOG("(! _outChannel->write(message))"); //####
+                ODL_LOG("(! _outChannel->writeBottle(message))"); //####
 #if defined(MpM_StallOnSendProblem)
                 Stall();
 #endif // defined(MpM_StallOnSendProblem)
@@ -356,9 +356,9 @@ AbsorberFilterService::reportMessageRate(void)
 
             outBottle.addDouble(messageRate);
             outBottle.addDouble(byteRate);
-            if (! outStream->write(outBottle))
+            if (! outStream->writeBottle(outBottle))
             {
-                ODL_LOG("(! outStream->write(message))"); //####
+                ODL_LOG("(! outStream->writeBottle(outBottle))"); //####
 #if defined(MpM_StallOnSendProblem)
                 Stall();
 #endif // defined(MpM_StallOnSendProblem)
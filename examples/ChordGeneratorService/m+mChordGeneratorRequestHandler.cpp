@@ -151,7 +151,8 @@ bool
 ChordGeneratorRequestHandler::processRequest(const YarpString &           request,
                                              const yarp::os::Bottle &     restOfInput,
                                              const YarpString &           senderChannel,
-                                             yarp::os::ConnectionWriter * replyMechanism)
+                                             yarp::os::ConnectionWriter * replyMechanism,
+                                             yarp::os::Bottle &           response)
 {
 #if (! defined(ODL_ENABLE_LOGGING_))
 # if MAC_OR_LINUX_
@@ -161,14 +162,13 @@ ChordGeneratorRequestHandler::processRequest(const YarpString &           reques
     ODL_OBJENTER(); //####
     ODL_S3s("request = ", request, "restOfInput = ", restOfInput.toString(), //####
             "senderChannel = ", senderChannel); //####
-    ODL_P1("replyMechanism = ", replyMechanism); //####
+    ODL_P2("replyMechanism = ", replyMechanism, "response = ", &response); //####
     bool result = true;
 
     try
     {
         int count;
 
-        _response.clear();
         if (0 < restOfInput.size())
         {
             yarp::os::Value number(restOfInput.get(0));
@@ -190,14 +190,14 @@ ChordGeneratorRequestHandler::processRequest(const YarpString &           reques
         {
             for (int ii = 0; ii < count; ++ii)
             {
-                _response.addDouble(yarp::os::Random::uniform());
+                response.addDouble(yarp::os::Random::uniform());
             }
         }
         else
         {
             ODL_LOG("! (count > 0)"); //####
         }
-        sendResponse(replyMechanism);
+        sendResponse(response, replyMechanism);
     }
     catch (...)
     {
@@ -98,6 +98,15 @@ namespace MplusM
             fillInDescription(const YarpString &   request,
                               yarp::os::Property & info);
 
+            /*! @brief Return @c true if the handler can process more than one request at a time.
+             @return @c true, as the request only uses its own input. */
+            virtual inline bool
+            isReentrant(void)
+            const
+            {
+                return true;
+            } // isReentrant
+
             /*! @brief The assignment operator.
              @param[in] other The object to be copied.
              @return The updated object. */
@@ -108,12 +117,14 @@ namespace MplusM
              @param[in] request The actual request name.
              @param[in] restOfInput The arguments to the operation.
              @param[in] senderChannel The name of the channel used to send the input data.
-             @param[in] replyMechanism non-@c NULL if a reply is expected and @c NULL otherwise. */
+             @param[in] replyMechanism non-@c NULL if a reply is expected and @c NULL otherwise.
+             @param[in,out] response The object to hold the response, which is initially empty. */
             virtual bool
             processRequest(const YarpString &           request,
                            const yarp::os::Bottle &     restOfInput,
                            const YarpString &           senderChannel,
-                           yarp::os::ConnectionWriter * replyMechanism);
+                           yarp::os::ConnectionWriter * replyMechanism,
+                           yarp::os::Bottle &           response);
 
         public :
 
@@ -88,7 +88,7 @@ EchoService::EchoService(const YarpString & launchPath,
                          const YarpString & tag,
                          const YarpString & serviceEndpointName,
                          const YarpString & servicePortNumber) :
-    inherited(kServiceKindNormal, launchPath, argc, argv, tag, true, MpM_ECHO_CANONICAL_NAME_,
+    inherited(kServiceKindNormal, launchPath, argc, argv, tag, false, MpM_ECHO_CANONICAL_NAME_,
               ECHO_SERVICE_DESCRIPTION_, "echo - send back any values given with the request",
               serviceEndpointName, servicePortNumber), _echoHandler(NULL)
 {
@@ -97,6 +97,9 @@ EchoService::EchoService(const YarpString & launchPath,
             serviceEndpointName, "servicePortNumber = ", servicePortNumber); //####
     ODL_I1("argc = ", argc); //####
     ODL_P1("argv = ", argv); //####
+    // A single input handler feeds a fixed pool of workers, rather than each connection having
+    // its own handler thread.
+    setRequestWorkerCount(ECHO_SERVICE_REQUEST_WORKERS_);
     attachRequestHandlers();
     ODL_EXIT_P(this); //####
 } // EchoService::EchoService
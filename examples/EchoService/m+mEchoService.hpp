@@ -59,6 +59,9 @@
 /*! @brief The description of the service. */
 # define ECHO_SERVICE_DESCRIPTION_ T_("Echo service")
 
+/*! @brief The number of worker threads that process the requests sent to the service. */
+# define ECHO_SERVICE_REQUEST_WORKERS_ 4
+
 namespace MplusM
 {
     namespace Example
@@ -136,9 +136,9 @@ PlaybackFromJSONInputThread::run(void)
 
                     if (toWrite && _outChannel)
                     {
-                        if (! _outChannel->write(*toWrite))
+                        if (! _outChannel->writeBottle(*toWrite))
                         {
-                            ODL_LOG("(! _outChannel->write(*toWrite))"); //####
+                            ODL_LOG("(! _outChannel->writeBottle(*toWrite))"); //####
 #if defined(MpM_StallOnSendProblem)
                             Stall();
 #endif // defined(MpM_StallOnSendProblem)
@@ -127,9 +127,9 @@ RandomBurstInputThread::run(void)
             }
             if (_outChannel)
             {
-                if (! _outChannel->write(message))
+                if (! _outChannel->writeBottle(message))
                 {
-                    ODL_LOG("(! _outChannel->write(message))"); //####
+                    ODL_LOG("(! _outChannel->writeBottle(message))"); //####
 #if defined(MpM_StallOnSendProblem)
                     Stall();
 #endif // defined(MpM_StallOnSendProblem)
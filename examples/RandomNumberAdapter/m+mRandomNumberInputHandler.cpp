@@ -170,9 +170,9 @@ RandomNumberInputHandler::handleInput(const yarp::os::Bottle &     input,
                             }
                         }
                         _shared.lock();
-                        if (! theOutput->write(message))
+                        if (! theOutput->writeBottle(message))
                         {
-                            ODL_LOG("(! theOutput->write(message))"); //####
+                            ODL_LOG("(! theOutput->writeBottle(message))"); //####
 #if defined(MpM_StallOnSendProblem)
                             Stall();
 #endif // defined(MpM_StallOnSendProblem)
@@ -194,9 +194,9 @@ RandomNumberInputHandler::handleInput(const yarp::os::Bottle &     input,
 
                         message.addDouble(randResult);
                         _shared.lock();
-                        if (! theOutput->write(message))
+                        if (! theOutput->writeBottle(message))
                         {
-                            ODL_LOG("(! theOutput->write(message))"); //####
+                            ODL_LOG("(! theOutput->writeBottle(message))"); //####
 #if defined(MpM_StallOnSendProblem)
                             Stall();
 #endif // defined(MpM_StallOnSendProblem)
@@ -150,7 +150,8 @@ bool
 RandomRequestHandler::processRequest(const YarpString &           request,
                                      const yarp::os::Bottle &     restOfInput,
                                      const YarpString &           senderChannel,
-                                     yarp::os::ConnectionWriter * replyMechanism)
+                                     yarp::os::ConnectionWriter * replyMechanism,
+                                     yarp::os::Bottle &           response)
 {
 #if (! defined(ODL_ENABLE_LOGGING_))
 # if MAC_OR_LINUX_
@@ -160,14 +161,13 @@ RandomRequestHandler::processRequest(const YarpString &           request,
     ODL_OBJENTER(); //####
     ODL_S3s("request = ", request, "restOfInput = ", restOfInput.toString(), //####
             "senderChannel = ", senderChannel); //####
-    ODL_P1("replyMechanism = ", replyMechanism); //####
+    ODL_P2("replyMechanism = ", replyMechanism, "response = ", &response); //####
     bool result = true;
 
     try
     {
         int count;
 
-        _response.clear();
         if (0 < restOfInput.size())
         {
             yarp::os::Value number(restOfInput.get(0));
@@ -189,14 +189,14 @@ RandomRequestHandler::processRequest(const YarpString &           request,
         {
             for (int ii = 0; ii < count; ++ii)
             {
-                _response.addDouble(yarp::os::Random::uniform());
+                response.addDouble(yarp::os::Random::uniform());
             }
         }
         else
         {
             ODL_LOG("! (count > 0)"); //####
         }
-        sendResponse(replyMechanism);
+        sendResponse(response, replyMechanism);
     }
     catch (...)
     {
@@ -163,9 +163,9 @@ RunningSumDataInputHandler::handleInput(const yarp::os::Bottle &     input,
                             yarp::os::Bottle message;
 
                             message.addDouble(outValue);
-                            if (! theOutput->write(message))
+                            if (! theOutput->writeBottle(message))
                             {
-                                ODL_LOG("(! theOutput->write(message))"); //####
+                                ODL_LOG("(! theOutput->writeBottle(message))"); //####
 #if defined(MpM_StallOnSendProblem)
                                 Stall();
 #endif // defined(MpM_StallOnSendProblem)
@@ -208,9 +208,9 @@ RunningSumDataInputHandler::handleInput(const yarp::os::Bottle &     input,
                             yarp::os::Bottle message;
 
                             message.addDouble(outValue);
-                            if (! theOutput->write(message))
+                            if (! theOutput->writeBottle(message))
                             {
-                                ODL_LOG("(! theOutput->write(message))"); //####
+                                ODL_LOG("(! theOutput->writeBottle(message))"); //####
 #if defined(MpM_StallOnSendProblem)
                                 Stall();
 #endif // defined(MpM_StallOnSendProblem)
@@ -161,9 +161,9 @@ RunningSumInputHandler::handleInput(const yarp::os::Bottle &     input,
                                     yarp::os::Bottle message;
 
                                     message.addDouble(outValue);
-                                    if (! theOutput->write(message))
+                                    if (! theOutput->writeBottle(message))
                                     {
-                                        ODL_LOG("(! theOutput->write(message))"); //####
+                                        ODL_LOG("(! theOutput->writeBottle(message))"); //####
 #if defined(MpM_StallOnSendProblem)
                                         Stall();
 #endif // defined(MpM_StallOnSendProblem)
@@ -183,9 +183,9 @@ RunningSumInputHandler::handleInput(const yarp::os::Bottle &     input,
                                     yarp::os::Bottle message;
 
                                     message.addDouble(outValue);
-                                    if (! theOutput->write(message))
+                                    if (! theOutput->writeBottle(message))
                                     {
-                                        ODL_LOG("(! theOutput->write(message))"); //####
+                                        ODL_LOG("(! theOutput->writeBottle(message))"); //####
 #if defined(MpM_StallOnSendProblem)
                                         Stall();
 #endif // defined(MpM_StallOnSendProblem)
@@ -264,9 +264,9 @@ RunningSumInputHandler::handleInput(const yarp::os::Bottle &     input,
                             yarp::os::Bottle message;
 
                             message.addDouble(outValue);
-                            if (! theOutput->write(message))
+                            if (! theOutput->writeBottle(message))
                             {
-                                ODL_LOG("(! theOutput->write(message))"); //####
+                                ODL_LOG("(! theOutput->writeBottle(message))"); //####
 #if defined(MpM_StallOnSendProblem)
                                 Stall();
 #endif // defined(MpM_StallOnSendProblem)
@@ -286,9 +286,9 @@ RunningSumInputHandler::handleInput(const yarp::os::Bottle &     input,
                             yarp::os::Bottle message;
 
                             message.addDouble(outValue);
-                            if (! theOutput->write(message))
+                            if (! theOutput->writeBottle(message))
                             {
-                                ODL_LOG("(! theOutput->write(message))"); //####
+                                ODL_LOG("(! theOutput->writeBottle(message))"); //####
 #if defined(MpM_StallOnSendProblem)
                                 Stall();
 #endif // defined(MpM_StallOnSendProblem)
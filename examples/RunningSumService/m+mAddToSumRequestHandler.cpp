@@ -151,7 +151,8 @@ bool
 AddToSumRequestHandler::processRequest(const YarpString &           request,
                                        const yarp::os::Bottle &     restOfInput,
                                        const YarpString &           senderChannel,
-                                       yarp::os::ConnectionWriter * replyMechanism)
+                                       yarp::os::ConnectionWriter * replyMechanism,
+                                       yarp::os::Bottle &           response)
 {
 #if (! defined(ODL_ENABLE_LOGGING_))
 # if MAC_OR_LINUX_
@@ -161,7 +162,7 @@ AddToSumRequestHandler::processRequest(const YarpString &           request,
     ODL_OBJENTER(); //####
     ODL_S3s("request = ", request, "restOfInput = ", restOfInput.toString(), //####
             "senderChannel = ", senderChannel); //####
-    ODL_P1("replyMechanism = ", replyMechanism); //####
+    ODL_P2("replyMechanism = ", replyMechanism, "response = ", &response); //####
     bool result = true;
 
     try
@@ -169,7 +170,6 @@ AddToSumRequestHandler::processRequest(const YarpString &           request,
         double total = 0.0;
         int    count = restOfInput.size();
 
-        _response.clear();
         if (1 <= count)
         {
             int tally = 0;
@@ -193,22 +193,22 @@ AddToSumRequestHandler::processRequest(const YarpString &           request,
             }
             if (tally)
             {
-                _response.addDouble(total);
+                response.addDouble(total);
             }
             else
             {
                 ODL_LOG("! (tally)"); //####
-                _response.addString(MpM_FAILED_RESPONSE_);
-                _response.addString("No numeric values in list");
+                response.addString(MpM_FAILED_RESPONSE_);
+                response.addString("No numeric values in list");
             }
         }
         else
         {
             ODL_LOG("! (1 <= count)"); //####
-            _response.addString(MpM_FAILED_RESPONSE_);
-            _response.addString("No values provided");
+            response.addString(MpM_FAILED_RESPONSE_);
+            response.addString("No values provided");
         }
-        sendResponse(replyMechanism);
+        sendResponse(response, replyMechanism);
     }
     catch (...)
     {
@@ -39,6 +39,8 @@
 
 #include "m+mTruncateFloatFilterInputHandler.hpp"
 
+#include <m+m/m+mNumericArrayView.hpp>
+
 //#include <odlEnable.h>
 #include <odlInclude.h>
 
@@ -122,6 +124,7 @@ TruncateFloatFilterInputHandler::handleInput(const yarp::os::Bottle &     input,
 
     try
     {
+        NumericArrayView arrayView;
         yarp::os::Bottle outBottle;
 
         for (int ii = 0, mm = input.size(); mm > ii; ++ii)
@@ -136,12 +139,19 @@ TruncateFloatFilterInputHandler::handleInput(const yarp::os::Bottle &     input,
             {
                 outBottle.addInt(static_cast<int>(aValue.asDouble()));
             }
+            else if (arrayView.attach(aValue))
+            {
+                for (size_t jj = 0, nn = arrayView.size(); nn > jj; ++jj)
+                {
+                    outBottle.addInt(static_cast<int>(arrayView[jj]));
+                }
+            }
         }
         if ((0 < outBottle.size()) && _outChannel)
         {
-            if (! _outChannel->write(outBottle))
+            if (! _outChannel->writeBottle(outBottle))
             {
-                ODL_LOG("(! _outChannel->write(message))"); //####
+                ODL_LOG("(! _outChannel->writeBottle(message))"); //####
 #if defined(MpM_StallOnSendProblem)
                 Stall();
 #endif // defined(MpM_StallOnSendProblem)
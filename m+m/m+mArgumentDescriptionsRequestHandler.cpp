@@ -146,7 +146,8 @@ bool
 ArgumentDescriptionsRequestHandler::processRequest(const YarpString &           request,
                                                    const yarp::os::Bottle &     restOfInput,
                                                    const YarpString &           senderChannel,
-                                                   yarp::os::ConnectionWriter * replyMechanism)
+                                                   yarp::os::ConnectionWriter * replyMechanism,
+                                                   yarp::os::Bottle &           response)
 {
 #if (! defined(ODL_ENABLE_LOGGING_))
 # if MAC_OR_LINUX_
@@ -156,25 +157,31 @@ ArgumentDescriptionsRequestHandler::processRequest(const YarpString &
     ODL_OBJENTER(); //####
     ODL_S3s("request = ", request, "restOfInput = ", restOfInput.toString(), //####
             "senderChannel = ", senderChannel); //####
-    ODL_P1("replyMechanism = ", replyMechanism); //####
+    ODL_P2("replyMechanism = ", replyMechanism, "response = ", &response); //####
     bool result = true;
 
     try
     {
-        const Utilities::DescriptorVector & argDescriptions =
-                        static_cast<BaseInputOutputService &>(_service).getArgumentDescriptions();
+        size_t generation;
 
-        _response.clear();
-        for (size_t ii = 0, numArgs = argDescriptions.size(); numArgs > ii; ++ii)
+        if (! _service.sendCachedReply(MpM_ARGUMENTDESCRIPTIONS_REQUEST_, replyMechanism,
+                                       generation))
         {
-            Utilities::BaseArgumentDescriptor * anArg = argDescriptions[ii];
+            const Utilities::DescriptorVector & argDescriptions =
+                        static_cast<BaseInputOutputService &>(_service).getArgumentDescriptions();
 
-            if (anArg)
+            for (size_t ii = 0, numArgs = argDescriptions.size(); numArgs > ii; ++ii)
             {
-                _response.addString(anArg->toString());
+                Utilities::BaseArgumentDescriptor * anArg = argDescriptions[ii];
+
+                if (anArg)
+                {
+                    response.addString(anArg->toString());
+                }
             }
+            _service.cacheReply(MpM_ARGUMENTDESCRIPTIONS_REQUEST_, response, generation);
+            sendResponse(response, replyMechanism);
         }
-        sendResponse(replyMechanism);
     }
     catch (...)
     {
@@ -153,7 +153,8 @@ bool
 ArgumentsRequestHandler::processRequest(const YarpString &           request,
                                         const yarp::os::Bottle &     restOfInput,
                                         const YarpString &           senderChannel,
-                                        yarp::os::ConnectionWriter * replyMechanism)
+                                        yarp::os::ConnectionWriter * replyMechanism,
+                                        yarp::os::Bottle &           response)
 {
 #if (! defined(ODL_ENABLE_LOGGING_))
 # if MAC_OR_LINUX_
@@ -163,19 +164,18 @@ ArgumentsRequestHandler::processRequest(const YarpString &           request,
     ODL_OBJENTER(); //####
     ODL_S3s("request = ", request, "restOfInput = ", restOfInput.toString(), //####
             "senderChannel = ", senderChannel); //####
-    ODL_P1("replyMechanism = ", replyMechanism); //####
+    ODL_P2("replyMechanism = ", replyMechanism, "response = ", &response); //####
     bool result = true;
 
     try
     {
         const YarpStringVector & args = _service.getArguments();
 
-        _response.clear();
         for (size_t ii = 0, mm = args.size(); mm > ii; ++ii)
         {
-            _response.addString(args[ii]);
+            response.addString(args[ii]);
         }
-        sendResponse(replyMechanism);
+        sendResponse(response, replyMechanism);
     }
     catch (...)
     {
@@ -38,8 +38,6 @@
 
 #include "m+mBailOut.hpp"
 
-#include <m+m/m+mBailOutThread.hpp>
-
 //#include <odlEnable.h>
 #include <odlInclude.h>
 
@@ -82,50 +80,29 @@ using namespace MplusM::Common;
 #endif // defined(__APPLE__)
 
 BailOut::BailOut(const double timeToWait) :
-    _bailer(NULL), _stopTime(timeToWait)
+    _deadline()
 {
     ODL_ENTER(); //####
     ODL_D1("timeToWait = ", timeToWait); //####
-    _bailer = new BailOutThread(timeToWait);
-    if (! _bailer->start())
-    {
-        ODL_LOG("(! _bailer->start())"); //####
-        delete _bailer;
-        _bailer = NULL;
-    }
+    DeadlineService::Register(_deadline, NULL, timeToWait);
     ODL_EXIT_P(this); //####
 } // BailOut::BailOut
 
 BailOut::BailOut(BaseChannel & channelOfInterest,
                  const double  timeToWait) :
-    _bailer(NULL), _stopTime(timeToWait)
+    _deadline()
 {
     ODL_ENTER(); //####
     ODL_P1("channelOfInterest = ", &channelOfInterest); //####
     ODL_D1("timeToWait = ", timeToWait); //####
-    _bailer = new BailOutThread(channelOfInterest, timeToWait);
-    if (! _bailer->start())
-    {
-        ODL_LOG("(! _bailer->start())"); //####
-        delete _bailer;
-        _bailer = NULL;
-    }
+    DeadlineService::Register(_deadline, &channelOfInterest, timeToWait);
     ODL_EXIT_P(this); //####
 } // BailOut::BailOut
 
 BailOut::~BailOut(void)
 {
     ODL_OBJENTER(); //####
-    if (_bailer)
-    {
-        _bailer->stop();
-        for ( ; _bailer->isRunning(); )
-        {
-            yarp::os::Time::delay(_stopTime / 4.3);
-        }
-        delete _bailer;
-        _bailer = NULL;
-    }
+    DeadlineService::Cancel(_deadline);
     ODL_OBJEXIT(); //####
 } // BailOut::~BailOut
 
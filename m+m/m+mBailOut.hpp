@@ -39,7 +39,7 @@
 #if (! defined(MpMBailOut_HPP_))
 # define MpMBailOut_HPP_ /* Header guard */
 
-# include <m+m/m+mCommon.hpp>
+# include <m+m/m+mDeadlineService.hpp>
 
 # if defined(__APPLE__)
 #  pragma clang diagnostic push
@@ -56,10 +56,12 @@ namespace MplusM
 {
     namespace Common
     {
-        class BailOutThread;
         class BaseChannel;
 
-        /*! @brief A convenience class to timeout objects. */
+        /*! @brief A convenience class to timeout objects.
+
+         The timeout is tracked by the process-wide deadline service from construction until
+         destruction. */
         class BailOut
         {
         public :
@@ -105,11 +107,8 @@ namespace MplusM
 
         private :
 
-            /*! @brief The bailout thread to use. */
-            BailOutThread * _bailer;
-
-            /*! @brief The amount of time to wait for the thread to stop. */
-            double _stopTime;
+            /*! @brief The timeout being tracked. */
+            Deadline _deadline;
 
         }; // BailOut
 
@@ -39,6 +39,7 @@
 #include "m+mBaseChannel.hpp"
 
 #include <m+m/m+mBailOut.hpp>
+#include <m+m/m+mBottleSizeReader.hpp>
 
 //#include <odlEnable.h>
 #include <odlInclude.h>
@@ -146,7 +147,7 @@ BaseChannel::RelinquishChannel(BaseChannel * theChannel)
 #endif // defined(__APPLE__)
 
 BaseChannel::BaseChannel(void) :
-    inherited(), _name(), _counters(), _metricsEnabled(false)
+    inherited(), _name(), _counters(), _outBuffer(), _outBufferLock(), _metricsEnabled(false)
 {
     ODL_ENTER(); //####
     ODL_EXIT_P(this); //####
@@ -162,6 +163,14 @@ BaseChannel::~BaseChannel(void)
 # pragma mark Actions and Accessors
 #endif // defined(__APPLE__)
 
+void
+BaseChannel::clearSendReceiveCounters(void)
+{
+    ODL_OBJENTER(); //####
+    _counters.clearCounters();
+    ODL_OBJEXIT(); //####
+} // BaseChannel::clearSendReceiveCounters
+
 void
 BaseChannel::close(void)
 {
@@ -212,7 +221,7 @@ BaseChannel::getSendReceiveCounters(SendReceiveCounters & counters)
 {
     ODL_OBJENTER(); //####
     ODL_P1("counters = ", &counters); //####
-    counters = _counters;
+    _counters.getCounters(counters);
     ODL_OBJEXIT(); //####
 } // BaseChannel::getSendReceiveCounters
 
@@ -295,8 +304,8 @@ BaseChannel::openWithRetries(yarp::os::Contact & theContactInfo,
                 if (0 < --retriesLeft)
                 {
                     ODL_LOG("%%retry%%"); //####
+                    retryTime = Common::NextRetryInterval(retryTime);
                     yarp::os::Time::delay(retryTime);
-                    retryTime *= RETRY_MULTIPLIER_;
                 }
             }
             if (result)
@@ -322,6 +331,32 @@ BaseChannel::openWithRetries(yarp::os::Contact & theContactInfo,
 # pragma warning(pop)
 #endif // ! MAC_OR_LINUX_
 
+void
+BaseChannel::updateDispatchCounters(const size_t  queueDepth,
+                                    const int64_t waitTime)
+{
+    ODL_OBJENTER(); //####
+    ODL_I2("queueDepth = ", queueDepth, "waitTime = ", waitTime); //####
+    if (_metricsEnabled)
+    {
+        _counters.incrementDispatchCounters(queueDepth, waitTime);
+    }
+    ODL_OBJEXIT(); //####
+} // BaseChannel::updateDispatchCounters
+
+void
+BaseChannel::updateOutletCounters(const size_t lag,
+                                  const size_t dropped)
+{
+    ODL_OBJENTER(); //####
+    ODL_I2("lag = ", lag, "dropped = ", dropped); //####
+    if (_metricsEnabled)
+    {
+        _counters.incrementOutletCounters(lag, dropped);
+    }
+    ODL_OBJEXIT(); //####
+} // BaseChannel::updateOutletCounters
+
 void
 BaseChannel::updateReceiveCounters(const size_t numBytes)
 {
@@ -351,17 +386,15 @@ BaseChannel::writeBottle(yarp::os::Bottle & message)
 {
     ODL_OBJENTER(); //####
     ODL_S1s("message = ", message.toString()); //####
-    size_t messageSize = 0;
+    bool result;
 
     if (_metricsEnabled)
     {
-        message.toBinary(&messageSize);
+        result = writeSerializedBottle(message, NULL);
     }
-    bool result = inherited::write(message);
-
-    if (result && _metricsEnabled)
+    else
     {
-        updateSendCounters(messageSize);
+        result = inherited::write(message);
     }
     ODL_OBJEXIT_B(result); //####
     return result;
@@ -374,25 +407,55 @@ BaseChannel::writeBottle(yarp::os::Bottle & message,
     ODL_OBJENTER(); //####
     ODL_S1s("message = ", message.toString()); //####
     ODL_P1("reply = ", &reply); //####
-    size_t messageSize = 0;
+    bool result;
 
     if (_metricsEnabled)
     {
-        message.toBinary(&messageSize);
+        result = writeSerializedBottle(message, &reply);
+    }
+    else
+    {
+        result = inherited::write(message, reply);
     }
-    bool result = inherited::write(message, reply);
+    ODL_OBJEXIT_B(result); //####
+    return result;
+} // BaseChannel::writeBottle
 
-    if (result && _metricsEnabled)
+bool
+BaseChannel::writeSerializedBottle(yarp::os::Bottle & message,
+                                   yarp::os::Bottle * reply)
+{
+    ODL_OBJENTER(); //####
+    ODL_P2("message = ", &message, "reply = ", reply); //####
+    bool   result;
+    size_t messageSize;
+
+    _outBufferLock.lock();
+    messageSize = _outBuffer.prepare(message);
+    if (reply)
     {
-        size_t replySize = 0;
+        BottleSizeReader replyReader(*reply);
 
-        reply.toBinary(&replySize);
-        updateSendCounters(messageSize);
-        updateReceiveCounters(replySize);
+        result = inherited::write(_outBuffer, replyReader);
+        if (result)
+        {
+            updateSendCounters(messageSize);
+            updateReceiveCounters(replyReader.numBytes());
+        }
     }
+    else
+    {
+        result = inherited::write(_outBuffer);
+        if (result)
+        {
+            updateSendCounters(messageSize);
+        }
+    }
+    _outBuffer.clear();
+    _outBufferLock.unlock();
     ODL_OBJEXIT_B(result); //####
     return result;
-} // BaseChannel::writeBottle
+} // BaseChannel::writeSerializedBottle
 
 #if defined(__APPLE__)
 # pragma mark Global functions
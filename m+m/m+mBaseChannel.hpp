@@ -39,7 +39,8 @@
 #if (! defined(MpMBaseChannel_HPP_))
 # define MpMBaseChannel_HPP_ /* Header guard */
 
-# include <m+m/m+mSendReceiveCounters.hpp>
+# include <m+m/m+mSerializedMessage.hpp>
+# include <m+m/m+mShardedSendReceiveCounters.hpp>
 
 # if defined(__APPLE__)
 #  pragma clang diagnostic push
@@ -77,8 +78,12 @@ namespace MplusM
             virtual
             ~BaseChannel(void);
 
-            /*! @brief Close the channel. */
+            /*! @brief Reset the send / receive counters. */
             void
+            clearSendReceiveCounters(void);
+
+            /*! @brief Close the channel. */
+            virtual void
             close(void);
 
             /*! @brief Turn off the send / receive metrics collecting. */
@@ -135,6 +140,20 @@ namespace MplusM
             static void
             RelinquishChannel(BaseChannel * theChannel);
 
+            /*! @brief Update the dispatch counters for the channel.
+             @param[in] queueDepth The number of received messages waiting to be dispatched.
+             @param[in] waitTime The time, in microseconds, that the dispatched message waited. */
+            void
+            updateDispatchCounters(const size_t  queueDepth,
+                                   const int64_t waitTime);
+
+            /*! @brief Update the outgoing queue counters for the channel.
+             @param[in] lag The number of messages waiting to be sent.
+             @param[in] dropped The number of messages discarded instead of being sent. */
+            void
+            updateOutletCounters(const size_t lag,
+                                 const size_t dropped);
+
             /*! @brief Update the receive counters for the channel.
              @param[in] numBytes The number of bytes received. */
             void
@@ -146,12 +165,19 @@ namespace MplusM
             updateSendCounters(const size_t numBytes);
 
             /*! @brief Write a message to the port.
+
+             If metrics are enabled, the message is converted to its binary form once, in the
+             channel buffer, and the same bytes are used to send the message and to update the send
+             counters.
              @param[in] message The message to write.
              @return @c true if the message was successfully sent and @c false otherwise. */
-            bool
+            virtual bool
             writeBottle(yarp::os::Bottle & message);
 
             /*! @brief Write a message to the port, with a reply expected.
+
+             If metrics are enabled, the message is converted to its binary form once, in the
+             channel buffer, and the size of the reply is taken from the connection as it is read.
              @param[in] message The message to write.
              @param[in,out] reply Where to put the expected reply.
              @return @c true if the message was successfully sent and @c false otherwise. */
@@ -173,6 +199,14 @@ namespace MplusM
             BaseChannel &
             operator =(const BaseChannel & other);
 
+            /*! @brief Write a message to the port, using the channel buffer.
+             @param[in] message The message to write.
+             @param[in] reply Where to put the expected reply, or @c NULL if no reply is expected.
+             @return @c true if the message was successfully sent and @c false otherwise. */
+            bool
+            writeSerializedBottle(yarp::os::Bottle & message,
+                                  yarp::os::Bottle * reply);
+
         public :
 
         protected :
@@ -183,7 +217,13 @@ namespace MplusM
             YarpString _name;
 
             /*! @brief The send / receive counters. */
-            SendReceiveCounters _counters;
+            ShardedSendReceiveCounters _counters;
+
+            /*! @brief The buffer used to hold outgoing messages when metrics are enabled. */
+            SerializedMessage _outBuffer;
+
+            /*! @brief The contention lock used to serialize access to the outgoing buffer. */
+            yarp::os::Mutex _outBufferLock;
 
             /*! @brief @c true if metrics are enabled and @c false otherwise. */
             bool _metricsEnabled;
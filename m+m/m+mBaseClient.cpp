@@ -40,6 +40,8 @@
 #include "m+mBaseClient.hpp"
 
 #include <m+m/m+mClientChannel.hpp>
+#include <m+m/m+mClientChannelPool.hpp>
+#include <m+m/m+mRegistryCache.hpp>
 #include <m+m/m+mRequests.hpp>
 #include <m+m/m+mServiceRequest.hpp>
 #include <m+m/m+mServiceResponse.hpp>
@@ -539,65 +541,34 @@ Common::FindMatchingServices(const YarpString & criteria,
 
     try
     {
-        YarpString      aName(GetRandomChannelName(HIDDEN_CHANNEL_PREFIX_
-                                                   BUILD_NAME_("findmatch_",
-                                                               DEFAULT_CHANNEL_ROOT_)));
-        ClientChannel * newChannel = new ClientChannel;
+        int cacheVersion;
 
-        if (newChannel)
+        if (RegistryCache::Lookup(criteria, getNames, result, cacheVersion))
         {
-#if defined(MpM_ReportOnConnections)
-            newChannel->setReporter(*Utilities::GetGlobalStatusReporter());
-#endif // defined(MpM_ReportOnConnections)
-            if (newChannel->openWithRetries(aName, STANDARD_WAIT_TIME_))
-            {
-                if (Utilities::NetworkConnectWithRetries(aName, MpM_REGISTRY_ENDPOINT_NAME_,
-                                                         STANDARD_WAIT_TIME_, false, checker,
-                                                         checkStuff))
-                {
-                    yarp::os::Bottle parameters;
+            ODL_S1s("result <- ", result.toString()); //####
+        }
+        else
+        {
+            yarp::os::Bottle parameters;
 
-                    parameters.addInt(getNames ? 1 : 0);
-                    parameters.addString(criteria);
-                    ServiceRequest  request(MpM_MATCH_REQUEST_, parameters);
-                    ServiceResponse response;
+            parameters.addInt(getNames ? 1 : 0);
+            parameters.addString(criteria);
+            ServiceRequest  request(MpM_MATCH_REQUEST_, parameters);
+            ServiceResponse response;
 
-                    if (request.send(*newChannel, response))
-                    {
-                        ODL_S1s("response <- ", response.asString()); //####
-                        result = validateMatchResponse(response.values());
-                    }
-                    else
-                    {
-                        ODL_LOG("! (request.send(*newChannel, response))"); //####
-                    }
-#if defined(MpM_DoExplicitDisconnect)
-                    if (! Utilities::NetworkDisconnectWithRetries(aName,
-                                                                  MpM_REGISTRY_ENDPOINT_NAME_,
-                                                                  STANDARD_WAIT_TIME_, checker,
-                                                                  checkStuff))
-                    {
-                        ODL_LOG("(! Utilities::NetworkDisconnectWithRetries(aName, " //####
-                                "MpM_REGISTRY_ENDPOINT_NAME_, STANDARD_WAIT_TIME_, checker, " //####
-                                "checkStuff))"); //####
-                    }
-#endif // defined(MpM_DoExplicitDisconnect)
-                }
-                else
-                {
-                    ODL_LOG("! (Utilities::NetworkConnectWithRetries(aName, " //####
-                            "MpM_REGISTRY_ENDPOINT_NAME_, STANDARD_WAIT_TIME_, false, " //####
-                            "checker, checkStuff))"); //####
-                }
-#if defined(MpM_DoExplicitClose)
-                newChannel->close();
-#endif // defined(MpM_DoExplicitClose)
+            if (ClientChannelPool::SendRequest(MpM_REGISTRY_ENDPOINT_NAME_, request, response,
+                                               true, false, NULL, checker, checkStuff))
+            {
+                ODL_S1s("response <- ", response.asString()); //####
+                result = validateMatchResponse(response.values());
+                RegistryCache::Remember(criteria, getNames, result, cacheVersion);
             }
             else
             {
-                ODL_LOG("! (newChannel->openWithRetries(aName, STANDARD_WAIT_TIME_))"); //####
+                ODL_LOG("! (ClientChannelPool::SendRequest(MpM_REGISTRY_ENDPOINT_NAME_, " //####
+                        "request, response, true, false, NULL, checker, " //####
+                        "checkStuff))"); //####
             }
-            BaseChannel::RelinquishChannel(newChannel);
         }
     }
     catch (...)
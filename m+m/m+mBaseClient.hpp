@@ -210,6 +210,9 @@ namespace MplusM
 
         /*! @brief Find one or more matching services that are registered with a running %Registry
          service.
+
+         If the registry cache has been enabled, the response is taken from the cache when
+         possible.
          @param[in] criteria The matching conditions.
          @param[in] getNames @c true if service names are to be returned and @c false if service
          ports are to be returned.
@@ -39,6 +39,8 @@
 #include "m+mBaseInputHandler.hpp"
 
 #include <m+m/m+mBaseChannel.hpp>
+#include <m+m/m+mInputDispatchThread.hpp>
+#include <m+m/m+mRawInput.hpp>
 
 //#include <odlEnable.h>
 #include <odlInclude.h>
@@ -65,6 +67,10 @@ using namespace MplusM::Common;
 # pragma mark Private structures, constants and variables
 #endif // defined(__APPLE__)
 
+/*! @brief The time, in seconds, between checks for readers that are still handing input to the
+ dispatch threads. */
+static const double kDispatchPollInterval = 0.01;
+
 #if defined(__APPLE__)
 # pragma mark Global constants and variables
 #endif // defined(__APPLE__)
@@ -73,6 +79,49 @@ using namespace MplusM::Common;
 # pragma mark Local functions
 #endif // defined(__APPLE__)
 
+/*! @brief Return the messages held in a frame of coalesced messages.
+ @param[in] input The received input.
+ @return The messages, each as a list, or @c NULL if the input is not a frame of coalesced
+ messages. */
+static yarp::os::Bottle *
+getBatchedMessages(const yarp::os::Bottle & input)
+{
+    ODL_ENTER(); //####
+    ODL_P1("input = ", &input); //####
+    yarp::os::Bottle * result = NULL;
+
+    if (2 == input.size())
+    {
+        yarp::os::Value & marker = input.get(0);
+
+        if (marker.isString() && (marker.asString() == BATCH_FRAME_MARKER_))
+        {
+            result = input.get(1).asList();
+        }
+    }
+    ODL_EXIT_P(result); //####
+    return result;
+} // getBatchedMessages
+
+/*! @brief Return a hash value for the name of a sending channel.
+ @param[in] senderChannel The name of the channel used to send the input data.
+ @return A hash value for the name. */
+static size_t
+hashSenderChannel(const YarpString & senderChannel)
+{
+    ODL_ENTER(); //####
+    ODL_S1s("senderChannel = ", senderChannel); //####
+    uint32_t result = 2166136261U;
+
+    for (size_t ii = 0, mm = senderChannel.length(); mm > ii; ++ii)
+    {
+        result ^= static_cast<uint8_t>(senderChannel[ii]);
+        result *= 16777619U;
+    }
+    ODL_EXIT_I(result); //####
+    return result;
+} // hashSenderChannel
+
 #if defined(__APPLE__)
 # pragma mark Class methods
 #endif // defined(__APPLE__)
@@ -82,7 +131,9 @@ using namespace MplusM::Common;
 #endif // defined(__APPLE__)
 
 BaseInputHandler::BaseInputHandler(void) :
-    inherited(), _channel(NULL), _canProcessInput(true), _metricsEnabled(false)
+    inherited(), _channel(NULL), _dispatchThreads(), _dispatchLock(), _dispatchUsers(0),
+    _rawBuffer(), _rawLock(), _batchedInputEnabled(false), _canProcessInput(true),
+    _metricsEnabled(false), _rawInputEnabled(false)
 {
     ODL_ENTER(); //####
     ODL_EXIT_P(this); //####
@@ -99,6 +150,73 @@ BaseInputHandler::~BaseInputHandler(void)
 # pragma mark Actions and Accessors
 #endif // defined(__APPLE__)
 
+bool
+BaseInputHandler::deliverInput(const yarp::os::Bottle &     input,
+                               const YarpString &           senderChannel,
+                               yarp::os::ConnectionWriter * replyMechanism,
+                               const size_t                 numBytes)
+{
+    ODL_OBJENTER(); //####
+    ODL_P2("input = ", &input, "replyMechanism = ", replyMechanism); //####
+    ODL_S1s("senderChannel = ", senderChannel); //####
+    ODL_I1("numBytes = ", numBytes); //####
+    bool               result;
+    yarp::os::Bottle * messages = (_batchedInputEnabled ? getBatchedMessages(input) : NULL);
+
+    if (messages)
+    {
+        result = handleInputBatch(*messages, senderChannel, replyMechanism, numBytes);
+    }
+    else
+    {
+        result = handleInput(input, senderChannel, replyMechanism, numBytes);
+    }
+    ODL_OBJEXIT_B(result); //####
+    return result;
+} // BaseInputHandler::deliverInput
+
+void
+BaseInputHandler::disableAsynchronousDispatch(void)
+{
+    ODL_OBJENTER(); //####
+    std::vector<InputDispatchThread *> threads;
+
+    // Take the threads away from the readers first, and then wait for any reader that is still
+    // handing input to one of them, so that no thread is deleted while it is in use.
+    _dispatchLock.lock();
+    threads.swap(_dispatchThreads);
+    _dispatchLock.unlock();
+    for (bool inUse = true; inUse; )
+    {
+        _dispatchLock.lock();
+        inUse = (0 < _dispatchUsers);
+        _dispatchLock.unlock();
+        if (inUse)
+        {
+            yarp::os::Time::delay(kDispatchPollInterval);
+        }
+    }
+    for (size_t ii = 0, mm = threads.size(); mm > ii; ++ii)
+    {
+        InputDispatchThread * aThread = threads[ii];
+
+        if (aThread)
+        {
+            aThread->stop();
+            delete aThread;
+        }
+    }
+    ODL_OBJEXIT(); //####
+} // BaseInputHandler::disableAsynchronousDispatch
+
+void
+BaseInputHandler::disableBatchedInput(void)
+{
+    ODL_OBJENTER(); //####
+    _batchedInputEnabled = false;
+    ODL_OBJEXIT(); //####
+} // BaseInputHandler::disableBatchedInput
+
 void
 BaseInputHandler::disableMetrics(void)
 {
@@ -107,6 +225,67 @@ BaseInputHandler::disableMetrics(void)
     ODL_OBJEXIT(); //####
 } // BaseInputHandler::disableMetrics
 
+void
+BaseInputHandler::disableRawInput(void)
+{
+    ODL_OBJENTER(); //####
+    _rawInputEnabled = false;
+    ODL_OBJEXIT(); //####
+} // BaseInputHandler::disableRawInput
+
+bool
+BaseInputHandler::enableAsynchronousDispatch(const size_t threadCount,
+                                             const size_t queueSize)
+{
+    ODL_OBJENTER(); //####
+    ODL_I2("threadCount = ", threadCount, "queueSize = ", queueSize); //####
+    bool                               result;
+    std::vector<InputDispatchThread *> threads;
+
+    _dispatchLock.lock();
+    result = (0 < threadCount) && (0 < queueSize) && _dispatchThreads.empty();
+    _dispatchLock.unlock();
+    for (size_t ii = 0; result && (threadCount > ii); ++ii)
+    {
+        InputDispatchThread * aThread = new InputDispatchThread(*this, queueSize);
+
+        if (aThread->start())
+        {
+            threads.push_back(aThread);
+        }
+        else
+        {
+            ODL_LOG("! (aThread->start())"); //####
+            delete aThread;
+            result = false;
+        }
+    }
+    if (result)
+    {
+        _dispatchLock.lock();
+        _dispatchThreads.swap(threads);
+        _dispatchLock.unlock();
+    }
+    else
+    {
+        for (size_t ii = 0, mm = threads.size(); mm > ii; ++ii)
+        {
+            threads[ii]->stop();
+            delete threads[ii];
+        }
+    }
+    ODL_OBJEXIT_B(result); //####
+    return result;
+} // BaseInputHandler::enableAsynchronousDispatch
+
+void
+BaseInputHandler::enableBatchedInput(void)
+{
+    ODL_OBJENTER(); //####
+    _batchedInputEnabled = true;
+    ODL_OBJEXIT(); //####
+} // BaseInputHandler::enableBatchedInput
+
 void
 BaseInputHandler::enableMetrics(void)
 {
@@ -115,6 +294,58 @@ BaseInputHandler::enableMetrics(void)
     ODL_OBJEXIT(); //####
 } // BaseInputHandler::enableMetrics
 
+void
+BaseInputHandler::enableRawInput(void)
+{
+    ODL_OBJENTER(); //####
+    _rawInputEnabled = true;
+    ODL_OBJEXIT(); //####
+} // BaseInputHandler::enableRawInput
+
+bool
+BaseInputHandler::handleInputBatch(const yarp::os::Bottle &     inputs,
+                                   const YarpString &           senderChannel,
+                                   yarp::os::ConnectionWriter * replyMechanism,
+                                   const size_t                 numBytes)
+{
+    ODL_OBJENTER(); //####
+    ODL_P2("inputs = ", &inputs, "replyMechanism = ", replyMechanism); //####
+    ODL_S1s("senderChannel = ", senderChannel); //####
+    ODL_I1("numBytes = ", numBytes); //####
+    bool result = true;
+
+    for (int ii = 0, mm = inputs.size(); mm > ii; ++ii)
+    {
+        yarp::os::Bottle * anInput = inputs.get(ii).asList();
+
+        // Keep going after a failure, so that the later messages are not lost.
+        if (! (anInput && handleInput(*anInput, senderChannel, replyMechanism, numBytes)))
+        {
+            ODL_LOG("! (anInput && handleInput(*anInput, senderChannel, " //####
+                    "replyMechanism, numBytes))"); //####
+            result = false;
+        }
+    }
+    ODL_OBJEXIT_B(result); //####
+    return result;
+} // BaseInputHandler::handleInputBatch
+
+bool
+BaseInputHandler::handleRawInput(RawInput &                   input,
+                                 const YarpString &           senderChannel,
+                                 yarp::os::ConnectionWriter * replyMechanism,
+                                 const size_t                 numBytes)
+{
+    ODL_OBJENTER(); //####
+    ODL_P2("input = ", &input, "replyMechanism = ", replyMechanism); //####
+    ODL_S1s("senderChannel = ", senderChannel); //####
+    ODL_I1("numBytes = ", numBytes); //####
+    bool result = deliverInput(input.asBottle(), senderChannel, replyMechanism, numBytes);
+
+    ODL_OBJEXIT_B(result); //####
+    return result;
+} // BaseInputHandler::handleRawInput
+
 bool
 BaseInputHandler::read(yarp::os::ConnectionReader & connection)
 {
@@ -129,17 +360,75 @@ BaseInputHandler::read(yarp::os::ConnectionReader & connection)
 #if defined(MpM_ReportContactDetails)
             DumpContactToLog("input read", connection.getRemoteContact()); //####
 #endif // defined(MpM_ReportContactDetails)
-            yarp::os::Bottle aBottle;
-            size_t           numBytes = connection.getSize();
+            yarp::os::Bottle      aBottle;
+            size_t                numBytes = connection.getSize();
+            InputDispatchThread * aThread = NULL;
+            YarpString            senderChannel;
 
             if (_metricsEnabled && _channel && _channel->metricsAreEnabled())
             {
                 _channel->updateReceiveCounters(numBytes);
             }
-            if (aBottle.read(connection))
+            // The dispatch threads can be stopped by another thread at any time, so the chosen
+            // thread is marked as in use before the lock is released.
+            _dispatchLock.lock();
+            if (! _dispatchThreads.empty())
             {
-                result = handleInput(aBottle, connection.getRemoteContact().getName(),
-                                     connection.getWriter(), numBytes);
+                senderChannel = connection.getRemoteContact().getName();
+                aThread = _dispatchThreads[hashSenderChannel(senderChannel) %
+                                           _dispatchThreads.size()];
+                ++_dispatchUsers;
+            }
+            _dispatchLock.unlock();
+            if (aThread)
+            {
+                try
+                {
+                    result = aThread->dispatchInput(connection, senderChannel, numBytes);
+                }
+                catch (...)
+                {
+                    _dispatchLock.lock();
+                    --_dispatchUsers;
+                    _dispatchLock.unlock();
+                    throw;
+                }
+                _dispatchLock.lock();
+                --_dispatchUsers;
+                _dispatchLock.unlock();
+            }
+            else if (_rawInputEnabled && (0 < numBytes) && (! connection.isTextMode()))
+            {
+                // The storage is reused, so that undecoded input does not allocate each time. It
+                // is taken out of the handler while in use, so that a concurrent read gets its
+                // own storage rather than waiting for this one to be processed.
+                std::vector<char> rawBuffer;
+
+                _rawLock.lock();
+                rawBuffer.swap(_rawBuffer);
+                _rawLock.unlock();
+                if (rawBuffer.size() < numBytes)
+                {
+                    rawBuffer.resize(numBytes);
+                }
+                if (connection.expectBlock(&rawBuffer[0], numBytes))
+                {
+                    RawInput rawInput(&rawBuffer[0], numBytes);
+
+                    result = handleRawInput(rawInput, connection.getRemoteContact().getName(),
+                                            connection.getWriter(), numBytes);
+                }
+                _rawLock.lock();
+                if (_rawBuffer.size() < rawBuffer.size())
+                {
+                    _rawBuffer.swap(rawBuffer);
+                }
+                _rawLock.unlock();
+            }
+            else if (aBottle.read(connection))
+            {
+                result = deliverInput(aBottle, connection.getRemoteContact().getName(),
+                                      connection.getWriter(), numBytes);
             }
         }
     }
@@ -166,9 +455,23 @@ BaseInputHandler::stopProcessing(void)
 {
     ODL_OBJENTER(); //####
     _canProcessInput = false;
+    disableAsynchronousDispatch();
     ODL_OBJEXIT(); //####
 } // BaseInputHandler::stopProcessing
 
+void
+BaseInputHandler::updateDispatchCounters(const size_t  queueDepth,
+                                         const int64_t waitTime)
+{
+    ODL_OBJENTER(); //####
+    ODL_I2("queueDepth = ", queueDepth, "waitTime = ", waitTime); //####
+    if (_metricsEnabled && _channel && _channel->metricsAreEnabled())
+    {
+        _channel->updateDispatchCounters(queueDepth, waitTime);
+    }
+    ODL_OBJEXIT(); //####
+} // BaseInputHandler::updateDispatchCounters
+
 #if defined(__APPLE__)
 # pragma mark Global functions
 #endif // defined(__APPLE__)
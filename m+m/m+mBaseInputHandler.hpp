@@ -52,11 +52,16 @@
 #  pragma clang diagnostic pop
 # endif // defined(__APPLE__)
 
+/*! @brief The default number of received messages that can be waiting for each dispatch thread. */
+# define MpM_INPUT_DISPATCH_QUEUE_SIZE_ 64
+
 namespace MplusM
 {
     namespace Common
     {
         class BaseChannel;
+        class InputDispatchThread;
+        class RawInput;
 
         /*! @brief A handler for partially-structured input data. */
         class BaseInputHandler : public yarp::os::PortReader
@@ -79,14 +84,71 @@ namespace MplusM
             virtual
             ~BaseInputHandler(void);
 
+            /*! @brief Process received input, unpacking it first if it is a frame of coalesced
+             messages and batched input has been enabled.
+             @param[in] input The partially-structured input data.
+             @param[in] senderChannel The name of the channel used to send the input data.
+             @param[in] replyMechanism @c NULL if no reply is expected and non-@c NULL otherwise.
+             @param[in] numBytes The number of bytes available on the connection.
+             @return @c true if the input was correctly structured and successfully processed. */
+            bool
+            deliverInput(const yarp::os::Bottle &     input,
+                         const YarpString &           senderChannel,
+                         yarp::os::ConnectionWriter * replyMechanism,
+                         const size_t                 numBytes);
+
+            /*! @brief Stop the dispatch threads and return to processing input on the thread that
+             reads it. */
+            void
+            disableAsynchronousDispatch(void);
+
+            /*! @brief Deliver frames of coalesced messages as they were received. */
+            void
+            disableBatchedInput(void);
+
             /*! @brief Turn off the send / receive metrics collecting. */
             void
             disableMetrics(void);
 
+            /*! @brief Return to decoding all input before it is processed. */
+            void
+            disableRawInput(void);
+
+            /*! @brief Process input on a pool of dispatch threads, rather than on the thread that
+             reads it.
+
+             Each sender is assigned to one of the dispatch threads, so that messages from a sender
+             are processed in the order in which they were received. Input that expects a reply
+             still holds the connection until it has been processed. This must be called before
+             the handler is attached to a channel, and a handler that uses dispatch threads must
+             call stopProcessing() in its destructor, so that the threads are stopped before the
+             handler is destroyed.
+             @param[in] threadCount The number of dispatch threads.
+             @param[in] queueSize The maximum number of messages that can be waiting for each
+             dispatch thread.
+             @return @c true if the dispatch threads were started and @c false otherwise. */
+            bool
+            enableAsynchronousDispatch(const size_t threadCount = 1,
+                                       const size_t queueSize = MpM_INPUT_DISPATCH_QUEUE_SIZE_);
+
+            /*! @brief Unpack frames of coalesced messages and pass them to handleInputBatch().
+
+             This should only be enabled for channels whose senders coalesce their messages, so
+             that an ordinary message that happens to look like a frame is not unpacked. */
+            void
+            enableBatchedInput(void);
+
             /*! @brief Turn on the send / receive metrics collecting. */
             void
             enableMetrics(void);
 
+            /*! @brief Pass input to handleRawInput() without decoding it first.
+
+             Raw input is only used when the input is processed on the thread that reads it and
+             the connection is not in text mode; otherwise, handleInput() is used. */
+            void
+            enableRawInput(void);
+
             /*! @brief Process partially-structured input data.
              @param[in] input The partially-structured input data.
              @param[in] senderChannel The name of the channel used to send the input data.
@@ -99,6 +161,40 @@ namespace MplusM
                         yarp::os::ConnectionWriter * replyMechanism,
                         const size_t                 numBytes) = 0;
 
+            /*! @brief Process a set of messages that were coalesced by the sender.
+
+             The default behaviour is to pass each message, in order, to handleInput(); handlers
+             that can process many messages at once should override this.
+             @param[in] inputs The messages, each as a list, in the order in which they were
+             written.
+             @param[in] senderChannel The name of the channel used to send the input data.
+             @param[in] replyMechanism @c NULL if no reply is expected and non-@c NULL otherwise.
+             @param[in] numBytes The number of bytes available on the connection, for all the
+             messages.
+             @return @c true if the messages were correctly structured and successfully
+             processed. */
+            virtual bool
+            handleInputBatch(const yarp::os::Bottle &     inputs,
+                             const YarpString &           senderChannel,
+                             yarp::os::ConnectionWriter * replyMechanism,
+                             const size_t                 numBytes);
+
+            /*! @brief Process input that has not been decoded.
+
+             This is only called if enableRawInput() has been used. The default behaviour is to
+             decode the input and process it as handleInput() would; handlers that only forward
+             bytes, or only look at part of the input, should override this.
+             @param[in] input The undecoded input data.
+             @param[in] senderChannel The name of the channel used to send the input data.
+             @param[in] replyMechanism @c NULL if no reply is expected and non-@c NULL otherwise.
+             @param[in] numBytes The number of bytes available on the connection.
+             @return @c true if the input was correctly structured and successfully processed. */
+            virtual bool
+            handleRawInput(RawInput &                   input,
+                           const YarpString &           senderChannel,
+                           yarp::os::ConnectionWriter * replyMechanism,
+                           const size_t                 numBytes);
+
             /*! @brief Return the state of the  send / receive metrics.
              @return @c true if the send / receive metrics are being gathered and @c false
              otherwise. */
@@ -118,6 +214,14 @@ namespace MplusM
             void
             stopProcessing(void);
 
+            /*! @brief Update the dispatch counters for the channel that is feeding the input
+             handler.
+             @param[in] queueDepth The number of received messages waiting to be dispatched.
+             @param[in] waitTime The time, in microseconds, that the dispatched message waited. */
+            void
+            updateDispatchCounters(const size_t  queueDepth,
+                                   const int64_t waitTime);
+
         protected :
 
         private :
@@ -147,18 +251,42 @@ namespace MplusM
             /*! @brief The channel that is feeding this input handler. */
             BaseChannel * _channel;
 
+            /*! @brief The threads that process the input, or empty if the input is processed on
+             the thread that reads it. */
+            std::vector<InputDispatchThread *> _dispatchThreads;
+
+            /*! @brief The contention lock used to control access to the dispatch threads. */
+            yarp::os::Mutex _dispatchLock;
+
+            /*! @brief The number of readers that are handing input to a dispatch thread. */
+            size_t _dispatchUsers;
+
+            /*! @brief The storage for input that is not decoded before being processed, kept
+             between reads so that it can be reused. */
+            std::vector<char> _rawBuffer;
+
+            /*! @brief The contention lock used to control access to the raw input storage. */
+            yarp::os::Mutex _rawLock;
+
+            /*! @brief @c true if frames of coalesced messages are unpacked and @c false
+             otherwise. */
+            bool _batchedInputEnabled;
+
             /*! @brief @c true if input stream processing is enabled. */
             bool _canProcessInput;
 
             /*! @brief @c true if metrics are enabled and @c false otherwise. */
             bool _metricsEnabled;
 
+            /*! @brief @c true if input is passed to handleRawInput() and @c false otherwise. */
+            bool _rawInputEnabled;
+
 # if defined(__APPLE__)
 #  pragma clang diagnostic push
 #  pragma clang diagnostic ignored "-Wunused-private-field"
 # endif // defined(__APPLE__)
             /*! @brief Filler to pad to alignment boundary */
-            char _filler[6];
+            char _filler[4];
 # if defined(__APPLE__)
 #  pragma clang diagnostic pop
 # endif // defined(__APPLE__)
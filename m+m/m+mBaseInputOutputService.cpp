@@ -408,6 +408,7 @@ BaseInputOutputService::addClientStreamsFromDescriptions(const ChannelVector & d
                 }
             }
         }
+        invalidateCachedReplies();
     }
     catch (...)
     {
@@ -475,6 +476,7 @@ BaseInputOutputService::addInStreamsFromDescriptions(const ChannelVector & descr
                 }
             }
         }
+        invalidateCachedReplies();
     }
     catch (...)
     {
@@ -525,6 +527,20 @@ BaseInputOutputService::addOutStreamsFromDescriptions(const ChannelVector & desc
                         {
                             newChannel->disableMetrics();
                         }
+                        if (! newChannel->setOverflowPolicy(aDescription._overflowPolicy,
+                                                            aDescription._overflowLimit))
+                        {
+                            ODL_LOG("(! newChannel->setOverflowPolicy(aDescription." //####
+                                    "_overflowPolicy, aDescription._overflowLimit))"); //####
+                        }
+                        if (aDescription._batchLimit &&
+                            (! newChannel->setBatching(aDescription._batchLimit,
+                                                       aDescription._batchLatency)))
+                        {
+                            ODL_LOG("(aDescription._batchLimit && (! newChannel->" //####
+                                    "setBatching(aDescription._batchLimit, " //####
+                                    "aDescription._batchLatency)))"); //####
+                        }
                         _outStreams.push_back(newChannel);
                     }
                     else
@@ -542,6 +558,7 @@ BaseInputOutputService::addOutStreamsFromDescriptions(const ChannelVector & desc
                 }
             }
         }
+        invalidateCachedReplies();
     }
     catch (...)
     {
@@ -1316,6 +1333,7 @@ BaseInputOutputService::shutDownClientStreams(void)
             }
         }
         _clientStreams.clear();
+        invalidateCachedReplies();
     }
     ODL_EXIT_B(result); //####
     return result;
@@ -1341,6 +1359,7 @@ BaseInputOutputService::shutDownInputStreams(void)
             }
         }
         _inStreams.clear();
+        invalidateCachedReplies();
     }
     ODL_EXIT_B(result); //####
     return result;
@@ -1366,6 +1385,7 @@ BaseInputOutputService::shutDownOutputStreams(void)
             }
         }
         _outStreams.clear();
+        invalidateCachedReplies();
     }
     ODL_EXIT_B(result); //####
     return result;
@@ -67,6 +67,17 @@ using namespace MplusM::Common;
 # pragma mark Private structures, constants and variables
 #endif // defined(__APPLE__)
 
+/*! @brief The response objects that are available for reuse. */
+struct ResponsePool
+{
+    /*! @brief The contention lock used to avoid inconsistencies. */
+    yarp::os::Mutex _lock;
+
+    /*! @brief The available response objects. */
+    std::vector<yarp::os::Bottle *> _available;
+
+}; // ResponsePool
+
 #if defined(__APPLE__)
 # pragma mark Global constants and variables
 #endif // defined(__APPLE__)
@@ -75,17 +86,75 @@ using namespace MplusM::Common;
 # pragma mark Local functions
 #endif // defined(__APPLE__)
 
+/*! @brief Return the pool of response objects, creating it if necessary.
+
+ The pool is never deleted, as requests might still be processed during program termination.
+ @return The pool of response objects. */
+static ResponsePool &
+getResponsePool(void)
+{
+    ODL_ENTER(); //####
+    static ResponsePool * lPool = new ResponsePool;
+
+    ODL_EXIT_P(lPool); //####
+    return *lPool;
+} // getResponsePool
+
 #if defined(__APPLE__)
 # pragma mark Class methods
 #endif // defined(__APPLE__)
 
+yarp::os::Bottle *
+BaseRequestHandler::AcquireResponse(void)
+{
+    ODL_ENTER(); //####
+    yarp::os::Bottle * result = NULL;
+    ResponsePool &     pool = getResponsePool();
+
+    pool._lock.lock();
+    if (! pool._available.empty())
+    {
+        result = pool._available.back();
+        pool._available.pop_back();
+    }
+    pool._lock.unlock();
+    if (! result)
+    {
+        result = new yarp::os::Bottle;
+    }
+    ODL_EXIT_P(result); //####
+    return result;
+} // BaseRequestHandler::AcquireResponse
+
+void
+BaseRequestHandler::ReleaseResponse(yarp::os::Bottle * response)
+{
+    ODL_ENTER(); //####
+    ODL_P1("response = ", response); //####
+    if (response)
+    {
+        ResponsePool & pool = getResponsePool();
+
+        response->clear();
+        pool._lock.lock();
+        if (RESPONSE_POOL_SIZE_ > pool._available.size())
+        {
+            pool._available.push_back(response);
+            response = NULL;
+        }
+        pool._lock.unlock();
+        delete response;
+    }
+    ODL_EXIT(); //####
+} // BaseRequestHandler::ReleaseResponse
+
 #if defined(__APPLE__)
 # pragma mark Constructors and Destructors
 #endif // defined(__APPLE__)
 
 BaseRequestHandler::BaseRequestHandler(const YarpString & request,
                                        BaseService &      service) :
-    _service(service), _owner(NULL), _name(request)
+    _service(service), _owner(NULL), _serialLock(), _name(request)
 {
     ODL_ENTER(); //####
     ODL_S1s("request = ", request); //####
@@ -103,6 +172,47 @@ BaseRequestHandler::~BaseRequestHandler(void)
 # pragma mark Actions and Accessors
 #endif // defined(__APPLE__)
 
+bool
+BaseRequestHandler::handleRequest(const YarpString &           request,
+                                  const yarp::os::Bottle &     restOfInput,
+                                  const YarpString &           senderChannel,
+                                  yarp::os::ConnectionWriter * replyMechanism)
+{
+    ODL_OBJENTER(); //####
+    ODL_S3s("request = ", request, "restOfInput = ", restOfInput.toString(), //####
+            "senderChannel = ", senderChannel); //####
+    ODL_P1("replyMechanism = ", replyMechanism); //####
+    bool               result;
+    bool               serialized = (! isReentrant());
+    yarp::os::Bottle * response = AcquireResponse();
+
+    if (serialized)
+    {
+        _serialLock.lock();
+    }
+    try
+    {
+        result = processRequest(request, restOfInput, senderChannel, replyMechanism, *response);
+    }
+    catch (...)
+    {
+        ODL_LOG("Exception caught"); //####
+        if (serialized)
+        {
+            _serialLock.unlock();
+        }
+        ReleaseResponse(response);
+        throw;
+    }
+    if (serialized)
+    {
+        _serialLock.unlock();
+    }
+    ReleaseResponse(response);
+    ODL_OBJEXIT_B(result); //####
+    return result;
+} // BaseRequestHandler::handleRequest
+
 void
 BaseRequestHandler::sendOKResponse(yarp::os::ConnectionWriter * replyMechanism)
 {
@@ -111,50 +221,37 @@ BaseRequestHandler::sendOKResponse(yarp::os::ConnectionWriter * replyMechanism)
     if (replyMechanism)
     {
         ODL_LOG("(replyMechanism)"); //####
-        size_t messageSize = 0;
+        yarp::os::Bottle * response = AcquireResponse();
 
-        _response.clear();
-        _response.addString(MpM_OK_RESPONSE_);
-        if (_service.metricsAreEnabled())
-        {
-            _response.toBinary(&messageSize);
-        }
-        if (_response.write(*replyMechanism))
-        {
-            _service.updateResponseCounters(messageSize);
-        }
-        else
-        {
-            ODL_LOG("(! _response.write(*replyMechanism))"); //####
-#if defined(MpM_StallOnSendProblem)
-            Stall();
-#endif // defined(MpM_StallOnSendProblem)
-        }
+        response->addString(MpM_OK_RESPONSE_);
+        sendResponse(*response, replyMechanism);
+        ReleaseResponse(response);
     }
     ODL_OBJEXIT(); //####
 } // BaseRequestHandler::sendOKResponse
 
 void
-BaseRequestHandler::sendResponse(yarp::os::ConnectionWriter * replyMechanism)
+BaseRequestHandler::sendResponse(yarp::os::Bottle &           response,
+                                 yarp::os::ConnectionWriter * replyMechanism)
 {
     ODL_OBJENTER(); //####
-    ODL_P1("replyMechanism = ", replyMechanism); //####
+    ODL_P2("response = ", &response, "replyMechanism = ", replyMechanism); //####
     if (replyMechanism)
     {
         ODL_LOG("(replyMechanism)"); //####
-        if (_response.write(*replyMechanism))
+        if (response.write(*replyMechanism))
         {
             if (_service.metricsAreEnabled())
             {
                 size_t messageSize = 0;
 
-                _response.toBinary(&messageSize);
+                response.toBinary(&messageSize);
                 _service.updateResponseCounters(messageSize);
             }
         }
         else
         {
-            ODL_LOG("(! _response.write(*replyMechanism))"); //####
+            ODL_LOG("(! response.write(*replyMechanism))"); //####
 #if defined(MpM_StallOnSendProblem)
             Stall();
 #endif // defined(MpM_StallOnSendProblem)
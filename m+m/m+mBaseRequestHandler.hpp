@@ -103,6 +103,33 @@ namespace MplusM
 # endif // MAC_OR_LINUX_
             } // fillInDescription
 
+            /*! @brief Process a request, using a response object that is not shared with any
+             other request.
+
+             Requests for a handler that is not reentrant are processed one at a time.
+             @param[in] request The actual request name.
+             @param[in] restOfInput The arguments to the operation.
+             @param[in] senderChannel The name of the channel used to send the input data.
+             @param[in] replyMechanism non-@c NULL if a reply is expected and @c NULL otherwise.
+             @return @c true if the request was successfully processed and @c false otherwise. */
+            bool
+            handleRequest(const YarpString &           request,
+                          const yarp::os::Bottle &     restOfInput,
+                          const YarpString &           senderChannel,
+                          yarp::os::ConnectionWriter * replyMechanism);
+
+            /*! @brief Return @c true if the handler can process more than one request at a time.
+
+             A reentrant handler must keep all the state for a request in the response object
+             and in local variables, and must protect any shared state that it changes.
+             @return @c true if requests can be processed simultaneously and @c false otherwise. */
+            virtual inline bool
+            isReentrant(void)
+            const
+            {
+                return false;
+            } // isReentrant
+
             /*! @brief Return the name of the request.
              @return The name of the request. */
             inline const YarpString &
@@ -116,12 +143,14 @@ namespace MplusM
              @param[in] request The actual request name.
              @param[in] restOfInput The arguments to the operation.
              @param[in] senderChannel The name of the channel used to send the input data.
-             @param[in] replyMechanism non-@c NULL if a reply is expected and @c NULL otherwise. */
+             @param[in] replyMechanism non-@c NULL if a reply is expected and @c NULL otherwise.
+             @param[in,out] response The object to hold the response, which is initially empty. */
             virtual bool
             processRequest(const YarpString &           request,
                            const yarp::os::Bottle &     restOfInput,
                            const YarpString &           senderChannel,
-                           yarp::os::ConnectionWriter * replyMechanism) = 0;
+                           yarp::os::ConnectionWriter * replyMechanism,
+                           yarp::os::Bottle &           response) = 0;
 
             /*! @brief Send a simple OK response to a request.
              @param[in] replyMechanism The destination for the response. */
@@ -129,9 +158,11 @@ namespace MplusM
             sendOKResponse(yarp::os::ConnectionWriter * replyMechanism);
 
             /*! @brief Send a response to a request.
+             @param[in] response The response to be sent.
              @param[in] replyMechanism The destination for the response. */
             void
-            sendResponse(yarp::os::ConnectionWriter * replyMechanism);
+            sendResponse(yarp::os::Bottle &           response,
+                         yarp::os::ConnectionWriter * replyMechanism);
 
             /*! @brief Connect the handler to a map.
              @param[in] owner The map that contains this handler. */
@@ -140,9 +171,6 @@ namespace MplusM
 
         protected :
 
-            /*! @brief The object to use to hold the request response. */
-            yarp::os::Bottle _response;
-
             /*! @brief The service that is associated with the request. */
             BaseService & _service;
 
@@ -151,6 +179,11 @@ namespace MplusM
 
         private :
 
+            /*! @brief Return an empty response object, reusing a released one if possible.
+             @return An empty response object. */
+            static yarp::os::Bottle *
+            AcquireResponse(void);
+
             /*! @brief The copy constructor.
              @param[in] other The object to be copied. */
             BaseRequestHandler(const BaseRequestHandler & other);
@@ -161,12 +194,21 @@ namespace MplusM
             BaseRequestHandler &
             operator =(const BaseRequestHandler & other);
 
+            /*! @brief Make a response object available for reuse.
+             @param[in] response The response object that is no longer needed. */
+            static void
+            ReleaseResponse(yarp::os::Bottle * response);
+
         public :
 
         protected :
 
         private :
 
+            /*! @brief The contention lock used to process requests one at a time when the
+             handler is not reentrant. */
+            yarp::os::Mutex _serialLock;
+
             /*! @brief The name of the request. */
             YarpString _name;
 
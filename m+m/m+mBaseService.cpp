@@ -52,7 +52,7 @@
 #include "m+mStopRequestHandler.hpp"
 
 #include <m+m/m+mBaseContext.hpp>
-#include <m+m/m+mClientChannel.hpp>
+#include <m+m/m+mClientChannelPool.hpp>
 #include <m+m/m+mEndpoint.hpp>
 #include <m+m/m+mException.hpp>
 #include <m+m/m+mRequests.hpp>
@@ -73,6 +73,29 @@
 //#include <odlEnable.h>
 #include <odlInclude.h>
 
+#if defined(__APPLE__)
+# pragma clang diagnostic push
+# pragma clang diagnostic ignored "-Wunknown-pragmas"
+# pragma clang diagnostic ignored "-Wconversion"
+# pragma clang diagnostic ignored "-Wdeprecated-declarations"
+# pragma clang diagnostic ignored "-Wdocumentation-unknown-command"
+# pragma clang diagnostic ignored "-Wextern-c-compat"
+# pragma clang diagnostic ignored "-Wsign-conversion"
+#endif // defined(__APPLE__)
+#if (! MAC_OR_LINUX_)
+# pragma warning(push)
+# pragma warning(disable: 4996)
+#endif // ! MAC_OR_LINUX_
+#include <ace/OS.h>
+#if (! MAC_OR_LINUX_)
+# pragma warning(pop)
+#endif // ! MAC_OR_LINUX_
+#if defined(__APPLE__)
+# pragma clang diagnostic pop
+#endif // defined(__APPLE__)
+
+#include <yarp/os/DummyConnector.h>
+
 #if defined(__APPLE__)
 # pragma clang diagnostic push
 # pragma clang diagnostic ignored "-Wunknown-pragmas"
@@ -112,6 +135,79 @@ static const bool kMeasurementsOn = false;
 # pragma mark Local functions
 #endif // defined(__APPLE__)
 
+/*! @brief Check if the %Registry Service is too busy to handle a request.
+ @param[in] response The response to be checked.
+ @param[out] retryAfter The time that the %Registry Service suggested waiting before retrying.
+ @return @c true if the %Registry Service reported that it was busy and @c false otherwise. */
+static bool
+checkBusyResponse(const ServiceResponse & response,
+                  double &                retryAfter)
+{
+    ODL_ENTER(); //####
+    ODL_P2("response = ", &response, "retryAfter = ", &retryAfter); //####
+    bool result = false;
+
+    if (MpM_EXPECTED_BUSY_RESPONSE_SIZE_ == response.count())
+    {
+        yarp::os::Value theValue = response.element(0);
+
+        if (theValue.isString() && (theValue.toString() == MpM_BUSY_RESPONSE_))
+        {
+            yarp::os::Value hint = response.element(1);
+
+            result = true;
+            if (hint.isDouble())
+            {
+                retryAfter = hint.asDouble();
+            }
+            else if (hint.isInt())
+            {
+                retryAfter = hint.asInt();
+            }
+            else
+            {
+                retryAfter = INITIAL_RETRY_INTERVAL_;
+            }
+            ODL_D1("retryAfter <- ", retryAfter); //####
+        }
+    }
+    ODL_EXIT_B(result); //####
+    return result;
+} // checkBusyResponse
+
+/*! @brief Check the response to a 'register' request.
+ @param[in] response The response to be checked.
+ @return @c true if the registration succeeded and @c false otherwise. */
+static bool
+checkRegisterResponse(const ServiceResponse & response)
+{
+    ODL_ENTER(); //####
+    ODL_P1("response = ", &response); //####
+    bool result = false;
+
+    // Check that we got a successful self-registration!
+    if (MpM_EXPECTED_REGISTER_RESPONSE_SIZE_ == response.count())
+    {
+        yarp::os::Value theValue = response.element(0);
+
+        if (theValue.isString())
+        {
+            result = (theValue.toString() == MpM_OK_RESPONSE_);
+        }
+        else
+        {
+            ODL_LOG("! (theValue.isString())"); //####
+        }
+    }
+    else
+    {
+        ODL_LOG("! (MpM_EXPECTED_REGISTER_RESPONSE_SIZE_ == response.count())"); //####
+        ODL_S1s("response = ", response.asString()); //####
+    }
+    ODL_EXIT_B(result); //####
+    return result;
+} // checkRegisterResponse
+
 #if defined(__APPLE__)
 # pragma mark Class methods
 #endif // defined(__APPLE__)
@@ -133,12 +229,13 @@ BaseService::BaseService(const ServiceKind  theKind,
                          const YarpString & servicePortNumber) :
     _launchPath(launchPath), _contextsLock(), _requestHandlers(*this), _contexts(),
     _description(description), _requestsDescription(requestsDescription), _tag(tag),
-    _auxCounters(), _argumentsHandler(NULL), _channelsHandler(NULL), _clientsHandler(NULL),
-    _detachHandler(NULL), _extraInfoHandler(NULL), _infoHandler(NULL), _listHandler(NULL),
-    _metricsHandler(NULL), _metricsStateHandler(NULL), _nameHandler(NULL),
-    _setMetricsStateHandler(NULL), _stopHandler(NULL), _endpoint(NULL), _handler(NULL),
-    _handlerCreator(NULL), _pinger(NULL), _kind(theKind), _metricsEnabled(kMeasurementsOn),
-    _started(false), _useMultipleHandlers(useMultipleHandlers)
+    _auxCounters(), _cachedRepliesLock(), _cachedReplies(), _argumentsHandler(NULL),
+    _channelsHandler(NULL), _clientsHandler(NULL), _detachHandler(NULL), _extraInfoHandler(NULL),
+    _infoHandler(NULL), _listHandler(NULL), _metricsHandler(NULL), _metricsStateHandler(NULL),
+    _nameHandler(NULL), _setMetricsStateHandler(NULL), _stopHandler(NULL), _endpoint(NULL),
+    _handler(NULL), _handlerCreator(NULL), _pinger(NULL), _requestWorkerCount(0),
+    _cachedRepliesGeneration(0), _kind(theKind),
+    _metricsEnabled(kMeasurementsOn), _started(false), _useMultipleHandlers(useMultipleHandlers)
 {
     ODL_ENTER(); //####
     ODL_I2("theKind = ", theKind, "argc = ", argc); //####
@@ -188,12 +285,13 @@ BaseService::BaseService(const ServiceKind  theKind,
                          const YarpString & requestsDescription) :
     _launchPath(launchPath), _contextsLock(), _requestHandlers(*this), _contexts(),
     _description(description), _requestsDescription(requestsDescription),
-    _serviceName(canonicalName), _tag(), _auxCounters(), _argumentsHandler(NULL),
-    _channelsHandler(NULL), _clientsHandler(NULL), _detachHandler(NULL), _infoHandler(NULL),
-    _listHandler(NULL), _metricsHandler(NULL), _metricsStateHandler(NULL), _nameHandler(NULL),
-    _setMetricsStateHandler(NULL), _stopHandler(NULL), _endpoint(NULL), _handler(NULL),
-    _handlerCreator(NULL), _pinger(NULL), _kind(theKind), _metricsEnabled(kMeasurementsOn),
-    _started(false), _useMultipleHandlers(useMultipleHandlers)
+    _serviceName(canonicalName), _tag(), _auxCounters(), _cachedRepliesLock(), _cachedReplies(),
+    _argumentsHandler(NULL), _channelsHandler(NULL), _clientsHandler(NULL), _detachHandler(NULL),
+    _infoHandler(NULL), _listHandler(NULL), _metricsHandler(NULL), _metricsStateHandler(NULL),
+    _nameHandler(NULL), _setMetricsStateHandler(NULL), _stopHandler(NULL), _endpoint(NULL),
+    _handler(NULL), _handlerCreator(NULL), _pinger(NULL), _requestWorkerCount(0),
+    _cachedRepliesGeneration(0), _kind(theKind),
+    _metricsEnabled(kMeasurementsOn), _started(false), _useMultipleHandlers(useMultipleHandlers)
 {
 #if (! defined(ODL_ENABLE_LOGGING_))
 # if MAC_OR_LINUX_
@@ -250,6 +348,7 @@ BaseService::~BaseService(void)
     delete _handler;
     delete _handlerCreator;
     clearContexts();
+    invalidateCachedReplies();
     ODL_OBJEXIT(); //####
 } // BaseService::~BaseService
 
@@ -323,6 +422,7 @@ BaseService::attachRequestHandlers(void)
                     "_metricsHandler && _metricsStateHandler && _nameHandler && " //####
                     "_setMetricsStateHandler && _stopHandler)"); //####
         }
+        invalidateCachedReplies();
     }
     catch (...)
     {
@@ -332,6 +432,50 @@ BaseService::attachRequestHandlers(void)
     ODL_OBJEXIT(); //####
 } // BaseService::attachRequestHandlers
 
+void
+BaseService::cacheReply(const YarpString & key,
+                        yarp::os::Bottle & reply,
+                        const size_t       generation)
+{
+    ODL_OBJENTER(); //####
+    ODL_S2s("key = ", key, "reply = ", reply.toString()); //####
+    ODL_I1("generation = ", generation); //####
+    try
+    {
+        size_t        replySize = 0;
+        const char *  replyBytes = reply.toBinary(&replySize);
+        CachedReply * newReply = new CachedReply;
+
+        newReply->_reply = reply;
+        newReply->_bytes.assign(replyBytes, replyBytes + replySize);
+        _cachedRepliesLock.lock();
+        try
+        {
+            // A reply that was constructed before the service was reconfigured is out of date.
+            if ((generation == _cachedRepliesGeneration) &&
+                (_cachedReplies.end() == _cachedReplies.find(key)))
+            {
+                _cachedReplies[key] = newReply;
+                newReply = NULL;
+            }
+        }
+        catch (...)
+        {
+            _cachedRepliesLock.unlock();
+            delete newReply;
+            throw;
+        }
+        _cachedRepliesLock.unlock();
+        delete newReply;
+    }
+    catch (...)
+    {
+        ODL_LOG("Exception caught"); //####
+        throw;
+    }
+    ODL_OBJEXIT(); //####
+} // BaseService::cacheReply
+
 void
 BaseService::clearContexts(void)
 {
@@ -450,6 +594,7 @@ BaseService::detachRequestHandlers(void)
             delete _stopHandler;
             _stopHandler = NULL;
         }
+        invalidateCachedReplies();
     }
     catch (...)
     {
@@ -501,6 +646,34 @@ BaseService::fillInClientList(YarpStringVector & clients)
     ODL_OBJEXIT(); //####
 } // BaseService::fillInClientList
 
+void
+BaseService::fillInListReply(yarp::os::Bottle & reply)
+{
+    ODL_OBJENTER(); //####
+    ODL_P1("reply = ", &reply); //####
+    _requestHandlers.fillInListReply(reply);
+    ODL_OBJEXIT(); //####
+} // BaseService::fillInListReply
+
+void
+BaseService::fillInNameReply(yarp::os::Bottle & reply)
+{
+    ODL_OBJENTER(); //####
+    ODL_P1("reply = ", &reply); //####
+    char bigPath[PATH_MAX * 2];
+
+    ACE_OS::realpath(_launchPath.c_str(), bigPath);
+    ODL_S1("bigPath <- ", bigPath); //####
+    reply.addString(_serviceName);
+    reply.addString(_description);
+    reply.addString(_extraInfo);
+    reply.addString(Utilities::MapServiceKindToString(_kind));
+    reply.addString(bigPath);
+    reply.addString(_requestsDescription);
+    reply.addString(_tag);
+    ODL_OBJEXIT(); //####
+} // BaseService::fillInNameReply
+
 void
 BaseService::fillInSecondaryClientChannelsList(ChannelVector & channels)
 {
@@ -560,14 +733,15 @@ BaseService::gatherMetrics(yarp::os::Bottle & metrics)
 {
     ODL_OBJENTER(); //####
     ODL_P1("metrics = ", &metrics); //####
+    SendReceiveCounters counters;
+
     if (_endpoint)
     {
-        SendReceiveCounters counters;
-
         _endpoint->getSendReceiveCounters(counters);
         counters.addToList(metrics, _endpoint->getName());
     }
-    _auxCounters.addToList(metrics, "auxiliary");
+    _auxCounters.getCounters(counters);
+    counters.addToList(metrics, "auxiliary");
     ODL_OBJEXIT(); //####
 } // BaseService::gatherMetrics
 
@@ -576,10 +750,71 @@ BaseService::incrementAuxiliaryCounters(const SendReceiveCounters & additionalCo
 {
     ODL_OBJENTER(); //####
     ODL_P1("additionalCounters = ", &additionalCounters); //####
-    _auxCounters += additionalCounters;
+    _auxCounters.addCounters(additionalCounters);
     ODL_OBJEXIT(); //####
 } // BaseService::incrementAuxiliaryCounters
 
+void
+BaseService::invalidateCachedReplies(void)
+{
+    ODL_OBJENTER(); //####
+    _cachedRepliesLock.lock();
+    for (CachedReplyMap::const_iterator walker(_cachedReplies.begin());
+         _cachedReplies.end() != walker; ++walker)
+    {
+        delete walker->second;
+    }
+    _cachedReplies.clear();
+    ++_cachedRepliesGeneration;
+    _cachedRepliesLock.unlock();
+    ODL_OBJEXIT(); //####
+} // BaseService::invalidateCachedReplies
+
+bool
+BaseService::processAsyncRequest(const YarpString &       request,
+                                 const yarp::os::Bottle & restOfInput,
+                                 const YarpString &       senderChannel,
+                                 const int                correlationId,
+                                 const YarpString &       replyChannel)
+{
+    ODL_OBJENTER(); //####
+    ODL_S4s("request = ", request, "restOfInput = ", restOfInput.toString(), //####
+            "senderChannel = ", senderChannel, "replyChannel = ", replyChannel); //####
+    ODL_I1("correlationId = ", correlationId); //####
+    bool result = false;
+
+    try
+    {
+        yarp::os::DummyConnector replyHolder;
+        yarp::os::Bottle         reply;
+        yarp::os::Bottle         message;
+        SendReceiveCounters      newCounters;
+
+        // The response is captured, so that it can be sent to the reply channel with the
+        // correlation identifier; the client can then match it with its request.
+        result = processRequest(request, restOfInput, senderChannel, &replyHolder.getWriter());
+        reply.read(replyHolder.getReader());
+        message.addInt(correlationId);
+        message.addList() = reply;
+        if (! ClientChannelPool::SendMessage(replyChannel, message, _metricsEnabled, &newCounters))
+        {
+            ODL_LOG("(! ClientChannelPool::SendMessage(replyChannel, message, " //####
+                    "_metricsEnabled, &newCounters))"); //####
+#if defined(MpM_StallOnSendProblem)
+            Stall();
+#endif // defined(MpM_StallOnSendProblem)
+        }
+        incrementAuxiliaryCounters(newCounters);
+    }
+    catch (...)
+    {
+        ODL_LOG("Exception caught"); //####
+        throw;
+    }
+    ODL_OBJEXIT_B(result); //####
+    return result;
+} // BaseService::processAsyncRequest
+
 bool
 BaseService::processRequest(const YarpString &           request,
                             const yarp::os::Bottle &     restOfInput,
@@ -590,16 +825,48 @@ BaseService::processRequest(const YarpString &           request,
     ODL_S3s("request = ", request, "restOfInput = ", restOfInput.toString(), //####
             "senderChannel = ", senderChannel); //####
     ODL_P1("replyMechanism = ", replyMechanism); //####
+    bool result = processRequest(request.c_str(), request.length(), restOfInput, senderChannel,
+                                 replyMechanism);
+
+    ODL_OBJEXIT_B(result); //####
+    return result;
+} // BaseService::processRequest
+
+bool
+BaseService::processRequest(const char *                 request,
+                            const size_t                 requestLength,
+                            const yarp::os::Bottle &     restOfInput,
+                            const YarpString &           senderChannel,
+                            yarp::os::ConnectionWriter * replyMechanism)
+{
+    ODL_OBJENTER(); //####
+    ODL_P1("request = ", request); //####
+    ODL_I1("requestLength = ", requestLength); //####
+    ODL_S2s("restOfInput = ", restOfInput.toString(), "senderChannel = ", senderChannel); //####
+    ODL_P1("replyMechanism = ", replyMechanism); //####
     bool result = true;
 
     try
     {
-        BaseRequestHandler * handler = _requestHandlers.lookupRequestHandler(request);
+        const YarpString *   requestName;
+        BaseRequestHandler * handler = _requestHandlers.lookupRequestHandler(request,
+                                                                             requestLength,
+                                                                             requestName);
 
         if (handler)
         {
             ODL_LOG("(handler)"); //####
-            result = handler->processRequest(request, restOfInput, senderChannel, replyMechanism);
+            if (requestName)
+            {
+                result = handler->handleRequest(*requestName, restOfInput, senderChannel,
+                                                replyMechanism);
+            }
+            else
+            {
+                // The default handler needs the request as it was given.
+                result = handler->handleRequest(YarpString(request, requestLength),
+                                                restOfInput, senderChannel, replyMechanism);
+            }
         }
         else
         {
@@ -636,6 +903,7 @@ BaseService::registerRequestHandler(BaseRequestHandler * handler)
     ODL_OBJENTER(); //####
     ODL_P1("handler = ", handler); //####
     _requestHandlers.registerRequestHandler(handler);
+    invalidateCachedReplies();
     ODL_OBJEXIT(); //####
 } // BaseService::registerRequestHandler
 
@@ -670,112 +938,140 @@ BaseService::removeContext(const YarpString & key)
 } // BaseService::removeContext
 
 bool
-BaseService::sendPingForChannel(const YarpString & channelName,
-                                CheckFunction      checker,
-                                void *             checkStuff)
+BaseService::sendCachedReply(const YarpString &           key,
+                             yarp::os::ConnectionWriter * replyMechanism,
+                             size_t &                     generation)
 {
     ODL_OBJENTER(); //####
-    ODL_S1s("channelName = ", channelName); //####
-    ODL_P1("checkStuff = ", checkStuff); //####
-    bool result = false;
+    ODL_S1s("key = ", key); //####
+    ODL_P2("replyMechanism = ", replyMechanism, "generation = ", &generation); //####
+    bool   result = false;
+    size_t replySize = 0;
 
     try
     {
-        YarpString              aName(GetRandomChannelName(HIDDEN_CHANNEL_PREFIX_
-                                                           BUILD_NAME_("ping_",
-                                                                       DEFAULT_CHANNEL_ROOT_)));
-        ClientChannel *         newChannel = new ClientChannel;
-#if defined(MpM_ReportOnConnections)
-        ChannelStatusReporter * reporter = Utilities::GetGlobalStatusReporter();
-#endif // defined(MpM_ReportOnConnections)
-
-        if (newChannel)
+        _cachedRepliesLock.lock();
+        try
         {
-            if (_metricsEnabled)
+            CachedReplyMap::const_iterator match(_cachedReplies.find(key));
+
+            if (_cachedReplies.end() == match)
             {
-                newChannel->enableMetrics();
+                ODL_LOG("(_cachedReplies.end() == match)"); //####
+                generation = _cachedRepliesGeneration;
             }
             else
             {
-                newChannel->disableMetrics();
-            }
-#if defined(MpM_ReportOnConnections)
-            newChannel->setReporter(*reporter);
-            newChannel->getReport(*reporter);
-#endif // defined(MpM_ReportOnConnections)
-            if (newChannel->openWithRetries(aName, STANDARD_WAIT_TIME_))
-            {
-                if (Utilities::NetworkConnectWithRetries(aName, MpM_REGISTRY_ENDPOINT_NAME_,
-                                                         STANDARD_WAIT_TIME_, false, checker,
-                                                         checkStuff))
+                if (replyMechanism)
                 {
-                    yarp::os::Bottle parameters(channelName);
-                    ServiceRequest   request(MpM_PING_REQUEST_, parameters);
-                    ServiceResponse  response;
+                    CachedReply * aReply = match->second;
+                    bool          written;
 
-                    if (request.send(*newChannel, response))
+                    if (replyMechanism->isTextMode())
                     {
-                        // Check that we got a successful ping!
-                        if (MpM_EXPECTED_PING_RESPONSE_SIZE_ == response.count())
-                        {
-                            yarp::os::Value theValue = response.element(0);
-
-                            if (theValue.isString())
-                            {
-                                result = (theValue.toString() == MpM_OK_RESPONSE_);
-                            }
-                            else
-                            {
-                                ODL_LOG("! (theValue.isString())"); //####
-                            }
-                        }
-                        else
-                        {
-                            ODL_LOG("! (MpM_EXPECTED_PING_RESPONSE_SIZE_ == " //####
-                                    "response.count())"); //####
-                            ODL_S1s("response = ", response.asString()); //####
-                        }
+                        written = aReply->_reply.write(*replyMechanism);
                     }
                     else
                     {
-                        ODL_LOG("! (request.send(*newChannel, response))"); //####
+                        // The bytes are copied into the outgoing message, so the saved reply can be
+                        // discarded before the message is sent.
+                        replyMechanism->appendBlock(&aReply->_bytes[0], aReply->_bytes.size());
+                        written = true;
                     }
-#if defined(MpM_DoExplicitDisconnect)
-                    if (! Utilities::NetworkDisconnectWithRetries(aName,
-                                                                  MpM_REGISTRY_ENDPOINT_NAME_,
-                                                                  STANDARD_WAIT_TIME_, checker,
-                                                                  checkStuff))
+                    if (written)
                     {
-                        ODL_LOG("(! Utilities::NetworkDisconnectWithRetries(aName, " //####
-                                "MpM_REGISTRY_ENDPOINT_NAME_, STANDARD_WAIT_TIME_, checker, " //####
-                                "checkStuff))"); //####
+                        replySize = aReply->_bytes.size();
                     }
-#endif // defined(MpM_DoExplicitDisconnect)
+                    else
+                    {
+                        ODL_LOG("(! written)"); //####
+#if defined(MpM_StallOnSendProblem)
+                        Stall();
+#endif // defined(MpM_StallOnSendProblem)
+                    }
+                }
+                result = true;
+            }
+        }
+        catch (...)
+        {
+            _cachedRepliesLock.unlock();
+            throw;
+        }
+        _cachedRepliesLock.unlock();
+        if (replySize && _metricsEnabled)
+        {
+            updateResponseCounters(replySize);
+        }
+    }
+    catch (...)
+    {
+        ODL_LOG("Exception caught"); //####
+        throw;
+    }
+    ODL_OBJEXIT_B(result); //####
+    return result;
+} // BaseService::sendCachedReply
+
+bool
+BaseService::sendPingForChannel(const YarpString & channelName,
+                                CheckFunction      checker,
+                                void *             checkStuff,
+                                double *           retryAfter)
+{
+    ODL_OBJENTER(); //####
+    ODL_S1s("channelName = ", channelName); //####
+    ODL_P2("checkStuff = ", checkStuff, "retryAfter = ", retryAfter); //####
+    bool result = false;
+
+    try
+    {
+        yarp::os::Bottle    parameters(channelName);
+        ServiceRequest      request(MpM_PING_REQUEST_, parameters);
+        ServiceResponse     response;
+        SendReceiveCounters newCounters;
+
+        if (ClientChannelPool::SendRequest(MpM_REGISTRY_ENDPOINT_NAME_, request, response, true,
+                                           _metricsEnabled, &newCounters, checker, checkStuff))
+        {
+            double busyHint;
+
+            // Check that we got a successful ping!
+            if (checkBusyResponse(response, busyHint))
+            {
+                ODL_LOG("(checkBusyResponse(response, busyHint))"); //####
+                if (retryAfter)
+                {
+                    *retryAfter = busyHint;
+                }
+            }
+            else if (MpM_EXPECTED_PING_RESPONSE_SIZE_ == response.count())
+            {
+                yarp::os::Value theValue = response.element(0);
+
+                if (theValue.isString())
+                {
+                    result = (theValue.toString() == MpM_OK_RESPONSE_);
                 }
                 else
                 {
-                    ODL_LOG("! (Utilities::NetworkConnectWithRetries(aName, " //####
-                            "MpM_REGISTRY_ENDPOINT_NAME_, STANDARD_WAIT_TIME_, false, " //####
-                            "checker, checkStuff))"); //####
+                    ODL_LOG("! (theValue.isString())"); //####
                 }
-#if defined(MpM_DoExplicitClose)
-                newChannel->close();
-#endif // defined(MpM_DoExplicitClose)
             }
             else
             {
-                ODL_LOG("! (newChannel->openWithRetries(aName, STANDARD_WAIT_TIME_))"); //####
+                ODL_LOG("! (MpM_EXPECTED_PING_RESPONSE_SIZE_ == " //####
+                        "response.count())"); //####
+                ODL_S1s("response = ", response.asString()); //####
             }
-            SendReceiveCounters newCounters;
-
-            newChannel->getSendReceiveCounters(newCounters);
-            incrementAuxiliaryCounters(newCounters);
-            BaseChannel::RelinquishChannel(newChannel);
         }
         else
         {
-            ODL_LOG("! (newChannel)"); //####
+            ODL_LOG("! (ClientChannelPool::SendRequest(MpM_REGISTRY_ENDPOINT_NAME_, " //####
+                    "request, response, true, _metricsEnabled, &newCounters, " //####
+                    "checker, checkStuff))"); //####
         }
+        incrementAuxiliaryCounters(newCounters);
     }
     catch (...)
     {
@@ -801,9 +1097,19 @@ BaseService::setExtraInformation(const YarpString & extraInfo)
     ODL_OBJENTER(); //####
     ODL_S1s("extraInfo = ", extraInfo); //####
     _extraInfo = extraInfo;
+    invalidateCachedReplies();
     ODL_OBJEXIT(); //####
 } // BaseService::setExtraInformation
 
+void
+BaseService::setRequestWorkerCount(const size_t workerCount)
+{
+    ODL_OBJENTER(); //####
+    ODL_I1("workerCount = ", workerCount); //####
+    _requestWorkerCount = workerCount;
+    ODL_OBJEXIT(); //####
+} // BaseService::setRequestWorkerCount
+
 bool
 BaseService::startService(void)
 {
@@ -840,6 +1146,10 @@ BaseService::startService(void)
                 _handler = new ServiceInputHandler(*this);
                 if (_handler)
                 {
+                    if (0 < _requestWorkerCount)
+                    {
+                        _handler->enableAsynchronousDispatch(_requestWorkerCount);
+                    }
                     if (_endpoint->setInputHandler(*_handler) &&
                         _endpoint->open(STANDARD_WAIT_TIME_))
                     {
@@ -908,6 +1218,7 @@ BaseService::unregisterRequestHandler(BaseRequestHandler * handler)
     ODL_OBJENTER(); //####
     ODL_P1("handler = ", handler); //####
     _requestHandlers.unregisterRequestHandler(handler);
+    invalidateCachedReplies();
     ODL_OBJEXIT(); //####
 } // BaseService::unregisterRequestHandler
 
@@ -1583,101 +1894,71 @@ Common::RegisterLocalService(const YarpString & channelName,
 
     try
     {
-        YarpString              aName(GetRandomChannelName(HIDDEN_CHANNEL_PREFIX_
-                                                           BUILD_NAME_("registerlocal_",
-                                                                       DEFAULT_CHANNEL_ROOT_)));
-        ClientChannel *         newChannel = new ClientChannel;
-#if defined(MpM_ReportOnConnections)
-        ChannelStatusReporter * reporter = Utilities::GetGlobalStatusReporter();
-#endif // defined(MpM_ReportOnConnections)
-
-        if (newChannel)
+        yarp::os::Bottle    parameters;
+        ServiceResponse     response;
+        SendReceiveCounters newCounters;
+
+        // Send the description of the service along with the channel, so that the Registry
+        // Service doesn't need to connect back to the service to ask for it.
+        parameters.addString(channelName);
+        service.fillInNameReply(parameters.addList());
+        service.fillInListReply(parameters.addList());
+        ServiceRequest request(MpM_REGISTER_REQUEST_, parameters);
+        bool           busy = false;
+        bool           sent = false;
+        double         retryAfter = 0;
+
+        // When the Registry Service is overloaded, wait for a random time based on its hint, so
+        // that the services that were turned away together don't all come back together.
+        for (int retriesLeft = MAX_RETRIES_; 0 < retriesLeft; --retriesLeft)
         {
-            if (service.metricsAreEnabled())
-            {
-                newChannel->enableMetrics();
-            }
-            else
+            sent = ClientChannelPool::SendRequest(MpM_REGISTRY_ENDPOINT_NAME_, request, response,
+                                                  false, service.metricsAreEnabled(), &newCounters,
+                                                  checker, checkStuff);
+            busy = (sent && checkBusyResponse(response, retryAfter));
+            if ((! busy) || (checker && checker(checkStuff)))
             {
-                newChannel->disableMetrics();
+                break;
             }
-#if defined(MpM_ReportOnConnections)
-            newChannel->setReporter(*reporter);
-            newChannel->getReport(*reporter);
-#endif // defined(MpM_ReportOnConnections)
-            if (newChannel->openWithRetries(aName, STANDARD_WAIT_TIME_))
+
+            ODL_LOG("%%retry%%"); //####
+            yarp::os::Time::delay(retryAfter * (1 + ((REGISTRY_BUSY_MULTIPLIER_ - 1) *
+                                                     yarp::os::Random::uniform())));
+        }
+        if (busy)
+        {
+            ODL_LOG("(busy)"); //####
+        }
+        else if (sent)
+        {
+            result = checkRegisterResponse(response);
+            if (! result)
             {
-                if (Utilities::NetworkConnectWithRetries(aName, MpM_REGISTRY_ENDPOINT_NAME_,
-                                                         STANDARD_WAIT_TIME_, false, checker,
-                                                         checkStuff))
+                // An older Registry Service will reject the description, so fall back to
+                // sending just the channel and letting the Registry Service ask for the rest.
+                yarp::os::Bottle channelOnly(channelName);
+                ServiceRequest   oldRequest(MpM_REGISTER_REQUEST_, channelOnly);
+
+                if (ClientChannelPool::SendRequest(MpM_REGISTRY_ENDPOINT_NAME_, oldRequest,
+                                                   response, false, service.metricsAreEnabled(),
+                                                   &newCounters, checker, checkStuff))
                 {
-                    yarp::os::Bottle parameters(channelName);
-                    ServiceRequest   request(MpM_REGISTER_REQUEST_, parameters);
-                    ServiceResponse  response;
-
-                    if (request.send(*newChannel, response))
-                    {
-                        // Check that we got a successful self-registration!
-                        if (MpM_EXPECTED_REGISTER_RESPONSE_SIZE_ == response.count())
-                        {
-                            yarp::os::Value theValue = response.element(0);
-
-                            if (theValue.isString())
-                            {
-                                result = (theValue.toString() == MpM_OK_RESPONSE_);
-                            }
-                            else
-                            {
-                                ODL_LOG("! (theValue.isString())"); //####
-                            }
-                        }
-                        else
-                        {
-                            ODL_LOG("! (MpM_EXPECTED_REGISTER_RESPONSE_SIZE_ == " //####
-                                    "response.count())"); //####
-                            ODL_S1s("response = ", response.asString()); //####
-                        }
-                    }
-                    else
-                    {
-                        ODL_LOG("! (request.send(*newChannel, response))"); //####
-                    }
-#if defined(MpM_DoExplicitDisconnect)
-                    if (! Utilities::NetworkDisconnectWithRetries(aName,
-                                                                  MpM_REGISTRY_ENDPOINT_NAME_,
-                                                                  STANDARD_WAIT_TIME_, checker,
-                                                                  checkStuff))
-                    {
-                        ODL_LOG("(! Utilities::NetworkDisconnectWithRetries(aName, " //####
-                                "MpM_REGISTRY_ENDPOINT_NAME_, STANDARD_WAIT_TIME_, checker, " //####
-                                "checkStuff))"); //####
-                    }
-#endif // defined(MpM_DoExplicitDisconnect)
+                    result = checkRegisterResponse(response);
                 }
                 else
                 {
-                    ODL_LOG("! (Utilities::NetworkConnectWithRetries(aName, " //####
-                            "MpM_REGISTRY_ENDPOINT_NAME_, STANDARD_WAIT_TIME_, false, " //####
-                            "checker, checkStuff))"); //####
+                    ODL_LOG("! (ClientChannelPool::SendRequest(MpM_REGISTRY_ENDPOINT_NAME_, " //####
+                            "oldRequest, response, false, " //####
+                            "service.metricsAreEnabled(), " //####
+                            "&newCounters, checker, checkStuff))"); //####
                 }
-#if defined(MpM_DoExplicitClose)
-                newChannel->close();
-#endif // defined(MpM_DoExplicitClose)
-            }
-            else
-            {
-                ODL_LOG("! (newChannel->openWithRetries(aName, STANDARD_WAIT_TIME_))"); //####
             }
-            SendReceiveCounters newCounters;
-
-            newChannel->getSendReceiveCounters(newCounters);
-            service.incrementAuxiliaryCounters(newCounters);
-            BaseChannel::RelinquishChannel(newChannel);
         }
         else
         {
-            ODL_LOG("! (newChannel)"); //####
+            ODL_LOG("! (sent)"); //####
         }
+        service.incrementAuxiliaryCounters(newCounters);
     }
     catch (...)
     {
@@ -1701,101 +1982,43 @@ Common::UnregisterLocalService(const YarpString & channelName,
 
     try
     {
-        YarpString              aName(GetRandomChannelName(HIDDEN_CHANNEL_PREFIX_
-                                                           BUILD_NAME_("unregisterlocal_",
-                                                                       DEFAULT_CHANNEL_ROOT_)));
-        ClientChannel *         newChannel = new ClientChannel;
-#if defined(MpM_ReportOnConnections)
-        ChannelStatusReporter * reporter = Utilities::GetGlobalStatusReporter();
-#endif // defined(MpM_ReportOnConnections)
+        yarp::os::Bottle    parameters(channelName);
+        ServiceRequest      request(MpM_UNREGISTER_REQUEST_, parameters);
+        ServiceResponse     response;
+        SendReceiveCounters newCounters;
 
-        if (newChannel)
+        if (ClientChannelPool::SendRequest(MpM_REGISTRY_ENDPOINT_NAME_, request, response, false,
+                                           service.metricsAreEnabled(), &newCounters, checker,
+                                           checkStuff))
         {
-            if (service.metricsAreEnabled())
-            {
-                newChannel->enableMetrics();
-            }
-            else
+            // Check that we got a successful self-deregistration!
+            if (MpM_EXPECTED_UNREGISTER_RESPONSE_SIZE_ == response.count())
             {
-                newChannel->disableMetrics();
-            }
-#if defined(MpM_ReportOnConnections)
-            newChannel->setReporter(*reporter);
-            newChannel->getReport(*reporter);
-#endif // defined(MpM_ReportOnConnections)
-            if (newChannel->openWithRetries(aName, STANDARD_WAIT_TIME_))
-            {
-                if (Utilities::NetworkConnectWithRetries(aName, MpM_REGISTRY_ENDPOINT_NAME_,
-                                                         STANDARD_WAIT_TIME_, false, checker,
-                                                         checkStuff))
-                {
-                    yarp::os::Bottle parameters(channelName);
-                    ServiceRequest   request(MpM_UNREGISTER_REQUEST_, parameters);
-                    ServiceResponse  response;
+                yarp::os::Value theValue = response.element(0);
 
-                    if (request.send(*newChannel, response))
-                    {
-                        // Check that we got a successful self-deregistration!
-                        if (MpM_EXPECTED_UNREGISTER_RESPONSE_SIZE_ == response.count())
-                        {
-                            yarp::os::Value theValue = response.element(0);
-
-                            if (theValue.isString())
-                            {
-                                result = (theValue.toString() == MpM_OK_RESPONSE_);
-                            }
-                            else
-                            {
-                                ODL_LOG("! (theValue.isString())"); //####
-                            }
-                        }
-                        else
-                        {
-                            ODL_LOG("! (MpM_EXPECTED_UNREGISTER_RESPONSE_SIZE_ == " //####
-                                    "response.count())"); //####
-                            ODL_S1s("response = ", response.asString()); //####
-                        }
-                    }
-                    else
-                    {
-                        ODL_LOG("! (request.send(*newChannel, response))"); //####
-                    }
-#if defined(MpM_DoExplicitDisconnect)
-                    if (! Utilities::NetworkDisconnectWithRetries(aName,
-                                                                  MpM_REGISTRY_ENDPOINT_NAME_,
-                                                                  STANDARD_WAIT_TIME_, checker,
-                                                                  checkStuff))
-                    {
-                        ODL_LOG("(! Utilities::NetworkDisconnectWithRetries(aName, " //####
-                                "MpM_REGISTRY_ENDPOINT_NAME_, STANDARD_WAIT_TIME_, checker, " //####
-                                "checkStuff))"); //####
-                    }
-#endif // defined(MpM_DoExplicitDisconnect)
+                if (theValue.isString())
+                {
+                    result = (theValue.toString() == MpM_OK_RESPONSE_);
                 }
                 else
                 {
-                    ODL_LOG("! (Utilities::NetworkConnectWithRetries(aName, " //####
-                            "MpM_REGISTRY_ENDPOINT_NAME_, STANDARD_WAIT_TIME_, false, " //####
-                            "checker, checkStuff))"); //####
+                    ODL_LOG("! (theValue.isString())"); //####
                 }
-#if defined(MpM_DoExplicitClose)
-                newChannel->close();
-#endif // defined(MpM_DoExplicitClose)
             }
             else
             {
-                ODL_LOG("! (newChannel->openWithRetries(aName, STANDARD_WAIT_TIME_))"); //####
+                ODL_LOG("! (MpM_EXPECTED_UNREGISTER_RESPONSE_SIZE_ == " //####
+                        "response.count())"); //####
+                ODL_S1s("response = ", response.asString()); //####
             }
-            SendReceiveCounters newCounters;
-
-            newChannel->getSendReceiveCounters(newCounters);
-            service.incrementAuxiliaryCounters(newCounters);
-            BaseChannel::RelinquishChannel(newChannel);
         }
         else
         {
-            ODL_LOG("! (newChannel)"); //####
+            ODL_LOG("! (ClientChannelPool::SendRequest(MpM_REGISTRY_ENDPOINT_NAME_, " //####
+                    "request, response, false, service.metricsAreEnabled(), " //####
+                    "&newCounters, checker, checkStuff))"); //####
         }
+        service.incrementAuxiliaryCounters(newCounters);
     }
     catch (...)
     {
@@ -41,7 +41,7 @@
 
 # include <m+m/m+mBaseArgumentDescriptor.hpp>
 # include <m+m/m+mRequestMap.hpp>
-# include <m+m/m+mSendReceiveCounters.hpp>
+# include <m+m/m+mShardedSendReceiveCounters.hpp>
 
 # if defined(__APPLE__)
 #  pragma clang diagnostic push
@@ -188,6 +188,21 @@ namespace MplusM
             /*! @brief The entry-type for the mapping. */
             typedef ContextMap::value_type ContextMapValue;
 
+            /*! @brief A saved reply to a request whose response only changes when the service is
+             reconfigured. */
+            struct CachedReply
+            {
+                /*! @brief The reply, for connections that do not use the binary form. */
+                yarp::os::Bottle _reply;
+
+                /*! @brief The binary form of the reply. */
+                std::vector<char> _bytes;
+
+            }; // CachedReply
+
+            /*! @brief A mapping from request keys to saved replies. */
+            typedef std::map<YarpString, CachedReply *> CachedReplyMap;
+
         public :
 
             /*! @brief The constructor.
@@ -242,6 +257,19 @@ namespace MplusM
             virtual
             ~BaseService(void);
 
+            /*! @brief Save the reply to a request, so that it can be resent without being rebuilt.
+
+             The reply is not saved if the saved replies have been invalidated since the
+             generation was retrieved.
+             @param[in] key The key for the request.
+             @param[in] reply The reply to be saved.
+             @param[in] generation The generation reported by sendCachedReply() when the reply
+             was not found. */
+            void
+            cacheReply(const YarpString & key,
+                       yarp::os::Bottle & reply,
+                       const size_t       generation);
+
             /*! @brief Return the description of the service.
              @return The description of the service. */
             inline const YarpString &
@@ -278,6 +306,16 @@ namespace MplusM
             void
             fillInClientList(YarpStringVector & clients);
 
+            /*! @brief Fill in the response to a 'list' request for the service.
+             @param[in,out] reply The response to be filled in. */
+            void
+            fillInListReply(yarp::os::Bottle & reply);
+
+            /*! @brief Fill in the response to a 'name' request for the service.
+             @param[in,out] reply The response to be filled in. */
+            void
+            fillInNameReply(yarp::os::Bottle & reply);
+
             /*! @brief Fill in a list of secondary client channels for the service.
              @param[in,out] channels The list of channels to be filled in. */
             virtual void
@@ -321,6 +359,11 @@ namespace MplusM
             void
             incrementAuxiliaryCounters(const SendReceiveCounters & additionalCounters);
 
+            /*! @brief Discard the saved replies, as the requests, channels or extra information of
+             the service have changed. */
+            void
+            invalidateCachedReplies(void);
+
             /*! @brief Return the state of the service.
              @return @c true if the service has been started and @c false otherwise. */
             inline bool
@@ -358,6 +401,21 @@ namespace MplusM
                 return _metricsEnabled;
             } // metricsAreEnabled
 
+            /*! @brief Process an asynchronous request, sending the response to the reply channel
+             of the client.
+             @param[in] request The requested operation.
+             @param[in] restOfInput The arguments for the operation.
+             @param[in] senderChannel The name of the channel used to send the input data.
+             @param[in] correlationId The identifier to be returned with the response.
+             @param[in] replyChannel The name of the channel that is to receive the response.
+             @return @c true if the input was correctly structured and successfully processed. */
+            bool
+            processAsyncRequest(const YarpString &       request,
+                                const yarp::os::Bottle & restOfInput,
+                                const YarpString &       senderChannel,
+                                const int                correlationId,
+                                const YarpString &       replyChannel);
+
             /*! @brief Process partially-structured input data.
              @param[in] request The requested operation.
              @param[in] restOfInput The arguments for the operation.
@@ -370,6 +428,22 @@ namespace MplusM
                            const YarpString &           senderChannel,
                            yarp::os::ConnectionWriter * replyMechanism);
 
+            /*! @brief Process partially-structured input data, without constructing a string for
+             the requested operation unless it is not recognized.
+             @param[in] request The characters of the requested operation; they need not be
+             terminated.
+             @param[in] requestLength The number of characters in the requested operation.
+             @param[in] restOfInput The arguments for the operation.
+             @param[in] senderChannel The name of the channel used to send the input data.
+             @param[in] replyMechanism @c NULL if no reply is expected and non-@c NULL otherwise.
+             @return @c true if the input was correctly structured and successfully processed. */
+            bool
+            processRequest(const char *                 request,
+                           const size_t                 requestLength,
+                           const yarp::os::Bottle &     restOfInput,
+                           const YarpString &           senderChannel,
+                           yarp::os::ConnectionWriter * replyMechanism);
+
             /*! @brief Return the description of the requests for the service.
              @return The description of the requests for the service. */
             inline const YarpString &
@@ -379,14 +453,30 @@ namespace MplusM
                 return _requestsDescription;
             } // requestsDescription
 
+            /*! @brief Send the saved reply to a request, if there is one.
+             @param[in] key The key for the request.
+             @param[in] replyMechanism @c NULL if no reply is expected and non-@c NULL otherwise.
+             @param[out] generation The generation of the saved replies, to be passed to
+             cacheReply() if there was no saved reply.
+             @return @c true if the saved reply was sent and @c false if the reply needs to be
+             constructed. */
+            bool
+            sendCachedReply(const YarpString &           key,
+                            yarp::os::ConnectionWriter * replyMechanism,
+                            size_t &                     generation);
+
             /*! @brief Send a 'ping' on behalf of a service.
              @param[in] channelName The service channel to report with the ping.
              @param[in] checker A function that provides for early exit from loops.
-             @param[in] checkStuff The private data for the early exit function. */
+             @param[in] checkStuff The private data for the early exit function.
+             @param[out] retryAfter If non-@c NULL, set to the time suggested by the %Registry
+             Service before trying again, if it was too busy to handle the ping.
+             @return @c true if the ping was accepted and @c false otherwise. */
             bool
             sendPingForChannel(const YarpString & channelName,
                                CheckFunction      checker = NULL,
-                               void *             checkStuff = NULL);
+                               void *             checkStuff = NULL,
+                               double *           retryAfter = NULL);
 
             /*! @brief Return the working name of the service.
              @return The working name of the service. */
@@ -402,6 +492,17 @@ namespace MplusM
             void
             setExtraInformation(const YarpString & extraInfo);
 
+            /*! @brief Set the number of worker threads used to process requests.
+
+             This must be called before the service is started. Workers are only used when the
+             service has a single input handler, as the input from each connection is otherwise
+             processed on its own thread. Requests from a sender are processed in the order in which
+             they were received, and a sender that expects a reply waits for it.
+             @param[in] workerCount The number of worker threads, or zero to process requests on
+             the thread that reads them. */
+            void
+            setRequestWorkerCount(const size_t workerCount);
+
             /*! @brief Start the background 'pinging' thread. */
             void
             startPinger(void);
@@ -550,7 +651,13 @@ namespace MplusM
             YarpStringVector _originalArguments;
 
             /*! @brief The auxiliary send / receive counters. */
-            SendReceiveCounters _auxCounters;
+            ShardedSendReceiveCounters _auxCounters;
+
+            /*! @brief The contention lock used to protect the saved replies. */
+            yarp::os::Mutex _cachedRepliesLock;
+
+            /*! @brief The saved replies to requests. */
+            CachedReplyMap _cachedReplies;
 
             /*! @brief The request handler for the 'arguments' request. */
             ArgumentsRequestHandler * _argumentsHandler;
@@ -600,6 +707,12 @@ namespace MplusM
             /*! @brief The object used to generate 'pings' for the service. */
             PingThread * _pinger;
 
+            /*! @brief The number of worker threads used to process requests. */
+            size_t _requestWorkerCount;
+
+            /*! @brief The number of times that the saved replies have been invalidated. */
+            size_t _cachedRepliesGeneration;
+
             /*! @brief The kind of service. */
             ServiceKind _kind;
 
@@ -0,0 +1,134 @@
+//--------------------------------------------------------------------------------------------------
+//
+//  File:       m+m/m+mBottleSizeReader.hpp
+//
+//  Project:    m+m
+//
+//  Contains:   The class declaration for a reader that records the number of bytes received for a
+//              message.
+//
+//  Written by: Norman Jaffe
+//
+//  Copyright:  (c) 2026 by OpenDragon.
+//
+//              All rights reserved. Redistribution and use in source and binary forms, with or
+//              without modification, are permitted provided that the following conditions are met:
+//                * Redistributions of source code must retain the above copyright notice, this list
+//                  of conditions and the following disclaimer.
+//                * Redistributions in binary form must reproduce the above copyright notice, this
+//                  list of conditions and the following disclaimer in the documentation and / or
+//                  other materials provided with the distribution.
+//                * Neither the name of the copyright holders nor the names of its contributors may
+//                  be used to endorse or promote products derived from this software without
+//                  specific prior written permission.
+//
+//              THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//              EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//              OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//              SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//              INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//              TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//              BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//              CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//              ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//              DAMAGE.
+//
+//  Created:    2026-10-17
+//
+//--------------------------------------------------------------------------------------------------
+
+
+#if (! defined(MpMBottleSizeReader_HPP_))
+# define MpMBottleSizeReader_HPP_ /* Header guard */
+
+# include <m+m/m+mCommon.hpp>
+
+# if defined(__APPLE__)
+#  pragma clang diagnostic push
+#  pragma clang diagnostic ignored "-Wunknown-pragmas"
+#  pragma clang diagnostic ignored "-Wdocumentation-unknown-command"
+# endif // defined(__APPLE__)
+/*! @file
+ @brief The class declaration for a reader that records the number of bytes received for a
+ message. */
+# if defined(__APPLE__)
+#  pragma clang diagnostic pop
+# endif // defined(__APPLE__)
+
+namespace MplusM
+{
+    namespace Common
+    {
+        /*! @brief A reader that fills in a message and records the number of bytes that were
+         received for it, so that the message does not need to be converted to its binary form
+         again to be measured. */
+        class BottleSizeReader : public yarp::os::PortReader
+        {
+        public :
+
+        protected :
+
+        private :
+
+            /*! @brief The class that this class is derived from. */
+            typedef yarp::os::PortReader inherited;
+
+        public :
+
+            /*! @brief The constructor.
+             @param[in,out] message The message to be filled in. */
+            explicit
+            BottleSizeReader(yarp::os::Bottle & message);
+
+            /*! @brief The destructor. */
+            virtual
+            ~BottleSizeReader(void);
+
+            /*! @brief Return the number of bytes that were received.
+             @return The number of bytes that were received. */
+            inline size_t
+            numBytes(void)
+            const
+            {
+                return _numBytes;
+            } // numBytes
+
+            /*! @brief Read the message from a connection.
+             @param[in] connection The connection that is to be read from.
+             @return @c true if the message was successfully read and @c false otherwise. */
+            virtual bool
+            read(yarp::os::ConnectionReader & connection);
+
+        protected :
+
+        private :
+
+            /*! @brief The copy constructor.
+             @param[in] other The object to be copied. */
+            BottleSizeReader(const BottleSizeReader & other);
+
+            /*! @brief The assignment operator.
+             @param[in] other The object to be copied.
+             @return The updated object. */
+            BottleSizeReader &
+            operator =(const BottleSizeReader & other);
+
+        public :
+
+        protected :
+
+        private :
+
+            /*! @brief The message to be filled in. */
+            yarp::os::Bottle & _message;
+
+            /*! @brief The number of bytes that were received. */
+            size_t _numBytes;
+
+        }; // BottleSizeReader
+
+    } // Common
+
+} // MplusM
+
+#endif // ! defined(MpMBottleSizeReader_HPP_)
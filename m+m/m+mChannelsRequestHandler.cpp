@@ -148,7 +148,8 @@ bool
 ChannelsRequestHandler::processRequest(const YarpString &           request,
                                        const yarp::os::Bottle &     restOfInput,
                                        const YarpString &           senderChannel,
-                                       yarp::os::ConnectionWriter * replyMechanism)
+                                       yarp::os::ConnectionWriter * replyMechanism,
+                                       yarp::os::Bottle &           response)
 {
 #if (! defined(ODL_ENABLE_LOGGING_))
 # if MAC_OR_LINUX_
@@ -158,64 +159,69 @@ ChannelsRequestHandler::processRequest(const YarpString &           request,
     ODL_OBJENTER(); //####
     ODL_S3s("request = ", request, "restOfInput = ", restOfInput.toString(), //####
             "senderChannel = ", senderChannel); //####
-    ODL_P1("replyMechanism = ", replyMechanism); //####
+    ODL_P2("replyMechanism = ", replyMechanism, "response = ", &response); //####
     bool result = true;
 
     try
     {
-        _response.clear();
-        ChannelVector      channels;
-        yarp::os::Bottle & aList1 = _response.addList();
+        size_t generation;
 
-        _service.fillInSecondaryInputChannelsList(channels);
-        if (0 < channels.size())
+        if (! _service.sendCachedReply(MpM_CHANNELS_REQUEST_, replyMechanism, generation))
         {
-            for (ChannelVector::const_iterator walker(channels.begin());
-                 channels.end() != walker; ++walker)
-            {
-                const ChannelDescription & aChannel = *walker;
-                yarp::os::Bottle &         newBottle = aList1.addList();
+            ChannelVector      channels;
+            yarp::os::Bottle & aList1 = response.addList();
 
-                newBottle.addString(aChannel._portName);
-                newBottle.addString(aChannel._portProtocol);
-                newBottle.addString(aChannel._protocolDescription);
+            _service.fillInSecondaryInputChannelsList(channels);
+            if (0 < channels.size())
+            {
+                for (ChannelVector::const_iterator walker(channels.begin());
+                     channels.end() != walker; ++walker)
+                {
+                    const ChannelDescription & aChannel = *walker;
+                    yarp::os::Bottle &         newBottle = aList1.addList();
+
+                    newBottle.addString(aChannel._portName);
+                    newBottle.addString(aChannel._portProtocol);
+                    newBottle.addString(aChannel._protocolDescription);
+                }
             }
-        }
-        // Note that we can't reuse the first list variable; we wind up with duplicate entries
-        // for some reason.
-        yarp::os::Bottle & aList2 = _response.addList();
+            // Note that we can't reuse the first list variable; we wind up with duplicate entries
+            // for some reason.
+            yarp::os::Bottle & aList2 = response.addList();
 
-        _service.fillInSecondaryOutputChannelsList(channels);
-        if (0 < channels.size())
-        {
-            for (ChannelVector::const_iterator walker(channels.begin());
-                 channels.end() != walker; ++walker)
+            _service.fillInSecondaryOutputChannelsList(channels);
+            if (0 < channels.size())
             {
-                const ChannelDescription & aChannel = *walker;
-                yarp::os::Bottle &         newBottle = aList2.addList();
-
-                newBottle.addString(aChannel._portName);
-                newBottle.addString(aChannel._portProtocol);
-                newBottle.addString(aChannel._protocolDescription);
+                for (ChannelVector::const_iterator walker(channels.begin());
+                     channels.end() != walker; ++walker)
+                {
+                    const ChannelDescription & aChannel = *walker;
+                    yarp::os::Bottle &         newBottle = aList2.addList();
+
+                    newBottle.addString(aChannel._portName);
+                    newBottle.addString(aChannel._portProtocol);
+                    newBottle.addString(aChannel._protocolDescription);
+                }
             }
-        }
-        yarp::os::Bottle & aList3 = _response.addList();
+            yarp::os::Bottle & aList3 = response.addList();
 
-        _service.fillInSecondaryClientChannelsList(channels);
-        if (0 < channels.size())
-        {
-            for (ChannelVector::const_iterator walker(channels.begin());
-                 channels.end() != walker; ++walker)
+            _service.fillInSecondaryClientChannelsList(channels);
+            if (0 < channels.size())
             {
-                const ChannelDescription & aChannel = *walker;
-                yarp::os::Bottle &         newBottle = aList3.addList();
-
-                newBottle.addString(aChannel._portName);
-                newBottle.addString(aChannel._portProtocol);
-                newBottle.addString(aChannel._protocolDescription);
+                for (ChannelVector::const_iterator walker(channels.begin());
+                     channels.end() != walker; ++walker)
+                {
+                    const ChannelDescription & aChannel = *walker;
+                    yarp::os::Bottle &         newBottle = aList3.addList();
+
+                    newBottle.addString(aChannel._portName);
+                    newBottle.addString(aChannel._portProtocol);
+                    newBottle.addString(aChannel._protocolDescription);
+                }
             }
+            _service.cacheReply(MpM_CHANNELS_REQUEST_, response, generation);
+            sendResponse(response, replyMechanism);
         }
-        sendResponse(replyMechanism);
     }
     catch (...)
     {
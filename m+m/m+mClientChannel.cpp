@@ -39,6 +39,7 @@
 #include "m+mClientChannel.hpp"
 
 #include <m+m/m+mBailOut.hpp>
+#include <m+m/m+mResponseCorrelator.hpp>
 
 //#include <odlEnable.h>
 #include <odlInclude.h>
@@ -82,7 +83,7 @@ using namespace MplusM::Common;
 #endif // defined(__APPLE__)
 
 ClientChannel::ClientChannel(void) :
-    inherited()
+    inherited(), _correlator(NULL)
 {
     ODL_ENTER(); //####
     ODL_EXIT_P(this); //####
@@ -91,6 +92,7 @@ ClientChannel::ClientChannel(void) :
 ClientChannel::~ClientChannel(void)
 {
     ODL_OBJENTER(); //####
+    delete _correlator;
     ODL_OBJEXIT(); //####
 } // ClientChannel::~ClientChannel
 
@@ -136,8 +138,8 @@ ClientChannel::addOutputWithRetries(const YarpString & theChannelToBeAdded,
                 if (0 < --retriesLeft)
                 {
                     ODL_LOG("%%retry%%"); //####
+                    retryTime = Common::NextRetryInterval(retryTime);
                     yarp::os::Time::delay(retryTime);
-                    retryTime *= RETRY_MULTIPLIER_;
                 }
             }
         }
@@ -158,6 +160,38 @@ ClientChannel::addOutputWithRetries(const YarpString & theChannelToBeAdded,
 # pragma warning(pop)
 #endif // ! MAC_OR_LINUX_
 
+bool
+ClientChannel::enableAsyncRequests(const size_t maxOutstanding,
+                                   const double timeToWait)
+{
+    ODL_OBJENTER(); //####
+    ODL_I1("maxOutstanding = ", maxOutstanding); //####
+    ODL_D1("timeToWait = ", timeToWait); //####
+    bool result = false;
+
+    try
+    {
+        if (! _correlator)
+        {
+            _correlator = new ResponseCorrelator(maxOutstanding);
+            if (! _correlator->open(timeToWait))
+            {
+                ODL_LOG("(! _correlator->open(timeToWait))"); //####
+                delete _correlator;
+                _correlator = NULL;
+            }
+        }
+        result = (NULL != _correlator);
+    }
+    catch (...)
+    {
+        ODL_LOG("Exception caught"); //####
+        throw;
+    }
+    ODL_OBJEXIT_B(result); //####
+    return result;
+} // ClientChannel::enableAsyncRequests
+
 #if defined(__APPLE__)
 # pragma mark Global functions
 #endif // defined(__APPLE__)
@@ -56,6 +56,8 @@ namespace MplusM
 {
     namespace Common
     {
+        class ResponseCorrelator;
+
         /*! @brief A convenience class to provide distinct channels for responses from a service to
          a client. */
         class ClientChannel : public BaseChannel
@@ -86,6 +88,25 @@ namespace MplusM
             addOutputWithRetries(const YarpString & theChannelToBeAdded,
                                  const double       timeToWait);
 
+            /*! @brief Prepare the channel for sending asynchronous requests, by opening the channel
+             on which their responses will arrive.
+             @param[in] maxOutstanding The maximum number of requests that can be outstanding.
+             @param[in] timeToWait The number of seconds allowed before a failure is considered.
+             @return @c true if asynchronous requests can be sent and @c false otherwise. */
+            bool
+            enableAsyncRequests(const size_t maxOutstanding = DEFAULT_ASYNC_REQUEST_LIMIT_,
+                                const double timeToWait = STANDARD_WAIT_TIME_);
+
+            /*! @brief Return the object that matches responses to asynchronous requests.
+             @return The object that matches responses to asynchronous requests, or @c NULL if
+             asynchronous requests have not been enabled. */
+            inline ResponseCorrelator *
+            getCorrelator(void)
+            const
+            {
+                return _correlator;
+            } // getCorrelator
+
         protected :
 
         private :
@@ -106,6 +127,10 @@ namespace MplusM
 
         private :
 
+            /*! @brief The outstanding asynchronous requests, or @c NULL if asynchronous requests
+             have not been enabled. */
+            ResponseCorrelator * _correlator;
+
         }; // ClientChannel
 
     } // Common
@@ -0,0 +1,568 @@
+//--------------------------------------------------------------------------------------------------
+//
+//  File:       m+m/m+mClientChannelPool.cpp
+//
+//  Project:    m+m
+//
+//  Contains:   The class definition for the pool of long-lived client connections used by m+m.
+//
+//  Written by: Norman Jaffe
+//
+//  Copyright:  (c) 2026 by OpenDragon.
+//
+//              All rights reserved. Redistribution and use in source and binary forms, with or
+//              without modification, are permitted provided that the following conditions are met:
+//                * Redistributions of source code must retain the above copyright notice, this list
+//                  of conditions and the following disclaimer.
+//                * Redistributions in binary form must reproduce the above copyright notice, this
+//                  list of conditions and the following disclaimer in the documentation and / or
+//                  other materials provided with the distribution.
+//                * Neither the name of the copyright holders nor the names of its contributors may
+//                  be used to endorse or promote products derived from this software without
+//                  specific prior written permission.
+//
+//              THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//              EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//              OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//              SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//              INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//              TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//              BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//              CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//              ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//              DAMAGE.
+//
+//  Created:    2026-10-17
+//
+//--------------------------------------------------------------------------------------------------
+
+
+#include "m+mClientChannelPool.hpp"
+
+#include <m+m/m+mServiceRequest.hpp>
+#include <m+m/m+mServiceResponse.hpp>
+#include <m+m/m+mUtilities.hpp>
+
+//#include <odlEnable.h>
+#include <odlInclude.h>
+
+#if defined(__APPLE__)
+# pragma clang diagnostic push
+# pragma clang diagnostic ignored "-Wunknown-pragmas"
+# pragma clang diagnostic ignored "-Wdocumentation-unknown-command"
+#endif // defined(__APPLE__)
+/*! @file
+ @brief The class definition for the pool of long-lived client connections used by m+m. */
+#if defined(__APPLE__)
+# pragma clang diagnostic pop
+#endif // defined(__APPLE__)
+
+#if defined(__APPLE__)
+# pragma mark Namespace references
+#endif // defined(__APPLE__)
+
+using namespace MplusM;
+using namespace MplusM::Common;
+
+#if defined(__APPLE__)
+# pragma mark Private structures, constants and variables
+#endif // defined(__APPLE__)
+
+#if defined(__APPLE__)
+# pragma mark Global constants and variables
+#endif // defined(__APPLE__)
+
+#if defined(__APPLE__)
+# pragma mark Local functions
+#endif // defined(__APPLE__)
+
+#if defined(__APPLE__)
+# pragma mark Class methods
+#endif // defined(__APPLE__)
+
+void
+ClientChannelPool::CloseAll(void)
+{
+    ODL_ENTER(); //####
+    ClientChannelPool * thePool = GetPool();
+    IdleChannelMap      toBeClosed;
+
+    thePool->_lock.lock();
+    toBeClosed.swap(thePool->_idleChannels);
+    thePool->_lock.unlock();
+    DiscardChannels(toBeClosed);
+    ODL_EXIT(); //####
+} // ClientChannelPool::CloseAll
+
+#if (! MAC_OR_LINUX_)
+# pragma warning(push)
+# pragma warning(disable: 4100)
+#endif // ! MAC_OR_LINUX_
+void
+ClientChannelPool::DiscardChannel(ClientChannel *    theChannel,
+                                  const YarpString & destination,
+                                  CheckFunction      checker,
+                                  void *             checkStuff)
+{
+#if ((! defined(MpM_DoExplicitDisconnect)) && (! defined(ODL_ENABLE_LOGGING_)))
+# if MAC_OR_LINUX_
+#  pragma unused(destination,checker,checkStuff)
+# endif // MAC_OR_LINUX_
+#endif // (! defined(MpM_DoExplicitDisconnect)) && (! defined(ODL_ENABLE_LOGGING_))
+    ODL_ENTER(); //####
+    ODL_P2("theChannel = ", theChannel, "checkStuff = ", checkStuff); //####
+    ODL_S1s("destination = ", destination); //####
+#if defined(MpM_DoExplicitDisconnect)
+    if (! Utilities::NetworkDisconnectWithRetries(theChannel->name(), destination,
+                                                  STANDARD_WAIT_TIME_, checker, checkStuff))
+    {
+        ODL_LOG("(! Utilities::NetworkDisconnectWithRetries(theChannel->name(), " //####
+                "destination, STANDARD_WAIT_TIME_, checker, checkStuff))"); //####
+    }
+#endif // defined(MpM_DoExplicitDisconnect)
+#if defined(MpM_DoExplicitClose)
+    theChannel->close();
+#endif // defined(MpM_DoExplicitClose)
+    BaseChannel::RelinquishChannel(theChannel);
+    ODL_EXIT(); //####
+} // ClientChannelPool::DiscardChannel
+#if (! MAC_OR_LINUX_)
+# pragma warning(pop)
+#endif // ! MAC_OR_LINUX_
+
+void
+ClientChannelPool::DiscardChannels(IdleChannelMap & toBeClosed)
+{
+    ODL_ENTER(); //####
+    ODL_P1("toBeClosed = ", &toBeClosed); //####
+    for (IdleChannelMap::iterator walker(toBeClosed.begin()); toBeClosed.end() != walker;
+         ++walker)
+    {
+        IdleChannelVector & channels = walker->second;
+
+        for (size_t ii = 0, mm = channels.size(); mm > ii; ++ii)
+        {
+            DiscardChannel(channels[ii]._channel, walker->first, NULL, NULL);
+        }
+    }
+    ODL_EXIT(); //####
+} // ClientChannelPool::DiscardChannels
+
+size_t
+ClientChannelPool::GetIdleChannelCount(const YarpString & destination)
+{
+    ODL_ENTER(); //####
+    ODL_S1s("destination = ", destination); //####
+    ClientChannelPool * thePool = GetPool();
+    size_t              result = 0;
+
+    thePool->_lock.lock();
+    IdleChannelMap::const_iterator match(thePool->_idleChannels.find(destination));
+
+    if (thePool->_idleChannels.end() != match)
+    {
+        result = match->second.size();
+    }
+    thePool->_lock.unlock();
+    ODL_EXIT_I(result); //####
+    return result;
+} // ClientChannelPool::GetIdleChannelCount
+
+size_t
+ClientChannelPool::GetIdleDestinationCount(void)
+{
+    ODL_ENTER(); //####
+    ClientChannelPool * thePool = GetPool();
+    size_t              result;
+
+    thePool->_lock.lock();
+    result = thePool->_idleChannels.size();
+    thePool->_lock.unlock();
+    ODL_EXIT_I(result); //####
+    return result;
+} // ClientChannelPool::GetIdleDestinationCount
+
+ClientChannelPool *
+ClientChannelPool::GetPool(void)
+{
+    ODL_ENTER(); //####
+    // The pool is never deleted, so that it is still available while the process is exiting.
+    static ClientChannelPool * lPool = NULL;
+    static yarp::os::Mutex *   lPoolLock = new yarp::os::Mutex;
+
+    lPoolLock->lock();
+    if (! lPool)
+    {
+        lPool = new ClientChannelPool;
+    }
+    lPoolLock->unlock();
+    ODL_EXIT_P(lPool); //####
+    return lPool;
+} // ClientChannelPool::GetPool
+
+ClientChannel *
+ClientChannelPool::OpenChannel(const YarpString & destination,
+                               CheckFunction      checker,
+                               void *             checkStuff)
+{
+    ODL_ENTER(); //####
+    ODL_S1s("destination = ", destination); //####
+    ODL_P1("checkStuff = ", checkStuff); //####
+    YarpString      aName(GetRandomChannelName(HIDDEN_CHANNEL_PREFIX_
+                                               BUILD_NAME_("pooled_", DEFAULT_CHANNEL_ROOT_)));
+    ClientChannel * result = new ClientChannel;
+
+    if (result)
+    {
+#if defined(MpM_ReportOnConnections)
+        ChannelStatusReporter * reporter = Utilities::GetGlobalStatusReporter();
+
+        result->setReporter(*reporter);
+        result->getReport(*reporter);
+#endif // defined(MpM_ReportOnConnections)
+        if (result->openWithRetries(aName, STANDARD_WAIT_TIME_))
+        {
+            if (! Utilities::NetworkConnectWithRetries(aName, destination, STANDARD_WAIT_TIME_,
+                                                       false, checker, checkStuff))
+            {
+                ODL_LOG("(! Utilities::NetworkConnectWithRetries(aName, destination, " //####
+                        "STANDARD_WAIT_TIME_, false, checker, checkStuff))"); //####
+#if defined(MpM_DoExplicitClose)
+                result->close();
+#endif // defined(MpM_DoExplicitClose)
+                BaseChannel::RelinquishChannel(result);
+                result = NULL;
+            }
+        }
+        else
+        {
+            ODL_LOG("! (result->openWithRetries(aName, STANDARD_WAIT_TIME_))"); //####
+            BaseChannel::RelinquishChannel(result);
+            result = NULL;
+        }
+    }
+    else
+    {
+        ODL_LOG("! (result)"); //####
+    }
+    ODL_EXIT_P(result); //####
+    return result;
+} // ClientChannelPool::OpenChannel
+
+bool
+ClientChannelPool::SendMessage(const YarpString &    destination,
+                               yarp::os::Bottle &    message,
+                               const bool            metricsEnabled,
+                               SendReceiveCounters * counters,
+                               CheckFunction         checker,
+                               void *                checkStuff)
+{
+    ODL_ENTER(); //####
+    ODL_S1s("destination = ", destination); //####
+    ODL_P3("message = ", &message, "counters = ", counters, "checkStuff = ", checkStuff); //####
+    ODL_B1("metricsEnabled = ", metricsEnabled); //####
+    bool                result = false;
+    ClientChannelPool * thePool = GetPool();
+
+    try
+    {
+        bool            wasReused = false;
+        ClientChannel * theChannel = thePool->acquireChannel(destination, wasReused, checker,
+                                                             checkStuff);
+
+        if (theChannel)
+        {
+            if (metricsEnabled)
+            {
+                theChannel->enableMetrics();
+            }
+            else
+            {
+                theChannel->disableMetrics();
+            }
+            result = theChannel->writeBottle(message);
+            if (counters)
+            {
+                SendReceiveCounters newCounters;
+
+                theChannel->getSendReceiveCounters(newCounters);
+                theChannel->clearSendReceiveCounters();
+                *counters += newCounters;
+            }
+            if (result)
+            {
+                thePool->releaseChannel(theChannel, destination);
+            }
+            else
+            {
+                // The message may have reached the other end before the write failed, so it is
+                // not sent again on a new connection.
+                ODL_LOG("! (theChannel->writeBottle(message))"); //####
+                DiscardChannel(theChannel, destination, checker, checkStuff);
+            }
+        }
+        else
+        {
+            ODL_LOG("! (theChannel)"); //####
+        }
+    }
+    catch (...)
+    {
+        ODL_LOG("Exception caught"); //####
+        throw;
+    }
+    ODL_EXIT_B(result); //####
+    return result;
+} // ClientChannelPool::SendMessage
+
+bool
+ClientChannelPool::SendRequest(const YarpString &    destination,
+                               ServiceRequest &      request,
+                               ServiceResponse &     response,
+                               const bool            isIdempotent,
+                               const bool            metricsEnabled,
+                               SendReceiveCounters * counters,
+                               CheckFunction         checker,
+                               void *                checkStuff)
+{
+    ODL_ENTER(); //####
+    ODL_S1s("destination = ", destination); //####
+    ODL_P4("request = ", &request, "response = ", &response, "counters = ", counters, //####
+           "checkStuff = ", checkStuff); //####
+    ODL_B2("isIdempotent = ", isIdempotent, "metricsEnabled = ", metricsEnabled); //####
+    bool                result = false;
+    ClientChannelPool * thePool = GetPool();
+
+    try
+    {
+        // A reused connection may have been dropped by the other end since it was last used, so
+        // a failure on a reused connection is retried once on a new connection. As the other end
+        // may have processed the request before the connection failed, only a request that can
+        // safely be processed twice is retried.
+        for (bool retry = true; retry; )
+        {
+            bool            wasReused = false;
+            ClientChannel * theChannel = thePool->acquireChannel(destination, wasReused, checker,
+                                                                 checkStuff);
+
+            retry = false;
+            if (theChannel)
+            {
+                if (metricsEnabled)
+                {
+                    theChannel->enableMetrics();
+                }
+                else
+                {
+                    theChannel->disableMetrics();
+                }
+                result = request.send(*theChannel, response);
+                if (counters)
+                {
+                    SendReceiveCounters newCounters;
+
+                    theChannel->getSendReceiveCounters(newCounters);
+                    theChannel->clearSendReceiveCounters();
+                    *counters += newCounters;
+                }
+                if (result)
+                {
+                    thePool->releaseChannel(theChannel, destination);
+                }
+                else
+                {
+                    ODL_LOG("! (request.send(*theChannel, response))"); //####
+                    DiscardChannel(theChannel, destination, checker, checkStuff);
+                    retry = (wasReused && isIdempotent);
+                }
+            }
+            else
+            {
+                ODL_LOG("! (theChannel)"); //####
+            }
+        }
+    }
+    catch (...)
+    {
+        ODL_LOG("Exception caught"); //####
+        throw;
+    }
+    ODL_EXIT_B(result); //####
+    return result;
+} // ClientChannelPool::SendRequest
+
+void
+ClientChannelPool::SetLimits(const double idleLimit,
+                             const size_t destinationLimit)
+{
+    ODL_ENTER(); //####
+    ODL_D1("idleLimit = ", idleLimit); //####
+    ODL_I1("destinationLimit = ", destinationLimit); //####
+    ClientChannelPool * thePool = GetPool();
+
+    thePool->_lock.lock();
+    thePool->_idleLimit = idleLimit;
+    thePool->_destinationLimit = destinationLimit;
+    thePool->_lock.unlock();
+    ODL_EXIT(); //####
+} // ClientChannelPool::SetLimits
+
+#if defined(__APPLE__)
+# pragma mark Constructors and Destructors
+#endif // defined(__APPLE__)
+
+ClientChannelPool::ClientChannelPool(void) :
+    _idleChannels(), _lock(), _idleLimit(CONNECTION_POOL_IDLE_LIMIT_),
+    _destinationLimit(CONNECTION_POOL_DESTINATION_LIMIT_)
+{
+    ODL_ENTER(); //####
+    ODL_EXIT_P(this); //####
+} // ClientChannelPool::ClientChannelPool
+
+ClientChannelPool::~ClientChannelPool(void)
+{
+    ODL_OBJENTER(); //####
+    ODL_OBJEXIT(); //####
+} // ClientChannelPool::~ClientChannelPool
+
+#if defined(__APPLE__)
+# pragma mark Actions and Accessors
+#endif // defined(__APPLE__)
+
+ClientChannel *
+ClientChannelPool::acquireChannel(const YarpString & destination,
+                                  bool &             wasReused,
+                                  CheckFunction      checker,
+                                  void *             checkStuff)
+{
+    ODL_OBJENTER(); //####
+    ODL_S1s("destination = ", destination); //####
+    ODL_P2("wasReused = ", &wasReused, "checkStuff = ", checkStuff); //####
+    ClientChannel *   result = NULL;
+    double            now = yarp::os::Time::now();
+    IdleChannelVector stale;
+
+    _lock.lock();
+    IdleChannelMap::iterator match(_idleChannels.find(destination));
+
+    if (_idleChannels.end() != match)
+    {
+        IdleChannelVector & channels = match->second;
+
+        // Take the most recently used connection, discarding any that are no longer usable.
+        for ( ; (! result) && (! channels.empty()); channels.pop_back())
+        {
+            IdleChannel & candidate = channels.back();
+
+            if (((now - candidate._lastUsed) < _idleLimit) &&
+                (0 < candidate._channel->getOutputCount()))
+            {
+                result = candidate._channel;
+            }
+            else
+            {
+                stale.push_back(candidate);
+            }
+        }
+    }
+    _lock.unlock();
+    for (size_t ii = 0, mm = stale.size(); mm > ii; ++ii)
+    {
+        DiscardChannel(stale[ii]._channel, destination, checker, checkStuff);
+    }
+    wasReused = (NULL != result);
+    if (! result)
+    {
+        result = OpenChannel(destination, checker, checkStuff);
+    }
+    ODL_OBJEXIT_P(result); //####
+    return result;
+} // ClientChannelPool::acquireChannel
+
+void
+ClientChannelPool::pruneIdleChannels(const YarpString & destination,
+                                     IdleChannelMap &   stale)
+{
+    ODL_OBJENTER(); //####
+    ODL_S1s("destination = ", destination); //####
+    ODL_P1("stale = ", &stale); //####
+    double now = yarp::os::Time::now();
+
+    // Connections are added at the end of each list, so the oldest ones are at the front.
+    for (IdleChannelMap::iterator walker(_idleChannels.begin()); _idleChannels.end() != walker; )
+    {
+        IdleChannelVector &         channels = walker->second;
+        IdleChannelVector::iterator firstKept(channels.begin());
+
+        for ( ; (channels.end() != firstKept) &&
+             ((now - firstKept->_lastUsed) >= _idleLimit); ++firstKept)
+        {
+            stale[walker->first].push_back(*firstKept);
+        }
+        channels.erase(channels.begin(), firstKept);
+        if (channels.empty() && (walker->first != destination))
+        {
+            _idleChannels.erase(walker++);
+        }
+        else
+        {
+            ++walker;
+        }
+    }
+    if ((_idleChannels.end() == _idleChannels.find(destination)) &&
+        (0 < _idleChannels.size()) && (_destinationLimit <= _idleChannels.size()))
+    {
+        // Make room by giving up the destination that has gone the longest without being used.
+        IdleChannelMap::iterator oldest(_idleChannels.begin());
+
+        for (IdleChannelMap::iterator walker(_idleChannels.begin());
+             _idleChannels.end() != walker; ++walker)
+        {
+            if (walker->second.back()._lastUsed < oldest->second.back()._lastUsed)
+            {
+                oldest = walker;
+            }
+        }
+        IdleChannelVector & evicted = stale[oldest->first];
+
+        evicted.insert(evicted.end(), oldest->second.begin(), oldest->second.end());
+        _idleChannels.erase(oldest);
+    }
+    ODL_OBJEXIT(); //####
+} // ClientChannelPool::pruneIdleChannels
+
+void
+ClientChannelPool::releaseChannel(ClientChannel *    theChannel,
+                                  const YarpString & destination)
+{
+    ODL_OBJENTER(); //####
+    ODL_P1("theChannel = ", theChannel); //####
+    ODL_S1s("destination = ", destination); //####
+    bool           keepIt = false;
+    IdleChannelMap stale;
+
+    _lock.lock();
+    pruneIdleChannels(destination, stale);
+    IdleChannelVector & channels = _idleChannels[destination];
+
+    if (CONNECTION_POOL_SIZE_ > channels.size())
+    {
+        IdleChannel newEntry;
+
+        newEntry._channel = theChannel;
+        newEntry._lastUsed = yarp::os::Time::now();
+        channels.push_back(newEntry);
+        keepIt = true;
+    }
+    _lock.unlock();
+    DiscardChannels(stale);
+    if (! keepIt)
+    {
+        DiscardChannel(theChannel, destination, NULL, NULL);
+    }
+    ODL_OBJEXIT(); //####
+} // ClientChannelPool::releaseChannel
+
+#if defined(__APPLE__)
+# pragma mark Global functions
+#endif // defined(__APPLE__)
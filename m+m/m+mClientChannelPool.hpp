@@ -0,0 +1,278 @@
+//--------------------------------------------------------------------------------------------------
+//
+//  File:       m+m/m+mClientChannelPool.hpp
+//
+//  Project:    m+m
+//
+//  Contains:   The class declaration for the pool of long-lived client connections used by m+m.
+//
+//  Written by: Norman Jaffe
+//
+//  Copyright:  (c) 2026 by OpenDragon.
+//
+//              All rights reserved. Redistribution and use in source and binary forms, with or
+//              without modification, are permitted provided that the following conditions are met:
+//                * Redistributions of source code must retain the above copyright notice, this list
+//                  of conditions and the following disclaimer.
+//                * Redistributions in binary form must reproduce the above copyright notice, this
+//                  list of conditions and the following disclaimer in the documentation and / or
+//                  other materials provided with the distribution.
+//                * Neither the name of the copyright holders nor the names of its contributors may
+//                  be used to endorse or promote products derived from this software without
+//                  specific prior written permission.
+//
+//              THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//              EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//              OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//              SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//              INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//              TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//              BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//              CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//              ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//              DAMAGE.
+//
+//  Created:    2026-10-17
+//
+//--------------------------------------------------------------------------------------------------
+
+
+#if (! defined(MpMClientChannelPool_HPP_))
+# define MpMClientChannelPool_HPP_ /* Header guard */
+
+# include <m+m/m+mClientChannel.hpp>
+
+# if defined(__APPLE__)
+#  pragma clang diagnostic push
+#  pragma clang diagnostic ignored "-Wunknown-pragmas"
+#  pragma clang diagnostic ignored "-Wdocumentation-unknown-command"
+# endif // defined(__APPLE__)
+/*! @file
+ @brief The class declaration for the pool of long-lived client connections used by m+m. */
+# if defined(__APPLE__)
+#  pragma clang diagnostic pop
+# endif // defined(__APPLE__)
+
+namespace MplusM
+{
+    namespace Common
+    {
+        class ServiceRequest;
+        class ServiceResponse;
+
+        /*! @brief The process-wide pool of client connections to the Registry Service and to
+         other frequently contacted services.
+
+         Rather than opening a channel and connecting it for each request, a connection is taken
+         from the pool, used for one request and then returned. Idle connections are checked
+         before they are reused and are discarded if they have been idle for too long or have lost
+         their connection. A request that fails on a reused connection is sent again on a new
+         connection only if it is idempotent, since the other end may already have processed it;
+         a message without a reply is never sent again. Connections to destinations that are no
+         longer being used, such as the reply channels of departed clients, are discarded once they
+         have been idle for too long, and only a limited number of destinations keep idle
+         connections. */
+        class ClientChannelPool
+        {
+        public :
+
+        protected :
+
+        private :
+
+        public :
+
+            /*! @brief The destructor. */
+            virtual
+            ~ClientChannelPool(void);
+
+            /*! @brief Close all the idle connections; this should be done before the network is
+             shut down. */
+            static void
+            CloseAll(void);
+
+            /*! @brief Return the number of idle connections to a channel.
+             @param[in] destination The name of the channel.
+             @return The number of idle connections to the channel. */
+            static size_t
+            GetIdleChannelCount(const YarpString & destination);
+
+            /*! @brief Return the number of destinations that have idle connections.
+             @return The number of destinations that have idle connections. */
+            static size_t
+            GetIdleDestinationCount(void);
+
+            /*! @brief Send a message to a channel, using a pooled connection; no reply is
+             expected.
+
+             As the message may have reached the other end even if the write failed, it is not
+             sent again on a new connection.
+             @param[in] destination The name of the channel that is to receive the message.
+             @param[in] message The message to be sent.
+             @param[in] metricsEnabled @c true if the send / receive metrics are to be gathered
+             and @c false otherwise.
+             @param[in,out] counters If non-@c NULL, the send / receive counters to be updated.
+             @param[in] checker A function that provides for early exit from loops.
+             @param[in] checkStuff The private data for the early exit function.
+             @return @c true if the message was sent and @c false otherwise. */
+            static bool
+            SendMessage(const YarpString &    destination,
+                        yarp::os::Bottle &    message,
+                        const bool            metricsEnabled,
+                        SendReceiveCounters * counters = NULL,
+                        CheckFunction         checker = NULL,
+                        void *                checkStuff = NULL);
+
+            /*! @brief Send a request to a channel, using a pooled connection.
+             @param[in] destination The name of the channel that is to receive the request.
+             @param[in] request The request to be sent.
+             @param[out] response The response to the request.
+             @param[in] isIdempotent @c true if the request can be processed more than once
+             without changing its effect, so that it can be sent again on a new connection if it
+             fails on a reused connection, and @c false otherwise.
+             @param[in] metricsEnabled @c true if the send / receive metrics are to be gathered
+             and @c false otherwise.
+             @param[in,out] counters If non-@c NULL, the send / receive counters to be updated.
+             @param[in] checker A function that provides for early exit from loops.
+             @param[in] checkStuff The private data for the early exit function.
+             @return @c true if the request was sent and a response received and @c false
+             otherwise. */
+            static bool
+            SendRequest(const YarpString &    destination,
+                        ServiceRequest &      request,
+                        ServiceResponse &     response,
+                        const bool            isIdempotent,
+                        const bool            metricsEnabled,
+                        SendReceiveCounters * counters = NULL,
+                        CheckFunction         checker = NULL,
+                        void *                checkStuff = NULL);
+
+            /*! @brief Set the limits on the idle connections that are kept.
+             @param[in] idleLimit The number of seconds that a connection may be idle before it
+             is discarded.
+             @param[in] destinationLimit The maximum number of destinations for which idle
+             connections are kept. */
+            static void
+            SetLimits(const double idleLimit,
+                      const size_t destinationLimit);
+
+        protected :
+
+        private :
+
+            /*! @brief An idle connection. */
+            struct IdleChannel
+            {
+                /*! @brief The connected channel. */
+                ClientChannel * _channel;
+
+                /*! @brief The time at which the channel was returned to the pool. */
+                double _lastUsed;
+
+            }; // IdleChannel
+
+            /*! @brief The idle connections for a single destination. */
+            typedef std::vector<IdleChannel> IdleChannelVector;
+
+            /*! @brief The idle connections, indexed by destination. */
+            typedef std::map<YarpString, IdleChannelVector> IdleChannelMap;
+
+            /*! @brief The constructor. */
+            ClientChannelPool(void);
+
+            /*! @brief The copy constructor.
+             @param[in] other The object to be copied. */
+            ClientChannelPool(const ClientChannelPool & other);
+
+            /*! @brief Return a connection to a channel, reusing an idle connection if possible.
+             @param[in] destination The name of the channel to be connected to.
+             @param[out] wasReused @c true if an idle connection was returned and @c false if a
+             new connection was made.
+             @param[in] checker A function that provides for early exit from loops.
+             @param[in] checkStuff The private data for the early exit function.
+             @return The connected channel or @c NULL if a connection could not be made. */
+            ClientChannel *
+            acquireChannel(const YarpString & destination,
+                           bool &             wasReused,
+                           CheckFunction      checker,
+                           void *             checkStuff);
+
+            /*! @brief Disconnect, close and release a channel.
+             @param[in] theChannel The channel to be discarded.
+             @param[in] destination The name of the channel that it is connected to.
+             @param[in] checker A function that provides for early exit from loops.
+             @param[in] checkStuff The private data for the early exit function. */
+            static void
+            DiscardChannel(ClientChannel *    theChannel,
+                           const YarpString & destination,
+                           CheckFunction      checker,
+                           void *             checkStuff);
+
+            /*! @brief Disconnect, close and release a set of idle channels.
+             @param[in] toBeClosed The channels to be discarded, indexed by destination. */
+            static void
+            DiscardChannels(IdleChannelMap & toBeClosed);
+
+            /*! @brief Return the pool, creating it if necessary.
+             @return The pool. */
+            static ClientChannelPool *
+            GetPool(void);
+
+            /*! @brief Open a new channel and connect it to a channel.
+             @param[in] destination The name of the channel to be connected to.
+             @param[in] checker A function that provides for early exit from loops.
+             @param[in] checkStuff The private data for the early exit function.
+             @return The connected channel or @c NULL if a connection could not be made. */
+            static ClientChannel *
+            OpenChannel(const YarpString & destination,
+                        CheckFunction      checker,
+                        void *             checkStuff);
+
+            /*! @brief The assignment operator.
+             @param[in] other The object to be copied.
+             @return The updated object. */
+            ClientChannelPool &
+            operator =(const ClientChannelPool & other);
+
+            /*! @brief Remove the idle connections that are to be discarded before a connection is
+             returned to the pool; the lock must be held by the caller.
+             @param[in] destination The name of the channel that the returned connection is
+             connected to.
+             @param[out] stale The removed connections, indexed by destination. */
+            void
+            pruneIdleChannels(const YarpString & destination,
+                              IdleChannelMap &   stale);
+
+            /*! @brief Return a connection to the pool, or discard it if the pool is full.
+             @param[in] theChannel The channel to be returned.
+             @param[in] destination The name of the channel that it is connected to. */
+            void
+            releaseChannel(ClientChannel *    theChannel,
+                           const YarpString & destination);
+
+        public :
+
+        protected :
+
+        private :
+
+            /*! @brief The idle connections. */
+            IdleChannelMap _idleChannels;
+
+            /*! @brief The contention lock used to control access to the idle connections. */
+            yarp::os::Mutex _lock;
+
+            /*! @brief The number of seconds that a connection may be idle before it is
+             discarded. */
+            double _idleLimit;
+
+            /*! @brief The maximum number of destinations for which idle connections are kept. */
+            size_t _destinationLimit;
+
+        }; // ClientChannelPool
+
+    } // Common
+
+} // MplusM
+
+#endif // ! defined(MpMClientChannelPool_HPP_)
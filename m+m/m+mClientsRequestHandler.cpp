@@ -150,7 +150,8 @@ bool
 ClientsRequestHandler::processRequest(const YarpString &           request,
                                       const yarp::os::Bottle &     restOfInput,
                                       const YarpString &           senderChannel,
-                                      yarp::os::ConnectionWriter * replyMechanism)
+                                      yarp::os::ConnectionWriter * replyMechanism,
+                                      yarp::os::Bottle &           response)
 {
 #if (! defined(ODL_ENABLE_LOGGING_))
 # if MAC_OR_LINUX_
@@ -160,7 +161,7 @@ ClientsRequestHandler::processRequest(const YarpString &           request,
     ODL_OBJENTER(); //####
     ODL_S3s("request = ", request, "restOfInput = ", restOfInput.toString(), //####
             "senderChannel = ", senderChannel); //####
-    ODL_P1("replyMechanism = ", replyMechanism); //####
+    ODL_P2("replyMechanism = ", replyMechanism, "response = ", &response); //####
     bool result = true;
 
     try
@@ -168,14 +169,13 @@ ClientsRequestHandler::processRequest(const YarpString &           request,
         YarpStringVector clients;
 
         _service.fillInClientList(clients);
-        _response.clear();
         for (size_t ii = 0, mm = clients.size(); mm > ii; ++ii)
         {
             const YarpString & aString = clients.at(ii);
 
-            _response.addString(aString.c_str());
+            response.addString(aString.c_str());
         }
-        sendResponse(replyMechanism);
+        sendResponse(response, replyMechanism);
     }
     catch (...)
     {
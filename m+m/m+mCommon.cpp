@@ -41,6 +41,7 @@
 
 #include <m+m/m+mBailOut.hpp>
 #include <m+m/m+mRequests.hpp>
+#include <m+m/m+mSharedMemoryCarrier.hpp>
 
 //#include <odlEnable.h>
 #include <odlInclude.h>
@@ -240,14 +241,20 @@ Common::GetRandomChannelName(const char * channelRoot)
     ODL_ENTER(); //####
     ODL_S1("channelRoot = ", channelRoot); //####
     YarpString result;
+    // The random number generator is shared, so threads that make up names at the same time,
+    // such as those gathering an inventory, could otherwise be handed the same name.
+    static yarp::os::Mutex * lRandomLock = new yarp::os::Mutex;
 
     try
     {
         bool              hasLeadingSlash = false;
         const char *      stringToUse;
-        int               randNumb = static_cast<int>(yarp::os::Random::uniform() * kMaxRandom);
+        int               randNumb;
         std::stringstream buff;
 
+        lRandomLock->lock();
+        randNumb = static_cast<int>(yarp::os::Random::uniform() * kMaxRandom);
+        lRandomLock->unlock();
         if (channelRoot)
         {
             stringToUse = channelRoot;
@@ -328,6 +335,12 @@ Common::Initialize(const YarpString & progName)
         ODL_D2("time = ", now, "fraction = ", fraction); //####
         ODL_I1("seed = ", seed); //####
         yarp::os::Random::seed(seed);
+#if defined(MpM_UseSharedMemory)
+        if (! SharedMemoryCarrier::Register())
+        {
+            ODL_LOG("(! SharedMemoryCarrier::Register())"); //####
+        }
+#endif // defined(MpM_UseSharedMemory)
     }
     catch (...)
     {
@@ -340,6 +353,20 @@ Common::Initialize(const YarpString & progName)
 # pragma warning(pop)
 #endif // ! MAC_OR_LINUX_
 
+double
+Common::NextRetryInterval(const double previousInterval)
+{
+    ODL_ENTER(); //####
+    ODL_D1("previousInterval = ", previousInterval); //####
+    double upperBound = std::max(INITIAL_RETRY_INTERVAL_, previousInterval * RETRY_MULTIPLIER_);
+    double result = INITIAL_RETRY_INTERVAL_ + (yarp::os::Random::uniform() *
+                                               (upperBound - INITIAL_RETRY_INTERVAL_));
+
+    result = std::min(MAXIMUM_RETRY_INTERVAL_, result);
+    ODL_EXIT_D(result); //####
+    return result;
+} // Common::NextRetryInterval
+
 void
 Common::SetSignalHandlers(ACE_SignalHandler theHandler)
 {
@@ -174,6 +174,9 @@
 /*! @brief The character separating argument descriptors. */
 # define ARGUMENT_SEPARATOR_        "\v"
 
+/*! @brief The first element of a message that holds several coalesced messages. */
+# define BATCH_FRAME_MARKER_        "mpm_batch"
+
 /*! @brief Construct a proper channel name from two parts. */
 # define BUILD_NAME_(aa_, bb_)      T_(aa_ MpM_NAME_SEPARATOR_ bb_)
 
@@ -189,12 +192,41 @@
 /*! @brief A DOUBLEQUOTE character. */
 # define CHAR_DOUBLEQUOTE_          "\""
 
+/*! @brief The maximum number of destinations for which idle pooled connections are kept. */
+# define CONNECTION_POOL_DESTINATION_LIMIT_ 32
+
+/*! @brief The number of seconds that a pooled connection may be idle before it is discarded. */
+# define CONNECTION_POOL_IDLE_LIMIT_ (4 * PING_INTERVAL_)
+
+/*! @brief The maximum number of idle pooled connections kept for each destination. */
+# define CONNECTION_POOL_SIZE_      4
+
 /*! @brief The size of the buffer used to display the date or the time. */
 # define DATE_TIME_BUFFER_SIZE_     20
 
+/*! @brief The default number of asynchronous requests that can be outstanding on a client
+ channel. */
+# define DEFAULT_ASYNC_REQUEST_LIMIT_ 32
+
+/*! @brief The default time, in seconds, that a message can be held on a batching output
+ channel before it is sent. */
+# define DEFAULT_BATCH_LATENCY_     (0.001 * ONE_SECOND_DELAY_)
+
+/*! @brief The default number of bytes of messages that are coalesced on a batching output
+ channel. */
+# define DEFAULT_BATCH_LIMIT_       1400
+
 /*! @brief The default name for the root part of a channel name. */
 # define DEFAULT_CHANNEL_ROOT_      "channel_"
 
+/*! @brief The default maximum number of messages that can be waiting to be sent on an output
+ channel that does not block its writer. */
+# define DEFAULT_OVERFLOW_LIMIT_    16
+
+/*! @brief The default number of services or ports that are examined at the same time when
+ gathering an inventory. */
+# define DEFAULT_INVENTORY_FAN_OUT_ 16
+
 /*! @brief The line length for command-line help output. */
 # define HELP_LINE_LENGTH_          250
 
@@ -213,6 +245,9 @@
 /*! @brief The largest IP port that is acceptable. */
 # define MAXIMUM_PORT_ALLOWED_      65535
 
+/*! @brief The upper bound on the time interval for retries. */
+# define MAXIMUM_RETRY_INTERVAL_    (1.3 * ONE_SECOND_DELAY_)
+
 /*! @brief The smallest IP port that is acceptable. */
 # define MINIMUM_PORT_ALLOWED_      1024
 
@@ -231,7 +266,15 @@
 /*! @brief The time between ping requests that a service should use. */
 # define PING_INTERVAL_             (9.7 * ONE_SECOND_DELAY_)
 
-/*! @brief The retry interval multiplier. */
+/*! @brief The busy retry multiplier; when the %Registry Service is too busy, the time to wait
+ before retrying is chosen at random between its suggested time and this multiple of it. */
+# define REGISTRY_BUSY_MULTIPLIER_  2.0
+
+/*! @brief The maximum number of request response objects that are kept for reuse. */
+# define RESPONSE_POOL_SIZE_        64
+
+/*! @brief The retry interval multiplier; the next retry interval is chosen at random between
+ the initial retry interval and this multiple of the previous interval. */
 # define RETRY_MULTIPLIER_          1.21
 
 /*! @brief The IP address for the loopback address for the machine that is running the
@@ -242,6 +285,12 @@ executable. */
 executable. */
 # define SELF_ADDRESS_NAME_         "localhost"
 
+/*! @brief The carrier type to be used for m+m connections between channels on the same machine. */
+# define SHARED_MEMORY_CARRIER_     "mpm_shmem"
+
+/*! @brief The number of bytes in each direction of a shared memory connection. */
+# define SHARED_MEMORY_RING_SIZE_   (1024 * 1024)
+
 /*! @brief The standard copyright holder name to use for m+m-created executables. */
 # define STANDARD_COPYRIGHT_NAME_   "H Plus Technologies Ltd. and Simon Fraser University"
 
@@ -374,6 +423,44 @@ namespace MplusM
 
         }; // ChannelMode
 
+        /*! @brief The type of the elements of a packed numeric array. */
+        enum NumericArrayKind
+        {
+            /*! @brief The elements are 32-bit floating-point values. */
+            kNumericArrayKindFloat32,
+
+            /*! @brief The elements are 64-bit floating-point values. */
+            kNumericArrayKindFloat64,
+
+            /*! @brief Force the size to be 4 bytes. */
+            kNumericArrayKindUnknown = 0x7FFFFFFF
+
+        }; // NumericArrayKind
+
+        /*! @brief The handling of messages written to an output channel that cannot be sent as
+         quickly as they are produced. */
+        enum OverflowPolicy
+        {
+            /*! @brief The writer waits until the message has been sent. */
+            kOverflowPolicyBlock,
+
+            /*! @brief The message is queued and, if the queue is full, the oldest queued message
+             is discarded. */
+            kOverflowPolicyDropOldest,
+
+            /*! @brief The message is queued and, if the queue is full, the message is
+             discarded. */
+            kOverflowPolicyDropNewest,
+
+            /*! @brief Only the most recent message is kept; an unsent message is replaced by the
+             next message. */
+            kOverflowPolicyLatestOnly,
+
+            /*! @brief Force the size to be 4 bytes. */
+            kOverflowPolicyUnknown = 0x7FFFFFFF
+
+        }; // OverflowPolicy
+
         /*! @brief The format for the output from command-line tools. */
         enum OutputFlavour
         {
@@ -422,6 +509,14 @@ namespace MplusM
         /*! @brief A description of a channel. */
         struct ChannelDescription
         {
+            /*! @brief The constructor. */
+            inline ChannelDescription(void) :
+                _portName(), _portProtocol(), _protocolDescription(), _portMode(kChannelModeTCP),
+                _overflowPolicy(kOverflowPolicyBlock), _overflowLimit(DEFAULT_OVERFLOW_LIMIT_),
+                _batchLimit(0), _batchLatency(DEFAULT_BATCH_LATENCY_)
+            {
+            } // ChannelDescription
+
             /*! @brief The name of the port being connected to. */
             YarpString _portName;
 
@@ -434,15 +529,22 @@ namespace MplusM
             /*! @brief The mode of the connection. */
             ChannelMode _portMode;
 
-# if defined(__APPLE__)
-#  pragma clang diagnostic push
-#  pragma clang diagnostic ignored "-Wunused-private-field"
-# endif // defined(__APPLE__)
-            /*! @brief Filler to pad to alignment boundary */
-            char _filler[4];
-# if defined(__APPLE__)
-#  pragma clang diagnostic pop
-# endif // defined(__APPLE__)
+            /*! @brief The handling of messages that cannot be sent as quickly as they are
+             produced; only used for output channels. */
+            OverflowPolicy _overflowPolicy;
+
+            /*! @brief The maximum number of messages that can be waiting to be sent, for the
+             queueing overflow policies. */
+            size_t _overflowLimit;
+
+            /*! @brief The number of bytes of messages that are coalesced before being sent, or
+             zero if messages are sent individually; only used for output channels, whose
+             receivers must have enabled batched input. */
+            size_t _batchLimit;
+
+            /*! @brief The time, in seconds, that a message can be held before it is sent, when
+             messages are coalesced. */
+            double _batchLatency;
 
         }; // ChannelDescription
 
@@ -501,6 +603,15 @@ namespace MplusM
         void
         Initialize(const YarpString & progName);
 
+        /*! @brief Return the time to wait before the next retry.
+
+         The interval is chosen at random, so that clients that failed together do not retry
+         together.
+         @param[in] previousInterval The time that was waited before the previous retry.
+         @return The time to wait before the next retry. */
+        double
+        NextRetryInterval(const double previousInterval);
+
         /*! @brief Connect the standard signals to a handler.
          @param[in] theHandler The new handler for the signals. */
         void
@@ -114,6 +114,8 @@
 
 /* #undef MpM_UseDiskDatabase */
 
+/* #undef MpM_UseSharedMemory */
+
 /* #undef MpM_UseTestDatabase */
 
 /* #undef MpM_UseTimeoutsInRetryLoops */
@@ -143,7 +143,8 @@ bool
 ConfigurationRequestHandler::processRequest(const YarpString &           request,
                                             const yarp::os::Bottle &     restOfInput,
                                             const YarpString &           senderChannel,
-                                            yarp::os::ConnectionWriter * replyMechanism)
+                                            yarp::os::ConnectionWriter * replyMechanism,
+                                            yarp::os::Bottle &           response)
 {
 #if (! defined(ODL_ENABLE_LOGGING_))
 # if MAC_OR_LINUX_
@@ -153,19 +154,18 @@ ConfigurationRequestHandler::processRequest(const YarpString &           request
     ODL_OBJENTER(); //####
     ODL_S3s("request = ", request, "restOfInput = ", restOfInput.toString(), //####
             "senderChannel = ", senderChannel); //####
-    ODL_P1("replyMechanism = ", replyMechanism); //####
+    ODL_P2("replyMechanism = ", replyMechanism, "response = ", &response); //####
     bool result = true;
 
     try
     {
-        _response.clear();
-        if (! static_cast<BaseInputOutputService &>(_service).getConfiguration(_response))
+        if (! static_cast<BaseInputOutputService &>(_service).getConfiguration(response))
         {
-            _response.clear();
-            _response.addString(MpM_FAILED_RESPONSE_);
-            _response.addString("Problem getting service configuration");
+            response.clear();
+            response.addString(MpM_FAILED_RESPONSE_);
+            response.addString("Problem getting service configuration");
         }
-        sendResponse(replyMechanism);
+        sendResponse(response, replyMechanism);
     }
     catch (...)
     {
@@ -140,7 +140,8 @@ bool
 ConfigureRequestHandler::processRequest(const YarpString &           request,
                                         const yarp::os::Bottle &     restOfInput,
                                         const YarpString &           senderChannel,
-                                        yarp::os::ConnectionWriter * replyMechanism)
+                                        yarp::os::ConnectionWriter * replyMechanism,
+                                        yarp::os::Bottle &           response)
 {
 #if (! defined(ODL_ENABLE_LOGGING_))
 # if MAC_OR_LINUX_
@@ -150,22 +151,21 @@ ConfigureRequestHandler::processRequest(const YarpString &           request,
     ODL_OBJENTER(); //####
     ODL_S3s("request = ", request, "restOfInput = ", restOfInput.toString(), //####
             "senderChannel = ", senderChannel); //####
-    ODL_P1("replyMechanism = ", replyMechanism); //####
+    ODL_P2("replyMechanism = ", replyMechanism, "response = ", &response); //####
     bool result = true;
 
     try
     {
-        _response.clear();
         if (static_cast<BaseInputOutputService &>(_service).configure(restOfInput))
         {
-            _response.addString(MpM_OK_RESPONSE_);
+            response.addString(MpM_OK_RESPONSE_);
         }
         else
         {
-            _response.addString(MpM_FAILED_RESPONSE_);
-            _response.addString("Problem configurating service");
+            response.addString(MpM_FAILED_RESPONSE_);
+            response.addString("Problem configurating service");
         }
-        sendResponse(replyMechanism);
+        sendResponse(response, replyMechanism);
     }
     catch (...)
     {
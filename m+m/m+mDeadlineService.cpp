@@ -0,0 +1,358 @@
+//--------------------------------------------------------------------------------------------------
+//
+//  File:       m+m/m+mDeadlineService.cpp
+//
+//  Project:    m+m
+//
+//  Contains:   The class definition for the process-wide timeout service for m+m.
+//
+//  Written by: Norman Jaffe
+//
+//  Copyright:  (c) 2026 by OpenDragon.
+//
+//              All rights reserved. Redistribution and use in source and binary forms, with or
+//              without modification, are permitted provided that the following conditions are met:
+//                * Redistributions of source code must retain the above copyright notice, this list
+//                  of conditions and the following disclaimer.
+//                * Redistributions in binary form must reproduce the above copyright notice, this
+//                  list of conditions and the following disclaimer in the documentation and / or
+//                  other materials provided with the distribution.
+//                * Neither the name of the copyright holders nor the names of its contributors may
+//                  be used to endorse or promote products derived from this software without
+//                  specific prior written permission.
+//
+//              THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//              EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//              OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//              SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//              INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//              TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//              BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//              CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//              ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//              DAMAGE.
+//
+//  Created:    2026-10-17
+//
+//--------------------------------------------------------------------------------------------------
+
+
+#include "m+mDeadlineService.hpp"
+
+#include <m+m/m+mBaseChannel.hpp>
+
+//#include <odlEnable.h>
+#include <odlInclude.h>
+
+#include <cmath>
+
+#if defined(__APPLE__)
+# pragma clang diagnostic push
+# pragma clang diagnostic ignored "-Wunknown-pragmas"
+# pragma clang diagnostic ignored "-Wdocumentation-unknown-command"
+#endif // defined(__APPLE__)
+/*! @file
+ @brief The class definition for the process-wide timeout service for m+m. */
+#if defined(__APPLE__)
+# pragma clang diagnostic pop
+#endif // defined(__APPLE__)
+
+#if defined(__APPLE__)
+# pragma mark Namespace references
+#endif // defined(__APPLE__)
+
+using namespace MplusM;
+using namespace MplusM::Common;
+
+#if defined(__APPLE__)
+# pragma mark Private structures, constants and variables
+#endif // defined(__APPLE__)
+
+/*! @brief The number of seconds in each tick of the wheel. */
+static const double kTickInterval = 0.05;
+
+/*! @brief The number of slots in the wheel; longer timeouts wait for more than one turn. */
+static const size_t kWheelSize = 256;
+
+#if defined(__APPLE__)
+# pragma mark Global constants and variables
+#endif // defined(__APPLE__)
+
+#if defined(__APPLE__)
+# pragma mark Local functions
+#endif // defined(__APPLE__)
+
+#if defined(__APPLE__)
+# pragma mark Class methods
+#endif // defined(__APPLE__)
+
+void
+DeadlineService::Cancel(Deadline & aDeadline)
+{
+    ODL_ENTER(); //####
+    ODL_P1("aDeadline = ", &aDeadline); //####
+    DeadlineService * theService = GetService();
+
+    if (theService)
+    {
+        theService->lockIdleDeadline(aDeadline);
+        theService->removeDeadline(aDeadline);
+        theService->_lock.unlock();
+    }
+    ODL_EXIT(); //####
+} // DeadlineService::Cancel
+
+DeadlineService *
+DeadlineService::GetService(void)
+{
+    ODL_ENTER(); //####
+    // The service is never deleted, so that it is still available while the process is exiting.
+    static DeadlineService * lService = NULL;
+    static bool              lStarted = false;
+    static yarp::os::Mutex * lServiceLock = new yarp::os::Mutex;
+
+    lServiceLock->lock();
+    if (! lStarted)
+    {
+        lStarted = true;
+        lService = new DeadlineService;
+        if (! lService->start())
+        {
+            ODL_LOG("(! lService->start())"); //####
+            delete lService;
+            lService = NULL;
+        }
+    }
+    lServiceLock->unlock();
+    ODL_EXIT_P(lService); //####
+    return lService;
+} // DeadlineService::GetService
+
+void
+DeadlineService::Register(Deadline &    aDeadline,
+                          BaseChannel * channelOfInterest,
+                          const double  timeToWait)
+{
+    ODL_ENTER(); //####
+    ODL_P2("aDeadline = ", &aDeadline, "channelOfInterest = ", channelOfInterest); //####
+    ODL_D1("timeToWait = ", timeToWait); //####
+    DeadlineService * theService = GetService();
+
+    if (theService)
+    {
+        theService->addDeadline(aDeadline, channelOfInterest, timeToWait);
+    }
+    ODL_EXIT(); //####
+} // DeadlineService::Register
+
+#if defined(__APPLE__)
+# pragma mark Constructors and Destructors
+#endif // defined(__APPLE__)
+
+DeadlineService::DeadlineService(void) :
+    inherited(), _wheel(kWheelSize, NULL), _lock(), _wakeUp(0),
+    _baseTime(yarp::os::Time::now()), _currentTick(0), _activeCount(0)
+{
+    ODL_ENTER(); //####
+    ODL_EXIT_P(this); //####
+} // DeadlineService::DeadlineService
+
+DeadlineService::~DeadlineService(void)
+{
+    ODL_OBJENTER(); //####
+    ODL_OBJEXIT(); //####
+} // DeadlineService::~DeadlineService
+
+#if defined(__APPLE__)
+# pragma mark Actions and Accessors
+#endif // defined(__APPLE__)
+
+void
+DeadlineService::addDeadline(Deadline &    aDeadline,
+                             BaseChannel * channelOfInterest,
+                             const double  timeToWait)
+{
+    ODL_OBJENTER(); //####
+    ODL_P2("aDeadline = ", &aDeadline, "channelOfInterest = ", channelOfInterest); //####
+    ODL_D1("timeToWait = ", timeToWait); //####
+    size_t ticks = static_cast<size_t>(ceil(timeToWait / kTickInterval));
+
+    if (0 == ticks)
+    {
+        ticks = 1;
+    }
+    lockIdleDeadline(aDeadline);
+    if (aDeadline._isActive)
+    {
+        removeDeadline(aDeadline);
+    }
+    aDeadline._channel = channelOfInterest;
+    aDeadline._rounds = (ticks - 1) / kWheelSize;
+    aDeadline._slot = (_currentTick + ticks) % kWheelSize;
+    aDeadline._previous = NULL;
+    aDeadline._next = _wheel[aDeadline._slot];
+    if (aDeadline._next)
+    {
+        aDeadline._next->_previous = &aDeadline;
+    }
+    _wheel[aDeadline._slot] = &aDeadline;
+    aDeadline._isActive = true;
+    if (1 == ++_activeCount)
+    {
+        _wakeUp.post();
+    }
+    _lock.unlock();
+    ODL_OBJEXIT(); //####
+} // DeadlineService::addDeadline
+
+void
+DeadlineService::expireSlot(const size_t              slot,
+                            std::vector<Deadline *> & expired)
+{
+    ODL_OBJENTER(); //####
+    ODL_I1("slot = ", slot); //####
+    ODL_P1("expired = ", &expired); //####
+    Deadline * walker = _wheel[slot];
+
+    for ( ; walker; )
+    {
+        Deadline * nextOne = walker->_next;
+
+        if (walker->_rounds)
+        {
+            --walker->_rounds;
+        }
+        else
+        {
+            ODL_LOG("(! walker->_rounds)"); //####
+            removeDeadline(*walker);
+            // The owner of the timeout waits for it to be fired before changing or releasing
+            // it, so the channel cannot go away while it is being interrupted.
+            walker->_isFiring = true;
+            expired.push_back(walker);
+        }
+        walker = nextOne;
+    }
+    ODL_OBJEXIT(); //####
+} // DeadlineService::expireSlot
+
+void
+DeadlineService::fireDeadlines(const std::vector<Deadline *> & expired)
+{
+    ODL_OBJENTER(); //####
+    ODL_P1("expired = ", &expired); //####
+    for (size_t ii = 0, mm = expired.size(); mm > ii; ++ii)
+    {
+        BaseChannel * aChannel = expired[ii]->_channel;
+
+        if (aChannel)
+        {
+            aChannel->interrupt();
+        }
+        raise(STANDARD_SIGNAL_TO_USE_);
+    }
+    _lock.lock();
+    for (size_t ii = 0, mm = expired.size(); mm > ii; ++ii)
+    {
+        expired[ii]->_isFiring = false;
+    }
+    _lock.unlock();
+    ODL_OBJEXIT(); //####
+} // DeadlineService::fireDeadlines
+
+void
+DeadlineService::lockIdleDeadline(const Deadline & aDeadline)
+{
+    ODL_OBJENTER(); //####
+    ODL_P1("aDeadline = ", &aDeadline); //####
+    _lock.lock();
+    for ( ; aDeadline._isFiring; )
+    {
+        _lock.unlock();
+        yarp::os::Time::yield();
+        _lock.lock();
+    }
+    ODL_OBJEXIT(); //####
+} // DeadlineService::lockIdleDeadline
+
+void
+DeadlineService::onStop(void)
+{
+    ODL_OBJENTER(); //####
+    _wakeUp.post();
+    ODL_OBJEXIT(); //####
+} // DeadlineService::onStop
+
+void
+DeadlineService::removeDeadline(Deadline & aDeadline)
+{
+    ODL_OBJENTER(); //####
+    ODL_P1("aDeadline = ", &aDeadline); //####
+    // The caller holds the lock.
+    if (aDeadline._isActive)
+    {
+        if (aDeadline._previous)
+        {
+            aDeadline._previous->_next = aDeadline._next;
+        }
+        else
+        {
+            _wheel[aDeadline._slot] = aDeadline._next;
+        }
+        if (aDeadline._next)
+        {
+            aDeadline._next->_previous = aDeadline._previous;
+        }
+        aDeadline._previous = aDeadline._next = NULL;
+        aDeadline._isActive = false;
+        --_activeCount;
+    }
+    ODL_OBJEXIT(); //####
+} // DeadlineService::removeDeadline
+
+void
+DeadlineService::run(void)
+{
+    ODL_OBJENTER(); //####
+    std::vector<Deadline *> expired;
+
+    for ( ; ! isStopping(); )
+    {
+        bool isIdle;
+
+        _lock.lock();
+        isIdle = (0 == _activeCount);
+        _lock.unlock();
+        if (isIdle)
+        {
+            _wakeUp.wait();
+            // Restart the ticks from now, so that the time spent idle is not processed.
+            _lock.lock();
+            _baseTime = yarp::os::Time::now() - (_currentTick * kTickInterval);
+            _lock.unlock();
+        }
+        else
+        {
+            yarp::os::Time::delay(kTickInterval);
+            _lock.lock();
+            double now = yarp::os::Time::now();
+
+            for ( ; (_baseTime + ((_currentTick + 1) * kTickInterval)) <= now; )
+            {
+                ++_currentTick;
+                expireSlot(_currentTick % kWheelSize, expired);
+            }
+            _lock.unlock();
+            if (! expired.empty())
+            {
+                fireDeadlines(expired);
+                expired.clear();
+            }
+        }
+    }
+    ODL_OBJEXIT(); //####
+} // DeadlineService::run
+
+#if defined(__APPLE__)
+# pragma mark Global functions
+#endif // defined(__APPLE__)
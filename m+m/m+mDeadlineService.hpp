@@ -0,0 +1,228 @@
+//--------------------------------------------------------------------------------------------------
+//
+//  File:       m+m/m+mDeadlineService.hpp
+//
+//  Project:    m+m
+//
+//  Contains:   The class declaration for the process-wide timeout service for m+m.
+//
+//  Written by: Norman Jaffe
+//
+//  Copyright:  (c) 2026 by OpenDragon.
+//
+//              All rights reserved. Redistribution and use in source and binary forms, with or
+//              without modification, are permitted provided that the following conditions are met:
+//                * Redistributions of source code must retain the above copyright notice, this list
+//                  of conditions and the following disclaimer.
+//                * Redistributions in binary form must reproduce the above copyright notice, this
+//                  list of conditions and the following disclaimer in the documentation and / or
+//                  other materials provided with the distribution.
+//                * Neither the name of the copyright holders nor the names of its contributors may
+//                  be used to endorse or promote products derived from this software without
+//                  specific prior written permission.
+//
+//              THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//              EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//              OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//              SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//              INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//              TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//              BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//              CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//              ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//              DAMAGE.
+//
+//  Created:    2026-10-17
+//
+//--------------------------------------------------------------------------------------------------
+
+
+#if (! defined(MpMDeadlineService_HPP_))
+# define MpMDeadlineService_HPP_ /* Header guard */
+
+# include <m+m/m+mBaseThread.hpp>
+
+# if defined(__APPLE__)
+#  pragma clang diagnostic push
+#  pragma clang diagnostic ignored "-Wunknown-pragmas"
+#  pragma clang diagnostic ignored "-Wdocumentation-unknown-command"
+# endif // defined(__APPLE__)
+/*! @file
+ @brief The class declaration for the process-wide timeout service for m+m. */
+# if defined(__APPLE__)
+#  pragma clang diagnostic pop
+# endif // defined(__APPLE__)
+
+namespace MplusM
+{
+    namespace Common
+    {
+        class BaseChannel;
+
+        /*! @brief A timeout that is being tracked by the deadline service. */
+        struct Deadline
+        {
+            /*! @brief The constructor. */
+            inline Deadline(void) :
+                _previous(NULL), _next(NULL), _channel(NULL), _rounds(0), _slot(0),
+                _isActive(false), _isFiring(false)
+            {
+            } // Deadline
+
+            /*! @brief The previous timeout in the same slot of the wheel. */
+            Deadline * _previous;
+
+            /*! @brief The next timeout in the same slot of the wheel. */
+            Deadline * _next;
+
+            /*! @brief The channel to be interrupted when the timeout expires, or @c NULL. */
+            BaseChannel * _channel;
+
+            /*! @brief The number of turns of the wheel remaining before the timeout expires. */
+            size_t _rounds;
+
+            /*! @brief The slot of the wheel holding the timeout. */
+            size_t _slot;
+
+            /*! @brief @c true if the timeout is in the wheel and @c false otherwise. */
+            bool _isActive;
+
+            /*! @brief @c true if the timeout has expired and its channel is being interrupted. */
+            bool _isFiring;
+
+        }; // Deadline
+
+        /*! @brief A single thread that tracks all the timeouts of the process.
+
+         The timeouts are held in a timer wheel, so that adding or removing a timeout takes a
+         constant amount of time. When a timeout expires, its channel is interrupted and the
+         standard signal is raised, as the earlier per-timeout threads did. The service is
+         started the first time that it is used and is idle when there are no timeouts. */
+        class DeadlineService : public BaseThread
+        {
+        public :
+
+        protected :
+
+        private :
+
+            /*! @brief The class that this class is derived from. */
+            typedef BaseThread inherited;
+
+        public :
+
+            /*! @brief The destructor. */
+            virtual
+            ~DeadlineService(void);
+
+            /*! @brief Stop tracking a timeout; nothing happens if it has already expired.
+             @param[in,out] aDeadline The timeout to be removed. */
+            static void
+            Cancel(Deadline & aDeadline);
+
+            /*! @brief Start tracking a timeout.
+             @param[in,out] aDeadline The timeout to be added.
+             @param[in] channelOfInterest The channel to be interrupted when the timeout expires,
+             or @c NULL.
+             @param[in] timeToWait The number of seconds to delay before triggering. */
+            static void
+            Register(Deadline &    aDeadline,
+                     BaseChannel * channelOfInterest,
+                     const double  timeToWait);
+
+        protected :
+
+        private :
+
+            /*! @brief The constructor. */
+            DeadlineService(void);
+
+            /*! @brief The copy constructor.
+             @param[in] other The object to be copied. */
+            DeadlineService(const DeadlineService & other);
+
+            /*! @brief Add a timeout to the wheel.
+             @param[in,out] aDeadline The timeout to be added.
+             @param[in] channelOfInterest The channel to be interrupted when the timeout expires,
+             or @c NULL.
+             @param[in] timeToWait The number of seconds to delay before triggering. */
+            void
+            addDeadline(Deadline &    aDeadline,
+                        BaseChannel * channelOfInterest,
+                        const double  timeToWait);
+
+            /*! @brief Remove the timeouts in a slot of the wheel that have no turns remaining; the
+             lock must be held by the caller.
+             @param[in] slot The slot of the wheel to be examined.
+             @param[in,out] expired The timeouts to be fired once the lock is released. */
+            void
+            expireSlot(const size_t              slot,
+                       std::vector<Deadline *> & expired);
+
+            /*! @brief Interrupt the channels of expired timeouts; the lock must not be held by
+             the caller.
+             @param[in] expired The timeouts to be fired. */
+            void
+            fireDeadlines(const std::vector<Deadline *> & expired);
+
+            /*! @brief Return the service, starting it if necessary.
+             @return The service, or @c NULL if it could not be started. */
+            static DeadlineService *
+            GetService(void);
+
+            /*! @brief Acquire the lock once a timeout is not being fired, so that its owner can
+             safely change or release it.
+             @param[in] aDeadline The timeout to be changed. */
+            void
+            lockIdleDeadline(const Deadline & aDeadline);
+
+            /*! @brief Release the thread if it is waiting for a timeout to be added. */
+            virtual void
+            onStop(void);
+
+            /*! @brief The assignment operator.
+             @param[in] other The object to be copied.
+             @return The updated object. */
+            DeadlineService &
+            operator =(const DeadlineService & other);
+
+            /*! @brief Remove a timeout from the wheel; the lock must be held by the caller.
+             @param[in,out] aDeadline The timeout to be removed. */
+            void
+            removeDeadline(Deadline & aDeadline);
+
+            /*! @brief The thread main body. */
+            virtual void
+            run(void);
+
+        public :
+
+        protected :
+
+        private :
+
+            /*! @brief The timeouts, grouped by the slot of the wheel at which they expire. */
+            std::vector<Deadline *> _wheel;
+
+            /*! @brief The contention lock used to control access to the wheel. */
+            yarp::os::Mutex _lock;
+
+            /*! @brief Signalled when a timeout is added while there are no timeouts. */
+            yarp::os::Semaphore _wakeUp;
+
+            /*! @brief The time corresponding to the start of the first tick of the wheel. */
+            double _baseTime;
+
+            /*! @brief The number of ticks of the wheel that have been processed. */
+            size_t _currentTick;
+
+            /*! @brief The number of timeouts in the wheel. */
+            size_t _activeCount;
+
+        }; // DeadlineService
+
+    } // Common
+
+} // MplusM
+
+#endif // ! defined(MpMDeadlineService_HPP_)
@@ -275,10 +275,6 @@ Endpoint::close(void)
     {
         if (isOpen())
         {
-            if (_handler)
-            {
-                _handler->stopProcessing();
-            }
             if (_channel)
             {
                 if (0 < _contact.getHost().length())
@@ -289,9 +285,17 @@ Endpoint::close(void)
                 {
                     yarp::os::Network::unregisterName(_contact.getName());
                 }
-#if defined(MpM_DoExplicitClose)
+                // The port is closed before the handler is stopped, so that no input can arrive
+                // while its dispatch threads are being shut down; the channel itself is kept
+                // until then, as the dispatch threads still report to it.
                 _channel->close();
-#endif // defined(MpM_DoExplicitClose)
+            }
+            if (_handler)
+            {
+                _handler->stopProcessing();
+            }
+            if (_channel)
+            {
                 BaseChannel::RelinquishChannel(_channel);
                 _channel = NULL;
             }
@@ -172,7 +172,8 @@ bool
 ExtraInfoRequestHandler::processRequest(const YarpString &           request,
                                         const yarp::os::Bottle &     restOfInput,
                                         const YarpString &           senderChannel,
-                                        yarp::os::ConnectionWriter * replyMechanism)
+                                        yarp::os::ConnectionWriter * replyMechanism,
+                                        yarp::os::Bottle &           response)
 {
 #if (! defined(ODL_ENABLE_LOGGING_))
 # if MAC_OR_LINUX_
@@ -182,14 +183,13 @@ ExtraInfoRequestHandler::processRequest(const YarpString &           request,
     ODL_OBJENTER(); //####
     ODL_S3s("request = ", request, "restOfInput = ", restOfInput.toString(), //####
             "senderChannel = ", senderChannel); //####
-    ODL_P1("replyMechanism = ", replyMechanism); //####
+    ODL_P2("replyMechanism = ", replyMechanism, "response = ", &response); //####
     bool result = true;
 
     try
     {
-        _response.clear();
-        _response.addString(_service.extraInformation());
-        sendResponse(replyMechanism);
+        response.addString(_service.extraInformation());
+        sendResponse(response, replyMechanism);
     }
     catch (...)
     {
@@ -39,6 +39,8 @@
 #include "m+mGeneralChannel.hpp"
 
 #include <m+m/m+mBailOut.hpp>
+#include <m+m/m+mOutletBatchThread.hpp>
+#include <m+m/m+mOutletQueueThread.hpp>
 
 //#include <odlEnable.h>
 #include <odlInclude.h>
@@ -82,7 +84,9 @@ using namespace MplusM::Common;
 #endif // defined(__APPLE__)
 
 GeneralChannel::GeneralChannel(const bool isOutput) :
-    inherited(), _protocol(), _protocolDescription(), _isOutput(isOutput)
+    inherited(), _protocol(), _protocolDescription(), _batchThread(NULL), _outletThread(NULL),
+    _outletLock(), _batchLimit(0), _batchLatency(DEFAULT_BATCH_LATENCY_), _overflowPolicy(kOverflowPolicyBlock),
+    _isOutput(isOutput)
 {
     ODL_ENTER(); //####
     ODL_B1("isOutput = ", isOutput); //####
@@ -92,6 +96,8 @@ GeneralChannel::GeneralChannel(const bool isOutput) :
 GeneralChannel::~GeneralChannel(void)
 {
     ODL_OBJENTER(); //####
+    setBatching(0);
+    setOverflowPolicy(kOverflowPolicyBlock);
     ODL_OBJEXIT(); //####
 } // GeneralChannel::~GeneralChannel
 
@@ -99,6 +105,145 @@ GeneralChannel::~GeneralChannel(void)
 # pragma mark Actions and Accessors
 #endif // defined(__APPLE__)
 
+void
+GeneralChannel::close(void)
+{
+    ODL_OBJENTER(); //####
+    // Stop sending coalesced and queued messages before the port goes away.
+    setBatching(0);
+    setOverflowPolicy(kOverflowPolicyBlock);
+    inherited::close();
+    ODL_OBJEXIT(); //####
+} // GeneralChannel::close
+
+bool
+GeneralChannel::setBatching(const size_t byteLimit,
+                            const double latencyBudget)
+{
+    ODL_OBJENTER(); //####
+    ODL_I1("byteLimit = ", byteLimit); //####
+    ODL_D1("latencyBudget = ", latencyBudget); //####
+    bool                result = true;
+    OutletBatchThread * oldThread;
+
+    // The thread is detached under the lock, so that no writer is still using it when it is
+    // stopped; it is stopped without the lock, as it sends through writeUnbatched().
+    _outletLock.lock();
+    oldThread = _batchThread;
+    _batchThread = NULL;
+    _outletLock.unlock();
+    if (oldThread)
+    {
+        // Stopping the thread sends any messages that it is holding.
+        oldThread->stop();
+        delete oldThread;
+    }
+    _batchLimit = 0;
+    if (byteLimit)
+    {
+        if (_isOutput && (0 < latencyBudget))
+        {
+            OutletBatchThread * newThread = new OutletBatchThread(*this, byteLimit,
+                                                                  latencyBudget);
+
+            if (newThread->start())
+            {
+                _batchLimit = byteLimit;
+                _batchLatency = latencyBudget;
+                _outletLock.lock();
+                _batchThread = newThread;
+                _outletLock.unlock();
+            }
+            else
+            {
+                ODL_LOG("! (newThread->start())"); //####
+                delete newThread;
+                result = false;
+            }
+        }
+        else
+        {
+            ODL_LOG("! (_isOutput && (0 < latencyBudget))"); //####
+            result = false;
+        }
+    }
+    ODL_OBJEXIT_B(result); //####
+    return result;
+} // GeneralChannel::setBatching
+
+bool
+GeneralChannel::setOverflowPolicy(const OverflowPolicy policy,
+                                  const size_t         limit)
+{
+    ODL_OBJENTER(); //####
+    ODL_I2("policy = ", policy, "limit = ", limit); //####
+    bool                result = true;
+    size_t              batchLimit = _batchLimit;
+    OutletQueueThread * oldThread;
+
+    // The batching thread sends through the queueing thread, so it is stopped while the
+    // queueing thread is replaced.
+    if (batchLimit)
+    {
+        setBatching(0);
+    }
+    _outletLock.lock();
+    oldThread = _outletThread;
+    _outletThread = NULL;
+    _overflowPolicy = kOverflowPolicyBlock;
+    _outletLock.unlock();
+    if (oldThread)
+    {
+        oldThread->stop();
+        delete oldThread;
+    }
+    switch (policy)
+    {
+        case kOverflowPolicyBlock :
+            break;
+
+        case kOverflowPolicyDropOldest :
+        case kOverflowPolicyDropNewest :
+        case kOverflowPolicyLatestOnly :
+            if (_isOutput)
+            {
+                OutletQueueThread * newThread = new OutletQueueThread(*this, policy, limit);
+
+                if (newThread->start())
+                {
+                    _outletLock.lock();
+                    _outletThread = newThread;
+                    _overflowPolicy = policy;
+                    _outletLock.unlock();
+                }
+                else
+                {
+                    ODL_LOG("! (newThread->start())"); //####
+                    delete newThread;
+                    result = false;
+                }
+            }
+            else
+            {
+                ODL_LOG("! (_isOutput)"); //####
+                result = false;
+            }
+            break;
+
+        default :
+            result = false;
+            break;
+
+    }
+    if (batchLimit && (! setBatching(batchLimit, _batchLatency)))
+    {
+        ODL_LOG("(batchLimit && (! setBatching(batchLimit, _batchLatency)))"); //####
+        result = false;
+    }
+    ODL_OBJEXIT_B(result); //####
+    return result;
+} // GeneralChannel::setOverflowPolicy
+
 void
 GeneralChannel::setProtocol(const YarpString & newProtocol,
                             const YarpString & description)
@@ -110,6 +255,55 @@ GeneralChannel::setProtocol(const YarpString & newProtocol,
     ODL_OBJEXIT(); //####
 } // GeneralChannel::setProtocol
 
+bool
+GeneralChannel::writeBottle(yarp::os::Bottle & message)
+{
+    ODL_OBJENTER(); //####
+    ODL_P1("message = ", &message); //####
+    bool result;
+
+    // Adding a message doesn't wait for the receivers, so it is done under the lock, which keeps
+    // the thread from being replaced while it is in use.
+    _outletLock.lock();
+    if (_batchThread)
+    {
+        _batchThread->addMessage(message);
+        _outletLock.unlock();
+        result = true;
+    }
+    else
+    {
+        _outletLock.unlock();
+        result = writeUnbatched(message);
+    }
+    ODL_OBJEXIT_B(result); //####
+    return result;
+} // GeneralChannel::writeBottle
+
+bool
+GeneralChannel::writeUnbatched(yarp::os::Bottle & message)
+{
+    ODL_OBJENTER(); //####
+    ODL_P1("message = ", &message); //####
+    bool result;
+
+    _outletLock.lock();
+    if (_outletThread)
+    {
+        // A discarded message is not an error, since the overflow policy permits it.
+        _outletThread->queueMessage(message);
+        _outletLock.unlock();
+        result = true;
+    }
+    else
+    {
+        _outletLock.unlock();
+        result = inherited::writeBottle(message);
+    }
+    ODL_OBJEXIT_B(result); //####
+    return result;
+} // GeneralChannel::writeUnbatched
+
 #if defined(__APPLE__)
 # pragma mark Global functions
 #endif // defined(__APPLE__)
@@ -56,6 +56,9 @@ namespace MplusM
 {
     namespace Common
     {
+        class OutletBatchThread;
+        class OutletQueueThread;
+
         /*! @brief A convenience class to provide distinct channels to and from adapters. */
         class GeneralChannel : public BaseChannel
         {
@@ -80,6 +83,21 @@ namespace MplusM
             virtual
             ~GeneralChannel(void);
 
+            /*! @brief Close the channel, after sending any coalesced or queued messages. */
+            virtual void
+            close(void);
+
+            /*! @brief Returns @c true if messages are coalesced before being sent and @c false
+             otherwise.
+             @return @c true if messages are coalesced before being sent and @c false
+             otherwise. */
+            inline bool
+            isBatching(void)
+            const
+            {
+                return (NULL != _batchThread);
+            } // isBatching
+
             /*! @brief Returns @c true if the channel is used for output and @c false otherwise.
              @return @c true if the channel is used for output and @c false otherwise. */
             inline bool
@@ -89,6 +107,17 @@ namespace MplusM
                 return _isOutput;
             } // isOutput
 
+            /*! @brief Returns the handling of messages that cannot be sent as quickly as they are
+             produced.
+             @return The handling of messages that cannot be sent as quickly as they are
+             produced. */
+            inline OverflowPolicy
+            overflowPolicy(void)
+            const
+            {
+                return _overflowPolicy;
+            } // overflowPolicy
+
             /*! @brief Returns the protocol associated with the channel.
              @return The protocol associated with the channel. */
             inline const YarpString &
@@ -107,6 +136,22 @@ namespace MplusM
                 return _protocolDescription;
             } // protocolDescription
 
+            /*! @brief Sets the coalescing of messages written to the channel.
+
+             When batching is on, writeBottle() adds the message to a frame that is sent by a
+             separate thread once it holds at least the byte limit or once its oldest message has
+             waited for the latency budget. An input handler that has enabled batched input unpacks
+             the frame and delivers the messages in the order in which they were written, so
+             batching should only be turned on for channels whose receivers have done so.
+             @param[in] byteLimit The number of bytes of messages that are coalesced before being
+             sent, or zero to send each message as it is written.
+             @param[in] latencyBudget The time, in seconds, that a message can be held before it
+             is sent.
+             @return @c true if the batching was set and @c false otherwise. */
+            bool
+            setBatching(const size_t byteLimit,
+                        const double latencyBudget = DEFAULT_BATCH_LATENCY_);
+
             /*! @brief Sets the protocol associated with the channel.
              @param[in] newProtocol The new protocol associated with the channel.
              @param[in] description The description of the new protocol. */
@@ -114,6 +159,36 @@ namespace MplusM
             setProtocol(const YarpString & newProtocol,
                         const YarpString & description);
 
+            /*! @brief Sets the handling of messages that cannot be sent as quickly as they are
+             produced.
+
+             With any policy other than kOverflowPolicyBlock, messages are sent by a separate
+             thread and writeBottle() does not wait for the receivers. The policy can be changed
+             while other threads are writing to the channel.
+             @param[in] policy The handling of messages that cannot be sent as quickly as they are
+             produced.
+             @param[in] limit The maximum number of messages that can be waiting to be sent; only
+             used with kOverflowPolicyDropOldest and kOverflowPolicyDropNewest.
+             @return @c true if the policy was set and @c false otherwise. */
+            bool
+            setOverflowPolicy(const OverflowPolicy policy,
+                              const size_t         limit = DEFAULT_OVERFLOW_LIMIT_);
+
+            /*! @brief Write a message to the port, using the overflow policy of the channel.
+             @param[in] message The message to write.
+             @return @c true if the message was successfully sent or queued and @c false
+             otherwise. */
+            virtual bool
+            writeBottle(yarp::os::Bottle & message);
+
+            /*! @brief Write a message to the port without coalescing it, using the overflow policy
+             of the channel.
+             @param[in] message The message to write.
+             @return @c true if the message was successfully sent or queued and @c false
+             otherwise. */
+            bool
+            writeUnbatched(yarp::os::Bottle & message);
+
         protected :
 
         private :
@@ -140,6 +215,28 @@ namespace MplusM
             /*! @brief The description of the protocol that the channel supports. */
             YarpString _protocolDescription;
 
+            /*! @brief The thread that coalesces messages, or @c NULL if messages are not
+             coalesced. */
+            OutletBatchThread * _batchThread;
+
+            /*! @brief The thread that sends queued messages, or @c NULL if messages are sent by
+             the writer. */
+            OutletQueueThread * _outletThread;
+
+            /*! @brief The contention lock used to control access to the batching and queueing
+             threads. */
+            yarp::os::Mutex _outletLock;
+
+            /*! @brief The number of bytes of messages that are coalesced before being sent. */
+            size_t _batchLimit;
+
+            /*! @brief The time, in seconds, that a message can be held before it is sent. */
+            double _batchLatency;
+
+            /*! @brief The handling of messages that cannot be sent as quickly as they are
+             produced. */
+            OverflowPolicy _overflowPolicy;
+
             /*! @brief @c true if the channel is used for output and @c false otherwise. */
             bool _isOutput;
 
@@ -148,7 +245,7 @@ namespace MplusM
 #  pragma clang diagnostic ignored "-Wunused-private-field"
 # endif // defined(__APPLE__)
             /*! @brief Filler to pad to alignment boundary */
-            char _filler[7];
+            char _filler[3];
 # if defined(__APPLE__)
 #  pragma clang diagnostic pop
 # endif // defined(__APPLE__)
@@ -38,6 +38,7 @@
 
 #include "m+mInfoRequestHandler.hpp"
 
+#include <m+m/m+mBaseService.hpp>
 #include <m+m/m+mRequestMap.hpp>
 #include <m+m/m+mRequests.hpp>
 
@@ -142,7 +143,8 @@ bool
 InfoRequestHandler::processRequest(const YarpString &           request,
                                    const yarp::os::Bottle &     restOfInput,
                                    const YarpString &           senderChannel,
-                                   yarp::os::ConnectionWriter * replyMechanism)
+                                   yarp::os::ConnectionWriter * replyMechanism,
+                                   yarp::os::Bottle &           response)
 {
 #if (! defined(ODL_ENABLE_LOGGING_))
 # if MAC_OR_LINUX_
@@ -152,21 +154,35 @@ InfoRequestHandler::processRequest(const YarpString &           request,
     ODL_OBJENTER(); //####
     ODL_S3s("request = ", request, "restOfInput = ", restOfInput.toString(), //####
             "senderChannel = ", senderChannel); //####
-    ODL_P1("replyMechanism = ", replyMechanism); //####
+    ODL_P2("replyMechanism = ", replyMechanism, "response = ", &response); //####
     bool result = true;
 
     try
     {
-        _response.clear();
         if (_owner && (1 == restOfInput.size()))
         {
-            _owner->fillInRequestInfo(_response, restOfInput.get(0).toString());
+            YarpString requestName(restOfInput.get(0).toString());
+            YarpString key(MpM_INFO_REQUEST_ ARGUMENT_SEPARATOR_);
+            size_t     generation;
+
+            key += requestName;
+            if (! _service.sendCachedReply(key, replyMechanism, generation))
+            {
+                _owner->fillInRequestInfo(response, requestName);
+                // Only the replies for known requests are kept, so that the number of saved
+                // replies is bounded.
+                if (0 < response.size())
+                {
+                    _service.cacheReply(key, response, generation);
+                }
+                sendResponse(response, replyMechanism);
+            }
         }
         else
         {
             ODL_LOG("! (_owner && (1 == restOfInput.size()))"); //####
+            sendResponse(response, replyMechanism);
         }
-        sendResponse(replyMechanism);
     }
     catch (...)
     {
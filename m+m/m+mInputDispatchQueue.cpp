@@ -0,0 +1,245 @@
+//--------------------------------------------------------------------------------------------------
+//
+//  File:       m+m/m+mInputDispatchQueue.cpp
+//
+//  Project:    m+m
+//
+//  Contains:   The class definition for a bounded queue of received messages waiting to be
+//              dispatched to an input handler.
+//
+//  Written by: Norman Jaffe
+//
+//  Copyright:  (c) 2026 by OpenDragon.
+//
+//              All rights reserved. Redistribution and use in source and binary forms, with or
+//              without modification, are permitted provided that the following conditions are met:
+//                * Redistributions of source code must retain the above copyright notice, this list
+//                  of conditions and the following disclaimer.
+//                * Redistributions in binary form must reproduce the above copyright notice, this
+//                  list of conditions and the following disclaimer in the documentation and / or
+//                  other materials provided with the distribution.
+//                * Neither the name of the copyright holders nor the names of its contributors may
+//                  be used to endorse or promote products derived from this software without
+//                  specific prior written permission.
+//
+//              THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//              EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//              OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//              SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//              INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//              TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//              BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//              CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//              ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//              DAMAGE.
+//
+//  Created:    2026-10-17
+//
+//--------------------------------------------------------------------------------------------------
+
+
+#include "m+mInputDispatchQueue.hpp"
+
+//#include <odlEnable.h>
+#include <odlInclude.h>
+
+#if defined(__APPLE__)
+# pragma clang diagnostic push
+# pragma clang diagnostic ignored "-Wunknown-pragmas"
+# pragma clang diagnostic ignored "-Wdocumentation-unknown-command"
+#endif // defined(__APPLE__)
+/*! @file
+ @brief The class definition for a bounded queue of received messages waiting to be dispatched to
+ an input handler. */
+#if defined(__APPLE__)
+# pragma clang diagnostic pop
+#endif // defined(__APPLE__)
+
+#if defined(__APPLE__)
+# pragma mark Namespace references
+#endif // defined(__APPLE__)
+
+using namespace MplusM;
+using namespace MplusM::Common;
+
+#if defined(__APPLE__)
+# pragma mark Private structures, constants and variables
+#endif // defined(__APPLE__)
+
+/*! @brief The time, in seconds, between checks for a closed queue while waiting for a free slot. */
+static const double kFreeSlotPollInterval = 0.1;
+
+#if defined(__APPLE__)
+# pragma mark Global constants and variables
+#endif // defined(__APPLE__)
+
+#if defined(__APPLE__)
+# pragma mark Local functions
+#endif // defined(__APPLE__)
+
+#if defined(__APPLE__)
+# pragma mark Class methods
+#endif // defined(__APPLE__)
+
+#if defined(__APPLE__)
+# pragma mark Constructors and Destructors
+#endif // defined(__APPLE__)
+
+InputDispatchQueue::InputDispatchQueue(const size_t capacity) :
+    _slots(NULL), _capacity(capacity ? capacity : 1), _head(0), _tail(0),
+    _freeSlots(static_cast<int>(capacity ? capacity : 1)), _usedSlots(0), _closeLock(),
+    _closed(false)
+{
+    ODL_ENTER(); //####
+    ODL_I1("capacity = ", capacity); //####
+    _slots = new Slot[_capacity];
+    for (size_t ii = 0; ii < _capacity; ++ii)
+    {
+        _slots[ii]._sequence.store(ii, std::memory_order_relaxed);
+    }
+    ODL_EXIT_P(this); //####
+} // InputDispatchQueue::InputDispatchQueue
+
+InputDispatchQueue::~InputDispatchQueue(void)
+{
+    ODL_OBJENTER(); //####
+    delete[] _slots;
+    ODL_OBJEXIT(); //####
+} // InputDispatchQueue::~InputDispatchQueue
+
+#if defined(__APPLE__)
+# pragma mark Actions and Accessors
+#endif // defined(__APPLE__)
+
+void
+InputDispatchQueue::close(void)
+{
+    ODL_OBJENTER(); //####
+    bool wasClosed;
+
+    _closeLock.lock();
+    wasClosed = _closed.exchange(true);
+    _closeLock.unlock();
+    if (! wasClosed)
+    {
+        _usedSlots.post();
+    }
+    ODL_OBJEXIT(); //####
+} // InputDispatchQueue::close
+
+size_t
+InputDispatchQueue::depth(void)
+const
+{
+    ODL_OBJENTER(); //####
+    size_t result = _tail.load(std::memory_order_relaxed) - _head.load(std::memory_order_relaxed);
+
+    ODL_OBJEXIT_I(result); //####
+    return result;
+} // InputDispatchQueue::depth
+
+bool
+InputDispatchQueue::put(yarp::os::ConnectionReader & connection,
+                        const YarpString &           senderChannel,
+                        const size_t                 numBytes,
+                        yarp::os::Semaphore *        completion,
+                        bool *                       result)
+{
+    ODL_OBJENTER(); //####
+    ODL_P3("connection = ", &connection, "completion = ", completion, "result = ", //####
+           result); //####
+    ODL_S1s("senderChannel = ", senderChannel); //####
+    ODL_I1("numBytes = ", numBytes); //####
+    bool   okSoFar = true;
+    size_t position = 0;
+
+    for ( ; okSoFar && (! _freeSlots.waitWithTimeout(kFreeSlotPollInterval)); )
+    {
+        okSoFar = (! _closed.load());
+    }
+    if (okSoFar)
+    {
+        // The slot is claimed under the lock, so that once the queue is closed the dispatch
+        // thread sees every message that was accepted before it stopped.
+        _closeLock.lock();
+        if (_closed.load())
+        {
+            okSoFar = false;
+        }
+        else
+        {
+            position = _tail.fetch_add(1);
+        }
+        _closeLock.unlock();
+        if (! okSoFar)
+        {
+            _freeSlots.post();
+        }
+    }
+    if (okSoFar)
+    {
+        Slot & aSlot = _slots[position % _capacity];
+
+        // The slot is free once the dispatch thread has released it from its previous use.
+        for ( ; aSlot._sequence.load(std::memory_order_acquire) != position; )
+        {
+            yarp::os::Time::yield();
+        }
+        aSlot._message.clear();
+        aSlot._valid = aSlot._message.read(connection);
+        aSlot._senderChannel = senderChannel;
+        aSlot._queuedTime = yarp::os::Time::now();
+        aSlot._replyMechanism = (completion ? connection.getWriter() : NULL);
+        aSlot._completion = completion;
+        aSlot._result = result;
+        aSlot._numBytes = numBytes;
+        aSlot._sequence.store(position + 1, std::memory_order_release);
+        _usedSlots.post();
+    }
+    ODL_OBJEXIT_B(okSoFar); //####
+    return okSoFar;
+} // InputDispatchQueue::put
+
+void
+InputDispatchQueue::release(Slot & aSlot)
+{
+    ODL_OBJENTER(); //####
+    ODL_P1("aSlot = ", &aSlot); //####
+    size_t position = _head.load(std::memory_order_relaxed);
+
+    aSlot._replyMechanism = NULL;
+    aSlot._completion = NULL;
+    aSlot._result = NULL;
+    aSlot._sequence.store(position + _capacity, std::memory_order_release);
+    _head.store(position + 1, std::memory_order_relaxed);
+    _freeSlots.post();
+    ODL_OBJEXIT(); //####
+} // InputDispatchQueue::release
+
+InputDispatchQueue::Slot *
+InputDispatchQueue::take(void)
+{
+    ODL_OBJENTER(); //####
+    Slot * result = NULL;
+
+    _usedSlots.wait();
+    size_t position = _head.load(std::memory_order_relaxed);
+
+    if ((! _closed.load()) || (_tail.load() != position))
+    {
+        Slot & aSlot = _slots[position % _capacity];
+
+        // A slot may have been claimed by a producer that has not yet finished reading into it.
+        for ( ; aSlot._sequence.load(std::memory_order_acquire) != (position + 1); )
+        {
+            yarp::os::Time::yield();
+        }
+        result = &aSlot;
+    }
+    ODL_OBJEXIT_P(result); //####
+    return result;
+} // InputDispatchQueue::take
+
+#if defined(__APPLE__)
+# pragma mark Global functions
+#endif // defined(__APPLE__)
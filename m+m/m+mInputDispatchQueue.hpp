@@ -0,0 +1,234 @@
+//--------------------------------------------------------------------------------------------------
+//
+//  File:       m+m/m+mInputDispatchQueue.hpp
+//
+//  Project:    m+m
+//
+//  Contains:   The class declaration for a bounded queue of received messages waiting to be
+//              dispatched to an input handler.
+//
+//  Written by: Norman Jaffe
+//
+//  Copyright:  (c) 2026 by OpenDragon.
+//
+//              All rights reserved. Redistribution and use in source and binary forms, with or
+//              without modification, are permitted provided that the following conditions are met:
+//                * Redistributions of source code must retain the above copyright notice, this list
+//                  of conditions and the following disclaimer.
+//                * Redistributions in binary form must reproduce the above copyright notice, this
+//                  list of conditions and the following disclaimer in the documentation and / or
+//                  other materials provided with the distribution.
+//                * Neither the name of the copyright holders nor the names of its contributors may
+//                  be used to endorse or promote products derived from this software without
+//                  specific prior written permission.
+//
+//              THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//              EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//              OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//              SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//              INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//              TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//              BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//              CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//              ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//              DAMAGE.
+//
+//  Created:    2026-10-17
+//
+//--------------------------------------------------------------------------------------------------
+
+
+#if (! defined(MpMInputDispatchQueue_HPP_))
+# define MpMInputDispatchQueue_HPP_ /* Header guard */
+
+# include <m+m/m+mCommon.hpp>
+
+# include <atomic>
+
+# if defined(__APPLE__)
+#  pragma clang diagnostic push
+#  pragma clang diagnostic ignored "-Wunknown-pragmas"
+#  pragma clang diagnostic ignored "-Wdocumentation-unknown-command"
+# endif // defined(__APPLE__)
+/*! @file
+ @brief The class declaration for a bounded queue of received messages waiting to be dispatched to
+ an input handler. */
+# if defined(__APPLE__)
+#  pragma clang diagnostic pop
+# endif // defined(__APPLE__)
+
+namespace MplusM
+{
+    namespace Common
+    {
+        /*! @brief A bounded ring of received messages, filled by any number of YARP reader threads
+         and emptied by a single dispatch thread.
+
+         Producers claim slots in order with an atomic counter and decode each message directly
+         into its slot, so the message is not copied after it is read from the connection. When
+         the ring is full, producers wait for a free slot, which applies back-pressure to the
+         senders. */
+        class InputDispatchQueue
+        {
+        public :
+
+            /*! @brief A received message waiting to be dispatched. */
+            struct Slot
+            {
+                /*! @brief The received message. */
+                yarp::os::Bottle _message;
+
+                /*! @brief The name of the channel used to send the message. */
+                YarpString _senderChannel;
+
+                /*! @brief The time at which the message was added to the queue. */
+                double _queuedTime;
+
+                /*! @brief The mechanism to use for a reply, or @c NULL if no reply is expected. */
+                yarp::os::ConnectionWriter * _replyMechanism;
+
+                /*! @brief The semaphore to signal when the message has been processed, or @c NULL
+                 if the sender is not waiting. */
+                yarp::os::Semaphore * _completion;
+
+                /*! @brief Where to put the result of processing the message, or @c NULL if the
+                 sender is not waiting. */
+                bool * _result;
+
+                /*! @brief The number of bytes in the message. */
+                size_t _numBytes;
+
+                /*! @brief The position in the ring that this slot is ready for. */
+                std::atomic<size_t> _sequence;
+
+                /*! @brief @c true if the message was successfully read and @c false otherwise. */
+                bool _valid;
+
+# if defined(__APPLE__)
+#  pragma clang diagnostic push
+#  pragma clang diagnostic ignored "-Wunused-private-field"
+# endif // defined(__APPLE__)
+                /*! @brief Filler to pad to alignment boundary */
+                char _filler[7];
+# if defined(__APPLE__)
+#  pragma clang diagnostic pop
+# endif // defined(__APPLE__)
+
+            }; // Slot
+
+        protected :
+
+        private :
+
+        public :
+
+            /*! @brief The constructor.
+             @param[in] capacity The maximum number of messages that can be waiting. */
+            explicit
+            InputDispatchQueue(const size_t capacity);
+
+            /*! @brief The destructor. */
+            virtual
+            ~InputDispatchQueue(void);
+
+            /*! @brief Stop accepting messages and release the dispatch thread once the queue is
+             empty. */
+            void
+            close(void);
+
+            /*! @brief Return the number of messages waiting to be dispatched.
+             @return The number of messages waiting to be dispatched. */
+            size_t
+            depth(void)
+            const;
+
+            /*! @brief Read a message from a connection into the next free slot.
+             @param[in] connection The input stream that is to be read from.
+             @param[in] senderChannel The name of the channel used to send the message.
+             @param[in] numBytes The number of bytes available on the connection.
+             @param[in] completion The semaphore to signal when the message has been processed,
+             or @c NULL if the sender is not waiting.
+             @param[in] result Where to put the result of processing the message, or @c NULL if
+             the sender is not waiting.
+             @return @c true if the message was added to the queue and @c false if the queue has
+             been closed. */
+            bool
+            put(yarp::os::ConnectionReader & connection,
+                const YarpString &           senderChannel,
+                const size_t                 numBytes,
+                yarp::os::Semaphore *        completion,
+                bool *                       result);
+
+            /*! @brief Return a processed slot to the queue.
+             @param[in] aSlot The slot that was returned by take(). */
+            void
+            release(Slot & aSlot);
+
+            /*! @brief Wait for the next message.
+             @return The slot holding the next message or @c NULL if the queue has been closed and
+             is empty. */
+            Slot *
+            take(void);
+
+        protected :
+
+        private :
+
+            /*! @brief The copy constructor.
+             @param[in] other The object to be copied. */
+            InputDispatchQueue(const InputDispatchQueue & other);
+
+            /*! @brief The assignment operator.
+             @param[in] other The object to be copied.
+             @return The updated object. */
+            InputDispatchQueue &
+            operator =(const InputDispatchQueue & other);
+
+        public :
+
+        protected :
+
+        private :
+
+            /*! @brief The slots in the ring. */
+            Slot * _slots;
+
+            /*! @brief The number of slots in the ring. */
+            size_t _capacity;
+
+            /*! @brief The position of the next message to be taken. */
+            std::atomic<size_t> _head;
+
+            /*! @brief The position of the next slot to be filled. */
+            std::atomic<size_t> _tail;
+
+            /*! @brief The number of slots that can be filled. */
+            yarp::os::Semaphore _freeSlots;
+
+            /*! @brief The number of slots that have been claimed for messages. */
+            yarp::os::Semaphore _usedSlots;
+
+            /*! @brief The lock that keeps messages from being added while the queue is being
+             closed. */
+            yarp::os::Mutex _closeLock;
+
+            /*! @brief @c true if the queue is no longer accepting messages. */
+            std::atomic<bool> _closed;
+
+# if defined(__APPLE__)
+#  pragma clang diagnostic push
+#  pragma clang diagnostic ignored "-Wunused-private-field"
+# endif // defined(__APPLE__)
+            /*! @brief Filler to pad to alignment boundary */
+            char _filler[7];
+# if defined(__APPLE__)
+#  pragma clang diagnostic pop
+# endif // defined(__APPLE__)
+
+        }; // InputDispatchQueue
+
+    } // Common
+
+} // MplusM
+
+#endif // ! defined(MpMInputDispatchQueue_HPP_)
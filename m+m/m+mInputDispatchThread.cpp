@@ -0,0 +1,189 @@
+//--------------------------------------------------------------------------------------------------
+//
+//  File:       m+m/m+mInputDispatchThread.cpp
+//
+//  Project:    m+m
+//
+//  Contains:   The class definition for a thread that dispatches queued messages to an input
+//              handler.
+//
+//  Written by: Norman Jaffe
+//
+//  Copyright:  (c) 2026 by OpenDragon.
+//
+//              All rights reserved. Redistribution and use in source and binary forms, with or
+//              without modification, are permitted provided that the following conditions are met:
+//                * Redistributions of source code must retain the above copyright notice, this list
+//                  of conditions and the following disclaimer.
+//                * Redistributions in binary form must reproduce the above copyright notice, this
+//                  list of conditions and the following disclaimer in the documentation and / or
+//                  other materials provided with the distribution.
+//                * Neither the name of the copyright holders nor the names of its contributors may
+//                  be used to endorse or promote products derived from this software without
+//                  specific prior written permission.
+//
+//              THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//              EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//              OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//              SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//              INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//              TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//              BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//              CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//              ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//              DAMAGE.
+//
+//  Created:    2026-10-17
+//
+//--------------------------------------------------------------------------------------------------
+
+
+#include "m+mInputDispatchThread.hpp"
+
+#include <m+m/m+mBaseInputHandler.hpp>
+
+//#include <odlEnable.h>
+#include <odlInclude.h>
+
+#if defined(__APPLE__)
+# pragma clang diagnostic push
+# pragma clang diagnostic ignored "-Wunknown-pragmas"
+# pragma clang diagnostic ignored "-Wdocumentation-unknown-command"
+#endif // defined(__APPLE__)
+/*! @file
+ @brief The class definition for a thread that dispatches queued messages to an input handler. */
+#if defined(__APPLE__)
+# pragma clang diagnostic pop
+#endif // defined(__APPLE__)
+
+#if defined(__APPLE__)
+# pragma mark Namespace references
+#endif // defined(__APPLE__)
+
+using namespace MplusM;
+using namespace MplusM::Common;
+
+#if defined(__APPLE__)
+# pragma mark Private structures, constants and variables
+#endif // defined(__APPLE__)
+
+/*! @brief The time, in seconds, between checks for a stopped thread while waiting for a reply. */
+static const double kReplyPollInterval = 0.1;
+
+#if defined(__APPLE__)
+# pragma mark Global constants and variables
+#endif // defined(__APPLE__)
+
+#if defined(__APPLE__)
+# pragma mark Local functions
+#endif // defined(__APPLE__)
+
+#if defined(__APPLE__)
+# pragma mark Class methods
+#endif // defined(__APPLE__)
+
+#if defined(__APPLE__)
+# pragma mark Constructors and Destructors
+#endif // defined(__APPLE__)
+
+InputDispatchThread::InputDispatchThread(BaseInputHandler & handler,
+                                         const size_t       queueSize) :
+    inherited(), _handler(handler), _queue(queueSize)
+{
+    ODL_ENTER(); //####
+    ODL_P1("handler = ", &handler); //####
+    ODL_I1("queueSize = ", queueSize); //####
+    ODL_EXIT_P(this); //####
+} // InputDispatchThread::InputDispatchThread
+
+InputDispatchThread::~InputDispatchThread(void)
+{
+    ODL_OBJENTER(); //####
+    ODL_OBJEXIT(); //####
+} // InputDispatchThread::~InputDispatchThread
+
+#if defined(__APPLE__)
+# pragma mark Actions and Accessors
+#endif // defined(__APPLE__)
+
+bool
+InputDispatchThread::dispatchInput(yarp::os::ConnectionReader & connection,
+                                   const YarpString &           senderChannel,
+                                   const size_t                 numBytes)
+{
+    ODL_OBJENTER(); //####
+    ODL_P1("connection = ", &connection); //####
+    ODL_S1s("senderChannel = ", senderChannel); //####
+    ODL_I1("numBytes = ", numBytes); //####
+    bool result;
+
+    if (connection.getWriter())
+    {
+        bool                handled = false;
+        yarp::os::Semaphore completion(0);
+
+        result = _queue.put(connection, senderChannel, numBytes, &completion, &handled);
+        if (result)
+        {
+            for ( ; ! completion.waitWithTimeout(kReplyPollInterval); )
+            {
+                if (! isRunning())
+                {
+                    ODL_LOG("! (isRunning())"); //####
+                    break;
+                }
+            }
+            result = handled;
+        }
+    }
+    else
+    {
+        result = _queue.put(connection, senderChannel, numBytes, NULL, NULL);
+    }
+    ODL_OBJEXIT_B(result); //####
+    return result;
+} // InputDispatchThread::dispatchInput
+
+void
+InputDispatchThread::onStop(void)
+{
+    ODL_OBJENTER(); //####
+    _queue.close();
+    ODL_OBJEXIT(); //####
+} // InputDispatchThread::onStop
+
+void
+InputDispatchThread::run(void)
+{
+    ODL_OBJENTER(); //####
+    for (InputDispatchQueue::Slot * aSlot = _queue.take(); aSlot; aSlot = _queue.take())
+    {
+        bool   handled = false;
+        double waitTime = yarp::os::Time::now() - aSlot->_queuedTime;
+
+        _handler.updateDispatchCounters(_queue.depth(), static_cast<int64_t>(waitTime * 1e6));
+        if (aSlot->_valid)
+        {
+            try
+            {
+                handled = _handler.deliverInput(aSlot->_message, aSlot->_senderChannel,
+                                                aSlot->_replyMechanism, aSlot->_numBytes);
+            }
+            catch (...)
+            {
+                ODL_LOG("Exception caught"); //####
+            }
+        }
+        if (aSlot->_completion)
+        {
+            *aSlot->_result = handled;
+            aSlot->_completion->post();
+        }
+        _queue.release(*aSlot);
+    }
+    ODL_OBJEXIT(); //####
+} // InputDispatchThread::run
+
+#if defined(__APPLE__)
+# pragma mark Global functions
+#endif // defined(__APPLE__)
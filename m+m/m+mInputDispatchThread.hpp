@@ -0,0 +1,146 @@
+//--------------------------------------------------------------------------------------------------
+//
+//  File:       m+m/m+mInputDispatchThread.hpp
+//
+//  Project:    m+m
+//
+//  Contains:   The class declaration for a thread that dispatches queued messages to an input
+//              handler.
+//
+//  Written by: Norman Jaffe
+//
+//  Copyright:  (c) 2026 by OpenDragon.
+//
+//              All rights reserved. Redistribution and use in source and binary forms, with or
+//              without modification, are permitted provided that the following conditions are met:
+//                * Redistributions of source code must retain the above copyright notice, this list
+//                  of conditions and the following disclaimer.
+//                * Redistributions in binary form must reproduce the above copyright notice, this
+//                  list of conditions and the following disclaimer in the documentation and / or
+//                  other materials provided with the distribution.
+//                * Neither the name of the copyright holders nor the names of its contributors may
+//                  be used to endorse or promote products derived from this software without
+//                  specific prior written permission.
+//
+//              THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//              EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//              OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//              SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//              INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//              TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//              BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//              CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//              ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//              DAMAGE.
+//
+//  Created:    2026-10-17
+//
+//--------------------------------------------------------------------------------------------------
+
+
+#if (! defined(MpMInputDispatchThread_HPP_))
+# define MpMInputDispatchThread_HPP_ /* Header guard */
+
+# include <m+m/m+mBaseThread.hpp>
+# include <m+m/m+mInputDispatchQueue.hpp>
+
+# if defined(__APPLE__)
+#  pragma clang diagnostic push
+#  pragma clang diagnostic ignored "-Wunknown-pragmas"
+#  pragma clang diagnostic ignored "-Wdocumentation-unknown-command"
+# endif // defined(__APPLE__)
+/*! @file
+ @brief The class declaration for a thread that dispatches queued messages to an input handler. */
+# if defined(__APPLE__)
+#  pragma clang diagnostic pop
+# endif // defined(__APPLE__)
+
+namespace MplusM
+{
+    namespace Common
+    {
+        class BaseInputHandler;
+
+        /*! @brief A thread that takes received messages from its queue and passes them to an input
+         handler.
+
+         Each sender is always assigned to the same thread, so messages from one sender are
+         processed in the order that they were received. */
+        class InputDispatchThread : public BaseThread
+        {
+        public :
+
+        protected :
+
+        private :
+
+            /*! @brief The class that this class is derived from. */
+            typedef BaseThread inherited;
+
+        public :
+
+            /*! @brief The constructor.
+             @param[in] handler The input handler that will process the messages.
+             @param[in] queueSize The maximum number of messages that can be waiting. */
+            InputDispatchThread(BaseInputHandler & handler,
+                                const size_t       queueSize);
+
+            /*! @brief The destructor. */
+            virtual
+            ~InputDispatchThread(void);
+
+            /*! @brief Queue a message for processing.
+
+             If the sender expects a reply, the calling thread waits until the message has been
+             processed, since the reply must be written before the connection is released.
+             @param[in] connection The input stream that is to be read from.
+             @param[in] senderChannel The name of the channel used to send the message.
+             @param[in] numBytes The number of bytes available on the connection.
+             @return @c true if the message was queued and, if a reply was expected, successfully
+             processed, and @c false otherwise. */
+            bool
+            dispatchInput(yarp::os::ConnectionReader & connection,
+                          const YarpString &           senderChannel,
+                          const size_t                 numBytes);
+
+        protected :
+
+        private :
+
+            /*! @brief The copy constructor.
+             @param[in] other The object to be copied. */
+            InputDispatchThread(const InputDispatchThread & other);
+
+            /*! @brief Stop accepting new messages. */
+            virtual void
+            onStop(void);
+
+            /*! @brief The assignment operator.
+             @param[in] other The object to be copied.
+             @return The updated object. */
+            InputDispatchThread &
+            operator =(const InputDispatchThread & other);
+
+            /*! @brief The thread main body. */
+            virtual void
+            run(void);
+
+        public :
+
+        protected :
+
+        private :
+
+            /*! @brief The input handler that processes the messages. */
+            BaseInputHandler & _handler;
+
+            /*! @brief The messages waiting to be processed. */
+            InputDispatchQueue _queue;
+
+        }; // InputDispatchThread
+
+    } // Common
+
+} // MplusM
+
+#endif // ! defined(MpMInputDispatchThread_HPP_)
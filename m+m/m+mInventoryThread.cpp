@@ -0,0 +1,199 @@
+//--------------------------------------------------------------------------------------------------
+//
+//  File:       m+m/m+mInventoryThread.cpp
+//
+//  Project:    m+m
+//
+//  Contains:   The class definition for a thread that gathers inventory information.
+//
+//  Written by: Norman Jaffe
+//
+//  Copyright:  (c) 2026 by OpenDragon.
+//
+//
+//              All rights reserved. Redistribution and use in source and binary forms, with or
+//              without modification, are permitted provided that the following conditions are met:
+//                * Redistributions of source code must retain the above copyright notice, this list
+//                  of conditions and the following disclaimer.
+//                * Redistributions in binary form must reproduce the above copyright notice, this
+//                  list of conditions and the following disclaimer in the documentation and / or
+//                  other materials provided with the distribution.
+//                * Neither the name of the copyright holders nor the names of its contributors may
+//                  be used to endorse or promote products derived from this software without
+//                  specific prior written permission.
+//
+//              THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//              EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//              OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//              SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//              INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//              TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//              BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//              CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//              ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//              DAMAGE.
+//
+//  Created:    2026-10-17
+//
+//--------------------------------------------------------------------------------------------------
+
+#include "m+mInventoryThread.hpp"
+
+//#include <odlEnable.h>
+#include <odlInclude.h>
+
+#if defined(__APPLE__)
+# pragma clang diagnostic push
+# pragma clang diagnostic ignored "-Wunknown-pragmas"
+# pragma clang diagnostic ignored "-Wdocumentation-unknown-command"
+#endif // defined(__APPLE__)
+/*! @file
+ @brief The class definition for a thread that gathers inventory information. */
+#if defined(__APPLE__)
+# pragma clang diagnostic pop
+#endif // defined(__APPLE__)
+
+#if defined(__APPLE__)
+# pragma mark Namespace references
+#endif // defined(__APPLE__)
+
+using namespace MplusM;
+using namespace MplusM::Common;
+using namespace MplusM::Utilities;
+
+#if defined(__APPLE__)
+# pragma mark Private structures, constants and variables
+#endif // defined(__APPLE__)
+
+/*! @brief The data used to limit the time spent examining a single port. */
+struct EntryCheck
+{
+    /*! @brief The work shared with the other threads gathering the inventory. */
+    InventoryWork * _work;
+
+    /*! @brief The time at which the examination of the port is abandoned. */
+    double _deadline;
+
+    /*! @brief @c true if the examination of the port was abandoned and @c false otherwise. */
+    bool _expired;
+
+}; // EntryCheck
+
+#if defined(__APPLE__)
+# pragma mark Global constants and variables
+#endif // defined(__APPLE__)
+
+#if defined(__APPLE__)
+# pragma mark Local functions
+#endif // defined(__APPLE__)
+
+/*! @brief Check if the examination of a port should be abandoned.
+ @param[in] stuff The private data for the function.
+ @return @c true if the examination should be abandoned and @c false otherwise. */
+static bool
+checkEntry(void * stuff)
+{
+    ODL_ENTER(); //####
+    ODL_P1("stuff = ", stuff); //####
+    EntryCheck * check = reinterpret_cast<EntryCheck *>(stuff);
+    bool         result = (check->_deadline <= yarp::os::Time::now());
+
+    if (result)
+    {
+        check->_expired = true;
+    }
+    else if (check->_work->_checker)
+    {
+        result = check->_work->_checker(check->_work->_checkStuff);
+    }
+    ODL_EXIT_B(result); //####
+    return result;
+} // checkEntry
+
+#if defined(__APPLE__)
+# pragma mark Class methods
+#endif // defined(__APPLE__)
+
+#if defined(__APPLE__)
+# pragma mark Constructors and Destructors
+#endif // defined(__APPLE__)
+
+InventoryThread::InventoryThread(InventoryWork & work) :
+    inherited(), _work(work)
+{
+    ODL_ENTER(); //####
+    ODL_P1("work = ", &work); //####
+    ODL_EXIT_P(this); //####
+} // InventoryThread::InventoryThread
+
+InventoryThread::~InventoryThread(void)
+{
+    ODL_OBJENTER(); //####
+    ODL_OBJEXIT(); //####
+} // InventoryThread::~InventoryThread
+
+#if defined(__APPLE__)
+# pragma mark Actions and Accessors
+#endif // defined(__APPLE__)
+
+bool
+InventoryThread::claimEntry(size_t & index)
+{
+    ODL_OBJENTER(); //####
+    ODL_P1("index = ", &index); //####
+    bool   result;
+    size_t count = (_work._services ? _work._services->size() : _work._ports->size());
+
+    _work._lock.lock();
+    result = (count > _work._nextEntry);
+    if (result)
+    {
+        index = _work._nextEntry++;
+        ODL_I1("index <- ", index); //####
+    }
+    _work._lock.unlock();
+    ODL_OBJEXIT_B(result); //####
+    return result;
+} // InventoryThread::claimEntry
+
+void
+InventoryThread::run(void)
+{
+    ODL_OBJENTER(); //####
+    size_t index;
+
+    for ( ; (! isStopping()) && claimEntry(index); )
+    {
+        if (_work._checker && _work._checker(_work._checkStuff))
+        {
+            ODL_LOG("(_work._checker && _work._checker(_work._checkStuff))"); //####
+            break;
+        }
+
+        if (_work._services)
+        {
+            ServiceInventoryEntry & entry = (*_work._services)[index];
+
+            entry._valid = GetNameAndDescriptionForService(entry._channelName, entry._descriptor,
+                                                           _work._timeToWait, _work._checker,
+                                                           _work._checkStuff);
+        }
+        else
+        {
+            PortInventoryEntry & entry = (*_work._ports)[index];
+            EntryCheck           check;
+
+            check._work = &_work;
+            check._deadline = yarp::os::Time::now() + _work._timeToWait;
+            check._expired = false;
+            GatherPortConnections(entry._port._portName, entry._inputs, entry._outputs,
+                                  kInputAndOutputBoth, _work._quiet, checkEntry, &check);
+            entry._valid = (! check._expired);
+        }
+    }
+    ODL_OBJEXIT(); //####
+} // InventoryThread::run
+
+#if defined(__APPLE__)
+# pragma mark Global functions
+#endif // defined(__APPLE__)
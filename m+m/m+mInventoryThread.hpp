@@ -0,0 +1,158 @@
+//--------------------------------------------------------------------------------------------------
+//
+//  File:       m+m/m+mInventoryThread.hpp
+//
+//  Project:    m+m
+//
+//  Contains:   The class declaration for a thread that gathers inventory information.
+//
+//  Written by: Norman Jaffe
+//
+//  Copyright:  (c) 2026 by OpenDragon.
+//
+//
+//              All rights reserved. Redistribution and use in source and binary forms, with or
+//              without modification, are permitted provided that the following conditions are met:
+//                * Redistributions of source code must retain the above copyright notice, this list
+//                  of conditions and the following disclaimer.
+//                * Redistributions in binary form must reproduce the above copyright notice, this
+//                  list of conditions and the following disclaimer in the documentation and / or
+//                  other materials provided with the distribution.
+//                * Neither the name of the copyright holders nor the names of its contributors may
+//                  be used to endorse or promote products derived from this software without
+//                  specific prior written permission.
+//
+//              THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//              EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//              OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//              SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//              INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//              TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//              BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//              CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//              ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//              DAMAGE.
+//
+//  Created:    2026-10-17
+//
+//--------------------------------------------------------------------------------------------------
+
+#if (! defined(MpMInventoryThread_HPP_))
+# define MpMInventoryThread_HPP_ /* Header guard */
+
+# include <m+m/m+mBaseThread.hpp>
+# include <m+m/m+mUtilities.hpp>
+
+# if defined(__APPLE__)
+#  pragma clang diagnostic push
+#  pragma clang diagnostic ignored "-Wunknown-pragmas"
+#  pragma clang diagnostic ignored "-Wdocumentation-unknown-command"
+# endif // defined(__APPLE__)
+/*! @file
+ @brief The class declaration for a thread that gathers inventory information. */
+# if defined(__APPLE__)
+#  pragma clang diagnostic pop
+# endif // defined(__APPLE__)
+
+namespace MplusM
+{
+    namespace Utilities
+    {
+        /*! @brief The work shared by a set of threads that gather an inventory.
+
+         Exactly one of the service or port result sets is non-@c NULL. The result sets are sized
+         before the threads start, and each thread only writes to the entries that it claims. */
+        struct InventoryWork
+        {
+            /*! @brief The contention lock used to claim entries. */
+            yarp::os::Mutex _lock;
+
+            /*! @brief The service details being gathered, or @c NULL if ports are being
+             examined. */
+            ServiceInventory * _services;
+
+            /*! @brief The port connections being gathered, or @c NULL if services are being
+             examined. */
+            PortInventory * _ports;
+
+            /*! @brief A function that provides for early exit from loops. */
+            Common::CheckFunction _checker;
+
+            /*! @brief The private data for the early exit function. */
+            void * _checkStuff;
+
+            /*! @brief The number of seconds allowed for examining each entry. */
+            double _timeToWait;
+
+            /*! @brief The index of the next entry to be examined. */
+            size_t _nextEntry;
+
+            /*! @brief @c true if status output is to be suppressed and @c false otherwise. */
+            bool _quiet;
+
+        }; // InventoryWork
+
+        /*! @brief A thread that examines services or ports for an inventory, until there are no
+         more to examine. */
+        class InventoryThread : public Common::BaseThread
+        {
+        public :
+
+        protected :
+
+        private :
+
+            /*! @brief The class that this class is derived from. */
+            typedef BaseThread inherited;
+
+        public :
+
+            /*! @brief The constructor.
+             @param[in] work The work shared with the other threads gathering the inventory. */
+            explicit
+            InventoryThread(InventoryWork & work);
+
+            /*! @brief The destructor. */
+            virtual
+            ~InventoryThread(void);
+
+        protected :
+
+        private :
+
+            /*! @brief Claim the next entry to be examined.
+             @param[out] index The index of the claimed entry.
+             @return @c true if an entry was claimed and @c false if there are no more entries. */
+            bool
+            claimEntry(size_t & index);
+
+            /*! @brief The copy constructor.
+             @param[in] other The object to be copied. */
+            InventoryThread(const InventoryThread & other);
+
+            /*! @brief The assignment operator.
+             @param[in] other The object to be copied.
+             @return The updated object. */
+            InventoryThread &
+            operator =(const InventoryThread & other);
+
+            /*! @brief The thread main body. */
+            virtual void
+            run(void);
+
+        public :
+
+        protected :
+
+        private :
+
+            /*! @brief The work shared with the other threads gathering the inventory. */
+            InventoryWork & _work;
+
+        }; // InventoryThread
+
+    } // Utilities
+
+} // MplusM
+
+#endif // ! defined(MpMInventoryThread_HPP_)
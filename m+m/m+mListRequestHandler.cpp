@@ -38,6 +38,7 @@
 
 #include "m+mListRequestHandler.hpp"
 
+#include <m+m/m+mBaseService.hpp>
 #include <m+m/m+mRequestMap.hpp>
 #include <m+m/m+mRequests.hpp>
 
@@ -153,7 +154,8 @@ bool
 ListRequestHandler::processRequest(const YarpString &           request,
                                    const yarp::os::Bottle &     restOfInput,
                                    const YarpString &           senderChannel,
-                                   yarp::os::ConnectionWriter * replyMechanism)
+                                   yarp::os::ConnectionWriter * replyMechanism,
+                                   yarp::os::Bottle &           response)
 {
 #if (! defined(ODL_ENABLE_LOGGING_))
 # if MAC_OR_LINUX_
@@ -163,21 +165,26 @@ ListRequestHandler::processRequest(const YarpString &           request,
     ODL_OBJENTER(); //####
     ODL_S3s("request = ", request, "restOfInput = ", restOfInput.toString(), //####
             "senderChannel = ", senderChannel); //####
-    ODL_P1("replyMechanism = ", replyMechanism); //####
+    ODL_P2("replyMechanism = ", replyMechanism, "response = ", &response); //####
     bool result = true;
 
     try
     {
-        _response.clear();
-        if (_owner)
-        {
-            _owner->fillInListReply(_response);
-        }
-        else
+        size_t generation;
+
+        if (! _service.sendCachedReply(MpM_LIST_REQUEST_, replyMechanism, generation))
         {
-            ODL_LOG("! (_owner)"); //####
+            if (_owner)
+            {
+                _owner->fillInListReply(response);
+                _service.cacheReply(MpM_LIST_REQUEST_, response, generation);
+            }
+            else
+            {
+                ODL_LOG("! (_owner)"); //####
+            }
+            sendResponse(response, replyMechanism);
         }
-        sendResponse(replyMechanism);
     }
     catch (...)
     {
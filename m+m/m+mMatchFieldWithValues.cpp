@@ -296,6 +296,100 @@ const
     return result;
 } // MatchFieldWithValues::asString
 
+YarpString
+MatchFieldWithValues::fieldName(void)
+const
+{
+    return _fieldName->asString();
+} // MatchFieldWithValues::fieldName
+
+bool
+MatchFieldWithValues::getLiteralValues(YarpStringVector & values)
+const
+{
+    ODL_OBJENTER(); //####
+    ODL_P1("values = ", &values); //####
+    bool result = true;
+
+    try
+    {
+        values.clear();
+        if (_singleValue)
+        {
+            result = (! _singleValue->hasWildcardCharacters());
+            if (result)
+            {
+                values.push_back(_singleValue->asLiteral());
+            }
+        }
+        else if (_values)
+        {
+            for (int ii = 0, maxI = _values->count(); result && (ii < maxI); ++ii)
+            {
+                const MatchValue * element = _values->element(ii);
+
+                result = (! element->hasWildcardCharacters());
+                if (result)
+                {
+                    values.push_back(element->asLiteral());
+                }
+            }
+        }
+    }
+    catch (...)
+    {
+        ODL_LOG("Exception caught"); //####
+        throw;
+    }
+    ODL_OBJEXIT_B(result); //####
+    return result;
+} // MatchFieldWithValues::getLiteralValues
+
+bool
+MatchFieldWithValues::isNegated(void)
+const
+{
+    return _fieldName->isNegated();
+} // MatchFieldWithValues::isNegated
+
+bool
+MatchFieldWithValues::matches(const YarpString & candidate,
+                              const bool         ignoreCase)
+const
+{
+    ODL_OBJENTER(); //####
+    ODL_S1s("candidate = ", candidate); //####
+    ODL_B1("ignoreCase = ", ignoreCase); //####
+    bool result = false;
+
+    try
+    {
+        // A negated field is satisfied by a value that matches none of the field values.
+        if (_singleValue)
+        {
+            result = _singleValue->matches(candidate, ignoreCase);
+        }
+        else if (_values)
+        {
+            for (int ii = 0, maxI = _values->count(); (! result) && (ii < maxI); ++ii)
+            {
+                result = _values->element(ii)->matches(candidate, ignoreCase);
+            }
+        }
+        if (_fieldName->isNegated())
+        {
+            result = (! result);
+        }
+    }
+    catch (...)
+    {
+        ODL_LOG("Exception caught"); //####
+        throw;
+    }
+    ODL_OBJEXIT_B(result); //####
+    return result;
+} // MatchFieldWithValues::matches
+
 #if defined(__APPLE__)
 # pragma mark Global functions
 #endif // defined(__APPLE__)
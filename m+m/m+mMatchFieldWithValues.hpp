@@ -91,6 +91,38 @@ namespace MplusM
             asString(void)
             const;
 
+            /*! @brief Return the name of the field.
+             @return The name of the field, in lower-case if it was checked by a validator. */
+            YarpString
+            fieldName(void)
+            const;
+
+            /*! @brief Collect the values for the field, if none of them have wildcard characters.
+             @param[out] values The values for the field, with any escape characters removed.
+             @return @c true if none of the values have wildcard characters and @c false
+             otherwise. */
+            bool
+            getLiteralValues(YarpStringVector & values)
+            const;
+
+            /*! @brief Return @c true if the field is negated.
+             @return @c true if the field name was followed by the negation character and @c false
+             otherwise. */
+            bool
+            isNegated(void)
+            const;
+
+            /*! @brief Check if a field value satisfies the field, following the rules of the SQL
+             that is generated for the field.
+             @param[in] candidate The field value to be checked.
+             @param[in] ignoreCase @c true if the field is compared without regard to case and
+             @c false otherwise.
+             @return @c true if the value satisfies the field and @c false otherwise. */
+            bool
+            matches(const YarpString & candidate,
+                    const bool         ignoreCase)
+            const;
+
             /*! @brief Create a pattern matcher if the next substring would be a valid field with
              value(s).
              @param[in] inString The string being scanned.
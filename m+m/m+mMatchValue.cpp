@@ -94,6 +94,18 @@ static const char kUnderscore = '_';
 # pragma mark Local functions
 #endif // defined(__APPLE__)
 
+/*! @brief Compare two characters, ignoring case.
+ @param[in] left The first character.
+ @param[in] right The second character.
+ @return @c true if the characters are the same, ignoring case, and @c false otherwise. */
+static inline bool
+sameCharacterIgnoringCase(const char left,
+                          const char right)
+{
+    return (tolower(static_cast<unsigned char>(left)) ==
+            tolower(static_cast<unsigned char>(right)));
+} // sameCharacterIgnoringCase
+
 #if defined(__APPLE__)
 # pragma mark Class methods
 #endif // defined(__APPLE__)
@@ -306,6 +318,41 @@ MatchValue::~MatchValue(void)
 # pragma mark Actions and Accessors
 #endif // defined(__APPLE__)
 
+YarpString
+MatchValue::asLiteral(void)
+const
+{
+    ODL_OBJENTER(); //####
+    YarpString converted;
+
+    try
+    {
+        bool escapeNextChar = false;
+
+        for (size_t ii = 0, len = _matchingString.length(); ii < len; ++ii)
+        {
+            char walker = _matchingString[ii];
+
+            if ((! escapeNextChar) && (kEscapeChar == walker))
+            {
+                escapeNextChar = true;
+            }
+            else
+            {
+                escapeNextChar = false;
+                converted += walker;
+            }
+        }
+    }
+    catch (...)
+    {
+        ODL_LOG("Exception caught"); //####
+        throw;
+    }
+    ODL_OBJEXIT_S(converted.c_str()); //####
+    return converted;
+} // MatchValue::asLiteral
+
 YarpString
 MatchValue::asSQLString(void)
 const
@@ -499,6 +546,115 @@ const
     return converted;
 } // MatchValue::asString
 
+bool
+MatchValue::matches(const YarpString & candidate,
+                    const bool         ignoreCase)
+const
+{
+    ODL_OBJENTER(); //####
+    ODL_S1s("candidate = ", candidate); //####
+    ODL_B1("ignoreCase = ", ignoreCase); //####
+    bool result = false;
+
+    try
+    {
+        if (_hasWildcards)
+        {
+            // Match in the same manner as 'LIKE', which ignores case; after a mismatch, retry from
+            // one character beyond the position where the most recent asterisk began matching.
+            bool   sawAsterisk = false;
+            bool   stillMatching = true;
+            size_t candidateLength = candidate.length();
+            size_t patternLength = _matchingString.length();
+            size_t candidatePos = 0;
+            size_t patternPos = 0;
+            size_t retryCandidatePos = 0;
+            size_t retryPatternPos = 0;
+
+            while (stillMatching && (candidatePos < candidateLength))
+            {
+                bool advanced = false;
+
+                if (patternPos < patternLength)
+                {
+                    bool   isLiteral = false;
+                    char   patternChar = _matchingString[patternPos];
+                    size_t nextPatternPos = patternPos + 1;
+
+                    if ((kEscapeChar == patternChar) && (nextPatternPos < patternLength))
+                    {
+                        isLiteral = true;
+                        patternChar = _matchingString[nextPatternPos++];
+                    }
+                    if ((! isLiteral) && (kAsterisk == patternChar))
+                    {
+                        sawAsterisk = true;
+                        patternPos = retryPatternPos = nextPatternPos;
+                        retryCandidatePos = candidatePos;
+                        advanced = true;
+                    }
+                    else if (((! isLiteral) && (kQuestionMark == patternChar)) ||
+                             sameCharacterIgnoringCase(patternChar, candidate[candidatePos]))
+                    {
+                        patternPos = nextPatternPos;
+                        ++candidatePos;
+                        advanced = true;
+                    }
+                }
+                if (! advanced)
+                {
+                    if (sawAsterisk)
+                    {
+                        patternPos = retryPatternPos;
+                        candidatePos = ++retryCandidatePos;
+                    }
+                    else
+                    {
+                        stillMatching = false;
+                    }
+                }
+            }
+            if (stillMatching)
+            {
+                // Only asterisks may remain in the pattern.
+                while ((patternPos < patternLength) && (kAsterisk == _matchingString[patternPos]))
+                {
+                    ++patternPos;
+                }
+                result = (patternPos == patternLength);
+            }
+        }
+        else
+        {
+            YarpString literal(asLiteral());
+            size_t     len = literal.length();
+
+            if (len == candidate.length())
+            {
+                if (ignoreCase)
+                {
+                    result = true;
+                    for (size_t ii = 0; result && (ii < len); ++ii)
+                    {
+                        result = sameCharacterIgnoringCase(literal[ii], candidate[ii]);
+                    }
+                }
+                else
+                {
+                    result = (literal == candidate);
+                }
+            }
+        }
+    }
+    catch (...)
+    {
+        ODL_LOG("Exception caught"); //####
+        throw;
+    }
+    ODL_OBJEXIT_B(result); //####
+    return result;
+} // MatchValue::matches
+
 #if defined(__APPLE__)
 # pragma mark Global functions
 #endif // defined(__APPLE__)
@@ -74,6 +74,12 @@ namespace MplusM
             virtual
             ~MatchValue(void);
 
+            /*! @brief Return the value with any escape characters removed.
+             @return The value as it is compared when there are no wildcard characters. */
+            YarpString
+            asLiteral(void)
+            const;
+
             /*! @brief Generate a proper SQL string value corresponding to this match value.
              @return A string representing the value as a string suitable for use with SQL. */
             YarpString
@@ -109,6 +115,17 @@ namespace MplusM
                 return _hasWildcards;
             } // hasWildcardCharacters
 
+            /*! @brief Check if a string is matched by the value, following the rules of the SQL
+             that is generated for the value.
+             @param[in] candidate The string to be checked.
+             @param[in] ignoreCase @c true if a comparison without wildcard characters ignores case
+             and @c false otherwise; a comparison with wildcard characters always ignores case.
+             @return @c true if the string is matched by the value and @c false otherwise. */
+            bool
+            matches(const YarpString & candidate,
+                    const bool         ignoreCase)
+            const;
+
         protected :
 
         private :
@@ -143,7 +143,8 @@ bool
 MetricsStateRequestHandler::processRequest(const YarpString &           request,
                                            const yarp::os::Bottle &     restOfInput,
                                            const YarpString &           senderChannel,
-                                           yarp::os::ConnectionWriter * replyMechanism)
+                                           yarp::os::ConnectionWriter * replyMechanism,
+                                           yarp::os::Bottle &           response)
 {
 #if (! defined(ODL_ENABLE_LOGGING_))
 # if MAC_OR_LINUX_
@@ -153,14 +154,13 @@ MetricsStateRequestHandler::processRequest(const YarpString &           request,
     ODL_OBJENTER(); //####
     ODL_S3s("request = ", request, "restOfInput = ", restOfInput.toString(), //####
             "senderChannel = ", senderChannel); //####
-    ODL_P1("replyMechanism = ", replyMechanism); //####
+    ODL_P2("replyMechanism = ", replyMechanism, "response = ", &response); //####
     bool result = true;
 
     try
     {
-        _response.clear();
-        _response.addInt(_service.metricsAreEnabled() ? 1 : 0);
-        sendResponse(replyMechanism);
+        response.addInt(_service.metricsAreEnabled() ? 1 : 0);
+        sendResponse(response, replyMechanism);
     }
     catch (...)
     {
@@ -45,27 +45,6 @@
 //#include <odlEnable.h>
 #include <odlInclude.h>
 
-#if defined(__APPLE__)
-# pragma clang diagnostic push
-# pragma clang diagnostic ignored "-Wunknown-pragmas"
-# pragma clang diagnostic ignored "-Wconversion"
-# pragma clang diagnostic ignored "-Wdeprecated-declarations"
-# pragma clang diagnostic ignored "-Wdocumentation-unknown-command"
-# pragma clang diagnostic ignored "-Wextern-c-compat"
-# pragma clang diagnostic ignored "-Wsign-conversion"
-#endif // defined(__APPLE__)
-#if (! MAC_OR_LINUX_)
-# pragma warning(push)
-# pragma warning(disable: 4996)
-#endif // ! MAC_OR_LINUX_
-#include <ace/OS.h>
-#if (! MAC_OR_LINUX_)
-# pragma warning(pop)
-#endif // ! MAC_OR_LINUX_
-#if defined(__APPLE__)
-# pragma clang diagnostic pop
-#endif // defined(__APPLE__)
-
 #if defined(__APPLE__)
 # pragma clang diagnostic push
 # pragma clang diagnostic ignored "-Wunknown-pragmas"
@@ -183,7 +162,8 @@ bool
 NameRequestHandler::processRequest(const YarpString &           request,
                                    const yarp::os::Bottle &     restOfInput,
                                    const YarpString &           senderChannel,
-                                   yarp::os::ConnectionWriter * replyMechanism)
+                                   yarp::os::ConnectionWriter * replyMechanism,
+                                   yarp::os::Bottle &           response)
 {
 #if (! defined(ODL_ENABLE_LOGGING_))
 # if MAC_OR_LINUX_
@@ -193,24 +173,19 @@ NameRequestHandler::processRequest(const YarpString &           request,
     ODL_OBJENTER(); //####
     ODL_S3s("request = ", request, "restOfInput = ", restOfInput.toString(), //####
             "senderChannel = ", senderChannel); //####
-    ODL_P1("replyMechanism = ", replyMechanism); //####
+    ODL_P2("replyMechanism = ", replyMechanism, "response = ", &response); //####
     bool result = true;
 
     try
     {
-        char bigPath[PATH_MAX * 2];
-
-        _response.clear();
-        ACE_OS::realpath(_service.launchPath().c_str(), bigPath);
-        ODL_S1("bigPath <- ", bigPath); //####
-        _response.addString(_service.serviceName());
-        _response.addString(_service.description());
-        _response.addString(_service.extraInformation());
-        _response.addString(MapServiceKindToString(_service.kind()));
-        _response.addString(bigPath);
-        _response.addString(_service.requestsDescription());
-        _response.addString(_service.tag());
-        sendResponse(replyMechanism);
+        size_t generation;
+
+        if (! _service.sendCachedReply(MpM_NAME_REQUEST_, replyMechanism, generation))
+        {
+            _service.fillInNameReply(response);
+            _service.cacheReply(MpM_NAME_REQUEST_, response, generation);
+            sendResponse(response, replyMechanism);
+        }
     }
     catch (...)
     {
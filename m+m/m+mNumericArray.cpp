@@ -0,0 +1,341 @@
+//--------------------------------------------------------------------------------------------------
+//
+//  File:       m+m/m+mNumericArray.cpp
+//
+//  Project:    m+m
+//
+//  Contains:   The class definition for a packed array of floating-point values that is sent as a
+//              single block.
+//
+//  Written by: Norman Jaffe
+//
+//  Copyright:  (c) 2026 by OpenDragon.
+//
+//              All rights reserved. Redistribution and use in source and binary forms, with or
+//              without modification, are permitted provided that the following conditions are met:
+//                * Redistributions of source code must retain the above copyright notice, this list
+//                  of conditions and the following disclaimer.
+//                * Redistributions in binary form must reproduce the above copyright notice, this
+//                  list of conditions and the following disclaimer in the documentation and / or
+//                  other materials provided with the distribution.
+//                * Neither the name of the copyright holders nor the names of its contributors may
+//                  be used to endorse or promote products derived from this software without
+//                  specific prior written permission.
+//
+//              THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//              EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//              OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//              SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//              INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//              TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//              BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//              CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//              ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//              DAMAGE.
+//
+//  Created:    2026-10-17
+//
+//--------------------------------------------------------------------------------------------------
+
+
+#include "m+mNumericArray.hpp"
+
+#include <m+m/m+mNumericArrayView.hpp>
+
+//#include <odlEnable.h>
+#include <odlInclude.h>
+
+#if defined(__APPLE__)
+# pragma clang diagnostic push
+# pragma clang diagnostic ignored "-Wunknown-pragmas"
+# pragma clang diagnostic ignored "-Wdocumentation-unknown-command"
+#endif // defined(__APPLE__)
+/*! @file
+ @brief The class definition for a packed array of floating-point values that is sent as a single
+ block. */
+#if defined(__APPLE__)
+# pragma clang diagnostic pop
+#endif // defined(__APPLE__)
+
+#if defined(__APPLE__)
+# pragma mark Namespace references
+#endif // defined(__APPLE__)
+
+using namespace MplusM;
+using namespace MplusM::Common;
+
+#if defined(__APPLE__)
+# pragma mark Private structures, constants and variables
+#endif // defined(__APPLE__)
+
+/*! @brief The bytes that start every packed numeric array. */
+static const char kArrayTag[] = { 'M', 'p', 'M', '#' };
+
+/*! @brief The header byte that marks an array of 32-bit elements. */
+static const char kFloat32Code = 'f';
+
+/*! @brief The header byte that marks an array of 64-bit elements. */
+static const char kFloat64Code = 'd';
+
+/*! @brief The header byte that marks an array whose elements are big-endian. */
+static const char kBigEndianCode = 'B';
+
+/*! @brief The header byte that marks an array whose elements are little-endian. */
+static const char kLittleEndianCode = 'L';
+
+/*! @brief The position of the element type in the header. */
+static const size_t kKindOffset = sizeof(kArrayTag);
+
+/*! @brief The position of the byte order in the header. */
+static const size_t kByteOrderOffset = (kKindOffset + 1);
+
+#if defined(__APPLE__)
+# pragma mark Global constants and variables
+#endif // defined(__APPLE__)
+
+#if defined(__APPLE__)
+# pragma mark Local functions
+#endif // defined(__APPLE__)
+
+/*! @brief Return the number of bytes in an element of an array.
+ @param[in] kind The type of the elements.
+ @return The number of bytes in an element of an array. */
+static size_t
+elementSize(const NumericArrayKind kind)
+{
+    size_t result;
+
+    if (kNumericArrayKindFloat32 == kind)
+    {
+        result = sizeof(float);
+    }
+    else
+    {
+        result = sizeof(double);
+    }
+    return result;
+} // elementSize
+
+/*! @brief Return the header byte for the byte order of this machine.
+ @return The header byte for the byte order of this machine. */
+static char
+localByteOrder(void)
+{
+    const uint16_t probe = 1;
+    char           firstByte;
+
+    memcpy(&firstByte, &probe, sizeof(firstByte));
+    return (firstByte ? kLittleEndianCode : kBigEndianCode);
+} // localByteOrder
+
+#if defined(__APPLE__)
+# pragma mark Class methods
+#endif // defined(__APPLE__)
+
+#if defined(__APPLE__)
+# pragma mark Constructors and Destructors
+#endif // defined(__APPLE__)
+
+NumericArray::NumericArray(const NumericArrayKind kind,
+                           const size_t           reserveCount) :
+    _buffer(), _kind(kind)
+{
+    ODL_ENTER(); //####
+    ODL_I2("kind = ", kind, "reserveCount = ", reserveCount); //####
+    _buffer.reserve(MpM_NUMERICARRAY_HEADER_SIZE_ + (reserveCount * elementSize(kind)));
+    _buffer.resize(MpM_NUMERICARRAY_HEADER_SIZE_, 0);
+    memcpy(&_buffer[0], kArrayTag, sizeof(kArrayTag));
+    _buffer[kKindOffset] = ((kNumericArrayKindFloat32 == kind) ? kFloat32Code : kFloat64Code);
+    _buffer[kByteOrderOffset] = localByteOrder();
+    ODL_EXIT_P(this); //####
+} // NumericArray::NumericArray
+
+NumericArray::~NumericArray(void)
+{
+    ODL_OBJENTER(); //####
+    ODL_OBJEXIT(); //####
+} // NumericArray::~NumericArray
+
+#if defined(__APPLE__)
+# pragma mark Actions and Accessors
+#endif // defined(__APPLE__)
+
+void
+NumericArray::addToBottle(yarp::os::Bottle & aBottle)
+const
+{
+    ODL_OBJENTER(); //####
+    ODL_P1("aBottle = ", &aBottle); //####
+    aBottle.add(asValue());
+    ODL_OBJEXIT(); //####
+} // NumericArray::addToBottle
+
+void
+NumericArray::addToDictionary(yarp::os::Property & aDictionary,
+                              const YarpString &   tag)
+const
+{
+    ODL_OBJENTER(); //####
+    ODL_P1("aDictionary = ", &aDictionary); //####
+    ODL_S1s("tag = ", tag); //####
+    aDictionary.put(tag, asValue());
+    ODL_OBJEXIT(); //####
+} // NumericArray::addToDictionary
+
+void
+NumericArray::addValue(const double value)
+{
+    ODL_OBJENTER(); //####
+    ODL_D1("value = ", value); //####
+    size_t oldSize = _buffer.size();
+
+    if (kNumericArrayKindFloat32 == _kind)
+    {
+        float asFloat = static_cast<float>(value);
+
+        _buffer.resize(oldSize + sizeof(asFloat));
+        memcpy(&_buffer[oldSize], &asFloat, sizeof(asFloat));
+    }
+    else
+    {
+        _buffer.resize(oldSize + sizeof(value));
+        memcpy(&_buffer[oldSize], &value, sizeof(value));
+    }
+    ODL_OBJEXIT(); //####
+} // NumericArray::addValue
+
+yarp::os::Value
+NumericArray::asValue(void)
+const
+{
+    ODL_OBJENTER(); //####
+    // The blob constructor copies the data, so the buffer can be reused afterwards.
+    yarp::os::Value result(const_cast<char *>(&_buffer[0]), static_cast<int>(_buffer.size()));
+
+    ODL_OBJEXIT(); //####
+    return result;
+} // NumericArray::asValue
+
+void
+NumericArray::clear(void)
+{
+    ODL_OBJENTER(); //####
+    _buffer.resize(MpM_NUMERICARRAY_HEADER_SIZE_);
+    ODL_OBJEXIT(); //####
+} // NumericArray::clear
+
+bool
+NumericArray::ConvertToList(const yarp::os::Value & input,
+                            yarp::os::Bottle &      output)
+{
+    ODL_ENTER(); //####
+    ODL_P2("input = ", &input, "output = ", &output); //####
+    NumericArrayView view;
+    bool             result = view.attach(input);
+
+    if (result)
+    {
+        output.clear();
+        for (size_t ii = 0, mm = view.size(); mm > ii; ++ii)
+        {
+            output.addDouble(view[ii]);
+        }
+    }
+    ODL_EXIT_B(result); //####
+    return result;
+} // NumericArray::ConvertToList
+
+size_t
+NumericArray::count(void)
+const
+{
+    ODL_OBJENTER(); //####
+    size_t result = ((_buffer.size() - MpM_NUMERICARRAY_HEADER_SIZE_) / elementSize(_kind));
+
+    ODL_OBJEXIT_I(result); //####
+    return result;
+} // NumericArray::count
+
+bool
+NumericArray::DecodeHeader(const char *       data,
+                           const size_t       length,
+                           NumericArrayKind & kind,
+                           size_t &           count,
+                           bool &             swapped)
+{
+    ODL_ENTER(); //####
+    ODL_P4("data = ", data, "kind = ", &kind, "count = ", &count, "swapped = ", //####
+           &swapped); //####
+    ODL_I1("length = ", length); //####
+    bool result = false;
+
+    if (data && (MpM_NUMERICARRAY_HEADER_SIZE_ <= length) &&
+        (! memcmp(data, kArrayTag, sizeof(kArrayTag))))
+    {
+        char   code = data[kKindOffset];
+        char   order = data[kByteOrderOffset];
+        size_t dataLength = length - MpM_NUMERICARRAY_HEADER_SIZE_;
+
+        if (kFloat32Code == code)
+        {
+            kind = kNumericArrayKindFloat32;
+            result = true;
+        }
+        else if (kFloat64Code == code)
+        {
+            kind = kNumericArrayKindFloat64;
+            result = true;
+        }
+        if (result)
+        {
+            if ((kBigEndianCode == order) || (kLittleEndianCode == order))
+            {
+                swapped = (localByteOrder() != order);
+            }
+            else
+            {
+                ODL_LOG("! ((kBigEndianCode == order) || (kLittleEndianCode == order))"); //####
+                result = false;
+            }
+        }
+        if (result)
+        {
+            size_t size = elementSize(kind);
+
+            if (0 == (dataLength % size))
+            {
+                count = (dataLength / size);
+            }
+            else
+            {
+                ODL_LOG("! (0 == (dataLength % size))"); //####
+                result = false;
+            }
+        }
+    }
+    ODL_EXIT_B(result); //####
+    return result;
+} // NumericArray::DecodeHeader
+
+bool
+NumericArray::IsNumericArray(const yarp::os::Value & aValue)
+{
+    ODL_ENTER(); //####
+    ODL_P1("aValue = ", &aValue); //####
+    bool result = false;
+
+    if (aValue.isBlob())
+    {
+        NumericArrayKind kind;
+        size_t           count;
+        bool             swapped;
+
+        result = DecodeHeader(aValue.asBlob(), aValue.asBlobLength(), kind, count, swapped);
+    }
+    ODL_EXIT_B(result); //####
+    return result;
+} // NumericArray::IsNumericArray
+
+#if defined(__APPLE__)
+# pragma mark Global functions
+#endif // defined(__APPLE__)
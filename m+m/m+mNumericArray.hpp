@@ -0,0 +1,209 @@
+//--------------------------------------------------------------------------------------------------
+//
+//  File:       m+m/m+mNumericArray.hpp
+//
+//  Project:    m+m
+//
+//  Contains:   The class declaration for a packed array of floating-point values that is sent as a
+//              single block.
+//
+//  Written by: Norman Jaffe
+//
+//  Copyright:  (c) 2026 by OpenDragon.
+//
+//              All rights reserved. Redistribution and use in source and binary forms, with or
+//              without modification, are permitted provided that the following conditions are met:
+//                * Redistributions of source code must retain the above copyright notice, this list
+//                  of conditions and the following disclaimer.
+//                * Redistributions in binary form must reproduce the above copyright notice, this
+//                  list of conditions and the following disclaimer in the documentation and / or
+//                  other materials provided with the distribution.
+//                * Neither the name of the copyright holders nor the names of its contributors may
+//                  be used to endorse or promote products derived from this software without
+//                  specific prior written permission.
+//
+//              THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//              EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//              OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//              SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//              INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//              TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//              BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//              CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//              ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//              DAMAGE.
+//
+//  Created:    2026-10-17
+//
+//--------------------------------------------------------------------------------------------------
+
+
+#if (! defined(MpMNumericArray_HPP_))
+# define MpMNumericArray_HPP_ /* Header guard */
+
+# include <m+m/m+mCommon.hpp>
+
+# if defined(__APPLE__)
+#  pragma clang diagnostic push
+#  pragma clang diagnostic ignored "-Wunknown-pragmas"
+#  pragma clang diagnostic ignored "-Wdocumentation-unknown-command"
+# endif // defined(__APPLE__)
+/*! @file
+ @brief The class declaration for a packed array of floating-point values that is sent as a single
+ block. */
+# if defined(__APPLE__)
+#  pragma clang diagnostic pop
+# endif // defined(__APPLE__)
+
+/*! @brief The number of bytes in the header of a packed numeric array. */
+# define MpM_NUMERICARRAY_HEADER_SIZE_ 8
+
+namespace MplusM
+{
+    namespace Common
+    {
+        /*! @brief A packed array of floating-point values.
+
+         The array is sent as a single YARP blob, consisting of an eight-byte header that
+         identifies the blob, the element type and the byte order of the sending machine, followed
+         by the elements in that byte order; receivers on a machine with the other byte order swap
+         the elements as they read them. This avoids the per-element tagging and allocation of a list of
+         doubles, which matters for the high-rate skeleton and sensor streams. Receivers use a
+         NumericArrayView to get at the elements, and ConvertToList for code, such as scripts or
+         JSON output, that expects a plain list. */
+        class NumericArray
+        {
+        public :
+
+        protected :
+
+        private :
+
+        public :
+
+            /*! @brief The constructor.
+             @param[in] kind The type of the elements.
+             @param[in] reserveCount The number of elements to make room for. */
+            NumericArray(const NumericArrayKind kind = kNumericArrayKindFloat64,
+                         const size_t           reserveCount = 0);
+
+            /*! @brief The destructor. */
+            virtual
+            ~NumericArray(void);
+
+            /*! @brief Add the array to the end of a bottle.
+             @param[in,out] aBottle The bottle to be added to. */
+            void
+            addToBottle(yarp::os::Bottle & aBottle)
+            const;
+
+            /*! @brief Add the array to a dictionary.
+             @param[in,out] aDictionary The dictionary to be added to.
+             @param[in] tag The tag to associate with the array. */
+            void
+            addToDictionary(yarp::os::Property & aDictionary,
+                            const YarpString &   tag)
+            const;
+
+            /*! @brief Add an element to the end of the array.
+             @param[in] value The element to be added. */
+            void
+            addValue(const double value);
+
+            /*! @brief Return the array as a YARP value.
+             @return The array as a YARP value. */
+            yarp::os::Value
+            asValue(void)
+            const;
+
+            /*! @brief Remove all the elements from the array, but keep the buffer. */
+            void
+            clear(void);
+
+            /*! @brief Replace a packed numeric array with a list of doubles.
+             @param[in] input The value to be converted.
+             @param[out] output The list to be filled in.
+             @return @c true if the value was a packed numeric array and @c false otherwise. */
+            static bool
+            ConvertToList(const yarp::os::Value & input,
+                          yarp::os::Bottle &      output);
+
+            /*! @brief Return the number of elements in the array.
+             @return The number of elements in the array. */
+            size_t
+            count(void)
+            const;
+
+            /*! @brief Check the header of a blob, to see if it is a packed numeric array.
+             @param[in] data The contents of the blob.
+             @param[in] length The number of bytes in the blob.
+             @param[out] kind The type of the elements.
+             @param[out] count The number of elements.
+             @param[out] swapped @c true if the elements are in the opposite byte order to this
+             machine.
+             @return @c true if the blob is a packed numeric array and @c false otherwise. */
+            static bool
+            DecodeHeader(const char *       data,
+                         const size_t       length,
+                         NumericArrayKind & kind,
+                         size_t &           count,
+                         bool &             swapped);
+
+            /*! @brief Return @c true if a value is a packed numeric array.
+             @param[in] aValue The value to be checked.
+             @return @c true if the value is a packed numeric array and @c false otherwise. */
+            static bool
+            IsNumericArray(const yarp::os::Value & aValue);
+
+            /*! @brief Return the type of the elements.
+             @return The type of the elements. */
+            inline NumericArrayKind
+            kind(void)
+            const
+            {
+                return _kind;
+            } // kind
+
+        protected :
+
+        private :
+
+            /*! @brief The copy constructor.
+             @param[in] other The object to be copied. */
+            NumericArray(const NumericArray & other);
+
+            /*! @brief The assignment operator.
+             @param[in] other The object to be copied.
+             @return The updated object. */
+            NumericArray &
+            operator =(const NumericArray & other);
+
+        public :
+
+        protected :
+
+        private :
+
+            /*! @brief The header and elements of the array. */
+            std::vector<char> _buffer;
+
+            /*! @brief The type of the elements. */
+            NumericArrayKind _kind;
+
+# if defined(__APPLE__)
+#  pragma clang diagnostic push
+#  pragma clang diagnostic ignored "-Wunused-private-field"
+# endif // defined(__APPLE__)
+            /*! @brief Filler to pad to alignment boundary */
+            char _filler[4];
+# if defined(__APPLE__)
+#  pragma clang diagnostic pop
+# endif // defined(__APPLE__)
+
+        }; // NumericArray
+
+    } // Common
+
+} // MplusM
+
+#endif // ! defined(MpMNumericArray_HPP_)
@@ -0,0 +1,233 @@
+//--------------------------------------------------------------------------------------------------
+//
+//  File:       m+m/m+mNumericArrayView.cpp
+//
+//  Project:    m+m
+//
+//  Contains:   The class definition for read-only access to a packed array of floating-point values
+//              in a received message.
+//
+//  Written by: Norman Jaffe
+//
+//  Copyright:  (c) 2026 by OpenDragon.
+//
+//              All rights reserved. Redistribution and use in source and binary forms, with or
+//              without modification, are permitted provided that the following conditions are met:
+//                * Redistributions of source code must retain the above copyright notice, this list
+//                  of conditions and the following disclaimer.
+//                * Redistributions in binary form must reproduce the above copyright notice, this
+//                  list of conditions and the following disclaimer in the documentation and / or
+//                  other materials provided with the distribution.
+//                * Neither the name of the copyright holders nor the names of its contributors may
+//                  be used to endorse or promote products derived from this software without
+//                  specific prior written permission.
+//
+//              THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//              EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//              OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//              SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//              INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//              TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//              BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//              CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//              ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//              DAMAGE.
+//
+//  Created:    2026-10-17
+//
+//--------------------------------------------------------------------------------------------------
+
+
+#include "m+mNumericArrayView.hpp"
+
+//#include <odlEnable.h>
+#include <odlInclude.h>
+
+#if defined(__APPLE__)
+# pragma clang diagnostic push
+# pragma clang diagnostic ignored "-Wunknown-pragmas"
+# pragma clang diagnostic ignored "-Wdocumentation-unknown-command"
+#endif // defined(__APPLE__)
+/*! @file
+ @brief The class definition for read-only access to a packed array of floating-point values in a
+ received message. */
+#if defined(__APPLE__)
+# pragma clang diagnostic pop
+#endif // defined(__APPLE__)
+
+#if defined(__APPLE__)
+# pragma mark Namespace references
+#endif // defined(__APPLE__)
+
+using namespace MplusM;
+using namespace MplusM::Common;
+
+#if defined(__APPLE__)
+# pragma mark Private structures, constants and variables
+#endif // defined(__APPLE__)
+
+#if defined(__APPLE__)
+# pragma mark Global constants and variables
+#endif // defined(__APPLE__)
+
+#if defined(__APPLE__)
+# pragma mark Local functions
+#endif // defined(__APPLE__)
+
+/*! @brief Reverse the bytes of a value.
+ @param[in,out] value The bytes to be reversed.
+ @param[in] size The number of bytes in the value. */
+static void
+swapBytes(char *       value,
+          const size_t size)
+{
+    for (size_t ii = 0, jj = size - 1; ii < jj; ++ii, --jj)
+    {
+        char temp = value[ii];
+
+        value[ii] = value[jj];
+        value[jj] = temp;
+    }
+} // swapBytes
+
+#if defined(__APPLE__)
+# pragma mark Class methods
+#endif // defined(__APPLE__)
+
+#if defined(__APPLE__)
+# pragma mark Constructors and Destructors
+#endif // defined(__APPLE__)
+
+NumericArrayView::NumericArrayView(void) :
+    _data(NULL), _count(0), _kind(kNumericArrayKindUnknown), _swapped(false)
+{
+    ODL_ENTER(); //####
+    ODL_EXIT_P(this); //####
+} // NumericArrayView::NumericArrayView
+
+NumericArrayView::~NumericArrayView(void)
+{
+    ODL_OBJENTER(); //####
+    ODL_OBJEXIT(); //####
+} // NumericArrayView::~NumericArrayView
+
+#if defined(__APPLE__)
+# pragma mark Actions and Accessors
+#endif // defined(__APPLE__)
+
+bool
+NumericArrayView::attach(const yarp::os::Value & aValue)
+{
+    ODL_OBJENTER(); //####
+    ODL_P1("aValue = ", &aValue); //####
+    bool result = false;
+
+    _data = NULL;
+    _count = 0;
+    _kind = kNumericArrayKindUnknown;
+    _swapped = false;
+    if (aValue.isBlob())
+    {
+        const char * blobData = aValue.asBlob();
+
+        result = NumericArray::DecodeHeader(blobData, aValue.asBlobLength(), _kind, _count,
+                                            _swapped);
+        if (result)
+        {
+            _data = blobData + MpM_NUMERICARRAY_HEADER_SIZE_;
+        }
+        else
+        {
+            _count = 0;
+            _kind = kNumericArrayKindUnknown;
+            _swapped = false;
+        }
+    }
+    ODL_OBJEXIT_B(result); //####
+    return result;
+} // NumericArrayView::attach
+
+void
+NumericArrayView::copyTo(std::vector<double> & output)
+const
+{
+    ODL_OBJENTER(); //####
+    ODL_P1("output = ", &output); //####
+    output.resize(_count);
+    for (size_t ii = 0; _count > ii; ++ii)
+    {
+        output[ii] = operator [](ii);
+    }
+    ODL_OBJEXIT(); //####
+} // NumericArrayView::copyTo
+
+const double *
+NumericArrayView::doubleData(void)
+const
+{
+    ODL_OBJENTER(); //####
+    const double * result = NULL;
+
+    if ((kNumericArrayKindFloat64 == _kind) && (! _swapped) &&
+        (0 == (reinterpret_cast<uintptr_t>(_data) % sizeof(double))))
+    {
+        result = reinterpret_cast<const double *>(_data);
+    }
+    ODL_OBJEXIT_P(result); //####
+    return result;
+} // NumericArrayView::doubleData
+
+const float *
+NumericArrayView::floatData(void)
+const
+{
+    ODL_OBJENTER(); //####
+    const float * result = NULL;
+
+    if ((kNumericArrayKindFloat32 == _kind) && (! _swapped) &&
+        (0 == (reinterpret_cast<uintptr_t>(_data) % sizeof(float))))
+    {
+        result = reinterpret_cast<const float *>(_data);
+    }
+    ODL_OBJEXIT_P(result); //####
+    return result;
+} // NumericArrayView::floatData
+
+double
+NumericArrayView::operator [](const size_t index)
+const
+{
+    ODL_OBJENTER(); //####
+    ODL_I1("index = ", index); //####
+    double result = 0;
+
+    if (_count > index)
+    {
+        // The elements are not necessarily aligned within the message, so copy them out.
+        if (kNumericArrayKindFloat32 == _kind)
+        {
+            float asFloat;
+
+            memcpy(&asFloat, _data + (index * sizeof(asFloat)), sizeof(asFloat));
+            if (_swapped)
+            {
+                swapBytes(reinterpret_cast<char *>(&asFloat), sizeof(asFloat));
+            }
+            result = asFloat;
+        }
+        else
+        {
+            memcpy(&result, _data + (index * sizeof(result)), sizeof(result));
+            if (_swapped)
+            {
+                swapBytes(reinterpret_cast<char *>(&result), sizeof(result));
+            }
+        }
+    }
+    ODL_OBJEXIT_D(result); //####
+    return result;
+} // NumericArrayView::operator []
+
+#if defined(__APPLE__)
+# pragma mark Global functions
+#endif // defined(__APPLE__)
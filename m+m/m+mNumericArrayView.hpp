@@ -0,0 +1,183 @@
+//--------------------------------------------------------------------------------------------------
+//
+//  File:       m+m/m+mNumericArrayView.hpp
+//
+//  Project:    m+m
+//
+//  Contains:   The class declaration for read-only access to a packed array of floating-point
+//              values in a received message.
+//
+//  Written by: Norman Jaffe
+//
+//  Copyright:  (c) 2026 by OpenDragon.
+//
+//              All rights reserved. Redistribution and use in source and binary forms, with or
+//              without modification, are permitted provided that the following conditions are met:
+//                * Redistributions of source code must retain the above copyright notice, this list
+//                  of conditions and the following disclaimer.
+//                * Redistributions in binary form must reproduce the above copyright notice, this
+//                  list of conditions and the following disclaimer in the documentation and / or
+//                  other materials provided with the distribution.
+//                * Neither the name of the copyright holders nor the names of its contributors may
+//                  be used to endorse or promote products derived from this software without
+//                  specific prior written permission.
+//
+//              THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//              EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//              OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//              SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//              INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//              TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//              BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//              CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//              ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//              DAMAGE.
+//
+//  Created:    2026-10-17
+//
+//--------------------------------------------------------------------------------------------------
+
+
+#if (! defined(MpMNumericArrayView_HPP_))
+# define MpMNumericArrayView_HPP_ /* Header guard */
+
+# include <m+m/m+mNumericArray.hpp>
+
+# if defined(__APPLE__)
+#  pragma clang diagnostic push
+#  pragma clang diagnostic ignored "-Wunknown-pragmas"
+#  pragma clang diagnostic ignored "-Wdocumentation-unknown-command"
+# endif // defined(__APPLE__)
+/*! @file
+ @brief The class declaration for read-only access to a packed array of floating-point values in a
+ received message. */
+# if defined(__APPLE__)
+#  pragma clang diagnostic pop
+# endif // defined(__APPLE__)
+
+namespace MplusM
+{
+    namespace Common
+    {
+        /*! @brief Read-only access to the elements of a packed numeric array, without copying
+         them out of the received message.
+
+         The view refers to the storage of the value that it is attached to, so it must not be
+         used after that value, or the message containing it, has been released. */
+        class NumericArrayView
+        {
+        public :
+
+        protected :
+
+        private :
+
+        public :
+
+            /*! @brief The constructor. */
+            NumericArrayView(void);
+
+            /*! @brief The destructor. */
+            virtual
+            ~NumericArrayView(void);
+
+            /*! @brief Refer to the elements of a packed numeric array.
+             @param[in] aValue The value holding the array.
+             @return @c true if the value is a packed numeric array and @c false otherwise. */
+            bool
+            attach(const yarp::os::Value & aValue);
+
+            /*! @brief Copy the elements to a vector.
+             @param[out] output The vector to be filled in. */
+            void
+            copyTo(std::vector<double> & output)
+            const;
+
+            /*! @brief Return the elements directly, if they are 64-bit values that are suitably
+             aligned and in the byte order of this machine.
+             @return The elements or @c NULL if they cannot be accessed directly. */
+            const double *
+            doubleData(void)
+            const;
+
+            /*! @brief Return the elements directly, if they are 32-bit values that are suitably
+             aligned and in the byte order of this machine.
+             @return The elements or @c NULL if they cannot be accessed directly. */
+            const float *
+            floatData(void)
+            const;
+
+            /*! @brief Return the type of the elements.
+             @return The type of the elements. */
+            inline NumericArrayKind
+            kind(void)
+            const
+            {
+                return _kind;
+            } // kind
+
+            /*! @brief Return the number of elements.
+             @return The number of elements. */
+            inline size_t
+            size(void)
+            const
+            {
+                return _count;
+            } // size
+
+            /*! @brief Return an element.
+             @param[in] index The position of the element.
+             @return The element or @c 0 if the position is out of range. */
+            double
+            operator [](const size_t index)
+            const;
+
+        protected :
+
+        private :
+
+            /*! @brief The copy constructor.
+             @param[in] other The object to be copied. */
+            NumericArrayView(const NumericArrayView & other);
+
+            /*! @brief The assignment operator.
+             @param[in] other The object to be copied.
+             @return The updated object. */
+            NumericArrayView &
+            operator =(const NumericArrayView & other);
+
+        public :
+
+        protected :
+
+        private :
+
+            /*! @brief The first element of the array. */
+            const char * _data;
+
+            /*! @brief The number of elements. */
+            size_t _count;
+
+            /*! @brief The type of the elements. */
+            NumericArrayKind _kind;
+
+            /*! @brief @c true if the elements are in the opposite byte order to this machine. */
+            bool _swapped;
+
+# if defined(__APPLE__)
+#  pragma clang diagnostic push
+#  pragma clang diagnostic ignored "-Wunused-private-field"
+# endif // defined(__APPLE__)
+            /*! @brief Filler to pad to alignment boundary */
+            char _filler[3];
+# if defined(__APPLE__)
+#  pragma clang diagnostic pop
+# endif // defined(__APPLE__)
+
+        }; // NumericArrayView
+
+    } // Common
+
+} // MplusM
+
+#endif // ! defined(MpMNumericArrayView_HPP_)
@@ -0,0 +1,233 @@
+//--------------------------------------------------------------------------------------------------
+//
+//  File:       m+m/m+mOutletBatchThread.cpp
+//
+//  Project:    m+m
+//
+//  Contains:   The class definition for a thread that coalesces the messages of an output channel.
+//
+//  Written by: Norman Jaffe
+//
+//  Copyright:  (c) 2026 by OpenDragon.
+//
+//              All rights reserved. Redistribution and use in source and binary forms, with or
+//              without modification, are permitted provided that the following conditions are met:
+//                * Redistributions of source code must retain the above copyright notice, this list
+//                  of conditions and the following disclaimer.
+//                * Redistributions in binary form must reproduce the above copyright notice, this
+//                  list of conditions and the following disclaimer in the documentation and / or
+//                  other materials provided with the distribution.
+//                * Neither the name of the copyright holders nor the names of its contributors may
+//                  be used to endorse or promote products derived from this software without
+//                  specific prior written permission.
+//
+//              THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//              EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//              OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//              SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//              INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//              TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//              BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//              CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//              ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//              DAMAGE.
+//
+//  Created:    2026-10-17
+//
+//--------------------------------------------------------------------------------------------------
+
+
+#include "m+mOutletBatchThread.hpp"
+
+#include <m+m/m+mGeneralChannel.hpp>
+
+//#include <odlEnable.h>
+#include <odlInclude.h>
+
+#if defined(__APPLE__)
+# pragma clang diagnostic push
+# pragma clang diagnostic ignored "-Wunknown-pragmas"
+# pragma clang diagnostic ignored "-Wdocumentation-unknown-command"
+#endif // defined(__APPLE__)
+/*! @file
+ @brief The class definition for a thread that coalesces the messages of an output channel. */
+#if defined(__APPLE__)
+# pragma clang diagnostic pop
+#endif // defined(__APPLE__)
+
+#if defined(__APPLE__)
+# pragma mark Namespace references
+#endif // defined(__APPLE__)
+
+using namespace MplusM;
+using namespace MplusM::Common;
+
+#if defined(__APPLE__)
+# pragma mark Private structures, constants and variables
+#endif // defined(__APPLE__)
+
+#if defined(__APPLE__)
+# pragma mark Global constants and variables
+#endif // defined(__APPLE__)
+
+#if defined(__APPLE__)
+# pragma mark Local functions
+#endif // defined(__APPLE__)
+
+/*! @brief Make a frame ready to have messages added to it.
+ @param[in,out] aFrame The frame to be prepared. */
+static void
+resetFrame(yarp::os::Bottle & aFrame)
+{
+    ODL_ENTER(); //####
+    ODL_P1("aFrame = ", &aFrame); //####
+    aFrame.clear();
+    aFrame.addString(BATCH_FRAME_MARKER_);
+    aFrame.addList();
+    ODL_EXIT(); //####
+} // resetFrame
+
+#if defined(__APPLE__)
+# pragma mark Class methods
+#endif // defined(__APPLE__)
+
+#if defined(__APPLE__)
+# pragma mark Constructors and Destructors
+#endif // defined(__APPLE__)
+
+OutletBatchThread::OutletBatchThread(GeneralChannel & channel,
+                                     const size_t     byteLimit,
+                                     const double     latencyBudget) :
+    inherited(), _channel(channel), _lock(), _started(0), _filled(0), _byteLimit(byteLimit),
+    _current(0), _pendingBytes(0), _latencyBudget(latencyBudget)
+{
+    ODL_ENTER(); //####
+    ODL_P1("channel = ", &channel); //####
+    ODL_I1("byteLimit = ", byteLimit); //####
+    ODL_D1("latencyBudget = ", latencyBudget); //####
+    resetFrame(_frames[0]);
+    resetFrame(_frames[1]);
+    ODL_EXIT_P(this); //####
+} // OutletBatchThread::OutletBatchThread
+
+OutletBatchThread::~OutletBatchThread(void)
+{
+    ODL_OBJENTER(); //####
+    ODL_OBJEXIT(); //####
+} // OutletBatchThread::~OutletBatchThread
+
+#if defined(__APPLE__)
+# pragma mark Actions and Accessors
+#endif // defined(__APPLE__)
+
+void
+OutletBatchThread::addMessage(yarp::os::Bottle & message)
+{
+    ODL_OBJENTER(); //####
+    ODL_P1("message = ", &message); //####
+    size_t messageSize = 0;
+
+    // The serialized size of the message determines when the frame is full.
+    message.toBinary(&messageSize);
+    _lock.lock();
+    yarp::os::Bottle * messages = _frames[_current].get(1).asList();
+
+    if (messages)
+    {
+        bool isFirst = (0 == messages->size());
+
+        messages->addList() = message;
+        _pendingBytes += messageSize;
+        // The semaphores are signalled while the lock is held, so that flushMessages() can
+        // discard the signals that belong to the frame that it is sending.
+        if (isFirst)
+        {
+            _started.post();
+        }
+        if (_byteLimit <= _pendingBytes)
+        {
+            _filled.post();
+        }
+    }
+    _lock.unlock();
+    ODL_OBJEXIT(); //####
+} // OutletBatchThread::addMessage
+
+void
+OutletBatchThread::flushMessages(void)
+{
+    ODL_OBJENTER(); //####
+    size_t toSend;
+
+    _lock.lock();
+    toSend = _current;
+    _current = 1 - _current;
+    _pendingBytes = 0;
+    for ( ; _filled.check(); )
+    {
+        // Discard the signals for the frame being sent.
+    }
+    _lock.unlock();
+    yarp::os::Bottle & aFrame = _frames[toSend];
+    yarp::os::Bottle * messages = aFrame.get(1).asList();
+
+    if (messages)
+    {
+        int                count = messages->size();
+        yarp::os::Bottle * toWrite = NULL;
+
+        if (1 == count)
+        {
+            toWrite = messages->get(0).asList();
+        }
+        else if (1 < count)
+        {
+            toWrite = &aFrame;
+        }
+        if (toWrite)
+        {
+            if (_channel.writeUnbatched(*toWrite))
+            {
+                ODL_I1("written frame, count = ", count); //####
+            }
+            else
+            {
+                ODL_LOG("! (_channel.writeUnbatched(*toWrite))"); //####
+            }
+        }
+    }
+    resetFrame(aFrame);
+    ODL_OBJEXIT(); //####
+} // OutletBatchThread::flushMessages
+
+void
+OutletBatchThread::onStop(void)
+{
+    ODL_OBJENTER(); //####
+    _started.post();
+    _filled.post();
+    ODL_OBJEXIT(); //####
+} // OutletBatchThread::onStop
+
+void
+OutletBatchThread::run(void)
+{
+    ODL_OBJENTER(); //####
+    for ( ; ! isStopping(); )
+    {
+        _started.wait();
+        if (! isStopping())
+        {
+            // Hold the frame until it is full or the oldest message has waited long enough.
+            _filled.waitWithTimeout(_latencyBudget);
+        }
+        flushMessages();
+    }
+    // Send anything that was added while the thread was being stopped.
+    flushMessages();
+    ODL_OBJEXIT(); //####
+} // OutletBatchThread::run
+
+#if defined(__APPLE__)
+# pragma mark Global functions
+#endif // defined(__APPLE__)
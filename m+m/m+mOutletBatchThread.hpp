@@ -0,0 +1,167 @@
+//--------------------------------------------------------------------------------------------------
+//
+//  File:       m+m/m+mOutletBatchThread.hpp
+//
+//  Project:    m+m
+//
+//  Contains:   The class declaration for a thread that coalesces the messages of an output channel.
+//
+//  Written by: Norman Jaffe
+//
+//  Copyright:  (c) 2026 by OpenDragon.
+//
+//              All rights reserved. Redistribution and use in source and binary forms, with or
+//              without modification, are permitted provided that the following conditions are met:
+//                * Redistributions of source code must retain the above copyright notice, this list
+//                  of conditions and the following disclaimer.
+//                * Redistributions in binary form must reproduce the above copyright notice, this
+//                  list of conditions and the following disclaimer in the documentation and / or
+//                  other materials provided with the distribution.
+//                * Neither the name of the copyright holders nor the names of its contributors may
+//                  be used to endorse or promote products derived from this software without
+//                  specific prior written permission.
+//
+//              THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//              EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//              OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//              SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//              INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//              TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//              BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//              CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//              ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//              DAMAGE.
+//
+//  Created:    2026-10-17
+//
+//--------------------------------------------------------------------------------------------------
+
+
+#if (! defined(MpMOutletBatchThread_HPP_))
+# define MpMOutletBatchThread_HPP_ /* Header guard */
+
+# include <m+m/m+mBaseThread.hpp>
+
+# if defined(__APPLE__)
+#  pragma clang diagnostic push
+#  pragma clang diagnostic ignored "-Wunknown-pragmas"
+#  pragma clang diagnostic ignored "-Wdocumentation-unknown-command"
+# endif // defined(__APPLE__)
+/*! @file
+ @brief The class declaration for a thread that coalesces the messages of an output channel. */
+# if defined(__APPLE__)
+#  pragma clang diagnostic pop
+# endif // defined(__APPLE__)
+
+namespace MplusM
+{
+    namespace Common
+    {
+        class GeneralChannel;
+
+        /*! @brief A thread that coalesces the messages written to an output channel, so that many
+         small messages are sent as a single frame.
+
+         A frame is sent when the coalesced messages reach the byte limit or when the oldest of
+         them has waited for the latency budget, whichever comes first. A frame is a Bottle
+         containing the batch marker, followed by a list holding each message as a list; a
+         frame that would contain only one message is sent as the message itself. */
+        class OutletBatchThread : public BaseThread
+        {
+        public :
+
+        protected :
+
+        private :
+
+            /*! @brief The class that this class is derived from. */
+            typedef BaseThread inherited;
+
+        public :
+
+            /*! @brief The constructor.
+             @param[in] channel The channel that the messages are to be sent on.
+             @param[in] byteLimit The number of bytes of messages that are coalesced before being
+             sent.
+             @param[in] latencyBudget The time, in seconds, that a message can be held before it
+             is sent. */
+            OutletBatchThread(GeneralChannel & channel,
+                              const size_t     byteLimit,
+                              const double     latencyBudget);
+
+            /*! @brief The destructor. */
+            virtual
+            ~OutletBatchThread(void);
+
+            /*! @brief Add a message to the frame being built, without waiting for it to be sent.
+             @param[in] message The message to be sent. */
+            void
+            addMessage(yarp::os::Bottle & message);
+
+        protected :
+
+        private :
+
+            /*! @brief The copy constructor.
+             @param[in] other The object to be copied. */
+            OutletBatchThread(const OutletBatchThread & other);
+
+            /*! @brief Send the messages that have been coalesced. */
+            void
+            flushMessages(void);
+
+            /*! @brief Release the thread if it is waiting for a message. */
+            virtual void
+            onStop(void);
+
+            /*! @brief The assignment operator.
+             @param[in] other The object to be copied.
+             @return The updated object. */
+            OutletBatchThread &
+            operator =(const OutletBatchThread & other);
+
+            /*! @brief The thread main body. */
+            virtual void
+            run(void);
+
+        public :
+
+        protected :
+
+        private :
+
+            /*! @brief The channel that the messages are sent on. */
+            GeneralChannel & _channel;
+
+            /*! @brief The frames being built and being sent; the messages are added to one while
+             the other is sent. */
+            yarp::os::Bottle _frames[2];
+
+            /*! @brief The contention lock used to control access to the waiting messages. */
+            yarp::os::Mutex _lock;
+
+            /*! @brief Signalled when the first message of a frame has been added. */
+            yarp::os::Semaphore _started;
+
+            /*! @brief Signalled when the waiting messages have reached the byte limit. */
+            yarp::os::Semaphore _filled;
+
+            /*! @brief The number of bytes of messages that are coalesced before being sent. */
+            size_t _byteLimit;
+
+            /*! @brief The index of the frame that messages are being added to. */
+            size_t _current;
+
+            /*! @brief The number of bytes in the waiting messages. */
+            size_t _pendingBytes;
+
+            /*! @brief The time, in seconds, that a message can be held before it is sent. */
+            double _latencyBudget;
+
+        }; // OutletBatchThread
+
+    } // Common
+
+} // MplusM
+
+#endif // ! defined(MpMOutletBatchThread_HPP_)
@@ -0,0 +1,197 @@
+//--------------------------------------------------------------------------------------------------
+//
+//  File:       m+m/m+mOutletQueueThread.cpp
+//
+//  Project:    m+m
+//
+//  Contains:   The class definition for a thread that sends the queued messages of an output
+//              channel.
+//
+//  Written by: Norman Jaffe
+//
+//  Copyright:  (c) 2026 by OpenDragon.
+//
+//              All rights reserved. Redistribution and use in source and binary forms, with or
+//              without modification, are permitted provided that the following conditions are met:
+//                * Redistributions of source code must retain the above copyright notice, this list
+//                  of conditions and the following disclaimer.
+//                * Redistributions in binary form must reproduce the above copyright notice, this
+//                  list of conditions and the following disclaimer in the documentation and / or
+//                  other materials provided with the distribution.
+//                * Neither the name of the copyright holders nor the names of its contributors may
+//                  be used to endorse or promote products derived from this software without
+//                  specific prior written permission.
+//
+//              THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//              EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//              OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//              SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//              INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//              TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//              BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//              CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//              ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//              DAMAGE.
+//
+//  Created:    2026-10-17
+//
+//--------------------------------------------------------------------------------------------------
+
+
+#include "m+mOutletQueueThread.hpp"
+
+#include <m+m/m+mGeneralChannel.hpp>
+
+//#include <odlEnable.h>
+#include <odlInclude.h>
+
+#if defined(__APPLE__)
+# pragma clang diagnostic push
+# pragma clang diagnostic ignored "-Wunknown-pragmas"
+# pragma clang diagnostic ignored "-Wdocumentation-unknown-command"
+#endif // defined(__APPLE__)
+/*! @file
+ @brief The class definition for a thread that sends the queued messages of an output channel. */
+#if defined(__APPLE__)
+# pragma clang diagnostic pop
+#endif // defined(__APPLE__)
+
+#if defined(__APPLE__)
+# pragma mark Namespace references
+#endif // defined(__APPLE__)
+
+using namespace MplusM;
+using namespace MplusM::Common;
+
+#if defined(__APPLE__)
+# pragma mark Private structures, constants and variables
+#endif // defined(__APPLE__)
+
+#if defined(__APPLE__)
+# pragma mark Global constants and variables
+#endif // defined(__APPLE__)
+
+#if defined(__APPLE__)
+# pragma mark Local functions
+#endif // defined(__APPLE__)
+
+#if defined(__APPLE__)
+# pragma mark Class methods
+#endif // defined(__APPLE__)
+
+#if defined(__APPLE__)
+# pragma mark Constructors and Destructors
+#endif // defined(__APPLE__)
+
+OutletQueueThread::OutletQueueThread(GeneralChannel &     channel,
+                                     const OverflowPolicy policy,
+                                     const size_t         limit) :
+    inherited(), _channel(channel),
+    _ring(((kOverflowPolicyLatestOnly == policy) || (! limit)) ? 1 : limit), _lock(),
+    _available(0), _head(0), _count(0), _policy(policy)
+{
+    ODL_ENTER(); //####
+    ODL_P1("channel = ", &channel); //####
+    ODL_I2("policy = ", policy, "limit = ", limit); //####
+    ODL_EXIT_P(this); //####
+} // OutletQueueThread::OutletQueueThread
+
+OutletQueueThread::~OutletQueueThread(void)
+{
+    ODL_OBJENTER(); //####
+    ODL_OBJEXIT(); //####
+} // OutletQueueThread::~OutletQueueThread
+
+#if defined(__APPLE__)
+# pragma mark Actions and Accessors
+#endif // defined(__APPLE__)
+
+void
+OutletQueueThread::onStop(void)
+{
+    ODL_OBJENTER(); //####
+    _available.post();
+    ODL_OBJEXIT(); //####
+} // OutletQueueThread::onStop
+
+bool
+OutletQueueThread::queueMessage(const yarp::os::Bottle & message)
+{
+    ODL_OBJENTER(); //####
+    ODL_P1("message = ", &message); //####
+    bool   result = true;
+    size_t capacity = _ring.size();
+    size_t dropped = 0;
+    size_t lag;
+
+    _lock.lock();
+    if (capacity == _count)
+    {
+        dropped = 1;
+        if (kOverflowPolicyDropNewest == _policy)
+        {
+            result = false;
+        }
+        else
+        {
+            // Drop the oldest message, to make room for the new one.
+            _head = (_head + 1) % capacity;
+            --_count;
+        }
+    }
+    if (result)
+    {
+        _ring[(_head + _count) % capacity] = message;
+        ++_count;
+    }
+    lag = _count;
+    _lock.unlock();
+    if (result)
+    {
+        _available.post();
+    }
+    _channel.updateOutletCounters(lag, dropped);
+    ODL_OBJEXIT_B(result); //####
+    return result;
+} // OutletQueueThread::queueMessage
+
+void
+OutletQueueThread::run(void)
+{
+    ODL_OBJENTER(); //####
+    yarp::os::Bottle message;
+
+    for ( ; ! isStopping(); )
+    {
+        bool   haveMessage = false;
+        size_t lag = 0;
+
+        // The semaphore can be signalled more often than there are messages, since a message
+        // that replaces a dropped one also signals it.
+        _available.wait();
+        _lock.lock();
+        if (0 < _count)
+        {
+            message = _ring[_head];
+            _ring[_head].clear();
+            _head = (_head + 1) % _ring.size();
+            --_count;
+            lag = _count;
+            haveMessage = true;
+        }
+        _lock.unlock();
+        if (haveMessage && (! isStopping()))
+        {
+            _channel.updateOutletCounters(lag, 0);
+            if (! _channel.BaseChannel::writeBottle(message))
+            {
+                ODL_LOG("(! _channel.BaseChannel::writeBottle(message))"); //####
+            }
+        }
+    }
+    ODL_OBJEXIT(); //####
+} // OutletQueueThread::run
+
+#if defined(__APPLE__)
+# pragma mark Global functions
+#endif // defined(__APPLE__)
@@ -0,0 +1,164 @@
+//--------------------------------------------------------------------------------------------------
+//
+//  File:       m+m/m+mOutletQueueThread.hpp
+//
+//  Project:    m+m
+//
+//  Contains:   The class declaration for a thread that sends the queued messages of an output
+//              channel.
+//
+//  Written by: Norman Jaffe
+//
+//  Copyright:  (c) 2026 by OpenDragon.
+//
+//              All rights reserved. Redistribution and use in source and binary forms, with or
+//              without modification, are permitted provided that the following conditions are met:
+//                * Redistributions of source code must retain the above copyright notice, this list
+//                  of conditions and the following disclaimer.
+//                * Redistributions in binary form must reproduce the above copyright notice, this
+//                  list of conditions and the following disclaimer in the documentation and / or
+//                  other materials provided with the distribution.
+//                * Neither the name of the copyright holders nor the names of its contributors may
+//                  be used to endorse or promote products derived from this software without
+//                  specific prior written permission.
+//
+//              THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//              EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//              OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//              SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//              INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//              TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//              BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//              CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//              ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//              DAMAGE.
+//
+//  Created:    2026-10-17
+//
+//--------------------------------------------------------------------------------------------------
+
+
+#if (! defined(MpMOutletQueueThread_HPP_))
+# define MpMOutletQueueThread_HPP_ /* Header guard */
+
+# include <m+m/m+mBaseThread.hpp>
+
+# if defined(__APPLE__)
+#  pragma clang diagnostic push
+#  pragma clang diagnostic ignored "-Wunknown-pragmas"
+#  pragma clang diagnostic ignored "-Wdocumentation-unknown-command"
+# endif // defined(__APPLE__)
+/*! @file
+ @brief The class declaration for a thread that sends the queued messages of an output channel. */
+# if defined(__APPLE__)
+#  pragma clang diagnostic pop
+# endif // defined(__APPLE__)
+
+namespace MplusM
+{
+    namespace Common
+    {
+        class GeneralChannel;
+
+        /*! @brief A thread that sends the messages written to an output channel, so that the
+         writer does not wait for slow receivers.
+
+         The messages are held in a ring of fixed size; when the ring is full, the overflow policy
+         determines whether the oldest or the newest message is discarded. */
+        class OutletQueueThread : public BaseThread
+        {
+        public :
+
+        protected :
+
+        private :
+
+            /*! @brief The class that this class is derived from. */
+            typedef BaseThread inherited;
+
+        public :
+
+            /*! @brief The constructor.
+             @param[in] channel The channel that the messages are to be sent on.
+             @param[in] policy The handling of messages when the ring is full.
+             @param[in] limit The maximum number of messages that can be waiting to be sent. */
+            OutletQueueThread(GeneralChannel &     channel,
+                              const OverflowPolicy policy,
+                              const size_t         limit);
+
+            /*! @brief The destructor. */
+            virtual
+            ~OutletQueueThread(void);
+
+            /*! @brief Add a message to the ring, without waiting for it to be sent.
+             @param[in] message The message to be sent.
+             @return @c true if the message was queued and @c false if it was discarded. */
+            bool
+            queueMessage(const yarp::os::Bottle & message);
+
+        protected :
+
+        private :
+
+            /*! @brief The copy constructor.
+             @param[in] other The object to be copied. */
+            OutletQueueThread(const OutletQueueThread & other);
+
+            /*! @brief Release the thread if it is waiting for a message. */
+            virtual void
+            onStop(void);
+
+            /*! @brief The assignment operator.
+             @param[in] other The object to be copied.
+             @return The updated object. */
+            OutletQueueThread &
+            operator =(const OutletQueueThread & other);
+
+            /*! @brief The thread main body. */
+            virtual void
+            run(void);
+
+        public :
+
+        protected :
+
+        private :
+
+            /*! @brief The channel that the messages are sent on. */
+            GeneralChannel & _channel;
+
+            /*! @brief The messages waiting to be sent. */
+            std::vector<yarp::os::Bottle> _ring;
+
+            /*! @brief The contention lock used to control access to the ring. */
+            yarp::os::Mutex _lock;
+
+            /*! @brief Signalled when a message has been added to the ring. */
+            yarp::os::Semaphore _available;
+
+            /*! @brief The position of the oldest message in the ring. */
+            size_t _head;
+
+            /*! @brief The number of messages in the ring. */
+            size_t _count;
+
+            /*! @brief The handling of messages when the ring is full. */
+            OverflowPolicy _policy;
+
+# if defined(__APPLE__)
+#  pragma clang diagnostic push
+#  pragma clang diagnostic ignored "-Wunused-private-field"
+# endif // defined(__APPLE__)
+            /*! @brief Filler to pad to alignment boundary */
+            char _filler[4];
+# if defined(__APPLE__)
+#  pragma clang diagnostic pop
+# endif // defined(__APPLE__)
+
+        }; // OutletQueueThread
+
+    } // Common
+
+} // MplusM
+
+#endif // ! defined(MpMOutletQueueThread_HPP_)
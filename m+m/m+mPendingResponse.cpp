@@ -0,0 +1,203 @@
+//--------------------------------------------------------------------------------------------------
+//
+//  File:       m+m/m+mPendingResponse.cpp
+//
+//  Project:    m+m
+//
+//  Contains:   The class definition for the response to an asynchronous m+m request.
+//
+//  Written by: Norman Jaffe
+//
+//  Copyright:  (c) 2026 by OpenDragon.
+//
+//              All rights reserved. Redistribution and use in source and binary forms, with or
+//              without modification, are permitted provided that the following conditions are met:
+//                * Redistributions of source code must retain the above copyright notice, this list
+//                  of conditions and the following disclaimer.
+//                * Redistributions in binary form must reproduce the above copyright notice, this
+//                  list of conditions and the following disclaimer in the documentation and / or
+//                  other materials provided with the distribution.
+//                * Neither the name of the copyright holders nor the names of its contributors may
+//                  be used to endorse or promote products derived from this software without
+//                  specific prior written permission.
+//
+//              THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//              EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//              OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//              SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//              INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//              TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//              BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//              CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//              ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//              DAMAGE.
+//
+//  Created:    2026-10-17
+//
+//--------------------------------------------------------------------------------------------------
+
+
+#include "m+mPendingResponse.hpp"
+
+#include <m+m/m+mResponseCorrelator.hpp>
+
+//#include <odlEnable.h>
+#include <odlInclude.h>
+
+#if defined(__APPLE__)
+# pragma clang diagnostic push
+# pragma clang diagnostic ignored "-Wunknown-pragmas"
+# pragma clang diagnostic ignored "-Wdocumentation-unknown-command"
+#endif // defined(__APPLE__)
+/*! @file
+ @brief The class definition for the response to an asynchronous m+m request. */
+#if defined(__APPLE__)
+# pragma clang diagnostic pop
+#endif // defined(__APPLE__)
+
+#if defined(__APPLE__)
+# pragma mark Namespace references
+#endif // defined(__APPLE__)
+
+using namespace MplusM;
+using namespace MplusM::Common;
+
+#if defined(__APPLE__)
+# pragma mark Private structures, constants and variables
+#endif // defined(__APPLE__)
+
+#if defined(__APPLE__)
+# pragma mark Global constants and variables
+#endif // defined(__APPLE__)
+
+#if defined(__APPLE__)
+# pragma mark Local functions
+#endif // defined(__APPLE__)
+
+#if defined(__APPLE__)
+# pragma mark Class methods
+#endif // defined(__APPLE__)
+
+#if defined(__APPLE__)
+# pragma mark Constructors and Destructors
+#endif // defined(__APPLE__)
+
+PendingResponse::PendingResponse(ResponseCallback callback,
+                                 void *           callbackStuff) :
+    _response(), _ready(0), _callback(callback), _callbackStuff(callbackStuff),
+    _correlator(NULL), _correlationId(0), _isReady(false), _succeeded(false),
+    _isDelivering(false)
+{
+    ODL_ENTER(); //####
+    ODL_P1("callbackStuff = ", callbackStuff); //####
+    ODL_EXIT_P(this); //####
+} // PendingResponse::PendingResponse
+
+PendingResponse::~PendingResponse(void)
+{
+    ODL_OBJENTER(); //####
+    ResponseCorrelator * correlator = _correlator.load();
+
+    // Abandon the request, so that a late response is not delivered to this object; this also
+    // waits for a running callback function to return.
+    if (correlator)
+    {
+        correlator->cancelRequest(*this);
+    }
+    ODL_OBJEXIT(); //####
+} // PendingResponse::~PendingResponse
+
+#if defined(__APPLE__)
+# pragma mark Actions and Accessors
+#endif // defined(__APPLE__)
+
+bool
+PendingResponse::complete(const yarp::os::Bottle * values)
+{
+    ODL_OBJENTER(); //####
+    ODL_P1("values = ", values); //####
+    bool useCallback = (NULL != _callback);
+
+    if (values)
+    {
+        _response = *values;
+        _succeeded = true;
+    }
+    _isReady = true;
+    if (useCallback)
+    {
+        // The correlator is released once the callback function returns, so that the object
+        // cannot be destroyed while it is in use.
+        _isDelivering = true;
+    }
+    else
+    {
+        _ready.post();
+        // This is done last, so that an object that is being destroyed by a waiting thread will
+        // wait for the correlator to finish with it.
+        _correlator = NULL;
+    }
+    ODL_OBJEXIT_B(useCallback); //####
+    return useCallback;
+} // PendingResponse::complete
+
+void
+PendingResponse::start(ResponseCorrelator * correlator,
+                       const int            correlationId)
+{
+    ODL_OBJENTER(); //####
+    ODL_P1("correlator = ", correlator); //####
+    ODL_I1("correlationId = ", correlationId); //####
+    // Discard the signal left by a previous request.
+    while (_ready.check())
+    {
+    }
+    _response = yarp::os::Bottle();
+    _correlator = correlator;
+    _correlationId = correlationId;
+    _isReady = false;
+    _succeeded = false;
+    ODL_OBJEXIT(); //####
+} // PendingResponse::start
+
+bool
+PendingResponse::wait(ServiceResponse & response)
+{
+    ODL_OBJENTER(); //####
+    ODL_P1("response = ", &response); //####
+    bool result = false;
+
+    if (_correlator.load() || _isReady)
+    {
+        // The signal is restored, so that the response can be waited for again.
+        _ready.wait();
+        _ready.post();
+        response = _response.values();
+        result = _succeeded;
+    }
+    ODL_OBJEXIT_B(result); //####
+    return result;
+} // PendingResponse::wait
+
+bool
+PendingResponse::waitWithTimeout(ServiceResponse & response,
+                                 const double      timeToWait)
+{
+    ODL_OBJENTER(); //####
+    ODL_P1("response = ", &response); //####
+    ODL_D1("timeToWait = ", timeToWait); //####
+    bool result = false;
+
+    if ((_correlator.load() || _isReady) && _ready.waitWithTimeout(timeToWait))
+    {
+        _ready.post();
+        response = _response.values();
+        result = _succeeded;
+    }
+    ODL_OBJEXIT_B(result); //####
+    return result;
+} // PendingResponse::waitWithTimeout
+
+#if defined(__APPLE__)
+# pragma mark Global functions
+#endif // defined(__APPLE__)
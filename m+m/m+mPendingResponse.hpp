@@ -0,0 +1,241 @@
+//--------------------------------------------------------------------------------------------------
+//
+//  File:       m+m/m+mPendingResponse.hpp
+//
+//  Project:    m+m
+//
+//  Contains:   The class declaration for the response to an asynchronous m+m request.
+//
+//  Written by: Norman Jaffe
+//
+//  Copyright:  (c) 2026 by OpenDragon.
+//
+//              All rights reserved. Redistribution and use in source and binary forms, with or
+//              without modification, are permitted provided that the following conditions are met:
+//                * Redistributions of source code must retain the above copyright notice, this list
+//                  of conditions and the following disclaimer.
+//                * Redistributions in binary form must reproduce the above copyright notice, this
+//                  list of conditions and the following disclaimer in the documentation and / or
+//                  other materials provided with the distribution.
+//                * Neither the name of the copyright holders nor the names of its contributors may
+//                  be used to endorse or promote products derived from this software without
+//                  specific prior written permission.
+//
+//              THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//              EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//              OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//              SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//              INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//              TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//              BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//              CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//              ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//              DAMAGE.
+//
+//  Created:    2026-10-17
+//
+//--------------------------------------------------------------------------------------------------
+
+
+#if (! defined(MpMPendingResponse_HPP_))
+# define MpMPendingResponse_HPP_ /* Header guard */
+
+# include <m+m/m+mServiceResponse.hpp>
+
+# include <atomic>
+
+# if defined(__APPLE__)
+#  pragma clang diagnostic push
+#  pragma clang diagnostic ignored "-Wunknown-pragmas"
+#  pragma clang diagnostic ignored "-Wdocumentation-unknown-command"
+# endif // defined(__APPLE__)
+/*! @file
+ @brief The class declaration for the response to an asynchronous m+m request. */
+# if defined(__APPLE__)
+#  pragma clang diagnostic pop
+# endif // defined(__APPLE__)
+
+namespace MplusM
+{
+    namespace Common
+    {
+        class PendingResponse;
+        class ResponseCorrelator;
+
+        /*! @brief A function that is called when the response to an asynchronous request is
+         ready; the pending response must not be destroyed until the function returns.
+         @param[in,out] pending The response that is now ready.
+         @param[in] callbackStuff The private data for the function. */
+        typedef void
+        (*ResponseCallback)
+            (PendingResponse & pending,
+             void *            callbackStuff);
+
+        /*! @brief The response to an asynchronous request, which becomes ready when the service
+         replies or the channel that sent the request is closed.
+
+         A pending response can be used for only one request at a time. If it is destroyed before
+         it is ready, the request is abandoned and its response is discarded; if its callback
+         function is running, destroying it waits for the function to return. */
+        class PendingResponse
+        {
+        public :
+
+        protected :
+
+        private :
+
+            /*! @brief The class that manages the outstanding requests. */
+            friend class ResponseCorrelator;
+
+        public :
+
+            /*! @brief The constructor.
+             @param[in] callback The function to be called when the response is ready, or @c NULL
+             if the response will be waited for.
+             @param[in] callbackStuff The private data for the callback function. */
+            explicit
+            PendingResponse(ResponseCallback callback = NULL,
+                            void *           callbackStuff = NULL);
+
+            /*! @brief The destructor. */
+            virtual
+            ~PendingResponse(void);
+
+            /*! @brief Return the correlation identifier of the request.
+             @return The correlation identifier of the request. */
+            inline int
+            correlationId(void)
+            const
+            {
+                return _correlationId;
+            } // correlationId
+
+            /*! @brief Return @c true if the response has been received or the request has failed.
+             @return @c true if the response is ready and @c false otherwise. */
+            inline bool
+            isReady(void)
+            const
+            {
+                return _isReady;
+            } // isReady
+
+            /*! @brief Return the response to the request; this is only valid once the response is
+             ready.
+             @return The response to the request. */
+            inline const ServiceResponse &
+            response(void)
+            const
+            {
+                return _response;
+            } // response
+
+            /*! @brief Return @c true if a response was received for the request.
+             @return @c true if a response was received and @c false if the request failed or the
+             response is not ready. */
+            inline bool
+            succeeded(void)
+            const
+            {
+                return _succeeded;
+            } // succeeded
+
+            /*! @brief Wait for the response to the request; this should not be used if a callback
+             function was provided.
+             @param[out] response The response to the request.
+             @return @c true if a response was received and @c false if the request failed. */
+            bool
+            wait(ServiceResponse & response);
+
+            /*! @brief Wait for the response to the request, giving up after a time; this should
+             not be used if a callback function was provided.
+             @param[out] response The response to the request.
+             @param[in] timeToWait The number of seconds to wait for the response.
+             @return @c true if a response was received and @c false if the request failed or the
+             response did not arrive in time. */
+            bool
+            waitWithTimeout(ServiceResponse & response,
+                            const double      timeToWait);
+
+        protected :
+
+        private :
+
+            /*! @brief The copy constructor.
+             @param[in] other The object to be copied. */
+            PendingResponse(const PendingResponse & other);
+
+            /*! @brief Mark the response as ready; the lock of the correlator must be held by the
+             caller. If the callback function is to be called, the request stays attached to the
+             correlator until the function has returned.
+             @param[in] values The response, or @c NULL if the request failed.
+             @return @c true if the callback function is to be called and @c false otherwise. */
+            bool
+            complete(const yarp::os::Bottle * values);
+
+            /*! @brief The assignment operator.
+             @param[in] other The object to be copied.
+             @return The updated object. */
+            PendingResponse &
+            operator =(const PendingResponse & other);
+
+            /*! @brief Prepare for a new request; the lock of the correlator must be held by the
+             caller.
+             @param[in] correlator The object that manages the outstanding request.
+             @param[in] correlationId The identifier assigned to the request. */
+            void
+            start(ResponseCorrelator * correlator,
+                  const int            correlationId);
+
+        public :
+
+        protected :
+
+        private :
+
+            /*! @brief The response to the request. */
+            ServiceResponse _response;
+
+            /*! @brief Signalled when the response is ready. */
+            yarp::os::Semaphore _ready;
+
+            /*! @brief The function to be called when the response is ready. */
+            ResponseCallback _callback;
+
+            /*! @brief The private data for the callback function. */
+            void * _callbackStuff;
+
+            /*! @brief The object managing the request, or @c NULL if there is no outstanding
+             request. */
+            std::atomic<ResponseCorrelator *> _correlator;
+
+            /*! @brief The identifier assigned to the request. */
+            int _correlationId;
+
+            /*! @brief @c true if the response has been received or the request has failed. */
+            bool _isReady;
+
+            /*! @brief @c true if a response was received for the request. */
+            bool _succeeded;
+
+            /*! @brief @c true if the callback function is running; this is protected by the lock
+             of the correlator. */
+            bool _isDelivering;
+
+# if defined(__APPLE__)
+#  pragma clang diagnostic push
+#  pragma clang diagnostic ignored "-Wunused-private-field"
+# endif // defined(__APPLE__)
+            /*! @brief Filler to pad to alignment boundary */
+            char _filler[1];
+# if defined(__APPLE__)
+#  pragma clang diagnostic pop
+# endif // defined(__APPLE__)
+
+        }; // PendingResponse
+
+    } // Common
+
+} // MplusM
+
+#endif // ! defined(MpMPendingResponse_HPP_)
@@ -112,9 +112,21 @@ PingThread::run(void)
         if (_pingTime <= now)
         {
             ODL_LOG("(_pingTime <= now)"); //####
-            // Send a ping!
-            _service.sendPingForChannel(_channelName);
-            _pingTime = now + PING_INTERVAL_;
+            double retryAfter = -1;
+
+            // Send a ping! Spread the pings out a little, so that services that started together
+            // don't keep pinging together.
+            if (_service.sendPingForChannel(_channelName, NULL, NULL, &retryAfter) ||
+                (0 > retryAfter))
+            {
+                _pingTime = now + (PING_INTERVAL_ * (0.9 + (0.1 * yarp::os::Random::uniform())));
+            }
+            else
+            {
+                // The Registry Service was too busy, so come back when it suggested.
+                _pingTime = now + (retryAfter * (1 + ((REGISTRY_BUSY_MULTIPLIER_ - 1) *
+                                                      yarp::os::Random::uniform())));
+            }
         }
         if (! isStopping())
         {
@@ -0,0 +1,278 @@
+//--------------------------------------------------------------------------------------------------
+//
+//  File:       m+m/m+mRawInput.cpp
+//
+//  Project:    m+m
+//
+//  Contains:   The class definition for read-only access to the bytes of a received message.
+//
+//  Written by: Norman Jaffe
+//
+//  Copyright:  (c) 2026 by OpenDragon.
+//
+//              All rights reserved. Redistribution and use in source and binary forms, with or
+//              without modification, are permitted provided that the following conditions are met:
+//                * Redistributions of source code must retain the above copyright notice, this list
+//                  of conditions and the following disclaimer.
+//                * Redistributions in binary form must reproduce the above copyright notice, this
+//                  list of conditions and the following disclaimer in the documentation and / or
+//                  other materials provided with the distribution.
+//                * Neither the name of the copyright holders nor the names of its contributors may
+//                  be used to endorse or promote products derived from this software without
+//                  specific prior written permission.
+//
+//              THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//              EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//              OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//              SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//              INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//              TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//              BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//              CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//              ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//              DAMAGE.
+//
+//  Created:    2026-10-17
+//
+//--------------------------------------------------------------------------------------------------
+
+
+#include "m+mRawInput.hpp"
+
+//#include <odlEnable.h>
+#include <odlInclude.h>
+
+#if defined(__APPLE__)
+# pragma clang diagnostic push
+# pragma clang diagnostic ignored "-Wunknown-pragmas"
+# pragma clang diagnostic ignored "-Wdocumentation-unknown-command"
+#endif // defined(__APPLE__)
+/*! @file
+ @brief The class definition for read-only access to the bytes of a received message. */
+#if defined(__APPLE__)
+# pragma clang diagnostic pop
+#endif // defined(__APPLE__)
+
+#if defined(__APPLE__)
+# pragma mark Namespace references
+#endif // defined(__APPLE__)
+
+using namespace MplusM;
+using namespace MplusM::Common;
+
+#if defined(__APPLE__)
+# pragma mark Private structures, constants and variables
+#endif // defined(__APPLE__)
+
+/*! @brief The number of bytes in each integer of the serialized form of a message. */
+static const size_t kIntegerSize = 4;
+
+#if defined(__APPLE__)
+# pragma mark Global constants and variables
+#endif // defined(__APPLE__)
+
+#if defined(__APPLE__)
+# pragma mark Local functions
+#endif // defined(__APPLE__)
+
+/*! @brief Extract an integer from the serialized form of a message, which is little-endian.
+ @param[in] bytes The first byte of the integer.
+ @return The integer. */
+static int32_t
+getInteger(const char * bytes)
+{
+    ODL_ENTER(); //####
+    ODL_P1("bytes = ", bytes); //####
+    const uint8_t * asUnsigned = reinterpret_cast<const uint8_t *>(bytes);
+    uint32_t        value = (static_cast<uint32_t>(asUnsigned[0]) |
+                             (static_cast<uint32_t>(asUnsigned[1]) << 8) |
+                             (static_cast<uint32_t>(asUnsigned[2]) << 16) |
+                             (static_cast<uint32_t>(asUnsigned[3]) << 24));
+    int32_t         result = static_cast<int32_t>(value);
+
+    ODL_EXIT_I(result); //####
+    return result;
+} // getInteger
+
+/*! @brief Store an integer in the serialized form of a message, which is little-endian.
+ @param[in] bytes The first byte of the integer.
+ @param[in] value The integer. */
+static void
+putInteger(char *        bytes,
+           const int32_t value)
+{
+    ODL_ENTER(); //####
+    ODL_P1("bytes = ", bytes); //####
+    ODL_I1("value = ", value); //####
+    uint32_t asUnsigned = static_cast<uint32_t>(value);
+
+    bytes[0] = static_cast<char>(asUnsigned & 0x0FF);
+    bytes[1] = static_cast<char>((asUnsigned >> 8) & 0x0FF);
+    bytes[2] = static_cast<char>((asUnsigned >> 16) & 0x0FF);
+    bytes[3] = static_cast<char>((asUnsigned >> 24) & 0x0FF);
+    ODL_EXIT(); //####
+} // putInteger
+
+#if defined(__APPLE__)
+# pragma mark Class methods
+#endif // defined(__APPLE__)
+
+#if defined(__APPLE__)
+# pragma mark Constructors and Destructors
+#endif // defined(__APPLE__)
+
+RawInput::RawInput(const char * bytes,
+                   const size_t numBytes) :
+    _decoded(), _bytes(bytes), _numBytes(numBytes), _isDecoded(false)
+{
+    ODL_ENTER(); //####
+    ODL_P1("bytes = ", bytes); //####
+    ODL_I1("numBytes = ", numBytes); //####
+    ODL_EXIT_P(this); //####
+} // RawInput::RawInput
+
+RawInput::~RawInput(void)
+{
+    ODL_OBJENTER(); //####
+    ODL_OBJEXIT(); //####
+} // RawInput::~RawInput
+
+#if defined(__APPLE__)
+# pragma mark Actions and Accessors
+#endif // defined(__APPLE__)
+
+const yarp::os::Bottle &
+RawInput::asBottle(void)
+{
+    ODL_OBJENTER(); //####
+    if (! _isDecoded)
+    {
+        if (_bytes && (0 < _numBytes))
+        {
+            _decoded.fromBinary(_bytes, static_cast<int>(_numBytes));
+        }
+        _isDecoded = true;
+    }
+    ODL_OBJEXIT_P(&_decoded); //####
+    return _decoded;
+} // RawInput::asBottle
+
+bool
+RawInput::getSingleBlob(const char * & blobBytes,
+                        size_t &       blobLength)
+const
+{
+    ODL_OBJENTER(); //####
+    ODL_P2("blobBytes = ", &blobBytes, "blobLength = ", &blobLength); //####
+    bool   result = false;
+    size_t offset = 0;
+
+    // A message is serialized as a list tag, combined with the element tag if all the elements
+    // are of the same kind, then the element count, then the elements; a blob is its length
+    // followed by its contents.
+    if (_bytes && ((3 * kIntegerSize) <= _numBytes))
+    {
+        int32_t listTag = getInteger(_bytes);
+
+        if ((1 == getInteger(_bytes + kIntegerSize)) &&
+            ((BOTTLE_TAG_LIST | BOTTLE_TAG_BLOB) == listTag))
+        {
+            offset = 2 * kIntegerSize;
+        }
+        else if ((1 == getInteger(_bytes + kIntegerSize)) && (BOTTLE_TAG_LIST == listTag) &&
+                 ((4 * kIntegerSize) <= _numBytes) &&
+                 (BOTTLE_TAG_BLOB == getInteger(_bytes + (2 * kIntegerSize))))
+        {
+            offset = 3 * kIntegerSize;
+        }
+        if (0 < offset)
+        {
+            int32_t length = getInteger(_bytes + offset);
+
+            offset += kIntegerSize;
+            if ((0 <= length) && ((offset + static_cast<size_t>(length)) == _numBytes))
+            {
+                blobBytes = _bytes + offset;
+                blobLength = static_cast<size_t>(length);
+                result = true;
+            }
+        }
+    }
+    ODL_OBJEXIT_B(result); //####
+    return result;
+} // RawInput::getSingleBlob
+
+bool
+RawInput::splitLeadingString(const char * &      text,
+                             size_t &            textLength,
+                             yarp::os::Bottle &  rest,
+                             std::vector<char> & scratch)
+const
+{
+    ODL_OBJENTER(); //####
+    ODL_P4("text = ", &text, "textLength = ", &textLength, "rest = ", &rest, //####
+           "scratch = ", &scratch); //####
+    bool   result = false;
+    size_t offset = 0;
+
+    // A string is serialized as its length, including a terminating null, followed by its
+    // contents. If all the elements are strings, the list tag carries the element tag and the
+    // elements have no tags of their own.
+    if (_bytes && ((3 * kIntegerSize) <= _numBytes))
+    {
+        int32_t listTag = getInteger(_bytes);
+        int32_t count = getInteger(_bytes + kIntegerSize);
+
+        if ((BOTTLE_TAG_LIST | BOTTLE_TAG_STRING) == listTag)
+        {
+            offset = 2 * kIntegerSize;
+        }
+        else if ((BOTTLE_TAG_LIST == listTag) && ((4 * kIntegerSize) <= _numBytes) &&
+                 (BOTTLE_TAG_STRING == getInteger(_bytes + (2 * kIntegerSize))))
+        {
+            offset = 3 * kIntegerSize;
+        }
+        if ((0 < offset) && (0 < count))
+        {
+            int32_t length = getInteger(_bytes + offset);
+
+            offset += kIntegerSize;
+            if ((0 <= length) && ((offset + static_cast<size_t>(length)) <= _numBytes))
+            {
+                text = _bytes + offset;
+                textLength = static_cast<size_t>(length);
+                if ((0 < textLength) && (! text[textLength - 1]))
+                {
+                    --textLength;
+                }
+                offset += static_cast<size_t>(length);
+                if (1 == count)
+                {
+                    rest.clear();
+                }
+                else
+                {
+                    // Give the remaining elements a list header of their own; the storage keeps
+                    // its capacity, so this does not normally allocate.
+                    size_t restLength = _numBytes - offset;
+
+                    scratch.resize((2 * kIntegerSize) + restLength);
+                    putInteger(&scratch[0], listTag);
+                    putInteger(&scratch[kIntegerSize], count - 1);
+                    if (0 < restLength)
+                    {
+                        memcpy(&scratch[2 * kIntegerSize], _bytes + offset, restLength);
+                    }
+                    rest.fromBinary(&scratch[0], static_cast<int>(scratch.size()));
+                }
+                result = true;
+            }
+        }
+    }
+    ODL_OBJEXIT_B(result); //####
+    return result;
+} // RawInput::splitLeadingString
+
+#if defined(__APPLE__)
+# pragma mark Global functions
+#endif // defined(__APPLE__)
@@ -0,0 +1,182 @@
+//--------------------------------------------------------------------------------------------------
+//
+//  File:       m+m/m+mRawInput.hpp
+//
+//  Project:    m+m
+//
+//  Contains:   The class declaration for read-only access to the bytes of a received message.
+//
+//  Written by: Norman Jaffe
+//
+//  Copyright:  (c) 2026 by OpenDragon.
+//
+//              All rights reserved. Redistribution and use in source and binary forms, with or
+//              without modification, are permitted provided that the following conditions are met:
+//                * Redistributions of source code must retain the above copyright notice, this list
+//                  of conditions and the following disclaimer.
+//                * Redistributions in binary form must reproduce the above copyright notice, this
+//                  list of conditions and the following disclaimer in the documentation and / or
+//                  other materials provided with the distribution.
+//                * Neither the name of the copyright holders nor the names of its contributors may
+//                  be used to endorse or promote products derived from this software without
+//                  specific prior written permission.
+//
+//              THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//              EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//              OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//              SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//              INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//              TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//              BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//              CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//              ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//              DAMAGE.
+//
+//  Created:    2026-10-17
+//
+//--------------------------------------------------------------------------------------------------
+
+
+#if (! defined(MpMRawInput_HPP_))
+# define MpMRawInput_HPP_ /* Header guard */
+
+# include <m+m/m+mCommon.hpp>
+
+# if defined(__APPLE__)
+#  pragma clang diagnostic push
+#  pragma clang diagnostic ignored "-Wunknown-pragmas"
+#  pragma clang diagnostic ignored "-Wdocumentation-unknown-command"
+# endif // defined(__APPLE__)
+/*! @file
+ @brief The class declaration for read-only access to the bytes of a received message. */
+# if defined(__APPLE__)
+#  pragma clang diagnostic pop
+# endif // defined(__APPLE__)
+
+namespace MplusM
+{
+    namespace Common
+    {
+        /*! @brief Read-only access to the serialized form of a received message, which is only
+         decoded if it is asked for.
+
+         The bytes are owned by the input handler that received the message, so the object must
+         not be used after the input handler has returned. */
+        class RawInput
+        {
+        public :
+
+        protected :
+
+        private :
+
+        public :
+
+            /*! @brief The constructor.
+             @param[in] bytes The serialized form of the message.
+             @param[in] numBytes The number of bytes in the serialized form of the message. */
+            RawInput(const char * bytes,
+                     const size_t numBytes);
+
+            /*! @brief The destructor. */
+            virtual
+            ~RawInput(void);
+
+            /*! @brief Return the message, decoding it the first time that it is asked for.
+             @return The message. */
+            const yarp::os::Bottle &
+            asBottle(void);
+
+            /*! @brief Return the serialized form of the message.
+             @return The serialized form of the message. */
+            inline const char *
+            bytes(void)
+            const
+            {
+                return _bytes;
+            } // bytes
+
+            /*! @brief Return the contents of the message, if it consists of a single blob.
+             @param[out] blobBytes The contents of the blob, which refer to the serialized form of
+             the message.
+             @param[out] blobLength The number of bytes in the blob.
+             @return @c true if the message consists of a single blob and @c false otherwise. */
+            bool
+            getSingleBlob(const char * & blobBytes,
+                          size_t &       blobLength)
+            const;
+
+            /*! @brief Return the number of bytes in the serialized form of the message.
+             @return The number of bytes in the serialized form of the message. */
+            inline size_t
+            size(void)
+            const
+            {
+                return _numBytes;
+            } // size
+
+            /*! @brief Return the leading string of the message and the remaining elements, without
+             decoding the leading string.
+             @param[out] text The characters of the leading string, which refer to the serialized
+             form of the message.
+             @param[out] textLength The number of characters in the leading string.
+             @param[out] rest The elements that follow the leading string.
+             @param[in,out] scratch Storage for the serialized form of the remaining elements,
+             which can be reused from message to message.
+             @return @c true if the message starts with a string and @c false otherwise. */
+            bool
+            splitLeadingString(const char * &      text,
+                               size_t &            textLength,
+                               yarp::os::Bottle &  rest,
+                               std::vector<char> & scratch)
+            const;
+
+        protected :
+
+        private :
+
+            /*! @brief The copy constructor.
+             @param[in] other The object to be copied. */
+            RawInput(const RawInput & other);
+
+            /*! @brief The assignment operator.
+             @param[in] other The object to be copied.
+             @return The updated object. */
+            RawInput &
+            operator =(const RawInput & other);
+
+        public :
+
+        protected :
+
+        private :
+
+            /*! @brief The decoded message, once it has been asked for. */
+            yarp::os::Bottle _decoded;
+
+            /*! @brief The serialized form of the message. */
+            const char * _bytes;
+
+            /*! @brief The number of bytes in the serialized form of the message. */
+            size_t _numBytes;
+
+            /*! @brief @c true if the message has been decoded and @c false otherwise. */
+            bool _isDecoded;
+
+# if defined(__APPLE__)
+#  pragma clang diagnostic push
+#  pragma clang diagnostic ignored "-Wunused-private-field"
+# endif // defined(__APPLE__)
+            /*! @brief Filler to pad to alignment boundary */
+            char _filler[7];
+# if defined(__APPLE__)
+#  pragma clang diagnostic pop
+# endif // defined(__APPLE__)
+
+        }; // RawInput
+
+    } // Common
+
+} // MplusM
+
+#endif // ! defined(MpMRawInput_HPP_)
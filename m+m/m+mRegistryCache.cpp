@@ -0,0 +1,610 @@
+//--------------------------------------------------------------------------------------------------
+//
+//  File:       m+m/m+mRegistryCache.cpp
+//
+//  Project:    m+m
+//
+//  Contains:   The class definition for the local cache of Registry Service matches.
+//
+//  Written by: Norman Jaffe
+//
+//  Copyright:  (c) 2026 by OpenDragon.
+//
+//              All rights reserved. Redistribution and use in source and binary forms, with or
+//              without modification, are permitted provided that the following conditions are met:
+//                * Redistributions of source code must retain the above copyright notice, this list
+//                  of conditions and the following disclaimer.
+//                * Redistributions in binary form must reproduce the above copyright notice, this
+//                  list of conditions and the following disclaimer in the documentation and / or
+//                  other materials provided with the distribution.
+//                * Neither the name of the copyright holders nor the names of its contributors may
+//                  be used to endorse or promote products derived from this software without
+//                  specific prior written permission.
+//
+//              THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//              EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//              OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//              SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//              INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//              TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//              BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//              CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//              ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//              DAMAGE.
+//
+//  Created:    2026-10-17
+//
+//--------------------------------------------------------------------------------------------------
+
+
+#include "m+mRegistryCache.hpp"
+
+#include <m+m/m+mClientChannelPool.hpp>
+#include <m+m/m+mEndpoint.hpp>
+#include <m+m/m+mRequests.hpp>
+#include <m+m/m+mServiceRequest.hpp>
+#include <m+m/m+mServiceResponse.hpp>
+#include <m+m/m+mUtilities.hpp>
+
+//#include <odlEnable.h>
+#include <odlInclude.h>
+
+#include <set>
+
+#if defined(__APPLE__)
+# pragma clang diagnostic push
+# pragma clang diagnostic ignored "-Wunknown-pragmas"
+# pragma clang diagnostic ignored "-Wdocumentation-unknown-command"
+#endif // defined(__APPLE__)
+/*! @file
+ @brief The class definition for the local cache of %Registry Service matches. */
+#if defined(__APPLE__)
+# pragma clang diagnostic pop
+#endif // defined(__APPLE__)
+
+#if defined(__APPLE__)
+# pragma mark Namespace references
+#endif // defined(__APPLE__)
+
+using namespace MplusM;
+using namespace MplusM::Common;
+
+#if defined(__APPLE__)
+# pragma mark Private structures, constants and variables
+#endif // defined(__APPLE__)
+
+/*! @brief The criteria for a 'match' request that returns all the registered services. */
+#define ALL_SERVICES_CRITERIA_        MpM_REQREP_DICT_REQUEST_KEY_ ":*"
+
+/*! @brief The time between checks that the cache is still subscribed to the changes channel; a
+ subscription is lost if the %Registry Service is restarted. */
+#define SUBSCRIPTION_CHECK_INTERVAL_  PING_CHECK_INTERVAL_
+
+#if defined(__APPLE__)
+# pragma mark Global constants and variables
+#endif // defined(__APPLE__)
+
+#if defined(__APPLE__)
+# pragma mark Local functions
+#endif // defined(__APPLE__)
+
+#if defined(__APPLE__)
+# pragma mark Class methods
+#endif // defined(__APPLE__)
+
+void
+RegistryCache::Disable(void)
+{
+    ODL_ENTER(); //####
+    GetCache()->close();
+    ODL_EXIT(); //####
+} // RegistryCache::Disable
+
+bool
+RegistryCache::Enable(const double timeToWait)
+{
+    ODL_ENTER(); //####
+    ODL_D1("timeToWait = ", timeToWait); //####
+    bool result = GetCache()->open(timeToWait);
+
+    ODL_EXIT_B(result); //####
+    return result;
+} // RegistryCache::Enable
+
+RegistryCache *
+RegistryCache::GetCache(void)
+{
+    ODL_ENTER(); //####
+    // The cache is never deleted, so that it is still available while the process is exiting.
+    static RegistryCache *   lCache = NULL;
+    static yarp::os::Mutex * lCacheLock = new yarp::os::Mutex;
+
+    lCacheLock->lock();
+    if (! lCache)
+    {
+        lCache = new RegistryCache;
+    }
+    lCacheLock->unlock();
+    ODL_EXIT_P(lCache); //####
+    return lCache;
+} // RegistryCache::GetCache
+
+bool
+RegistryCache::Lookup(const YarpString & criteria,
+                      const bool         getNames,
+                      yarp::os::Bottle & response,
+                      int &              version)
+{
+    ODL_ENTER(); //####
+    ODL_S1s("criteria = ", criteria); //####
+    ODL_B1("getNames = ", getNames); //####
+    ODL_P2("response = ", &response, "version = ", &version); //####
+    RegistryCache * theCache = GetCache();
+    bool            found = false;
+    bool            isOpen;
+    bool            needsCheck;
+    bool            needsSynchronize;
+
+    version = -1;
+    theCache->_lock.lock();
+    isOpen = theCache->_isOpen;
+    needsCheck = (isOpen && ((theCache->_lastSubscriptionCheck + SUBSCRIPTION_CHECK_INTERVAL_) <
+                             yarp::os::Time::now()));
+    theCache->_lock.unlock();
+    if (needsCheck)
+    {
+        theCache->checkSubscription(STANDARD_WAIT_TIME_);
+    }
+    if (isOpen)
+    {
+        theCache->_lock.lock();
+        needsSynchronize = (theCache->_isOpen && (! theCache->_isSynchronized));
+        theCache->_lock.unlock();
+        if (needsSynchronize)
+        {
+            theCache->synchronize();
+        }
+        theCache->_lock.lock();
+        try
+        {
+            if (theCache->_isOpen && theCache->_isSynchronized)
+            {
+                ResultKey                 aKey(criteria, getNames);
+                ResultMap::const_iterator match(theCache->_results.find(aKey));
+
+                version = theCache->_version;
+                if (theCache->_results.end() != match)
+                {
+                    response = match->second;
+                    found = true;
+                }
+                else if (criteria == ALL_SERVICES_CRITERIA_)
+                {
+                    // Every service has requests, so the copy of the set of registered services
+                    // can be used directly.
+                    ServiceMap &         services = theCache->_services;
+                    std::set<YarpString> collected;
+
+                    for (ServiceMap::const_iterator walker(services.begin());
+                         services.end() != walker; ++walker)
+                    {
+                        collected.insert(getNames ? walker->second : walker->first);
+                    }
+                    response.clear();
+                    response.addString(MpM_OK_RESPONSE_);
+                    yarp::os::Bottle & matches = response.addList();
+
+                    for (std::set<YarpString>::const_iterator walker(collected.begin());
+                         collected.end() != walker; ++walker)
+                    {
+                        matches.addString(*walker);
+                    }
+                    theCache->_results[aKey] = response;
+                    found = true;
+                }
+            }
+        }
+        catch (...)
+        {
+            theCache->_lock.unlock();
+            ODL_LOG("Exception caught"); //####
+            throw;
+        }
+        theCache->_lock.unlock();
+    }
+    ODL_EXIT_B(found); //####
+    return found;
+} // RegistryCache::Lookup
+
+void
+RegistryCache::Remember(const YarpString &       criteria,
+                        const bool               getNames,
+                        const yarp::os::Bottle & response,
+                        const int                version)
+{
+    ODL_ENTER(); //####
+    ODL_S2s("criteria = ", criteria, "response = ", response.toString()); //####
+    ODL_B1("getNames = ", getNames); //####
+    ODL_I1("version = ", version); //####
+    if ((0 <= version) && (MpM_EXPECTED_MATCH_RESPONSE_SIZE_ == response.size()) &&
+        (response.get(0).toString() == MpM_OK_RESPONSE_))
+    {
+        RegistryCache * theCache = GetCache();
+
+        theCache->_lock.lock();
+        try
+        {
+            // A change that arrived while the request was outstanding might not be reflected in
+            // the response, so it is only kept if there has been no change.
+            if (theCache->_isOpen && theCache->_isSynchronized && (version == theCache->_version))
+            {
+                theCache->_results[ResultKey(criteria, getNames)] = response;
+            }
+        }
+        catch (...)
+        {
+            theCache->_lock.unlock();
+            ODL_LOG("Exception caught"); //####
+            throw;
+        }
+        theCache->_lock.unlock();
+    }
+    ODL_EXIT(); //####
+} // RegistryCache::Remember
+
+#if defined(__APPLE__)
+# pragma mark Constructors and Destructors
+#endif // defined(__APPLE__)
+
+RegistryCache::RegistryCache(void) :
+    inherited(), _results(), _services(), _endpoint(NULL), _endpointName(), _lock(),
+    _lastSubscriptionCheck(0), _version(0), _isOpen(false), _isSynchronized(false),
+    _needsSnapshot(true)
+{
+    ODL_ENTER(); //####
+    ODL_EXIT_P(this); //####
+} // RegistryCache::RegistryCache
+
+RegistryCache::~RegistryCache(void)
+{
+    ODL_OBJENTER(); //####
+    close();
+    ODL_OBJEXIT(); //####
+} // RegistryCache::~RegistryCache
+
+#if defined(__APPLE__)
+# pragma mark Actions and Accessors
+#endif // defined(__APPLE__)
+
+void
+RegistryCache::applyChange(const YarpString & kind,
+                           const YarpString & channelName,
+                           const YarpString & serviceName)
+{
+    ODL_OBJENTER(); //####
+    ODL_S3s("kind = ", kind, "channelName = ", channelName, "serviceName = ", //####
+            serviceName); //####
+    if (kind == MpM_REGISTRY_CHANGE_ADDED_)
+    {
+        _services[channelName] = serviceName;
+    }
+    else
+    {
+        _services.erase(channelName);
+    }
+    _results.clear();
+    ODL_OBJEXIT(); //####
+} // RegistryCache::applyChange
+
+void
+RegistryCache::checkSubscription(const double timeToWait)
+{
+    ODL_OBJENTER(); //####
+    ODL_D1("timeToWait = ", timeToWait); //####
+    YarpString endpointName;
+
+    _lock.lock();
+    endpointName = _endpointName;
+    _lastSubscriptionCheck = yarp::os::Time::now();
+    _lock.unlock();
+    if ((0 < endpointName.length()) &&
+        (! Utilities::CheckConnection(MpM_REGISTRY_CHANGES_NAME_, endpointName)))
+    {
+        // The changes that were sent while the cache was not subscribed cannot be recovered if
+        // the Registry Service was restarted, so the next synchronization uses a snapshot.
+        _lock.lock();
+        _isSynchronized = false;
+        _needsSnapshot = true;
+        _results.clear();
+        _lock.unlock();
+        if (! Utilities::NetworkConnectWithRetries(MpM_REGISTRY_CHANGES_NAME_, endpointName,
+                                                   timeToWait))
+        {
+            ODL_LOG("(! Utilities::NetworkConnectWithRetries(MpM_REGISTRY_CHANGES_NAME_, " //####
+                    "endpointName, timeToWait))"); //####
+        }
+    }
+    ODL_OBJEXIT(); //####
+} // RegistryCache::checkSubscription
+
+void
+RegistryCache::close(void)
+{
+    ODL_OBJENTER(); //####
+    if (_endpoint)
+    {
+        _endpoint->close();
+        delete _endpoint;
+        _endpoint = NULL;
+    }
+    _lock.lock();
+    _isOpen = false;
+    _isSynchronized = false;
+    _needsSnapshot = true;
+    _endpointName = "";
+    _results.clear();
+    _services.clear();
+    _lock.unlock();
+    ODL_OBJEXIT(); //####
+} // RegistryCache::close
+
+#if (! MAC_OR_LINUX_)
+# pragma warning(push)
+# pragma warning(disable: 4100)
+#endif // ! MAC_OR_LINUX_
+bool
+RegistryCache::handleInput(const yarp::os::Bottle &     input,
+                           const YarpString &           senderChannel,
+                           yarp::os::ConnectionWriter * replyMechanism,
+                           const size_t                 numBytes)
+{
+#if (! defined(ODL_ENABLE_LOGGING_))
+# if MAC_OR_LINUX_
+#  pragma unused(senderChannel,replyMechanism,numBytes)
+# endif // MAC_OR_LINUX_
+#endif // ! defined(ODL_ENABLE_LOGGING_)
+    ODL_OBJENTER(); //####
+    ODL_S2s("senderChannel = ", senderChannel, "got ", input.toString()); //####
+    ODL_P1("replyMechanism = ", replyMechanism); //####
+    ODL_I1("numBytes = ", numBytes); //####
+    bool result = false;
+
+    try
+    {
+        if (MpM_EXPECTED_REGISTRY_CHANGE_SIZE_ == input.size())
+        {
+            yarp::os::Value versionValue(input.get(0));
+            yarp::os::Value kindValue(input.get(1));
+            yarp::os::Value channelValue(input.get(2));
+            yarp::os::Value nameValue(input.get(3));
+
+            if (versionValue.isInt() && kindValue.isString() && channelValue.isString() &&
+                nameValue.isString())
+            {
+                int newVersion = versionValue.asInt();
+
+                _lock.lock();
+                try
+                {
+                    // A change that is already reflected in the cache is ignored; if a change was
+                    // missed, the cache is synchronized before it is used again.
+                    if (_isSynchronized)
+                    {
+                        if ((_version + 1) == newVersion)
+                        {
+                            applyChange(kindValue.toString(), channelValue.toString(),
+                                        nameValue.toString());
+                            _version = newVersion;
+                        }
+                        else if (_version < newVersion)
+                        {
+                            _isSynchronized = false;
+                            _results.clear();
+                        }
+                    }
+                }
+                catch (...)
+                {
+                    _lock.unlock();
+                    throw;
+                }
+                _lock.unlock();
+                result = true;
+            }
+            else
+            {
+                ODL_LOG("! (versionValue.isInt() && kindValue.isString() && " //####
+                        "channelValue.isString() && nameValue.isString())"); //####
+            }
+        }
+        else
+        {
+            ODL_LOG("! (MpM_EXPECTED_REGISTRY_CHANGE_SIZE_ == input.size())"); //####
+        }
+    }
+    catch (...)
+    {
+        ODL_LOG("Exception caught"); //####
+        throw;
+    }
+    ODL_OBJEXIT_B(result); //####
+    return result;
+} // RegistryCache::handleInput
+#if (! MAC_OR_LINUX_)
+# pragma warning(pop)
+#endif // ! MAC_OR_LINUX_
+
+bool
+RegistryCache::open(const double timeToWait)
+{
+    ODL_OBJENTER(); //####
+    ODL_D1("timeToWait = ", timeToWait); //####
+    bool result = false;
+
+    try
+    {
+        if (! _endpoint)
+        {
+            YarpString aName(GetRandomChannelName(HIDDEN_CHANNEL_PREFIX_
+                                                  BUILD_NAME_("changes_", DEFAULT_CHANNEL_ROOT_)));
+
+            _endpoint = new Endpoint(aName);
+#if defined(MpM_ReportOnConnections)
+            _endpoint->setReporter(*Utilities::GetGlobalStatusReporter(), true);
+#endif // defined(MpM_ReportOnConnections)
+            if (_endpoint->setInputHandler(*this) && _endpoint->open(timeToWait))
+            {
+                _lock.lock();
+                _endpointName = _endpoint->getName();
+                _lastSubscriptionCheck = yarp::os::Time::now();
+                _isOpen = true;
+                _isSynchronized = false;
+                _needsSnapshot = true;
+                _lock.unlock();
+                // The subscription is made before the snapshot is requested, so that no change is
+                // lost between them.
+                if (! Utilities::NetworkConnectWithRetries(MpM_REGISTRY_CHANGES_NAME_,
+                                                           _endpointName, timeToWait))
+                {
+                    ODL_LOG("(! Utilities::NetworkConnectWithRetries(" //####
+                            "MpM_REGISTRY_CHANGES_NAME_, _endpointName, timeToWait))"); //####
+                    close();
+                }
+            }
+            else
+            {
+                ODL_LOG("! (_endpoint->setInputHandler(*this) && " //####
+                        "_endpoint->open(timeToWait))"); //####
+                delete _endpoint;
+                _endpoint = NULL;
+            }
+        }
+        if (_endpoint)
+        {
+            result = synchronize();
+        }
+    }
+    catch (...)
+    {
+        ODL_LOG("Exception caught"); //####
+        throw;
+    }
+    ODL_OBJEXIT_B(result); //####
+    return result;
+} // RegistryCache::open
+
+bool
+RegistryCache::synchronize(void)
+{
+    ODL_OBJENTER(); //####
+    bool result = false;
+
+    try
+    {
+        yarp::os::Bottle parameters;
+        bool             needsSnapshot;
+        int              knownVersion;
+
+        _lock.lock();
+        needsSnapshot = _needsSnapshot;
+        knownVersion = _version;
+        _lock.unlock();
+        if (! needsSnapshot)
+        {
+            parameters.addInt(knownVersion);
+        }
+        ServiceRequest  request(MpM_CHANGES_REQUEST_, parameters);
+        ServiceResponse response;
+
+        if (ClientChannelPool::SendRequest(MpM_REGISTRY_ENDPOINT_NAME_, request, response, true,
+                                           false))
+        {
+            ODL_S1s("response <- ", response.asString()); //####
+            if ((MpM_EXPECTED_CHANGES_RESPONSE_SIZE_ == response.count()) &&
+                (response.element(0).toString() == MpM_OK_RESPONSE_))
+            {
+                yarp::os::Value    versionValue(response.element(1));
+                YarpString         kind(response.element(2).toString());
+                yarp::os::Bottle * entries = response.element(3).asList();
+
+                if (versionValue.isInt() && entries)
+                {
+                    _lock.lock();
+                    try
+                    {
+                        if (kind == MpM_REGISTRY_CHANGES_SNAPSHOT_)
+                        {
+                            _services.clear();
+                            for (int ii = 0, mm = entries->size(); mm > ii; ++ii)
+                            {
+                                yarp::os::Bottle * aService = entries->get(ii).asList();
+
+                                if (aService && (2 == aService->size()))
+                                {
+                                    _services[aService->get(0).toString()] =
+                                                                    aService->get(1).toString();
+                                }
+                            }
+                            result = true;
+                        }
+                        else if ((kind == MpM_REGISTRY_CHANGES_DELTAS_) &&
+                                 (knownVersion == _version))
+                        {
+                            for (int ii = 0, mm = entries->size(); mm > ii; ++ii)
+                            {
+                                yarp::os::Bottle * aChange = entries->get(ii).asList();
+
+                                if (aChange &&
+                                    (MpM_EXPECTED_REGISTRY_CHANGE_SIZE_ == aChange->size()))
+                                {
+                                    applyChange(aChange->get(1).toString(),
+                                                aChange->get(2).toString(),
+                                                aChange->get(3).toString());
+                                }
+                            }
+                            result = true;
+                        }
+                        if (result)
+                        {
+                            _version = versionValue.asInt();
+                            _results.clear();
+                            _isSynchronized = _isOpen;
+                            _needsSnapshot = false;
+                        }
+                    }
+                    catch (...)
+                    {
+                        _lock.unlock();
+                        throw;
+                    }
+                    _lock.unlock();
+                }
+                else
+                {
+                    ODL_LOG("! (versionValue.isInt() && entries)"); //####
+                }
+            }
+            else
+            {
+                ODL_LOG("! ((MpM_EXPECTED_CHANGES_RESPONSE_SIZE_ == response.count()) && " //####
+                        "(response.element(0).toString() == MpM_OK_RESPONSE_))"); //####
+            }
+        }
+        else
+        {
+            ODL_LOG("! (ClientChannelPool::SendRequest(MpM_REGISTRY_ENDPOINT_NAME_, " //####
+                    "request, response, true, false))"); //####
+        }
+    }
+    catch (...)
+    {
+        ODL_LOG("Exception caught"); //####
+        throw;
+    }
+    ODL_OBJEXIT_B(result); //####
+    return result;
+} // RegistryCache::synchronize
+
+#if defined(__APPLE__)
+# pragma mark Global functions
+#endif // defined(__APPLE__)
@@ -0,0 +1,258 @@
+//--------------------------------------------------------------------------------------------------
+//
+//  File:       m+m/m+mRegistryCache.hpp
+//
+//  Project:    m+m
+//
+//  Contains:   The class declaration for the local cache of Registry Service matches.
+//
+//  Written by: Norman Jaffe
+//
+//  Copyright:  (c) 2026 by OpenDragon.
+//
+//              All rights reserved. Redistribution and use in source and binary forms, with or
+//              without modification, are permitted provided that the following conditions are met:
+//                * Redistributions of source code must retain the above copyright notice, this list
+//                  of conditions and the following disclaimer.
+//                * Redistributions in binary form must reproduce the above copyright notice, this
+//                  list of conditions and the following disclaimer in the documentation and / or
+//                  other materials provided with the distribution.
+//                * Neither the name of the copyright holders nor the names of its contributors may
+//                  be used to endorse or promote products derived from this software without
+//                  specific prior written permission.
+//
+//              THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//              EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//              OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//              SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//              INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//              TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//              BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//              CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//              ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//              DAMAGE.
+//
+//  Created:    2026-10-17
+//
+//--------------------------------------------------------------------------------------------------
+
+
+#if (! defined(MpMRegistryCache_HPP_))
+# define MpMRegistryCache_HPP_ /* Header guard */
+
+# include <m+m/m+mBaseInputHandler.hpp>
+
+# if defined(__APPLE__)
+#  pragma clang diagnostic push
+#  pragma clang diagnostic ignored "-Wunknown-pragmas"
+#  pragma clang diagnostic ignored "-Wdocumentation-unknown-command"
+# endif // defined(__APPLE__)
+/*! @file
+ @brief The class declaration for the local cache of %Registry Service matches. */
+# if defined(__APPLE__)
+#  pragma clang diagnostic pop
+# endif // defined(__APPLE__)
+
+namespace MplusM
+{
+    namespace Common
+    {
+        class Endpoint;
+
+        /*! @brief The process-wide cache of the responses to 'match' requests.
+
+         When the cache is enabled, it subscribes to the changes channel of the %Registry Service
+         and keeps a copy of the set of registered services, starting from a snapshot returned by
+         the 'changes' request and applying each change as it arrives. Responses to 'match'
+         requests are retained until the next change, so that repeated lookups do not contact the
+         %Registry Service; a lookup for all services is answered from the copy of the set of
+         registered services. If a change is missed, the cache catches up with the 'changes'
+         request before it is used again. */
+        class RegistryCache : public BaseInputHandler
+        {
+        public :
+
+        protected :
+
+        private :
+
+            /*! @brief The class that this class is derived from. */
+            typedef BaseInputHandler inherited;
+
+            /*! @brief The criteria and the kind of result of a 'match' request. */
+            typedef std::pair<YarpString, bool> ResultKey;
+
+            /*! @brief The responses to 'match' requests. */
+            typedef std::map<ResultKey, yarp::os::Bottle> ResultMap;
+
+            /*! @brief The names of the registered services, indexed by service channel. */
+            typedef std::map<YarpString, YarpString> ServiceMap;
+
+        public :
+
+            /*! @brief The destructor. */
+            virtual
+            ~RegistryCache(void);
+
+            /*! @brief Stop using the cache and close its channel; this should be done before the
+             network is shut down. */
+            static void
+            Disable(void);
+
+            /*! @brief Start using the cache, by subscribing to the changes channel of the
+             %Registry Service.
+             @param[in] timeToWait The number of seconds allowed before a failure is considered.
+             @return @c true if the cache is in use and @c false otherwise. */
+            static bool
+            Enable(const double timeToWait = STANDARD_WAIT_TIME_);
+
+            /*! @brief Look for the response to a 'match' request in the cache.
+             @param[in] criteria The matching conditions.
+             @param[in] getNames @c true if service names are to be returned and @c false if
+             service channels are to be returned.
+             @param[out] response The response to the request, if it is in the cache.
+             @param[out] version The version of the cache, to be passed to Remember() once the
+             response has been received from the %Registry Service, or a negative value if the
+             cache is not in use.
+             @return @c true if the response was found in the cache and @c false otherwise. */
+            static bool
+            Lookup(const YarpString & criteria,
+                   const bool         getNames,
+                   yarp::os::Bottle & response,
+                   int &              version);
+
+            /*! @brief Add the response to a 'match' request to the cache, if there have been no
+             changes since it was requested.
+             @param[in] criteria The matching conditions.
+             @param[in] getNames @c true if service names were returned and @c false if service
+             channels were returned.
+             @param[in] response The response from the %Registry Service.
+             @param[in] version The version of the cache that was returned by Lookup(). */
+            static void
+            Remember(const YarpString &       criteria,
+                     const bool               getNames,
+                     const yarp::os::Bottle & response,
+                     const int                version);
+
+        protected :
+
+        private :
+
+            /*! @brief The constructor. */
+            RegistryCache(void);
+
+            /*! @brief The copy constructor.
+             @param[in] other The object to be copied. */
+            RegistryCache(const RegistryCache & other);
+
+            /*! @brief Apply a change to the copy of the set of registered services.
+             The lock must be held by the caller.
+             @param[in] kind The kind of change.
+             @param[in] channelName The service channel that was changed.
+             @param[in] serviceName The name of the service that was changed. */
+            void
+            applyChange(const YarpString & kind,
+                        const YarpString & channelName,
+                        const YarpString & serviceName);
+
+            /*! @brief Check that the cache is still subscribed to the changes channel, and
+             subscribe again if it is not.
+             @param[in] timeToWait The number of seconds allowed before a failure is considered. */
+            void
+            checkSubscription(const double timeToWait);
+
+            /*! @brief Close the channel and discard the contents of the cache. */
+            void
+            close(void);
+
+            /*! @brief Return the cache, creating it if necessary.
+             @return The cache. */
+            static RegistryCache *
+            GetCache(void);
+
+            /*! @brief Process partially-structured input data.
+             @param[in] input The partially-structured input data.
+             @param[in] senderChannel The name of the channel used to send the input data.
+             @param[in] replyMechanism @c NULL if no reply is expected and non-@c NULL otherwise.
+             @param[in] numBytes The number of bytes available on the connection.
+             @return @c true if the input was correctly structured and successfully processed. */
+            virtual bool
+            handleInput(const yarp::os::Bottle &     input,
+                        const YarpString &           senderChannel,
+                        yarp::os::ConnectionWriter * replyMechanism,
+                        const size_t                 numBytes);
+
+            /*! @brief Open the channel and subscribe to the changes channel of the %Registry
+             Service.
+             @param[in] timeToWait The number of seconds allowed before a failure is considered.
+             @return @c true if the cache is subscribed and synchronized and @c false otherwise. */
+            bool
+            open(const double timeToWait);
+
+            /*! @brief The assignment operator.
+             @param[in] other The object to be copied.
+             @return The updated object. */
+            RegistryCache &
+            operator =(const RegistryCache & other);
+
+            /*! @brief Bring the copy of the set of registered services up to date, using the
+             'changes' request.
+             @return @c true if the cache is synchronized and @c false otherwise. */
+            bool
+            synchronize(void);
+
+        public :
+
+        protected :
+
+        private :
+
+            /*! @brief The responses to 'match' requests that were made since the last change. */
+            ResultMap _results;
+
+            /*! @brief The registered services. */
+            ServiceMap _services;
+
+            /*! @brief The channel on which the changes arrive. */
+            Endpoint * _endpoint;
+
+            /*! @brief The name of the channel on which the changes arrive. */
+            YarpString _endpointName;
+
+            /*! @brief The contention lock used to control access to the cache. */
+            yarp::os::Mutex _lock;
+
+            /*! @brief The time at which the subscription was last checked. */
+            double _lastSubscriptionCheck;
+
+            /*! @brief The version of the set of registered services that the cache reflects. */
+            int _version;
+
+            /*! @brief @c true if the channel is open and @c false otherwise. */
+            bool _isOpen;
+
+            /*! @brief @c true if the cache reflects the set of registered services and @c false if
+             it must be synchronized before it can be used. */
+            bool _isSynchronized;
+
+            /*! @brief @c true if the next synchronization must use a snapshot, as changes might
+             have been sent while the cache was not subscribed, and @c false otherwise. */
+            bool _needsSnapshot;
+
+# if defined(__APPLE__)
+#  pragma clang diagnostic push
+#  pragma clang diagnostic ignored "-Wunused-private-field"
+# endif // defined(__APPLE__)
+            /*! @brief Filler to pad to alignment boundary */
+            char _filler[1];
+# if defined(__APPLE__)
+#  pragma clang diagnostic pop
+# endif // defined(__APPLE__)
+
+        }; // RegistryCache
+
+    } // Common
+
+} // MplusM
+
+#endif // ! defined(MpMRegistryCache_HPP_)
@@ -73,16 +73,81 @@ using namespace MplusM::Common;
 # pragma mark Local functions
 #endif // defined(__APPLE__)
 
+/*! @brief Compare a request name with a sequence of characters.
+ @param[in] name The request name.
+ @param[in] request The characters to be compared.
+ @param[in] requestLength The number of characters to be compared.
+ @return A negative value if the request name comes first, zero if they are the same and a
+ positive value if the characters come first. */
+static int
+compareRequestName(const YarpString & name,
+                   const char *       request,
+                   const size_t       requestLength)
+{
+    size_t nameLength = name.length();
+    int    result = memcmp(name.c_str(), request, std::min(nameLength, requestLength));
+
+    if (! result)
+    {
+        if (nameLength < requestLength)
+        {
+            result = -1;
+        }
+        else if (nameLength > requestLength)
+        {
+            result = 1;
+        }
+    }
+    return result;
+} // compareRequestName
+
 #if defined(__APPLE__)
 # pragma mark Class methods
 #endif // defined(__APPLE__)
 
+const RequestMap::RequestEntry *
+RequestMap::FindEntry(const RequestTable & table,
+                      const char *         request,
+                      const size_t         requestLength)
+{
+    ODL_ENTER(); //####
+    ODL_P1("table = ", &table); //####
+    ODL_P1("request = ", request); //####
+    ODL_I1("requestLength = ", requestLength); //####
+    const RequestEntry * result = NULL;
+    size_t               low = 0;
+    size_t               high = table.size();
+
+    while (low < high)
+    {
+        size_t middle = low + ((high - low) / 2);
+        int    order = compareRequestName(table[middle]._name, request, requestLength);
+
+        if (0 > order)
+        {
+            low = middle + 1;
+        }
+        else if (0 < order)
+        {
+            high = middle;
+        }
+        else
+        {
+            result = &table[middle];
+            break;
+        }
+
+    }
+    ODL_EXIT_P(result); //####
+    return result;
+} // RequestMap::FindEntry
+
 #if defined(__APPLE__)
 # pragma mark Constructors and Destructors
 #endif // defined(__APPLE__)
 
 RequestMap::RequestMap(BaseService & owner) :
-    _defaultHandler(NULL), _handlers(), _owner(owner)
+    _retiredTables(), _defaultHandler(NULL), _table(new RequestTable), _owner(owner)
 {
     ODL_ENTER(); //####
     ODL_P1("owner = ", &owner); //####
@@ -92,6 +157,12 @@ RequestMap::RequestMap(BaseService & owner) :
 RequestMap::~RequestMap(void)
 {
     ODL_OBJENTER(); //####
+    delete _table.load();
+    for (std::vector<const RequestTable *>::iterator walker(_retiredTables.begin());
+         _retiredTables.end() != walker; ++walker)
+    {
+        delete *walker;
+    }
     ODL_OBJEXIT(); //####
 } // RequestMap::~RequestMap
 
@@ -105,19 +176,15 @@ RequestMap::fillInListReply(yarp::os::Bottle & reply)
     ODL_OBJENTER(); //####
     try
     {
-        lock();
-        if (0 < _handlers.size())
+        const RequestTable & table = *_table.load(std::memory_order_acquire);
+
+        for (RequestTable::const_iterator walker(table.begin()); table.end() != walker;
+             ++walker)
         {
-            for (RequestHandlerMap::const_iterator walker = _handlers.begin();
-                 _handlers.end() != walker; ++walker)
-            {
-                yarp::os::Property & aDict = reply.addDict();
-                BaseRequestHandler * aHandler = walker->second;
+            yarp::os::Property & aDict = reply.addDict();
 
-                aHandler->fillInDescription(walker->first.c_str(), aDict);
-            }
+            walker->_handler->fillInDescription(walker->_name.c_str(), aDict);
         }
-        unlock();
     }
     catch (...)
     {
@@ -134,21 +201,19 @@ RequestMap::fillInRequestInfo(yarp::os::Bottle & reply,
     ODL_OBJENTER(); //####
     try
     {
-        lock();
-        RequestHandlerMap::const_iterator match(_handlers.find(requestName));
+        const RequestEntry * match = FindEntry(*_table.load(std::memory_order_acquire),
+                                               requestName.c_str(), requestName.length());
 
-        if (_handlers.end() == match)
+        if (match)
         {
-            ODL_LOG("(_handlers.end() == match)"); //####
+            yarp::os::Property & aDict = reply.addDict();
+
+            match->_handler->fillInDescription(match->_name.c_str(), aDict);
         }
         else
         {
-            yarp::os::Property & aDict = reply.addDict();
-            BaseRequestHandler * aHandler = match->second;
-
-            aHandler->fillInDescription(match->first.c_str(), aDict);
+            ODL_LOG("! (match)"); //####
         }
-        unlock();
     }
     catch (...)
     {
@@ -163,33 +228,60 @@ RequestMap::lookupRequestHandler(const YarpString & request)
 {
     ODL_OBJENTER(); //####
     ODL_S1s("request = ", request); //####
-    BaseRequestHandler * result = NULL;
+    const YarpString *   requestName;
+    BaseRequestHandler * result = lookupRequestHandler(request.c_str(), request.length(),
+                                                       requestName);
 
-    try
+    ODL_OBJEXIT_P(result); //####
+    return result;
+} // RequestMap::lookupRequestHandler
+
+BaseRequestHandler *
+RequestMap::lookupRequestHandler(const char *         request,
+                                 const size_t         requestLength,
+                                 const YarpString * & requestName)
+{
+    ODL_OBJENTER(); //####
+    ODL_P1("request = ", request); //####
+    ODL_I1("requestLength = ", requestLength); //####
+    BaseRequestHandler * result;
+    const RequestEntry * match = FindEntry(*_table.load(std::memory_order_acquire), request,
+                                           requestLength);
+
+    if (match)
     {
-        lock();
-        RequestHandlerMap::const_iterator match(_handlers.find(request));
+        ODL_LOG("(match)"); //####
+        requestName = &match->_name;
+        result = match->_handler;
+    }
+    else
+    {
+        ODL_LOG("! (match)"); //####
+        requestName = NULL;
+        result = _defaultHandler.load(std::memory_order_acquire);
+    }
+    ODL_OBJEXIT_P(result); //####
+    return result;
+} // RequestMap::lookupRequestHandler
 
-        if (_handlers.end() == match)
-        {
-            ODL_LOG("(_handlers.end() == match)"); //####
-            result = _defaultHandler;
-        }
-        else
-        {
-            ODL_LOG("! (_handlers.end() == match)"); //####
-            result = match->second;
-        }
-        unlock();
+void
+RequestMap::publishTable(RequestTable * newTable)
+{
+    ODL_OBJENTER(); //####
+    ODL_P1("newTable = ", newTable); //####
+    try
+    {
+        _retiredTables.push_back(_table.load());
+        _table.store(newTable, std::memory_order_release);
     }
     catch (...)
     {
         ODL_LOG("Exception caught"); //####
+        delete newTable;
         throw;
     }
-    ODL_OBJEXIT_P(result); //####
-    return result;
-} // RequestMap::lookupRequestHandler
+    ODL_OBJEXIT(); //####
+} // RequestMap::publishTable
 
 void
 RequestMap::registerRequestHandler(BaseRequestHandler * handler)
@@ -200,18 +292,47 @@ RequestMap::registerRequestHandler(BaseRequestHandler * handler)
     {
         if (handler)
         {
-            YarpStringVector aliases;
+            YarpStringVector requestNames;
 
-            handler->fillInAliases(aliases);
+            requestNames.push_back(handler->name());
+            handler->fillInAliases(requestNames);
             lock();
-            _handlers.insert(RequestHandlerMapValue(handler->name(), handler));
-            if (0 < aliases.size())
+            try
             {
-                for (YarpStringVector::const_iterator walker(aliases.begin());
-                     aliases.end() != walker; ++walker)
+                RequestTable * newTable = new RequestTable(*_table.load());
+
+                for (YarpStringVector::const_iterator walker(requestNames.begin());
+                     requestNames.end() != walker; ++walker)
                 {
-                    _handlers.insert(RequestHandlerMapValue(*walker, handler));
+                    RequestTable::iterator position(newTable->begin());
+                    int                    order = 1;
+
+                    // Find where the request belongs; an existing entry is not replaced.
+                    for ( ; newTable->end() != position; ++position)
+                    {
+                        order = compareRequestName(position->_name, walker->c_str(),
+                                                   walker->length());
+                        if (0 <= order)
+                        {
+                            break;
+                        }
+
+                    }
+                    if (order)
+                    {
+                        RequestEntry anEntry;
+
+                        anEntry._name = *walker;
+                        anEntry._handler = handler;
+                        newTable->insert(position, anEntry);
+                    }
                 }
+                publishTable(newTable);
+            }
+            catch (...)
+            {
+                unlock();
+                throw;
             }
             unlock();
             handler->setOwner(*this);
@@ -230,9 +351,7 @@ RequestMap::setDefaultRequestHandler(BaseRequestHandler * handler)
 {
     ODL_OBJENTER(); //####
     ODL_P1("handler = ", handler); //####
-    lock();
-    _defaultHandler = handler;
-    unlock();
+    _defaultHandler.store(handler, std::memory_order_release);
     ODL_OBJEXIT(); //####
 } // RequestMap::setDefaultRequestHandler
 
@@ -245,18 +364,32 @@ RequestMap::unregisterRequestHandler(BaseRequestHandler * handler)
     {
         if (handler)
         {
-            YarpStringVector aliases;
+            YarpStringVector requestNames;
 
-            handler->fillInAliases(aliases);
+            requestNames.push_back(handler->name());
+            handler->fillInAliases(requestNames);
             lock();
-            _handlers.erase(handler->name());
-            if (0 < aliases.size())
+            try
             {
-                for (YarpStringVector::const_iterator walker(aliases.begin());
-                     aliases.end() != walker; ++walker)
+                RequestTable * newTable = new RequestTable(*_table.load());
+
+                for (YarpStringVector::const_iterator walker(requestNames.begin());
+                     requestNames.end() != walker; ++walker)
                 {
-                    _handlers.erase(*walker);
+                    const RequestEntry * match = FindEntry(*newTable, walker->c_str(),
+                                                           walker->length());
+
+                    if (match)
+                    {
+                        newTable->erase(newTable->begin() + (match - &newTable->front()));
+                    }
                 }
+                publishTable(newTable);
+            }
+            catch (...)
+            {
+                unlock();
+                throw;
             }
             unlock();
         }
@@ -41,6 +41,8 @@
 
 # include <m+m/m+mCommon.hpp>
 
+# include <atomic>
+
 # if defined(__APPLE__)
 #  pragma clang diagnostic push
 #  pragma clang diagnostic ignored "-Wunknown-pragmas"
@@ -68,11 +70,20 @@ namespace MplusM
 
         private :
 
-            /*! @brief A mapping from strings to requests. */
-            typedef std::map<YarpString, BaseRequestHandler *> RequestHandlerMap;
+            /*! @brief The association between a request name and its handler. */
+            struct RequestEntry
+            {
+                /*! @brief The name of the request. */
+                YarpString _name;
+
+                /*! @brief The handler for the request. */
+                BaseRequestHandler * _handler;
 
-            /*! @brief The entry-type for the mapping. */
-            typedef RequestHandlerMap::value_type RequestHandlerMapValue;
+            }; // RequestEntry
+
+            /*! @brief The request handlers, in order of request name. A table is not modified once
+             it has been published; changes are made to a copy, which then replaces it. */
+            typedef std::vector<RequestEntry> RequestTable;
 
         public :
 
@@ -104,6 +115,20 @@ namespace MplusM
             BaseRequestHandler *
             lookupRequestHandler(const YarpString & request);
 
+            /*! @brief Return the function corresponding to a particular request, without
+             constructing a string for the request name.
+             @param[in] request The characters of the requested operation; they need not be
+             terminated.
+             @param[in] requestLength The number of characters in the requested operation.
+             @param[out] requestName The stored name of the request, which remains valid as long
+             as the mapping exists, or @c NULL if the request is not recognized.
+             @return A pointer to the function to be invoked for the request, or @c NULL if it is
+             not recognized and there is no default handler. */
+            BaseRequestHandler *
+            lookupRequestHandler(const char *         request,
+                                 const size_t         requestLength,
+                                 const YarpString * & requestName);
+
             /*! @brief Remember the function to be used to handle a particular request.
              @param[in] handler The function to be called for the request. */
             void
@@ -127,13 +152,15 @@ namespace MplusM
              @param[in] other The object to be copied. */
             RequestMap(const RequestMap & other);
 
-            /*! @brief Lock the data unless the lock would block.
-             @return @c true if the data was locked and @c false otherwise. */
-            inline bool
-            conditionallyLock(void)
-            {
-                return _lock.tryLock();
-            } // conditionallyLock
+            /*! @brief Locate the entry for a request in a table of request handlers.
+             @param[in] table The table to be searched.
+             @param[in] request The characters of the requested operation.
+             @param[in] requestLength The number of characters in the requested operation.
+             @return The matching entry or @c NULL if the request is not in the table. */
+            static const RequestEntry *
+            FindEntry(const RequestTable & table,
+                      const char *         request,
+                      const size_t         requestLength);
 
             /*! @brief Lock the data. */
             inline void
@@ -148,6 +175,13 @@ namespace MplusM
             RequestMap &
             operator =(const RequestMap & other);
 
+            /*! @brief Replace the published table of request handlers.
+             The lock must be held by the caller; the previous table is retained until the mapping
+             is destroyed, as a lookup might still be in progress with it.
+             @param[in] newTable The table to be published. */
+            void
+            publishTable(RequestTable * newTable);
+
             /*! @brief Unlock the data. */
             inline void
             unlock(void)
@@ -161,14 +195,17 @@ namespace MplusM
 
         private :
 
-            /*! @brief The contention lock used to avoid inconsistencies. */
+            /*! @brief The contention lock used to serialize changes to the mapping. */
             yarp::os::Mutex _lock;
 
+            /*! @brief The tables that have been replaced. */
+            std::vector<const RequestTable *> _retiredTables;
+
             /*! @brief The default handler to use for unrecognized requests. */
-            BaseRequestHandler * _defaultHandler;
+            std::atomic<BaseRequestHandler *> _defaultHandler;
 
-            /*! @brief The map between requests and request handlers. */
-            RequestHandlerMap _handlers;
+            /*! @brief The published table of request handlers. */
+            std::atomic<const RequestTable *> _table;
 
             /*! @brief The service that owns this map. */
             BaseService & _owner;
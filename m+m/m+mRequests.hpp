@@ -59,12 +59,23 @@
 /*! @brief The name of the secondary port for the %Registry Service. */
 # define MpM_REGISTRY_STATUS_NAME_         BUILD_NAME_(MpM_REGISTRY_ENDPOINT_NAME_, "status")
 
+/*! @brief The name of the port on which the %Registry Service sends the changes to the set of
+ registered services. */
+# define MpM_REGISTRY_CHANGES_NAME_        BUILD_NAME_(MpM_REGISTRY_ENDPOINT_NAME_, "changes")
+
+/*! @brief The marker for a request whose response is sent to the reply channel of the client
+ rather than being returned on the connection. */
+# define MpM_ASYNC_REQUEST_MARKER_         "mpm_async"
+
 /*! @brief The name for an 'argumentDescriptions' request. */
 # define MpM_ARGUMENTDESCRIPTIONS_REQUEST_ "argumentDescriptions"
 
 /*! @brief The name for an 'arguments' request. */
 # define MpM_ARGUMENTS_REQUEST_            "arguments"
 
+/*! @brief The standard name for a 'changes' request. */
+# define MpM_CHANGES_REQUEST_              "changes"
+
 /*! @brief The standard name for a 'channels' request. */
 # define MpM_CHANNELS_REQUEST_             "channels"
 
@@ -131,9 +142,21 @@
 /*! @brief The name for a 'where' request. */
 # define MpM_WHERE_REQUEST_                "where"
 
+/*! @brief The number of elements preceding the request name in an asynchronous request. */
+# define MpM_ASYNC_REQUEST_HEADER_SIZE_              3
+
+/*! @brief The number of elements expected in the response to an asynchronous request. */
+# define MpM_EXPECTED_ASYNC_RESPONSE_SIZE_           2
+
+/*! @brief The number of elements expected in a 'busy' response from the %Registry Service. */
+# define MpM_EXPECTED_BUSY_RESPONSE_SIZE_            2
+
 /*! @brief The number of elements expected in a channel description. */
 # define MpM_EXPECTED_CHANNEL_DESCRIPTOR_SIZE_ 3
 
+/*! @brief The number of elements expected in the output of a 'changes' request. */
+# define MpM_EXPECTED_CHANGES_RESPONSE_SIZE_         4
+
 /*! @brief The number of elements expected in the output of a 'channels' request. */
 # define MpM_EXPECTED_CHANNELS_RESPONSE_SIZE_        3
 
@@ -182,6 +205,11 @@
 /*! @brief The number of elements expected in the output of an 'where' request. */
 # define MpM_EXPECTED_WHERE_RESPONSE_SIZE_           2
 
+/*! @brief The response to a %Registry Service request that could not be accepted because the
+ %Registry Service is overloaded; it is followed by the number of seconds to wait before trying
+ again. */
+# define MpM_BUSY_RESPONSE_        "BUSY"
+
 /*! @brief The standard response to an invalid %Registry Service request. */
 # define MpM_FAILED_RESPONSE_      "FAILED"
 
@@ -203,6 +231,9 @@
 /*! @brief A service or request could not be added to the registry. */
 # define MpM_REGISTRY_STATUS_PROBLEM_       "problem"
 
+/*! @brief Services were recovered from the persistent database when the registry started. */
+# define MpM_REGISTRY_STATUS_RECOVERED_     "recovered"
+
 /*! @brief A service is being registered in the registry. */
 # define MpM_REGISTRY_STATUS_REGISTERING_   "registering"
 
@@ -227,6 +258,41 @@
 /*! @brief A service is being unregistered from the registry. */
 # define MpM_REGISTRY_STATUS_UNREGISTERING_ "unregistering"
 
+/*! @brief The number of elements expected in a %Registry Service change message. */
+# define MpM_EXPECTED_REGISTRY_CHANGE_SIZE_ 4
+
+/*! @brief A service was added to the registry. */
+# define MpM_REGISTRY_CHANGE_ADDED_         "added"
+
+/*! @brief A service was removed from the registry. */
+# define MpM_REGISTRY_CHANGE_REMOVED_       "removed"
+
+/*! @brief A service was removed from the registry because it has not pinged the registry
+ recently. */
+# define MpM_REGISTRY_CHANGE_STALE_         "stale"
+
+/*! @brief The output of a 'changes' request is the changes since the requested version. */
+# define MpM_REGISTRY_CHANGES_DELTAS_       "deltas"
+
+/*! @brief The output of a 'changes' request is the complete set of registered services. */
+# define MpM_REGISTRY_CHANGES_SNAPSHOT_     "snapshot"
+
+/*! @brief The metrics key for the time taken to absorb the most recent surge of registrations. */
+# define MpM_REGISTRY_HERD_RECOVERY_TIME_   "herdRecoveryTime"
+
+/*! @brief The metrics key for the number of times that the registry became overloaded. */
+# define MpM_REGISTRY_OVERLOAD_EPISODES_    "overloadEpisodes"
+
+/*! @brief The metrics key for the number of services recovered when the registry started. */
+# define MpM_REGISTRY_RECOVERED_SERVICES_   "recoveredServices"
+
+/*! @brief The metrics key for the time taken to recover the services when the registry started. */
+# define MpM_REGISTRY_RECOVERY_TIME_        "recoveryTime"
+
+/*! @brief The metrics key for the number of requests that were turned away because the registry
+ was overloaded. */
+# define MpM_REGISTRY_REJECTED_REQUESTS_    "rejectedRequests"
+
 /*! @brief Request/response specification character - zero or one repetitions of preceding. */
 # define MpM_REQREP_0_OR_1_     "?"
 
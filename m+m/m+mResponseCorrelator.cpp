@@ -0,0 +1,358 @@
+//--------------------------------------------------------------------------------------------------
+//
+//  File:       m+m/m+mResponseCorrelator.cpp
+//
+//  Project:    m+m
+//
+//  Contains:   The class definition for the matching of responses to asynchronous m+m requests.
+//
+//  Written by: Norman Jaffe
+//
+//  Copyright:  (c) 2026 by OpenDragon.
+//
+//              All rights reserved. Redistribution and use in source and binary forms, with or
+//              without modification, are permitted provided that the following conditions are met:
+//                * Redistributions of source code must retain the above copyright notice, this list
+//                  of conditions and the following disclaimer.
+//                * Redistributions in binary form must reproduce the above copyright notice, this
+//                  list of conditions and the following disclaimer in the documentation and / or
+//                  other materials provided with the distribution.
+//                * Neither the name of the copyright holders nor the names of its contributors may
+//                  be used to endorse or promote products derived from this software without
+//                  specific prior written permission.
+//
+//              THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//              EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//              OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//              SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//              INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//              TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//              BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//              CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//              ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//              DAMAGE.
+//
+//  Created:    2026-10-17
+//
+//--------------------------------------------------------------------------------------------------
+
+
+#include "m+mResponseCorrelator.hpp"
+
+#include <m+m/m+mEndpoint.hpp>
+#include <m+m/m+mPendingResponse.hpp>
+#include <m+m/m+mRequests.hpp>
+#include <m+m/m+mUtilities.hpp>
+
+//#include <odlEnable.h>
+#include <odlInclude.h>
+
+#if defined(__APPLE__)
+# pragma clang diagnostic push
+# pragma clang diagnostic ignored "-Wunknown-pragmas"
+# pragma clang diagnostic ignored "-Wdocumentation-unknown-command"
+#endif // defined(__APPLE__)
+/*! @file
+ @brief The class definition for the matching of responses to asynchronous m+m requests. */
+#if defined(__APPLE__)
+# pragma clang diagnostic pop
+#endif // defined(__APPLE__)
+
+#if defined(__APPLE__)
+# pragma mark Namespace references
+#endif // defined(__APPLE__)
+
+using namespace MplusM;
+using namespace MplusM::Common;
+
+#if defined(__APPLE__)
+# pragma mark Private structures, constants and variables
+#endif // defined(__APPLE__)
+
+/*! @brief The largest correlation identifier that is used before starting again at zero. */
+static const int kMaxCorrelationId = 0x7FFFFFFF;
+
+#if defined(__APPLE__)
+# pragma mark Global constants and variables
+#endif // defined(__APPLE__)
+
+#if defined(__APPLE__)
+# pragma mark Local functions
+#endif // defined(__APPLE__)
+
+#if defined(__APPLE__)
+# pragma mark Class methods
+#endif // defined(__APPLE__)
+
+#if defined(__APPLE__)
+# pragma mark Constructors and Destructors
+#endif // defined(__APPLE__)
+
+ResponseCorrelator::ResponseCorrelator(const size_t maxOutstanding) :
+    inherited(), _endpoint(NULL), _replyChannelName(), _pending(), _lock(),
+    _available(static_cast<unsigned int>(maxOutstanding)), _nextCorrelationId(0),
+    _isOpen(false)
+{
+    ODL_ENTER(); //####
+    ODL_I1("maxOutstanding = ", maxOutstanding); //####
+    ODL_EXIT_P(this); //####
+} // ResponseCorrelator::ResponseCorrelator
+
+ResponseCorrelator::~ResponseCorrelator(void)
+{
+    ODL_OBJENTER(); //####
+    close();
+    ODL_OBJEXIT(); //####
+} // ResponseCorrelator::~ResponseCorrelator
+
+#if defined(__APPLE__)
+# pragma mark Actions and Accessors
+#endif // defined(__APPLE__)
+
+bool
+ResponseCorrelator::addRequest(PendingResponse & pending)
+{
+    ODL_OBJENTER(); //####
+    ODL_P1("pending = ", &pending); //####
+    bool result = false;
+
+    if (_isOpen)
+    {
+        _available.wait();
+        _lock.lock();
+        if (_isOpen && (! pending._correlator.load()))
+        {
+            int correlationId;
+
+            do
+            {
+                correlationId = _nextCorrelationId;
+                _nextCorrelationId = ((kMaxCorrelationId > _nextCorrelationId) ?
+                                      (_nextCorrelationId + 1) : 0);
+            }
+            while (_pending.end() != _pending.find(correlationId));
+            _pending[correlationId] = &pending;
+            pending.start(this, correlationId);
+            result = true;
+        }
+        _lock.unlock();
+        if (! result)
+        {
+            _available.post();
+        }
+    }
+    ODL_OBJEXIT_B(result); //####
+    return result;
+} // ResponseCorrelator::addRequest
+
+void
+ResponseCorrelator::cancelRequest(PendingResponse & pending)
+{
+    ODL_OBJENTER(); //####
+    ODL_P1("pending = ", &pending); //####
+    bool wasOutstanding = false;
+
+    _lock.lock();
+    // A response that is being delivered is still in use by its callback function.
+    for ( ; pending._isDelivering; )
+    {
+        _lock.unlock();
+        yarp::os::Time::yield();
+        _lock.lock();
+    }
+    PendingMap::iterator match(_pending.find(pending._correlationId));
+
+    if ((_pending.end() != match) && (&pending == match->second))
+    {
+        _pending.erase(match);
+        pending._correlator = NULL;
+        wasOutstanding = true;
+    }
+    _lock.unlock();
+    if (wasOutstanding)
+    {
+        _available.post();
+    }
+    ODL_OBJEXIT(); //####
+} // ResponseCorrelator::cancelRequest
+
+void
+ResponseCorrelator::close(void)
+{
+    ODL_OBJENTER(); //####
+    std::vector<PendingResponse *> withCallbacks;
+    size_t                         numFailed;
+
+    // Stop the responses first, so that the outstanding requests can be failed safely.
+    if (_endpoint)
+    {
+        _endpoint->close();
+        delete _endpoint;
+        _endpoint = NULL;
+    }
+    _lock.lock();
+    _isOpen = false;
+    numFailed = _pending.size();
+    for (PendingMap::iterator walker(_pending.begin()); _pending.end() != walker; ++walker)
+    {
+        PendingResponse * pending = walker->second;
+
+        if (pending->complete(NULL))
+        {
+            withCallbacks.push_back(pending);
+        }
+    }
+    _pending.clear();
+    _lock.unlock();
+    for (size_t ii = 0; numFailed > ii; ++ii)
+    {
+        _available.post();
+    }
+    for (size_t ii = 0, mm = withCallbacks.size(); mm > ii; ++ii)
+    {
+        deliverResponse(*withCallbacks[ii]);
+    }
+    ODL_OBJEXIT(); //####
+} // ResponseCorrelator::close
+
+void
+ResponseCorrelator::deliverResponse(PendingResponse & pending)
+{
+    ODL_OBJENTER(); //####
+    ODL_P1("pending = ", &pending); //####
+    pending._callback(pending, pending._callbackStuff);
+    _lock.lock();
+    pending._isDelivering = false;
+    pending._correlator = NULL;
+    _lock.unlock();
+    ODL_OBJEXIT(); //####
+} // ResponseCorrelator::deliverResponse
+
+#if (! MAC_OR_LINUX_)
+# pragma warning(push)
+# pragma warning(disable: 4100)
+#endif // ! MAC_OR_LINUX_
+bool
+ResponseCorrelator::handleInput(const yarp::os::Bottle &     input,
+                                const YarpString &           senderChannel,
+                                yarp::os::ConnectionWriter * replyMechanism,
+                                const size_t                 numBytes)
+{
+#if (! defined(ODL_ENABLE_LOGGING_))
+# if MAC_OR_LINUX_
+#  pragma unused(senderChannel,replyMechanism,numBytes)
+# endif // MAC_OR_LINUX_
+#endif // ! defined(ODL_ENABLE_LOGGING_)
+    ODL_OBJENTER(); //####
+    ODL_S2s("senderChannel = ", senderChannel, "got ", input.toString()); //####
+    ODL_P1("replyMechanism = ", replyMechanism); //####
+    ODL_I1("numBytes = ", numBytes); //####
+    bool result = false;
+
+    try
+    {
+        if (MpM_EXPECTED_ASYNC_RESPONSE_SIZE_ == input.size())
+        {
+            yarp::os::Value idValue(input.get(0));
+            yarp::os::Value responseValue(input.get(1));
+
+            if (idValue.isInt() && responseValue.isList())
+            {
+                PendingResponse * pending = NULL;
+                bool              useCallback = false;
+
+                _lock.lock();
+                PendingMap::iterator match(_pending.find(idValue.asInt()));
+
+                if (_pending.end() != match)
+                {
+                    pending = match->second;
+                    _pending.erase(match);
+                    useCallback = pending->complete(responseValue.asList());
+                }
+                _lock.unlock();
+                if (pending)
+                {
+                    _available.post();
+                    if (useCallback)
+                    {
+                        deliverResponse(*pending);
+                    }
+                    result = true;
+                }
+                else
+                {
+                    // The request was abandoned.
+                    ODL_LOG("! (pending)"); //####
+                    result = true;
+                }
+            }
+            else
+            {
+                ODL_LOG("! (idValue.isInt() && responseValue.isList())"); //####
+            }
+        }
+        else
+        {
+            ODL_LOG("! (MpM_EXPECTED_ASYNC_RESPONSE_SIZE_ == input.size())"); //####
+        }
+    }
+    catch (...)
+    {
+        ODL_LOG("Exception caught"); //####
+        throw;
+    }
+    ODL_OBJEXIT_B(result); //####
+    return result;
+} // ResponseCorrelator::handleInput
+#if (! MAC_OR_LINUX_)
+# pragma warning(pop)
+#endif // ! MAC_OR_LINUX_
+
+bool
+ResponseCorrelator::open(const double timeToWait)
+{
+    ODL_OBJENTER(); //####
+    ODL_D1("timeToWait = ", timeToWait); //####
+    bool result = false;
+
+    try
+    {
+        if (! _endpoint)
+        {
+            YarpString aName(GetRandomChannelName(HIDDEN_CHANNEL_PREFIX_
+                                                  BUILD_NAME_("reply_", DEFAULT_CHANNEL_ROOT_)));
+
+            _endpoint = new Endpoint(aName);
+#if defined(MpM_ReportOnConnections)
+            _endpoint->setReporter(*Utilities::GetGlobalStatusReporter(), true);
+#endif // defined(MpM_ReportOnConnections)
+            if (_endpoint->setInputHandler(*this) && _endpoint->open(timeToWait))
+            {
+                _lock.lock();
+                _replyChannelName = _endpoint->getName();
+                _isOpen = true;
+                _lock.unlock();
+            }
+            else
+            {
+                ODL_LOG("! (_endpoint->setInputHandler(*this) && " //####
+                        "_endpoint->open(timeToWait))"); //####
+                delete _endpoint;
+                _endpoint = NULL;
+            }
+        }
+        result = _isOpen;
+    }
+    catch (...)
+    {
+        ODL_LOG("Exception caught"); //####
+        throw;
+    }
+    ODL_OBJEXIT_B(result); //####
+    return result;
+} // ResponseCorrelator::open
+
+#if defined(__APPLE__)
+# pragma mark Global functions
+#endif // defined(__APPLE__)
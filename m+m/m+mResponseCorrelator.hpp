@@ -0,0 +1,199 @@
+//--------------------------------------------------------------------------------------------------
+//
+//  File:       m+m/m+mResponseCorrelator.hpp
+//
+//  Project:    m+m
+//
+//  Contains:   The class declaration for the matching of responses to asynchronous m+m requests.
+//
+//  Written by: Norman Jaffe
+//
+//  Copyright:  (c) 2026 by OpenDragon.
+//
+//              All rights reserved. Redistribution and use in source and binary forms, with or
+//              without modification, are permitted provided that the following conditions are met:
+//                * Redistributions of source code must retain the above copyright notice, this list
+//                  of conditions and the following disclaimer.
+//                * Redistributions in binary form must reproduce the above copyright notice, this
+//                  list of conditions and the following disclaimer in the documentation and / or
+//                  other materials provided with the distribution.
+//                * Neither the name of the copyright holders nor the names of its contributors may
+//                  be used to endorse or promote products derived from this software without
+//                  specific prior written permission.
+//
+//              THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//              EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//              OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//              SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//              INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//              TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//              BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//              CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//              ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//              DAMAGE.
+//
+//  Created:    2026-10-17
+//
+//--------------------------------------------------------------------------------------------------
+
+
+#if (! defined(MpMResponseCorrelator_HPP_))
+# define MpMResponseCorrelator_HPP_ /* Header guard */
+
+# include <m+m/m+mBaseInputHandler.hpp>
+
+# if defined(__APPLE__)
+#  pragma clang diagnostic push
+#  pragma clang diagnostic ignored "-Wunknown-pragmas"
+#  pragma clang diagnostic ignored "-Wdocumentation-unknown-command"
+# endif // defined(__APPLE__)
+/*! @file
+ @brief The class declaration for the matching of responses to asynchronous m+m requests. */
+# if defined(__APPLE__)
+#  pragma clang diagnostic pop
+# endif // defined(__APPLE__)
+
+namespace MplusM
+{
+    namespace Common
+    {
+        class Endpoint;
+        class PendingResponse;
+
+        /*! @brief The outstanding asynchronous requests of a client channel, and the channel on
+         which their responses arrive.
+
+         Each request is given a correlation identifier, which the service returns with the
+         response, so that responses can be matched to their requests in any order. */
+        class ResponseCorrelator : public BaseInputHandler
+        {
+        public :
+
+        protected :
+
+        private :
+
+            /*! @brief The class that this class is derived from. */
+            typedef BaseInputHandler inherited;
+
+        public :
+
+            /*! @brief The constructor.
+             @param[in] maxOutstanding The maximum number of requests that can be outstanding. */
+            explicit
+            ResponseCorrelator(const size_t maxOutstanding);
+
+            /*! @brief The destructor. */
+            virtual
+            ~ResponseCorrelator(void);
+
+            /*! @brief Add a request, waiting if too many requests are outstanding.
+             @param[in,out] pending The response for the request.
+             @return @c true if the request was added and @c false if the reply channel is closed
+             or the response is already in use. */
+            bool
+            addRequest(PendingResponse & pending);
+
+            /*! @brief Abandon a request; nothing happens if the response has already arrived.
+             @param[in,out] pending The response for the request. */
+            void
+            cancelRequest(PendingResponse & pending);
+
+            /*! @brief Close the reply channel and fail all the outstanding requests. */
+            void
+            close(void);
+
+            /*! @brief Open the reply channel.
+             @param[in] timeToWait The number of seconds allowed before a failure is considered.
+             @return @c true if the reply channel was opened and @c false otherwise. */
+            bool
+            open(const double timeToWait);
+
+            /*! @brief Return the name of the reply channel.
+             @return The name of the reply channel. */
+            inline const YarpString &
+            replyChannelName(void)
+            const
+            {
+                return _replyChannelName;
+            } // replyChannelName
+
+        protected :
+
+        private :
+
+            /*! @brief The copy constructor.
+             @param[in] other The object to be copied. */
+            ResponseCorrelator(const ResponseCorrelator & other);
+
+            /*! @brief Call the callback function of a completed request and then release the
+             request; the lock must not be held by the caller.
+             @param[in,out] pending The completed request. */
+            void
+            deliverResponse(PendingResponse & pending);
+
+            /*! @brief Process partially-structured input data.
+             @param[in] input The partially-structured input data.
+             @param[in] senderChannel The name of the channel used to send the input data.
+             @param[in] replyMechanism @c NULL if no reply is expected and non-@c NULL otherwise.
+             @param[in] numBytes The number of bytes available on the connection.
+             @return @c true if the input was correctly structured and successfully processed. */
+            virtual bool
+            handleInput(const yarp::os::Bottle &     input,
+                        const YarpString &           senderChannel,
+                        yarp::os::ConnectionWriter * replyMechanism,
+                        const size_t                 numBytes);
+
+            /*! @brief The assignment operator.
+             @param[in] other The object to be copied.
+             @return The updated object. */
+            ResponseCorrelator &
+            operator =(const ResponseCorrelator & other);
+
+        public :
+
+        protected :
+
+        private :
+
+            /*! @brief The outstanding requests, indexed by correlation identifier. */
+            typedef std::map<int, PendingResponse *> PendingMap;
+
+            /*! @brief The channel on which the responses arrive. */
+            Endpoint * _endpoint;
+
+            /*! @brief The name of the channel on which the responses arrive. */
+            YarpString _replyChannelName;
+
+            /*! @brief The outstanding requests. */
+            PendingMap _pending;
+
+            /*! @brief The contention lock used to control access to the outstanding requests. */
+            yarp::os::Mutex _lock;
+
+            /*! @brief Counts the number of requests that can be added before one must complete. */
+            yarp::os::Semaphore _available;
+
+            /*! @brief The correlation identifier to be used for the next request. */
+            int _nextCorrelationId;
+
+            /*! @brief @c true if the reply channel is open and @c false otherwise. */
+            bool _isOpen;
+
+# if defined(__APPLE__)
+#  pragma clang diagnostic push
+#  pragma clang diagnostic ignored "-Wunused-private-field"
+# endif // defined(__APPLE__)
+            /*! @brief Filler to pad to alignment boundary */
+            char _filler[3];
+# if defined(__APPLE__)
+#  pragma clang diagnostic pop
+# endif // defined(__APPLE__)
+
+        }; // ResponseCorrelator
+
+    } // Common
+
+} // MplusM
+
+#endif // ! defined(MpMResponseCorrelator_HPP_)
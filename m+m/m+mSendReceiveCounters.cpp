@@ -43,6 +43,8 @@
 //#include <odlEnable.h>
 #include <odlInclude.h>
 
+#include <climits>
+
 #if defined(__APPLE__)
 # pragma clang diagnostic push
 # pragma clang diagnostic ignored "-Wunknown-pragmas"
@@ -93,10 +95,51 @@ addLargeValueToDictionary(yarp::os::Property & dictionary,
     }
 } // addLargeValueToDictionary
 
+/*! @brief Add a histogram to a dictionary.
+ @param[in,out] dictionary The dictionary to be updated.
+ @param[in] tag The tag to associate with the histogram.
+ @param[in] buckets The histogram buckets to be added. */
+static void
+addHistogramToDictionary(yarp::os::Property & dictionary,
+                         const YarpString &   tag,
+                         const int64_t *      buckets)
+{
+    yarp::os::Value    stuff;
+    yarp::os::Bottle * stuffAsList = stuff.asList();
+
+    if (stuffAsList)
+    {
+        for (size_t ii = 0; MpM_SENDRECEIVE_HISTOGRAM_BUCKETS_ > ii; ++ii)
+        {
+            int64_t aCount = buckets[ii];
+
+            // Keep the bucket counts within the range of a YARP integer.
+            stuffAsList->addInt(static_cast<int>((aCount > INT_MAX) ? INT_MAX : aCount));
+        }
+        dictionary.put(tag, stuff);
+    }
+} // addHistogramToDictionary
+
 #if defined(__APPLE__)
 # pragma mark Class methods
 #endif // defined(__APPLE__)
 
+size_t
+SendReceiveCounters::HistogramBucket(const int64_t value)
+{
+    ODL_ENTER(); //####
+    ODL_I1("value = ", value); //####
+    size_t  result = 0;
+    int64_t walker = value;
+
+    for ( ; (1 < walker) && ((MpM_SENDRECEIVE_HISTOGRAM_BUCKETS_ - 1) > result); ++result)
+    {
+        walker >>= 1;
+    }
+    ODL_EXIT_I(result); //####
+    return result;
+} // SendReceiveCounters::HistogramBucket
+
 #if defined(__APPLE__)
 # pragma mark Constructors and Destructors
 #endif // defined(__APPLE__)
@@ -106,9 +149,26 @@ SendReceiveCounters::SendReceiveCounters(const int64_t initialInBytes,
                                          const int64_t initialOutBytes,
                                          const size_t  initialOutMessages) :
     _inBytes(initialInBytes), _outBytes(initialOutBytes), _inMessages(initialInMessages),
-    _outMessages(initialOutMessages)
+    _outMessages(initialOutMessages), _queueDepth(0), _maxQueueDepth(0),
+    _outDropped(0), _outLag(0), _maxOutLag(0)
 {
     ODL_ENTER(); //####
+    ODL_I4("initialInBytes = ", initialInBytes, "initialInMessages = ", initialInMessages, //####
+           "initialOutBytes = ", initialOutBytes, "initialOutMessages = ", //####
+           initialOutMessages); //####
+    memset(_inSizes, 0, sizeof(_inSizes));
+    memset(_outSizes, 0, sizeof(_outSizes));
+    memset(_inIntervals, 0, sizeof(_inIntervals));
+    memset(_outIntervals, 0, sizeof(_outIntervals));
+    memset(_queueWaits, 0, sizeof(_queueWaits));
+    if (0 < initialInMessages)
+    {
+        _inSizes[HistogramBucket(initialInBytes / initialInMessages)] = initialInMessages;
+    }
+    if (0 < initialOutMessages)
+    {
+        _outSizes[HistogramBucket(initialOutBytes / initialOutMessages)] = initialOutMessages;
+    }
     ODL_EXIT_P(this); //####
 } // SendReceiveCounters::SendReceiveCounters
 
@@ -135,6 +195,24 @@ SendReceiveCounters::addToList(yarp::os::Bottle & counterList,
     addLargeValueToDictionary(props, MpM_SENDRECEIVE_INMESSAGES_, _inMessages);
     addLargeValueToDictionary(props, MpM_SENDRECEIVE_OUTBYTES_, _outBytes);
     addLargeValueToDictionary(props, MpM_SENDRECEIVE_OUTMESSAGES_, _outMessages);
+    addHistogramToDictionary(props, MpM_SENDRECEIVE_INSIZES_, _inSizes);
+    addHistogramToDictionary(props, MpM_SENDRECEIVE_OUTSIZES_, _outSizes);
+    addHistogramToDictionary(props, MpM_SENDRECEIVE_ININTERVALS_, _inIntervals);
+    addHistogramToDictionary(props, MpM_SENDRECEIVE_OUTINTERVALS_, _outIntervals);
+    if (0 < _maxQueueDepth)
+    {
+        // Only channels that dispatch their input asynchronously have a queue to report.
+        addLargeValueToDictionary(props, MpM_SENDRECEIVE_QUEUEDEPTH_, _queueDepth);
+        addLargeValueToDictionary(props, MpM_SENDRECEIVE_MAXQUEUEDEPTH_, _maxQueueDepth);
+        addHistogramToDictionary(props, MpM_SENDRECEIVE_QUEUEWAITS_, _queueWaits);
+    }
+    if ((0 < _maxOutLag) || (0 < _outDropped))
+    {
+        // Only output channels with an overflow policy other than blocking have a queue to report.
+        addLargeValueToDictionary(props, MpM_SENDRECEIVE_OUTDROPPED_, _outDropped);
+        addLargeValueToDictionary(props, MpM_SENDRECEIVE_OUTLAG_, _outLag);
+        addLargeValueToDictionary(props, MpM_SENDRECEIVE_MAXOUTLAG_, _maxOutLag);
+    }
     ODL_OBJEXIT(); //####
 } // SendReceiveCounters::addToList
 
@@ -144,9 +222,32 @@ SendReceiveCounters::clearCounters(void)
     ODL_OBJENTER(); //####
     _inBytes = _outBytes = 0;
     _inMessages = _outMessages = 0;
+    memset(_inSizes, 0, sizeof(_inSizes));
+    memset(_outSizes, 0, sizeof(_outSizes));
+    memset(_inIntervals, 0, sizeof(_inIntervals));
+    memset(_outIntervals, 0, sizeof(_outIntervals));
+    memset(_queueWaits, 0, sizeof(_queueWaits));
+    _queueDepth = _maxQueueDepth = 0;
+    _outDropped = _outLag = _maxOutLag = 0;
     ODL_OBJEXIT(); //####
 } // SendReceiveCounters::clearCounters
 
+SendReceiveCounters &
+SendReceiveCounters::incrementDispatchCounters(const int64_t queueDepth,
+                                               const int64_t waitTime)
+{
+    ODL_OBJENTER(); //####
+    ODL_I2("queueDepth = ", queueDepth, "waitTime = ", waitTime); //####
+    _queueDepth = queueDepth;
+    if (_maxQueueDepth < queueDepth)
+    {
+        _maxQueueDepth = queueDepth;
+    }
+    ++_queueWaits[HistogramBucket(waitTime)];
+    ODL_OBJEXIT_P(this); //####
+    return *this;
+} // SendReceiveCounters::incrementDispatchCounters
+
 SendReceiveCounters &
 SendReceiveCounters::incrementInCounters(const int64_t moreInBytes)
 {
@@ -154,10 +255,27 @@ SendReceiveCounters::incrementInCounters(const int64_t moreInBytes)
     ODL_I1("moreInBytes = ", moreInBytes); //####
     _inBytes += moreInBytes;
     ++_inMessages;
+    ++_inSizes[HistogramBucket(moreInBytes)];
     ODL_OBJEXIT_P(this); //####
     return *this;
 } // SendReceiveCounters::incrementInCounters
 
+SendReceiveCounters &
+SendReceiveCounters::incrementOutletCounters(const int64_t lag,
+                                             const int64_t dropped)
+{
+    ODL_OBJENTER(); //####
+    ODL_I2("lag = ", lag, "dropped = ", dropped); //####
+    _outLag = lag;
+    if (_maxOutLag < lag)
+    {
+        _maxOutLag = lag;
+    }
+    _outDropped += dropped;
+    ODL_OBJEXIT_P(this); //####
+    return *this;
+} // SendReceiveCounters::incrementOutletCounters
+
 SendReceiveCounters &
 SendReceiveCounters::incrementOutCounters(const int64_t moreOutBytes)
 {
@@ -165,6 +283,7 @@ SendReceiveCounters::incrementOutCounters(const int64_t moreOutBytes)
     ODL_I1("moreOutBytes = ", moreOutBytes); //####
     _outBytes += moreOutBytes;
     ++_outMessages;
+    ++_outSizes[HistogramBucket(moreOutBytes)];
     ODL_OBJEXIT_P(this); //####
     return *this;
 } // SendReceiveCounters::incrementOutCounters
@@ -178,6 +297,16 @@ SendReceiveCounters::operator =(const SendReceiveCounters & other)
     _outBytes = other._outBytes;
     _inMessages = other._inMessages;
     _outMessages = other._outMessages;
+    memcpy(_inSizes, other._inSizes, sizeof(_inSizes));
+    memcpy(_outSizes, other._outSizes, sizeof(_outSizes));
+    memcpy(_inIntervals, other._inIntervals, sizeof(_inIntervals));
+    memcpy(_outIntervals, other._outIntervals, sizeof(_outIntervals));
+    memcpy(_queueWaits, other._queueWaits, sizeof(_queueWaits));
+    _queueDepth = other._queueDepth;
+    _maxQueueDepth = other._maxQueueDepth;
+    _outDropped = other._outDropped;
+    _outLag = other._outLag;
+    _maxOutLag = other._maxOutLag;
     ODL_OBJEXIT_P(this); //####
     return *this;
 } // SendReceiveCounters::operator =
@@ -191,6 +320,25 @@ SendReceiveCounters::operator +=(const SendReceiveCounters & other)
     _outBytes += other._outBytes;
     _inMessages += other._inMessages;
     _outMessages += other._outMessages;
+    for (size_t ii = 0; MpM_SENDRECEIVE_HISTOGRAM_BUCKETS_ > ii; ++ii)
+    {
+        _inSizes[ii] += other._inSizes[ii];
+        _outSizes[ii] += other._outSizes[ii];
+        _inIntervals[ii] += other._inIntervals[ii];
+        _outIntervals[ii] += other._outIntervals[ii];
+        _queueWaits[ii] += other._queueWaits[ii];
+    }
+    _queueDepth += other._queueDepth;
+    if (_maxQueueDepth < other._maxQueueDepth)
+    {
+        _maxQueueDepth = other._maxQueueDepth;
+    }
+    _outDropped += other._outDropped;
+    _outLag += other._outLag;
+    if (_maxOutLag < other._maxOutLag)
+    {
+        _maxOutLag = other._maxOutLag;
+    }
     ODL_OBJEXIT_P(this); //####
     return *this;
 } // SendReceiveCounters::operator +=
@@ -61,22 +61,63 @@
 /*! @brief The property keyword for the number of received bytes. */
 # define MpM_SENDRECEIVE_INBYTES_     "inBytes"
 
+/*! @brief The property keyword for the largest number of messages waiting to be sent. */
+# define MpM_SENDRECEIVE_MAXOUTLAG_   "maxOutLag"
+
+/*! @brief The property keyword for the histogram of received message inter-arrival times. */
+# define MpM_SENDRECEIVE_ININTERVALS_ "inIntervals"
+
 /*! @brief The property keyword for the number of received messages. */
 # define MpM_SENDRECEIVE_INMESSAGES_  "inMessages"
 
+/*! @brief The property keyword for the histogram of received message sizes. */
+# define MpM_SENDRECEIVE_INSIZES_     "inSizes"
+
 /*! @brief The property keyword for the number of sent bytes. */
 # define MpM_SENDRECEIVE_OUTBYTES_    "outBytes"
 
+/*! @brief The property keyword for the number of messages discarded instead of being sent. */
+# define MpM_SENDRECEIVE_OUTDROPPED_  "outDropped"
+
+/*! @brief The property keyword for the histogram of sent message inter-arrival times. */
+# define MpM_SENDRECEIVE_OUTINTERVALS_ "outIntervals"
+
 /*! @brief The property keyword for the number of sent messages. */
 # define MpM_SENDRECEIVE_OUTMESSAGES_ "outMessages"
 
+/*! @brief The property keyword for the number of messages waiting to be sent. */
+# define MpM_SENDRECEIVE_OUTLAG_      "outLag"
+
+/*! @brief The property keyword for the histogram of sent message sizes. */
+# define MpM_SENDRECEIVE_OUTSIZES_    "outSizes"
+
+/*! @brief The property keyword for the largest number of received messages waiting to be
+ dispatched. */
+# define MpM_SENDRECEIVE_MAXQUEUEDEPTH_ "maxQueueDepth"
+
+/*! @brief The property keyword for the number of received messages waiting to be dispatched. */
+# define MpM_SENDRECEIVE_QUEUEDEPTH_  "queueDepth"
+
+/*! @brief The property keyword for the histogram of times that received messages waited to be
+ dispatched. */
+# define MpM_SENDRECEIVE_QUEUEWAITS_  "queueWaits"
+
 /*! @brief The property keyword for the time. */
 # define MpM_SENDRECEIVE_TIME_        "time"
 
+/*! @brief The number of buckets in each of the send / receive histograms.
+
+ Bucket @c 0 holds values less than @c 2, bucket @c n holds values from @c 2^n up to
+ @c 2^(n+1)-1 and the last bucket holds all larger values. Message sizes are in bytes and
+ inter-arrival times are in microseconds. */
+# define MpM_SENDRECEIVE_HISTOGRAM_BUCKETS_ 24
+
 namespace MplusM
 {
     namespace Common
     {
+        class ShardedSendReceiveCounters;
+
         /*! @brief A class to hold the send / receive counters. */
         class SendReceiveCounters
         {
@@ -86,9 +127,14 @@ namespace MplusM
 
         private :
 
+            friend class ShardedSendReceiveCounters;
+
         public :
 
             /*! @brief The constructor.
+
+             The message-size histograms are seeded with the average message size, so that a
+             set of counters describing a single message records that message.
              @param[in] initialInBytes The initial number of bytes received.
              @param[in] initialInMessages The initial number of messages received.
              @param[in] initialOutBytes The initial number of bytes sent.
@@ -110,6 +156,46 @@ namespace MplusM
             void
             clearCounters(void);
 
+            /*! @brief Return the histogram bucket for a value.
+             @param[in] value The value to be placed in a bucket.
+             @return The index of the histogram bucket for the value. */
+            static size_t
+            HistogramBucket(const int64_t value);
+
+            /*! @brief Update the dispatch data.
+             @param[in] queueDepth The number of received messages waiting to be dispatched.
+             @param[in] waitTime The time, in microseconds, that the dispatched message waited.
+             @return The modified values. */
+            SendReceiveCounters &
+            incrementDispatchCounters(const int64_t queueDepth,
+                                      const int64_t waitTime);
+
+            /*! @brief Update the outgoing queue data.
+             @param[in] lag The number of messages waiting to be sent.
+             @param[in] dropped The number of messages discarded instead of being sent.
+             @return The modified values. */
+            SendReceiveCounters &
+            incrementOutletCounters(const int64_t lag,
+                                    const int64_t dropped);
+
+            /*! @brief Return the largest number of messages waiting to be sent.
+             @return The largest number of messages waiting to be sent. */
+            inline int64_t
+            maxOutLag(void)
+            const
+            {
+                return _maxOutLag;
+            } // maxOutLag
+
+            /*! @brief Return the number of messages discarded instead of being sent.
+             @return The number of messages discarded instead of being sent. */
+            inline int64_t
+            outDropped(void)
+            const
+            {
+                return _outDropped;
+            } // outDropped
+
             /*! @brief Update the received data.
              @param[in] moreInBytes The number of bytes received.
              @return The modified values. */
@@ -156,6 +242,36 @@ namespace MplusM
             /*! @brief The number of messages sent. */
             size_t _outMessages;
 
+            /*! @brief The histogram of received message sizes. */
+            int64_t _inSizes[MpM_SENDRECEIVE_HISTOGRAM_BUCKETS_];
+
+            /*! @brief The histogram of sent message sizes. */
+            int64_t _outSizes[MpM_SENDRECEIVE_HISTOGRAM_BUCKETS_];
+
+            /*! @brief The histogram of received message inter-arrival times. */
+            int64_t _inIntervals[MpM_SENDRECEIVE_HISTOGRAM_BUCKETS_];
+
+            /*! @brief The histogram of sent message inter-arrival times. */
+            int64_t _outIntervals[MpM_SENDRECEIVE_HISTOGRAM_BUCKETS_];
+
+            /*! @brief The histogram of times that received messages waited to be dispatched. */
+            int64_t _queueWaits[MpM_SENDRECEIVE_HISTOGRAM_BUCKETS_];
+
+            /*! @brief The number of received messages waiting to be dispatched. */
+            int64_t _queueDepth;
+
+            /*! @brief The largest number of received messages waiting to be dispatched. */
+            int64_t _maxQueueDepth;
+
+            /*! @brief The number of messages discarded instead of being sent. */
+            int64_t _outDropped;
+
+            /*! @brief The number of messages waiting to be sent. */
+            int64_t _outLag;
+
+            /*! @brief The largest number of messages waiting to be sent. */
+            int64_t _maxOutLag;
+
         }; // SendReceiveCounters
 
     } // Common
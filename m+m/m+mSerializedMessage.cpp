@@ -0,0 +1,167 @@
+//--------------------------------------------------------------------------------------------------
+//
+//  File:       m+m/m+mSerializedMessage.cpp
+//
+//  Project:    m+m
+//
+//  Contains:   The class definition for a message that is serialized once and then written to a
+//              channel without being re-encoded.
+//
+//  Written by: Norman Jaffe
+//
+//  Copyright:  (c) 2026 by OpenDragon.
+//
+//              All rights reserved. Redistribution and use in source and binary forms, with or
+//              without modification, are permitted provided that the following conditions are met:
+//                * Redistributions of source code must retain the above copyright notice, this list
+//                  of conditions and the following disclaimer.
+//                * Redistributions in binary form must reproduce the above copyright notice, this
+//                  list of conditions and the following disclaimer in the documentation and / or
+//                  other materials provided with the distribution.
+//                * Neither the name of the copyright holders nor the names of its contributors may
+//                  be used to endorse or promote products derived from this software without
+//                  specific prior written permission.
+//
+//              THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//              EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//              OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//              SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//              INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//              TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//              BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//              CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//              ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//              DAMAGE.
+//
+//  Created:    2026-10-17
+//
+//--------------------------------------------------------------------------------------------------
+
+
+#include "m+mSerializedMessage.hpp"
+
+//#include <odlEnable.h>
+#include <odlInclude.h>
+
+#if defined(__APPLE__)
+# pragma clang diagnostic push
+# pragma clang diagnostic ignored "-Wunknown-pragmas"
+# pragma clang diagnostic ignored "-Wdocumentation-unknown-command"
+#endif // defined(__APPLE__)
+/*! @file
+ @brief The class definition for a message that is serialized once and then written to a channel
+ without being re-encoded. */
+#if defined(__APPLE__)
+# pragma clang diagnostic pop
+#endif // defined(__APPLE__)
+
+#if defined(__APPLE__)
+# pragma mark Namespace references
+#endif // defined(__APPLE__)
+
+using namespace MplusM;
+using namespace MplusM::Common;
+
+#if defined(__APPLE__)
+# pragma mark Private structures, constants and variables
+#endif // defined(__APPLE__)
+
+#if defined(__APPLE__)
+# pragma mark Global constants and variables
+#endif // defined(__APPLE__)
+
+#if defined(__APPLE__)
+# pragma mark Local functions
+#endif // defined(__APPLE__)
+
+#if defined(__APPLE__)
+# pragma mark Class methods
+#endif // defined(__APPLE__)
+
+#if defined(__APPLE__)
+# pragma mark Constructors and Destructors
+#endif // defined(__APPLE__)
+
+SerializedMessage::SerializedMessage(void) :
+    inherited(), _bytes(NULL), _source(NULL), _size(0)
+{
+    ODL_ENTER(); //####
+    ODL_EXIT_P(this); //####
+} // SerializedMessage::SerializedMessage
+
+SerializedMessage::~SerializedMessage(void)
+{
+    ODL_OBJENTER(); //####
+    ODL_OBJEXIT(); //####
+} // SerializedMessage::~SerializedMessage
+
+#if defined(__APPLE__)
+# pragma mark Actions and Accessors
+#endif // defined(__APPLE__)
+
+void
+SerializedMessage::clear(void)
+{
+    ODL_OBJENTER(); //####
+    _bytes = NULL;
+    _source = NULL;
+    _size = 0;
+    ODL_OBJEXIT(); //####
+} // SerializedMessage::clear
+
+size_t
+SerializedMessage::prepare(yarp::os::Bottle & message)
+{
+    ODL_OBJENTER(); //####
+    ODL_P1("message = ", &message); //####
+    size_t messageSize = 0;
+
+    // The message keeps its binary form in its own storage, so the bytes are used where they are
+    // rather than being copied; the message must not be changed until it has been written.
+    _bytes = message.toBinary(&messageSize);
+    _source = &message;
+    _size = (_bytes ? messageSize : 0);
+    ODL_OBJEXIT_I(_size); //####
+    return _size;
+} // SerializedMessage::prepare
+
+bool
+SerializedMessage::write(yarp::os::ConnectionWriter & connection)
+{
+    ODL_OBJENTER(); //####
+    ODL_P1("connection = ", &connection); //####
+    bool result = false;
+
+    try
+    {
+        if (connection.isTextMode())
+        {
+            // Text carriers need the textual form, which only the original message can provide.
+            if (_source)
+            {
+                result = _source->write(connection);
+            }
+        }
+        else if (0 < _size)
+        {
+            // The bytes are not touched until the channel write that uses them has completed.
+            connection.appendExternalBlock(_bytes, _size);
+            result = true;
+        }
+        else
+        {
+            ODL_LOG("! (0 < _size)"); //####
+        }
+    }
+    catch (...)
+    {
+        ODL_LOG("Exception caught"); //####
+        throw;
+    }
+    ODL_OBJEXIT_B(result); //####
+    return result;
+} // SerializedMessage::write
+
+#if defined(__APPLE__)
+# pragma mark Global functions
+#endif // defined(__APPLE__)
@@ -0,0 +1,147 @@
+//--------------------------------------------------------------------------------------------------
+//
+//  File:       m+m/m+mSerializedMessage.hpp
+//
+//  Project:    m+m
+//
+//  Contains:   The class declaration for a message that is serialized once and then written to a
+//              channel without being re-encoded.
+//
+//  Written by: Norman Jaffe
+//
+//  Copyright:  (c) 2026 by OpenDragon.
+//
+//              All rights reserved. Redistribution and use in source and binary forms, with or
+//              without modification, are permitted provided that the following conditions are met:
+//                * Redistributions of source code must retain the above copyright notice, this list
+//                  of conditions and the following disclaimer.
+//                * Redistributions in binary form must reproduce the above copyright notice, this
+//                  list of conditions and the following disclaimer in the documentation and / or
+//                  other materials provided with the distribution.
+//                * Neither the name of the copyright holders nor the names of its contributors may
+//                  be used to endorse or promote products derived from this software without
+//                  specific prior written permission.
+//
+//              THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//              EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//              OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//              SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//              INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//              TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//              BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//              CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//              ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//              DAMAGE.
+//
+//  Created:    2026-10-17
+//
+//--------------------------------------------------------------------------------------------------
+
+
+#if (! defined(MpMSerializedMessage_HPP_))
+# define MpMSerializedMessage_HPP_ /* Header guard */
+
+# include <m+m/m+mCommon.hpp>
+
+# if defined(__APPLE__)
+#  pragma clang diagnostic push
+#  pragma clang diagnostic ignored "-Wunknown-pragmas"
+#  pragma clang diagnostic ignored "-Wdocumentation-unknown-command"
+# endif // defined(__APPLE__)
+/*! @file
+ @brief The class declaration for a message that is serialized once and then written to a channel
+ without being re-encoded. */
+# if defined(__APPLE__)
+#  pragma clang diagnostic pop
+# endif // defined(__APPLE__)
+
+namespace MplusM
+{
+    namespace Common
+    {
+        /*! @brief A message that has been converted to its binary form once, so that its size is
+         known before it is sent and the bytes do not need to be regenerated by YARP.
+
+         The binary form is kept by the message itself, so no copy of it is made; the message must
+         not be changed until it has been written. */
+        class SerializedMessage : public yarp::os::PortWriter
+        {
+        public :
+
+        protected :
+
+        private :
+
+            /*! @brief The class that this class is derived from. */
+            typedef yarp::os::PortWriter inherited;
+
+        public :
+
+            /*! @brief The constructor. */
+            SerializedMessage(void);
+
+            /*! @brief The destructor. */
+            virtual
+            ~SerializedMessage(void);
+
+            /*! @brief Forget the message. */
+            void
+            clear(void);
+
+            /*! @brief Convert a message to its binary form.
+             @param[in] message The message to be converted.
+             @return The number of bytes in the binary form of the message. */
+            size_t
+            prepare(yarp::os::Bottle & message);
+
+            /*! @brief Return the number of bytes in the binary form of the message.
+             @return The number of bytes in the binary form of the message. */
+            inline size_t
+            size(void)
+            const
+            {
+                return _size;
+            } // size
+
+            /*! @brief Write the message to a connection.
+             @param[in] connection The connection that is to be written to.
+             @return @c true if the message was successfully written and @c false otherwise. */
+            virtual bool
+            write(yarp::os::ConnectionWriter & connection);
+
+        protected :
+
+        private :
+
+            /*! @brief The copy constructor.
+             @param[in] other The object to be copied. */
+            SerializedMessage(const SerializedMessage & other);
+
+            /*! @brief The assignment operator.
+             @param[in] other The object to be copied.
+             @return The updated object. */
+            SerializedMessage &
+            operator =(const SerializedMessage & other);
+
+        public :
+
+        protected :
+
+        private :
+
+            /*! @brief The binary form of the message, which belongs to the message. */
+            const char * _bytes;
+
+            /*! @brief The message that was converted, for connections that require text. */
+            yarp::os::Bottle * _source;
+
+            /*! @brief The number of bytes in the binary form of the message. */
+            size_t _size;
+
+        }; // SerializedMessage
+
+    } // Common
+
+} // MplusM
+
+#endif // ! defined(MpMSerializedMessage_HPP_)
@@ -40,6 +40,8 @@
 #include "m+mServiceInputHandler.hpp"
 
 #include <m+m/m+mBaseService.hpp>
+#include <m+m/m+mRawInput.hpp>
+#include <m+m/m+mRequests.hpp>
 
 //#include <odlEnable.h>
 #include <odlInclude.h>
@@ -83,16 +85,18 @@ using namespace MplusM::Common;
 #endif // defined(__APPLE__)
 
 ServiceInputHandler::ServiceInputHandler(BaseService & service) :
-    inherited(), _service(service)
+    inherited(), _restOfInput(), _scratch(), _service(service)
 {
     ODL_ENTER(); //####
     ODL_P1("service = ", &service);
+    enableRawInput();
     ODL_EXIT_P(this); //####
 } // ServiceInputHandler::ServiceInputHandler
 
 ServiceInputHandler::~ServiceInputHandler(void)
 {
     ODL_OBJENTER(); //####
+    stopProcessing();
     ODL_OBJEXIT(); //####
 } // ServiceInputHandler::~ServiceInputHandler
 
@@ -119,7 +123,33 @@ ServiceInputHandler::handleInput(const yarp::os::Bottle &     input,
 
     try
     {
-        if (0 < input.size())
+        int inputSize = input.size();
+
+        if ((MpM_ASYNC_REQUEST_HEADER_SIZE_ < inputSize) &&
+            (input.get(0).toString() == MpM_ASYNC_REQUEST_MARKER_))
+        {
+            // [marker, correlation identifier, reply channel, request, arguments...]
+            yarp::os::Value  idValue(input.get(1));
+            yarp::os::Value  replyValue(input.get(2));
+            YarpString       request(input.get(MpM_ASYNC_REQUEST_HEADER_SIZE_).toString());
+            yarp::os::Bottle restOfInput;
+
+            for (int ii = MpM_ASYNC_REQUEST_HEADER_SIZE_ + 1; inputSize > ii; ++ii)
+            {
+                restOfInput.add(input.get(ii));
+            }
+            if (idValue.isInt() && replyValue.isString())
+            {
+                result = _service.processAsyncRequest(request, restOfInput, senderChannel,
+                                                      idValue.asInt(), replyValue.toString());
+            }
+            else
+            {
+                ODL_LOG("! (idValue.isInt() && replyValue.isString())"); //####
+                result = false;
+            }
+        }
+        else if (0 < inputSize)
         {
             result = _service.processRequest(input.get(0).toString(), input.tail(), senderChannel,
                                              replyMechanism);
@@ -134,6 +164,47 @@ ServiceInputHandler::handleInput(const yarp::os::Bottle &     input,
     return result;
 } // ServiceInputHandler::handleInput
 
+bool
+ServiceInputHandler::handleRawInput(RawInput &                   input,
+                                    const YarpString &           senderChannel,
+                                    yarp::os::ConnectionWriter * replyMechanism,
+                                    const size_t                 numBytes)
+{
+    ODL_OBJENTER(); //####
+    ODL_P2("input = ", &input, "replyMechanism = ", replyMechanism); //####
+    ODL_S1s("senderChannel = ", senderChannel); //####
+    ODL_I1("numBytes = ", numBytes); //####
+    bool         result = true;
+    const char * request;
+    size_t       requestLength;
+
+    try
+    {
+        static const size_t kMarkerLength = sizeof(MpM_ASYNC_REQUEST_MARKER_) - 1;
+
+        // The request name is looked up directly in the serialized input; only the arguments are
+        // decoded.
+        if (input.splitLeadingString(request, requestLength, _restOfInput, _scratch) &&
+            ((kMarkerLength != requestLength) ||
+             memcmp(request, MpM_ASYNC_REQUEST_MARKER_, kMarkerLength)))
+        {
+            result = _service.processRequest(request, requestLength, _restOfInput, senderChannel,
+                                             replyMechanism);
+        }
+        else
+        {
+            result = inherited::handleRawInput(input, senderChannel, replyMechanism, numBytes);
+        }
+    }
+    catch (...)
+    {
+        ODL_LOG("Exception caught"); //####
+        throw;
+    }
+    ODL_OBJEXIT_B(result); //####
+    return result;
+} // ServiceInputHandler::handleRawInput
+
 #if defined(__APPLE__)
 # pragma mark Global functions
 #endif // defined(__APPLE__)
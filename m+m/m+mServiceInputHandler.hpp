@@ -102,6 +102,18 @@ namespace MplusM
                         yarp::os::ConnectionWriter * replyMechanism,
                         const size_t                 numBytes);
 
+            /*! @brief Process input that has not been decoded.
+             @param[in] input The undecoded input data.
+             @param[in] senderChannel The name of the channel used to send the input data.
+             @param[in] replyMechanism @c NULL if no reply is expected and non-@c NULL otherwise.
+             @param[in] numBytes The number of bytes available on the connection.
+             @return @c true if the input was correctly structured and successfully processed. */
+            virtual bool
+            handleRawInput(RawInput &                   input,
+                           const YarpString &           senderChannel,
+                           yarp::os::ConnectionWriter * replyMechanism,
+                           const size_t                 numBytes);
+
             /*! @brief The assignment operator.
              @param[in] other The object to be copied.
              @return The updated object. */
@@ -114,6 +126,13 @@ namespace MplusM
 
         private :
 
+            /*! @brief The arguments of the request being processed. */
+            yarp::os::Bottle _restOfInput;
+
+            /*! @brief Storage for the serialized form of the arguments of the request being
+             processed. Raw input is handled one message at a time, so this can be reused. */
+            std::vector<char> _scratch;
+
             /*! @brief The service that 'owns' this handler. */
             BaseService & _service;
 
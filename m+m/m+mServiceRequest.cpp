@@ -39,6 +39,9 @@
 #include "m+mServiceRequest.hpp"
 
 #include <m+m/m+mClientChannel.hpp>
+#include <m+m/m+mPendingResponse.hpp>
+#include <m+m/m+mRequests.hpp>
+#include <m+m/m+mResponseCorrelator.hpp>
 #include <m+m/m+mServiceResponse.hpp>
 
 //#include <odlEnable.h>
@@ -198,6 +201,56 @@ ServiceRequest::send(ClientChannel &   usingChannel,
     return result;
 } // ServiceRequest::send
 
+bool
+ServiceRequest::sendAsync(ClientChannel &   usingChannel,
+                          PendingResponse & pending)
+{
+    ODL_OBJENTER(); //####
+    ODL_P2("usingChannel = ", &usingChannel, "pending = ", &pending); //####
+    bool                 result = false;
+    ResponseCorrelator * correlator = usingChannel.getCorrelator();
+
+    try
+    {
+        if (correlator && correlator->addRequest(pending))
+        {
+            yarp::os::Bottle message;
+
+            // The correlation identifier and the reply channel precede the request, so that the
+            // service can send the response separately.
+            message.addString(MpM_ASYNC_REQUEST_MARKER_);
+            message.addInt(pending.correlationId());
+            message.addString(correlator->replyChannelName());
+            message.addString(_name);
+            message.append(_parameters);
+            ODL_S1s("message <- ", message.toString()); //####
+            if (usingChannel.writeBottle(message))
+            {
+                result = true;
+            }
+            else
+            {
+                ODL_LOG("(! usingChannel.writeBottle(message))"); //####
+                correlator->cancelRequest(pending);
+#if defined(MpM_StallOnSendProblem)
+                Stall();
+#endif // defined(MpM_StallOnSendProblem)
+            }
+        }
+        else
+        {
+            ODL_LOG("! (correlator && correlator->addRequest(pending))"); //####
+        }
+    }
+    catch (...)
+    {
+        ODL_LOG("Exception caught"); //####
+        throw;
+    }
+    ODL_OBJEXIT_B(result); //####
+    return result;
+} // ServiceRequest::sendAsync
+
 #if defined(__APPLE__)
 # pragma mark Global functions
 #endif // defined(__APPLE__)
@@ -58,6 +58,7 @@ namespace MplusM
     {
         class ClientChannel;
         class Endpoint;
+        class PendingResponse;
         class ServiceResponse;
 
         /*! @brief The data constituting a service request. */
@@ -100,6 +101,19 @@ namespace MplusM
             send(ClientChannel &   usingChannel,
                  ServiceResponse & response);
 
+            /*! @brief Send the request to an endpoint for processing, without waiting for the
+             response.
+
+             The channel must have been prepared with ClientChannel::enableAsyncRequests(). If the
+             maximum number of requests are outstanding, this waits until one of them completes.
+             @param[in] usingChannel The channel that is to send the request.
+             @param[in,out] pending The response to the request, which becomes ready when the
+             response arrives.
+             @return @c true if the request was successfully transmitted. */
+            bool
+            sendAsync(ClientChannel &   usingChannel,
+                      PendingResponse & pending);
+
         protected :
 
         private :
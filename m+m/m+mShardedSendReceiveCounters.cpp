@@ -0,0 +1,345 @@
+//--------------------------------------------------------------------------------------------------
+//
+//  File:       m+m/m+mShardedSendReceiveCounters.cpp
+//
+//  Project:    m+m
+//
+//  Contains:   The class definition for a set of send / receive counters that can be updated
+//              concurrently without locking.
+//
+//  Written by: Norman Jaffe
+//
+//  Copyright:  (c) 2026 by OpenDragon.
+//
+//              All rights reserved. Redistribution and use in source and binary forms, with or
+//              without modification, are permitted provided that the following conditions are met:
+//                * Redistributions of source code must retain the above copyright notice, this list
+//                  of conditions and the following disclaimer.
+//                * Redistributions in binary form must reproduce the above copyright notice, this
+//                  list of conditions and the following disclaimer in the documentation and / or
+//                  other materials provided with the distribution.
+//                * Neither the name of the copyright holders nor the names of its contributors may
+//                  be used to endorse or promote products derived from this software without
+//                  specific prior written permission.
+//
+//              THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//              EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//              OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//              SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//              INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//              TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//              BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//              CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//              ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//              DAMAGE.
+//
+//  Created:    2026-10-17
+//
+//--------------------------------------------------------------------------------------------------
+
+
+#include "m+mShardedSendReceiveCounters.hpp"
+
+//#include <odlEnable.h>
+#include <odlInclude.h>
+
+#if defined(__APPLE__)
+# pragma clang diagnostic push
+# pragma clang diagnostic ignored "-Wunknown-pragmas"
+# pragma clang diagnostic ignored "-Wdocumentation-unknown-command"
+#endif // defined(__APPLE__)
+/*! @file
+ @brief The class definition for a set of send / receive counters that can be updated
+ concurrently without locking. */
+#if defined(__APPLE__)
+# pragma clang diagnostic pop
+#endif // defined(__APPLE__)
+
+#if defined(__APPLE__)
+# pragma mark Namespace references
+#endif // defined(__APPLE__)
+
+using namespace MplusM;
+using namespace MplusM::Common;
+
+#if defined(__APPLE__)
+# pragma mark Private structures, constants and variables
+#endif // defined(__APPLE__)
+
+/*! @brief The shard to be assigned to the next thread that updates a set of counters. */
+static std::atomic<size_t> lNextShard(0);
+
+/*! @brief The shard assigned to the current thread, plus one, or zero if not yet assigned. */
+static thread_local size_t lThreadShard = 0;
+
+#if defined(__APPLE__)
+# pragma mark Global constants and variables
+#endif // defined(__APPLE__)
+
+#if defined(__APPLE__)
+# pragma mark Local functions
+#endif // defined(__APPLE__)
+
+/*! @brief Add the values from a histogram to a set of atomic counters.
+ @param[in,out] buckets The atomic counters to be updated.
+ @param[in] values The values to be added. */
+static void
+addHistogram(std::atomic<int64_t> * buckets,
+             const int64_t *        values)
+{
+    for (size_t ii = 0; MpM_SENDRECEIVE_HISTOGRAM_BUCKETS_ > ii; ++ii)
+    {
+        if (values[ii])
+        {
+            buckets[ii].fetch_add(values[ii], std::memory_order_relaxed);
+        }
+    }
+} // addHistogram
+
+/*! @brief Reset a set of atomic counters.
+ @param[in,out] buckets The atomic counters to be reset. */
+static void
+clearHistogram(std::atomic<int64_t> * buckets)
+{
+    for (size_t ii = 0; MpM_SENDRECEIVE_HISTOGRAM_BUCKETS_ > ii; ++ii)
+    {
+        buckets[ii].store(0, std::memory_order_relaxed);
+    }
+} // clearHistogram
+
+/*! @brief Add the values from a set of atomic counters to a histogram.
+ @param[in,out] values The histogram to be updated.
+ @param[in] buckets The atomic counters to be read. */
+static void
+collectHistogram(int64_t *                    values,
+                 const std::atomic<int64_t> * buckets)
+{
+    for (size_t ii = 0; MpM_SENDRECEIVE_HISTOGRAM_BUCKETS_ > ii; ++ii)
+    {
+        values[ii] += buckets[ii].load(std::memory_order_relaxed);
+    }
+} // collectHistogram
+
+#if defined(__APPLE__)
+# pragma mark Class methods
+#endif // defined(__APPLE__)
+
+void
+ShardedSendReceiveCounters::recordInterval(std::atomic<int64_t> & lastTime,
+                                           std::atomic<int64_t> * intervals)
+{
+    ODL_ENTER(); //####
+    ODL_P2("lastTime = ", &lastTime, "intervals = ", intervals); //####
+    int64_t now = static_cast<int64_t>(yarp::os::Time::now() * 1e6);
+    int64_t previous = lastTime.load(std::memory_order_relaxed);
+
+    // The timestamp is shared by all the threads using the channel, so that each interval is
+    // measured from the previous message on the channel. It only moves forward; a thread that
+    // loses the race to a later message records a zero interval.
+    while ((previous < now) &&
+           (! lastTime.compare_exchange_weak(previous, now, std::memory_order_relaxed)))
+    {
+        // Another thread changed the timestamp; try again with the new value.
+    }
+    if (0 < previous)
+    {
+        size_t bucket = SendReceiveCounters::HistogramBucket((previous < now) ?
+                                                             (now - previous) : 0);
+
+        intervals[bucket].fetch_add(1, std::memory_order_relaxed);
+    }
+    ODL_EXIT(); //####
+} // ShardedSendReceiveCounters::recordInterval
+
+#if defined(__APPLE__)
+# pragma mark Constructors and Destructors
+#endif // defined(__APPLE__)
+
+ShardedSendReceiveCounters::ShardedSendReceiveCounters(void) :
+    _lastInTime(0), _lastOutTime(0), _queueDepth(0), _maxQueueDepth(0), _outLag(0),
+    _maxOutLag(0)
+{
+    ODL_ENTER(); //####
+    clearCounters();
+    ODL_EXIT_P(this); //####
+} // ShardedSendReceiveCounters::ShardedSendReceiveCounters
+
+ShardedSendReceiveCounters::~ShardedSendReceiveCounters(void)
+{
+    ODL_OBJENTER(); //####
+    ODL_OBJEXIT(); //####
+} // ShardedSendReceiveCounters::~ShardedSendReceiveCounters
+
+#if defined(__APPLE__)
+# pragma mark Actions and Accessors
+#endif // defined(__APPLE__)
+
+void
+ShardedSendReceiveCounters::addCounters(const SendReceiveCounters & other)
+{
+    ODL_OBJENTER(); //####
+    ODL_P1("other = ", &other); //####
+    CounterShard & aShard = getShard();
+
+    aShard._inBytes.fetch_add(other._inBytes, std::memory_order_relaxed);
+    aShard._outBytes.fetch_add(other._outBytes, std::memory_order_relaxed);
+    aShard._inMessages.fetch_add(other._inMessages, std::memory_order_relaxed);
+    aShard._outMessages.fetch_add(other._outMessages, std::memory_order_relaxed);
+    aShard._outDropped.fetch_add(other._outDropped, std::memory_order_relaxed);
+    addHistogram(aShard._inSizes, other._inSizes);
+    addHistogram(aShard._outSizes, other._outSizes);
+    addHistogram(aShard._inIntervals, other._inIntervals);
+    addHistogram(aShard._outIntervals, other._outIntervals);
+    addHistogram(aShard._queueWaits, other._queueWaits);
+    ODL_OBJEXIT(); //####
+} // ShardedSendReceiveCounters::addCounters
+
+void
+ShardedSendReceiveCounters::clearCounters(void)
+{
+    ODL_OBJENTER(); //####
+    for (size_t ii = 0; MpM_SENDRECEIVE_SHARD_COUNT_ > ii; ++ii)
+    {
+        CounterShard & aShard = _shards[ii];
+
+        aShard._inBytes.store(0, std::memory_order_relaxed);
+        aShard._outBytes.store(0, std::memory_order_relaxed);
+        aShard._inMessages.store(0, std::memory_order_relaxed);
+        aShard._outMessages.store(0, std::memory_order_relaxed);
+        aShard._outDropped.store(0, std::memory_order_relaxed);
+        clearHistogram(aShard._inSizes);
+        clearHistogram(aShard._outSizes);
+        clearHistogram(aShard._inIntervals);
+        clearHistogram(aShard._outIntervals);
+        clearHistogram(aShard._queueWaits);
+    }
+    _lastInTime.store(0, std::memory_order_relaxed);
+    _lastOutTime.store(0, std::memory_order_relaxed);
+    _queueDepth.store(0, std::memory_order_relaxed);
+    _maxQueueDepth.store(0, std::memory_order_relaxed);
+    _outLag.store(0, std::memory_order_relaxed);
+    _maxOutLag.store(0, std::memory_order_relaxed);
+    ODL_OBJEXIT(); //####
+} // ShardedSendReceiveCounters::clearCounters
+
+void
+ShardedSendReceiveCounters::getCounters(SendReceiveCounters & counters)
+const
+{
+    ODL_OBJENTER(); //####
+    ODL_P1("counters = ", &counters); //####
+    counters.clearCounters();
+    for (size_t ii = 0; MpM_SENDRECEIVE_SHARD_COUNT_ > ii; ++ii)
+    {
+        const CounterShard & aShard = _shards[ii];
+
+        counters._inBytes += aShard._inBytes.load(std::memory_order_relaxed);
+        counters._outBytes += aShard._outBytes.load(std::memory_order_relaxed);
+        counters._inMessages +=
+                        static_cast<size_t>(aShard._inMessages.load(std::memory_order_relaxed));
+        counters._outMessages +=
+                        static_cast<size_t>(aShard._outMessages.load(std::memory_order_relaxed));
+        counters._outDropped += aShard._outDropped.load(std::memory_order_relaxed);
+        collectHistogram(counters._inSizes, aShard._inSizes);
+        collectHistogram(counters._outSizes, aShard._outSizes);
+        collectHistogram(counters._inIntervals, aShard._inIntervals);
+        collectHistogram(counters._outIntervals, aShard._outIntervals);
+        collectHistogram(counters._queueWaits, aShard._queueWaits);
+    }
+    counters._queueDepth = _queueDepth.load(std::memory_order_relaxed);
+    counters._maxQueueDepth = _maxQueueDepth.load(std::memory_order_relaxed);
+    counters._outLag = _outLag.load(std::memory_order_relaxed);
+    counters._maxOutLag = _maxOutLag.load(std::memory_order_relaxed);
+    ODL_OBJEXIT(); //####
+} // ShardedSendReceiveCounters::getCounters
+
+ShardedSendReceiveCounters::CounterShard &
+ShardedSendReceiveCounters::getShard(void)
+{
+    ODL_OBJENTER(); //####
+    if (! lThreadShard)
+    {
+        lThreadShard = 1 + (lNextShard.fetch_add(1, std::memory_order_relaxed) %
+                            MpM_SENDRECEIVE_SHARD_COUNT_);
+    }
+    CounterShard & result = _shards[lThreadShard - 1];
+
+    ODL_OBJEXIT_P(&result); //####
+    return result;
+} // ShardedSendReceiveCounters::getShard
+
+void
+ShardedSendReceiveCounters::incrementDispatchCounters(const int64_t queueDepth,
+                                                      const int64_t waitTime)
+{
+    ODL_OBJENTER(); //####
+    ODL_I2("queueDepth = ", queueDepth, "waitTime = ", waitTime); //####
+    CounterShard & aShard = getShard();
+    size_t         bucket = SendReceiveCounters::HistogramBucket(waitTime);
+    int64_t        maxDepth = _maxQueueDepth.load(std::memory_order_relaxed);
+
+    aShard._queueWaits[bucket].fetch_add(1, std::memory_order_relaxed);
+    _queueDepth.store(queueDepth, std::memory_order_relaxed);
+    while ((maxDepth < queueDepth) &&
+           (! _maxQueueDepth.compare_exchange_weak(maxDepth, queueDepth,
+                                                   std::memory_order_relaxed)))
+    {
+        // Another thread changed the maximum; try again with the new value.
+    }
+    ODL_OBJEXIT(); //####
+} // ShardedSendReceiveCounters::incrementDispatchCounters
+
+void
+ShardedSendReceiveCounters::incrementInCounters(const int64_t moreInBytes)
+{
+    ODL_OBJENTER(); //####
+    ODL_I1("moreInBytes = ", moreInBytes); //####
+    CounterShard & aShard = getShard();
+    size_t         bucket = SendReceiveCounters::HistogramBucket(moreInBytes);
+
+    aShard._inBytes.fetch_add(moreInBytes, std::memory_order_relaxed);
+    aShard._inMessages.fetch_add(1, std::memory_order_relaxed);
+    aShard._inSizes[bucket].fetch_add(1, std::memory_order_relaxed);
+    recordInterval(_lastInTime, aShard._inIntervals);
+    ODL_OBJEXIT(); //####
+} // ShardedSendReceiveCounters::incrementInCounters
+
+void
+ShardedSendReceiveCounters::incrementOutletCounters(const int64_t lag,
+                                                    const int64_t dropped)
+{
+    ODL_OBJENTER(); //####
+    ODL_I2("lag = ", lag, "dropped = ", dropped); //####
+    int64_t maxLag = _maxOutLag.load(std::memory_order_relaxed);
+
+    if (dropped)
+    {
+        getShard()._outDropped.fetch_add(dropped, std::memory_order_relaxed);
+    }
+    _outLag.store(lag, std::memory_order_relaxed);
+    while ((maxLag < lag) &&
+           (! _maxOutLag.compare_exchange_weak(maxLag, lag, std::memory_order_relaxed)))
+    {
+        // Another thread changed the maximum; try again with the new value.
+    }
+    ODL_OBJEXIT(); //####
+} // ShardedSendReceiveCounters::incrementOutletCounters
+
+void
+ShardedSendReceiveCounters::incrementOutCounters(const int64_t moreOutBytes)
+{
+    ODL_OBJENTER(); //####
+    ODL_I1("moreOutBytes = ", moreOutBytes); //####
+    CounterShard & aShard = getShard();
+    size_t         bucket = SendReceiveCounters::HistogramBucket(moreOutBytes);
+
+    aShard._outBytes.fetch_add(moreOutBytes, std::memory_order_relaxed);
+    aShard._outMessages.fetch_add(1, std::memory_order_relaxed);
+    aShard._outSizes[bucket].fetch_add(1, std::memory_order_relaxed);
+    recordInterval(_lastOutTime, aShard._outIntervals);
+    ODL_OBJEXIT(); //####
+} // ShardedSendReceiveCounters::incrementOutCounters
+
+#if defined(__APPLE__)
+# pragma mark Global functions
+#endif // defined(__APPLE__)
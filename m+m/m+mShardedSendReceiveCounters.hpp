@@ -0,0 +1,233 @@
+//--------------------------------------------------------------------------------------------------
+//
+//  File:       m+m/m+mShardedSendReceiveCounters.hpp
+//
+//  Project:    m+m
+//
+//  Contains:   The class declaration for a set of send / receive counters that can be updated
+//              concurrently without locking.
+//
+//  Written by: Norman Jaffe
+//
+//  Copyright:  (c) 2026 by OpenDragon.
+//
+//              All rights reserved. Redistribution and use in source and binary forms, with or
+//              without modification, are permitted provided that the following conditions are met:
+//                * Redistributions of source code must retain the above copyright notice, this list
+//                  of conditions and the following disclaimer.
+//                * Redistributions in binary form must reproduce the above copyright notice, this
+//                  list of conditions and the following disclaimer in the documentation and / or
+//                  other materials provided with the distribution.
+//                * Neither the name of the copyright holders nor the names of its contributors may
+//                  be used to endorse or promote products derived from this software without
+//                  specific prior written permission.
+//
+//              THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//              EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//              OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//              SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//              INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//              TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//              BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//              CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//              ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//              DAMAGE.
+//
+//  Created:    2026-10-17
+//
+//--------------------------------------------------------------------------------------------------
+
+
+#if (! defined(MpMShardedSendReceiveCounters_HPP_))
+# define MpMShardedSendReceiveCounters_HPP_ /* Header guard */
+
+# include <m+m/m+mSendReceiveCounters.hpp>
+
+# include <atomic>
+
+# if defined(__APPLE__)
+#  pragma clang diagnostic push
+#  pragma clang diagnostic ignored "-Wunknown-pragmas"
+#  pragma clang diagnostic ignored "-Wdocumentation-unknown-command"
+# endif // defined(__APPLE__)
+/*! @file
+ @brief The class declaration for a set of send / receive counters that can be updated
+ concurrently without locking. */
+# if defined(__APPLE__)
+#  pragma clang diagnostic pop
+# endif // defined(__APPLE__)
+
+/*! @brief The number of independent shards in a set of sharded send / receive counters. */
+# define MpM_SENDRECEIVE_SHARD_COUNT_ 8
+
+namespace MplusM
+{
+    namespace Common
+    {
+        /*! @brief A set of send / receive counters that can be updated by several threads at once.
+
+         Each updating thread is assigned to one of a fixed number of shards, and only updates the
+         atomic counters in its own shard, so that threads rarely contend for the same cache line.
+         Only the times of the last received and sent messages are shared, so that inter-arrival
+         times are measured across all the threads using the channel. The shards are combined into a single set of send / receive counters when the values are
+         requested. */
+        class ShardedSendReceiveCounters
+        {
+        public :
+
+        protected :
+
+        private :
+
+            /*! @brief The counters updated by a subset of the threads. */
+            struct CounterShard
+            {
+                /*! @brief The number of bytes received. */
+                std::atomic<int64_t> _inBytes;
+
+                /*! @brief The number of bytes sent. */
+                std::atomic<int64_t> _outBytes;
+
+                /*! @brief The number of messages received. */
+                std::atomic<int64_t> _inMessages;
+
+                /*! @brief The number of messages sent. */
+                std::atomic<int64_t> _outMessages;
+
+                /*! @brief The number of messages discarded instead of being sent. */
+                std::atomic<int64_t> _outDropped;
+
+                /*! @brief The histogram of received message sizes. */
+                std::atomic<int64_t> _inSizes[MpM_SENDRECEIVE_HISTOGRAM_BUCKETS_];
+
+                /*! @brief The histogram of sent message sizes. */
+                std::atomic<int64_t> _outSizes[MpM_SENDRECEIVE_HISTOGRAM_BUCKETS_];
+
+                /*! @brief The histogram of received message inter-arrival times. */
+                std::atomic<int64_t> _inIntervals[MpM_SENDRECEIVE_HISTOGRAM_BUCKETS_];
+
+                /*! @brief The histogram of sent message inter-arrival times. */
+                std::atomic<int64_t> _outIntervals[MpM_SENDRECEIVE_HISTOGRAM_BUCKETS_];
+
+                /*! @brief The histogram of times that received messages waited to be
+                 dispatched. */
+                std::atomic<int64_t> _queueWaits[MpM_SENDRECEIVE_HISTOGRAM_BUCKETS_];
+
+                /*! @brief Filler to keep neighbouring shards on separate cache lines. */
+                char _filler[64];
+
+            }; // CounterShard
+
+        public :
+
+            /*! @brief The constructor. */
+            ShardedSendReceiveCounters(void);
+
+            /*! @brief The destructor. */
+            virtual
+            ~ShardedSendReceiveCounters(void);
+
+            /*! @brief Add a set of send / receive counters to the shard of the calling thread.
+
+             The histograms are summed bucket by bucket; no new inter-arrival time is recorded,
+             since the added counters already hold the intervals of the messages that they
+             describe.
+             @param[in] other The values to be added to the send / receive counters. */
+            void
+            addCounters(const SendReceiveCounters & other);
+
+            /*! @brief Reset the send / receive counters. */
+            void
+            clearCounters(void);
+
+            /*! @brief Combine the shards into a single set of send / receive counters.
+             @param[out] counters The combined send / receive counters. */
+            void
+            getCounters(SendReceiveCounters & counters)
+            const;
+
+            /*! @brief Update the dispatch data.
+             @param[in] queueDepth The number of received messages waiting to be dispatched.
+             @param[in] waitTime The time, in microseconds, that the dispatched message waited. */
+            void
+            incrementDispatchCounters(const int64_t queueDepth,
+                                      const int64_t waitTime);
+
+            /*! @brief Update the outgoing queue data.
+             @param[in] lag The number of messages waiting to be sent.
+             @param[in] dropped The number of messages discarded instead of being sent. */
+            void
+            incrementOutletCounters(const int64_t lag,
+                                    const int64_t dropped);
+
+            /*! @brief Update the received data.
+             @param[in] moreInBytes The number of bytes received. */
+            void
+            incrementInCounters(const int64_t moreInBytes);
+
+            /*! @brief Update the sent data.
+             @param[in] moreOutBytes The number of bytes sent. */
+            void
+            incrementOutCounters(const int64_t moreOutBytes);
+
+        protected :
+
+        private :
+
+            /*! @brief The copy constructor.
+             @param[in] other The object to be copied. */
+            ShardedSendReceiveCounters(const ShardedSendReceiveCounters & other);
+
+            /*! @brief The assignment operator.
+             @param[in] other The object to be copied.
+             @return The updated object. */
+            ShardedSendReceiveCounters &
+            operator =(const ShardedSendReceiveCounters & other);
+
+            /*! @brief Return the shard to be updated by the calling thread.
+             @return The shard to be updated by the calling thread. */
+            CounterShard &
+            getShard(void);
+
+            /*! @brief Record the time between a message and the previous message on the channel.
+             @param[in,out] lastTime The time of the previous message on the channel, in
+             microseconds.
+             @param[in,out] intervals The histogram of the calling thread's shard. */
+            static void
+            recordInterval(std::atomic<int64_t> & lastTime,
+                           std::atomic<int64_t> * intervals);
+
+        public :
+
+        protected :
+
+        private :
+
+            /*! @brief The shards. */
+            CounterShard _shards[MpM_SENDRECEIVE_SHARD_COUNT_];
+
+            /*! @brief The time that the channel last received a message, in microseconds. */
+            std::atomic<int64_t> _lastInTime;
+
+            /*! @brief The time that the channel last sent a message, in microseconds. */
+            std::atomic<int64_t> _lastOutTime;
+
+            /*! @brief The number of received messages waiting to be dispatched. */
+            std::atomic<int64_t> _queueDepth;
+
+            /*! @brief The largest number of received messages waiting to be dispatched. */
+            std::atomic<int64_t> _maxQueueDepth;
+
+            /*! @brief The number of messages waiting to be sent. */
+            std::atomic<int64_t> _outLag;
+
+            /*! @brief The largest number of messages waiting to be sent. */
+            std::atomic<int64_t> _maxOutLag;
+
+        }; // ShardedSendReceiveCounters
+
+    } // Common
+
+} // MplusM
+
+#endif // ! defined(MpMShardedSendReceiveCounters_HPP_)
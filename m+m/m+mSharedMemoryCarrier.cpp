@@ -0,0 +1,285 @@
+//--------------------------------------------------------------------------------------------------
+//
+//  File:       m+m/m+mSharedMemoryCarrier.cpp
+//
+//  Project:    m+m
+//
+//  Contains:   The class definition for a carrier that uses shared memory between channels on the
+//              same machine.
+//
+//  Written by: Norman Jaffe
+//
+//  Copyright:  (c) 2026 by OpenDragon.
+//
+//              All rights reserved. Redistribution and use in source and binary forms, with or
+//              without modification, are permitted provided that the following conditions are met:
+//                * Redistributions of source code must retain the above copyright notice, this list
+//                  of conditions and the following disclaimer.
+//                * Redistributions in binary form must reproduce the above copyright notice, this
+//                  list of conditions and the following disclaimer in the documentation and / or
+//                  other materials provided with the distribution.
+//                * Neither the name of the copyright holders nor the names of its contributors may
+//                  be used to endorse or promote products derived from this software without
+//                  specific prior written permission.
+//
+//              THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//              EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//              OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//              SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//              INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//              TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//              BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//              CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//              ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//              DAMAGE.
+//
+//  Created:    2026-10-17
+//
+//--------------------------------------------------------------------------------------------------
+
+
+#include "m+mSharedMemoryCarrier.hpp"
+
+#include <m+m/m+mSharedMemoryStream.hpp>
+
+//#include <odlEnable.h>
+#include <odlInclude.h>
+
+#if defined(MpM_UseSharedMemory)
+# if defined(__APPLE__)
+#  pragma clang diagnostic push
+#  pragma clang diagnostic ignored "-Wdocumentation"
+#  pragma clang diagnostic ignored "-Wdocumentation-unknown-command"
+#  pragma clang diagnostic ignored "-Wpadded"
+#  pragma clang diagnostic ignored "-Wshadow"
+#  pragma clang diagnostic ignored "-Wweak-vtables"
+# endif // defined(__APPLE__)
+# include <yarp/os/Carriers.h>
+# include <yarp/os/ConnectionState.h>
+# if defined(__APPLE__)
+#  pragma clang diagnostic pop
+# endif // defined(__APPLE__)
+#endif // defined(MpM_UseSharedMemory)
+
+#if defined(__APPLE__)
+# pragma clang diagnostic push
+# pragma clang diagnostic ignored "-Wunknown-pragmas"
+# pragma clang diagnostic ignored "-Wdocumentation-unknown-command"
+#endif // defined(__APPLE__)
+/*! @file
+ @brief The class definition for a carrier that uses shared memory between channels on the same
+ machine. */
+#if defined(__APPLE__)
+# pragma clang diagnostic pop
+#endif // defined(__APPLE__)
+
+#if defined(__APPLE__)
+# pragma mark Namespace references
+#endif // defined(__APPLE__)
+
+using namespace MplusM;
+using namespace MplusM::Common;
+
+#if defined(MpM_UseSharedMemory)
+# if defined(__APPLE__)
+#  pragma mark Private structures, constants and variables
+# endif // defined(__APPLE__)
+
+/*! @brief The header that identifies a connection using this carrier. */
+static const char kCarrierHeader[] = { 'M', 'p', 'M', '_', 'S', 'H', 'M', '1' };
+
+/*! @brief The number of bytes in the reply to the header, which holds the segment name. */
+static const size_t kReplySize = 64;
+
+# if defined(__APPLE__)
+#  pragma mark Global constants and variables
+# endif // defined(__APPLE__)
+
+# if defined(__APPLE__)
+#  pragma mark Local functions
+# endif // defined(__APPLE__)
+
+# if defined(__APPLE__)
+#  pragma mark Class methods
+# endif // defined(__APPLE__)
+
+# if defined(__APPLE__)
+#  pragma mark Constructors and Destructors
+# endif // defined(__APPLE__)
+
+SharedMemoryCarrier::SharedMemoryCarrier(void) :
+    inherited()
+{
+    ODL_ENTER(); //####
+    ODL_EXIT_P(this); //####
+} // SharedMemoryCarrier::SharedMemoryCarrier
+
+SharedMemoryCarrier::~SharedMemoryCarrier(void)
+{
+    ODL_OBJENTER(); //####
+    ODL_OBJEXIT(); //####
+} // SharedMemoryCarrier::~SharedMemoryCarrier
+
+# if defined(__APPLE__)
+#  pragma mark Actions and Accessors
+# endif // defined(__APPLE__)
+
+bool
+SharedMemoryCarrier::checkHeader(const yarp::os::Bytes & header)
+{
+    ODL_OBJENTER(); //####
+    ODL_P1("header = ", &header); //####
+    bool result = ((sizeof(kCarrierHeader) == header.length()) &&
+                   (! memcmp(header.get(), kCarrierHeader, sizeof(kCarrierHeader))));
+
+    ODL_OBJEXIT_B(result); //####
+    return result;
+} // SharedMemoryCarrier::checkHeader
+
+yarp::os::Carrier *
+SharedMemoryCarrier::create(void)
+{
+    ODL_OBJENTER(); //####
+    yarp::os::Carrier * result = new SharedMemoryCarrier;
+
+    ODL_OBJEXIT_P(result); //####
+    return result;
+} // SharedMemoryCarrier::create
+
+bool
+SharedMemoryCarrier::expectReplyToHeader(yarp::os::ConnectionState & proto)
+{
+    ODL_OBJENTER(); //####
+    ODL_P1("proto = ", &proto); //####
+    bool result = true;
+    char reply[kReplySize];
+
+    for (size_t soFar = 0; result && (kReplySize > soFar); )
+    {
+        yarp::os::Bytes remainder(reply + soFar, kReplySize - soFar);
+        YARP_SSIZE_T    count = proto.is().read(remainder);
+
+        if (0 < count)
+        {
+            soFar += static_cast<size_t>(count);
+        }
+        else
+        {
+            ODL_LOG("! (0 < count)"); //####
+            result = false;
+        }
+    }
+    if (result)
+    {
+        reply[kReplySize - 1] = '\0';
+        if (reply[0])
+        {
+            yarp::os::TwoWayStream & oldStreams = proto.getStreams();
+            SharedMemoryStream *     newStreams =
+                                        SharedMemoryStream::Attach(reply,
+                                                                   oldStreams.getLocalAddress(),
+                                                                   oldStreams.getRemoteAddress());
+
+            if (newStreams)
+            {
+                proto.takeStreams(newStreams);
+            }
+            else
+            {
+                // The other end has already switched to shared memory, so we can't carry on.
+                ODL_LOG("! (newStreams)"); //####
+                result = false;
+            }
+        }
+        // An empty name means that the connection stays on TCP.
+    }
+    ODL_OBJEXIT_B(result); //####
+    return result;
+} // SharedMemoryCarrier::expectReplyToHeader
+
+void
+SharedMemoryCarrier::getHeader(const yarp::os::Bytes & header)
+{
+    ODL_OBJENTER(); //####
+    ODL_P1("header = ", &header); //####
+    if (sizeof(kCarrierHeader) <= header.length())
+    {
+        memcpy(header.get(), kCarrierHeader, sizeof(kCarrierHeader));
+    }
+    ODL_OBJEXIT(); //####
+} // SharedMemoryCarrier::getHeader
+
+yarp::os::ConstString
+SharedMemoryCarrier::getName(void)
+{
+    ODL_OBJENTER(); //####
+    ODL_OBJEXIT_s(SHARED_MEMORY_CARRIER_); //####
+    return SHARED_MEMORY_CARRIER_;
+} // SharedMemoryCarrier::getName
+
+bool
+SharedMemoryCarrier::isConnectionless(void)
+{
+    ODL_OBJENTER(); //####
+    ODL_OBJEXIT_B(false); //####
+    return false;
+} // SharedMemoryCarrier::isConnectionless
+
+bool
+SharedMemoryCarrier::Register(void)
+{
+    ODL_ENTER(); //####
+    bool result = yarp::os::Carriers::addCarrierPrototype(new SharedMemoryCarrier);
+
+    ODL_EXIT_B(result); //####
+    return result;
+} // SharedMemoryCarrier::Register
+
+bool
+SharedMemoryCarrier::requireAck(void)
+{
+    ODL_OBJENTER(); //####
+    ODL_OBJEXIT_B(true); //####
+    return true;
+} // SharedMemoryCarrier::requireAck
+
+bool
+SharedMemoryCarrier::respondToHeader(yarp::os::ConnectionState & proto)
+{
+    ODL_OBJENTER(); //####
+    ODL_P1("proto = ", &proto); //####
+    yarp::os::TwoWayStream & oldStreams = proto.getStreams();
+    const yarp::os::Contact & localAddress = oldStreams.getLocalAddress();
+    const yarp::os::Contact & remoteAddress = oldStreams.getRemoteAddress();
+    SharedMemoryStream *      newStreams = NULL;
+    bool                      result;
+    char                      reply[kReplySize];
+    yarp::os::Bytes           replyBytes(reply, sizeof(reply));
+
+    memset(reply, 0, sizeof(reply));
+    if (localAddress.getHost() == remoteAddress.getHost())
+    {
+        newStreams = SharedMemoryStream::Create(SHARED_MEMORY_RING_SIZE_, localAddress,
+                                                remoteAddress);
+        if (newStreams)
+        {
+            const YarpString & segmentName = newStreams->getSegmentName();
+
+            memcpy(reply, segmentName.c_str(), std::min(segmentName.length(), kReplySize - 1));
+        }
+    }
+    proto.os().write(replyBytes);
+    proto.os().flush();
+    if (newStreams)
+    {
+        proto.takeStreams(newStreams);
+    }
+    result = proto.checkStreams();
+    ODL_OBJEXIT_B(result); //####
+    return result;
+} // SharedMemoryCarrier::respondToHeader
+#endif // defined(MpM_UseSharedMemory)
+
+#if defined(__APPLE__)
+# pragma mark Global functions
+#endif // defined(__APPLE__)
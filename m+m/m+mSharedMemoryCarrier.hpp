@@ -0,0 +1,184 @@
+//--------------------------------------------------------------------------------------------------
+//
+//  File:       m+m/m+mSharedMemoryCarrier.hpp
+//
+//  Project:    m+m
+//
+//  Contains:   The class declaration for a carrier that uses shared memory between channels on the
+//              same machine.
+//
+//  Written by: Norman Jaffe
+//
+//  Copyright:  (c) 2026 by OpenDragon.
+//
+//              All rights reserved. Redistribution and use in source and binary forms, with or
+//              without modification, are permitted provided that the following conditions are met:
+//                * Redistributions of source code must retain the above copyright notice, this list
+//                  of conditions and the following disclaimer.
+//                * Redistributions in binary form must reproduce the above copyright notice, this
+//                  list of conditions and the following disclaimer in the documentation and / or
+//                  other materials provided with the distribution.
+//                * Neither the name of the copyright holders nor the names of its contributors may
+//                  be used to endorse or promote products derived from this software without
+//                  specific prior written permission.
+//
+//              THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//              EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//              OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//              SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//              INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//              TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//              BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//              CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//              ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//              DAMAGE.
+//
+//  Created:    2026-10-17
+//
+//--------------------------------------------------------------------------------------------------
+
+
+#if (! defined(MpMSharedMemoryCarrier_HPP_))
+# define MpMSharedMemoryCarrier_HPP_ /* Header guard */
+
+# include <m+m/m+mCommon.hpp>
+
+# if defined(MpM_UseSharedMemory)
+#  if defined(__APPLE__)
+#   pragma clang diagnostic push
+#   pragma clang diagnostic ignored "-Wdocumentation"
+#   pragma clang diagnostic ignored "-Wdocumentation-unknown-command"
+#   pragma clang diagnostic ignored "-Wpadded"
+#   pragma clang diagnostic ignored "-Wshadow"
+#   pragma clang diagnostic ignored "-Wweak-vtables"
+#  endif // defined(__APPLE__)
+#  include <yarp/os/AbstractCarrier.h>
+#  if defined(__APPLE__)
+#   pragma clang diagnostic pop
+#  endif // defined(__APPLE__)
+# endif // defined(MpM_UseSharedMemory)
+
+# if defined(__APPLE__)
+#  pragma clang diagnostic push
+#  pragma clang diagnostic ignored "-Wunknown-pragmas"
+#  pragma clang diagnostic ignored "-Wdocumentation-unknown-command"
+# endif // defined(__APPLE__)
+/*! @file
+ @brief The class declaration for a carrier that uses shared memory between channels on the same
+ machine. */
+# if defined(__APPLE__)
+#  pragma clang diagnostic pop
+# endif // defined(__APPLE__)
+
+# if defined(MpM_UseSharedMemory)
+namespace MplusM
+{
+    namespace Common
+    {
+        /*! @brief A carrier that moves data through shared memory when both ends of a connection
+         are on the same machine.
+
+         The connection is set up over TCP, as usual; the receiving end then creates a shared
+         memory segment and sends its name back to the sending end, after which both ends switch to
+         the segment. If the two ends turn out to be on different machines, the receiving end
+         sends back an empty name and the connection carries on over TCP. */
+        class SharedMemoryCarrier : public yarp::os::AbstractCarrier
+        {
+        public :
+
+        protected :
+
+        private :
+
+            /*! @brief The class that this class is derived from. */
+            typedef yarp::os::AbstractCarrier inherited;
+
+        public :
+
+            /*! @brief The constructor. */
+            SharedMemoryCarrier(void);
+
+            /*! @brief The destructor. */
+            virtual
+            ~SharedMemoryCarrier(void);
+
+            /*! @brief Check if the header of a new connection is for this carrier.
+             @param[in] header The first eight bytes of the connection.
+             @return @c true if the header is for this carrier and @c false otherwise. */
+            virtual bool
+            checkHeader(const yarp::os::Bytes & header);
+
+            /*! @brief Return a new instance of this carrier.
+             @return A new instance of this carrier. */
+            virtual yarp::os::Carrier *
+            create(void);
+
+            /*! @brief Handle the reply from the receiving end of a connection, switching to
+             shared memory if a segment was created.
+             @param[in] proto The state of the connection.
+             @return @c true if the connection can be used and @c false otherwise. */
+            virtual bool
+            expectReplyToHeader(yarp::os::ConnectionState & proto);
+
+            /*! @brief Fill in the header that identifies this carrier.
+             @param[in] header The first eight bytes of the connection. */
+            virtual void
+            getHeader(const yarp::os::Bytes & header);
+
+            /*! @brief Return the name of this carrier.
+             @return The name of this carrier. */
+            virtual yarp::os::ConstString
+            getName(void);
+
+            /*! @brief Return @c true if the carrier does not keep a connection.
+             @return @c false, since the carrier keeps a connection. */
+            virtual bool
+            isConnectionless(void);
+
+            /*! @brief Make the carrier available to YARP.
+
+             This should be called once per process, before any connections are made.
+             @return @c true if the carrier was added and @c false otherwise. */
+            static bool
+            Register(void);
+
+            /*! @brief Return @c true if the carrier needs an acknowledgement for each message.
+             @return @c true, since the carrier needs an acknowledgement. */
+            virtual bool
+            requireAck(void);
+
+            /*! @brief Reply to the sending end of a connection, creating a shared memory segment if
+             both ends are on the same machine.
+             @param[in] proto The state of the connection.
+             @return @c true if the connection can be used and @c false otherwise. */
+            virtual bool
+            respondToHeader(yarp::os::ConnectionState & proto);
+
+        protected :
+
+        private :
+
+            /*! @brief The copy constructor.
+             @param[in] other The object to be copied. */
+            SharedMemoryCarrier(const SharedMemoryCarrier & other);
+
+            /*! @brief The assignment operator.
+             @param[in] other The object to be copied.
+             @return The updated object. */
+            SharedMemoryCarrier &
+            operator =(const SharedMemoryCarrier & other);
+
+        public :
+
+        protected :
+
+        private :
+
+        }; // SharedMemoryCarrier
+
+    } // Common
+
+} // MplusM
+# endif // defined(MpM_UseSharedMemory)
+
+#endif // ! defined(MpMSharedMemoryCarrier_HPP_)
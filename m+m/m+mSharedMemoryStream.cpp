@@ -0,0 +1,693 @@
+//--------------------------------------------------------------------------------------------------
+//
+//  File:       m+m/m+mSharedMemoryStream.cpp
+//
+//  Project:    m+m
+//
+//  Contains:   The class definition for a stream that exchanges data through a shared memory
+//              segment.
+//
+//  Written by: Norman Jaffe
+//
+//  Copyright:  (c) 2026 by OpenDragon.
+//
+//              All rights reserved. Redistribution and use in source and binary forms, with or
+//              without modification, are permitted provided that the following conditions are met:
+//                * Redistributions of source code must retain the above copyright notice, this list
+//                  of conditions and the following disclaimer.
+//                * Redistributions in binary form must reproduce the above copyright notice, this
+//                  list of conditions and the following disclaimer in the documentation and / or
+//                  other materials provided with the distribution.
+//                * Neither the name of the copyright holders nor the names of its contributors may
+//                  be used to endorse or promote products derived from this software without
+//                  specific prior written permission.
+//
+//              THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//              EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//              OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//              SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//              INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//              TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//              BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//              CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//              ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//              DAMAGE.
+//
+//  Created:    2026-10-17
+//
+//--------------------------------------------------------------------------------------------------
+
+
+#include "m+mSharedMemoryStream.hpp"
+
+//#include <odlEnable.h>
+#include <odlInclude.h>
+
+#if defined(MpM_UseSharedMemory)
+# include <atomic>
+# include <cerrno>
+# include <climits>
+# include <cstdio>
+# include <fcntl.h>
+# include <signal.h>
+# include <sys/mman.h>
+# include <sys/stat.h>
+# include <unistd.h>
+# if defined(__linux__)
+#  include <linux/futex.h>
+#  include <sys/syscall.h>
+# endif // defined(__linux__)
+#endif // defined(MpM_UseSharedMemory)
+
+#if defined(__APPLE__)
+# pragma clang diagnostic push
+# pragma clang diagnostic ignored "-Wunknown-pragmas"
+# pragma clang diagnostic ignored "-Wdocumentation-unknown-command"
+#endif // defined(__APPLE__)
+/*! @file
+ @brief The class definition for a stream that exchanges data through a shared memory segment. */
+#if defined(__APPLE__)
+# pragma clang diagnostic pop
+#endif // defined(__APPLE__)
+
+#if defined(__APPLE__)
+# pragma mark Namespace references
+#endif // defined(__APPLE__)
+
+using namespace MplusM;
+using namespace MplusM::Common;
+
+#if defined(MpM_UseSharedMemory)
+# if defined(__APPLE__)
+#  pragma mark Private structures, constants and variables
+# endif // defined(__APPLE__)
+
+/*! @brief The size of a cache line, used to keep the reader and writer positions apart. */
+# define CACHE_LINE_SIZE_ 64
+
+namespace MplusM
+{
+    namespace Common
+    {
+        /*! @brief The control block for one direction of a shared memory connection.
+
+         The positions only ever increase; the offset into the data area is the position modulo
+         the ring size. The signal words are used as futexes, so they must be 32 bits wide. */
+        struct SharedMemoryRing
+        {
+            /*! @brief The position of the next byte to be read. */
+            std::atomic<uint64_t> _readPosition;
+
+            /*! @brief Filler to keep the reader and writer on separate cache lines. */
+            char _filler1[CACHE_LINE_SIZE_ - sizeof(std::atomic<uint64_t>)];
+
+            /*! @brief The position of the next byte to be written. */
+            std::atomic<uint64_t> _writePosition;
+
+            /*! @brief Filler to keep the reader and writer on separate cache lines. */
+            char _filler2[CACHE_LINE_SIZE_ - sizeof(std::atomic<uint64_t>)];
+
+            /*! @brief Changed whenever data is added to the ring. */
+            std::atomic<uint32_t> _dataSignal;
+
+            /*! @brief Non-zero if the reader is sleeping on the data signal. */
+            std::atomic<uint32_t> _readerWaiting;
+
+            /*! @brief Changed whenever data is removed from the ring. */
+            std::atomic<uint32_t> _spaceSignal;
+
+            /*! @brief Non-zero if the writer is sleeping on the space signal. */
+            std::atomic<uint32_t> _writerWaiting;
+
+            /*! @brief Non-zero if either end of the connection has been closed. */
+            std::atomic<uint32_t> _closed;
+
+            /*! @brief Filler to pad to a cache line boundary. */
+            char _filler3[CACHE_LINE_SIZE_ - (5 * sizeof(std::atomic<uint32_t>))];
+
+        }; // SharedMemoryRing
+
+        /*! @brief The layout of the start of a shared memory segment; the data areas of the two
+         rings follow it. */
+        struct SharedMemorySegment
+        {
+            /*! @brief A value to check that the segment was set up correctly. */
+            uint32_t _magic;
+
+            /*! @brief The number of bytes in the data area of each ring. */
+            uint32_t _ringSize;
+
+            /*! @brief The process that created the segment. */
+            std::atomic<int32_t> _creatorProcess;
+
+            /*! @brief The process that attached to the segment. */
+            std::atomic<int32_t> _attacherProcess;
+
+            /*! @brief Filler to pad to a cache line boundary. */
+            char _filler[CACHE_LINE_SIZE_ - (4 * sizeof(uint32_t))];
+
+            /*! @brief The ring that is written by the attaching end and read by the creating end.
+             */
+            SharedMemoryRing _toCreator;
+
+            /*! @brief The ring that is written by the creating end and read by the attaching end.
+             */
+            SharedMemoryRing _toAttacher;
+
+        }; // SharedMemorySegment
+
+    } // Common
+
+} // MplusM
+
+/*! @brief The value used to check that a segment was set up correctly. */
+static const uint32_t kSegmentMagic = 0x4D704D53;
+
+/*! @brief The number of times to check for a change before sleeping. */
+static const int kSpinCount = 2000;
+
+/*! @brief The time, in seconds, that the other end of a connection has to attach to a newly
+ created segment. */
+static const double kAttachTimeout = 5.0;
+
+/*! @brief The time, in nanoseconds, to sleep between checks that the connection is still alive. */
+static const long kWaitSlice = 100000000;
+
+/*! @brief The counter used to make segment names unique within a process. */
+static std::atomic<uint32_t> lSegmentCounter(0);
+
+# if defined(__APPLE__)
+#  pragma mark Global constants and variables
+# endif // defined(__APPLE__)
+
+# if defined(__APPLE__)
+#  pragma mark Local functions
+# endif // defined(__APPLE__)
+
+/*! @brief Copy data into a ring, handling the wrap-around at the end of the data area.
+ @param[in] data The data area of the ring.
+ @param[in] ringSize The number of bytes in the data area.
+ @param[in] position The position to write at.
+ @param[in] source The data to be copied.
+ @param[in] count The number of bytes to be copied. */
+static void
+copyIntoRing(char *       data,
+             const size_t ringSize,
+             const size_t position,
+             const char * source,
+             const size_t count)
+{
+    size_t offset = (position % ringSize);
+    size_t firstPart = std::min(count, ringSize - offset);
+
+    memcpy(data + offset, source, firstPart);
+    if (firstPart < count)
+    {
+        memcpy(data, source + firstPart, count - firstPart);
+    }
+} // copyIntoRing
+
+/*! @brief Copy data out of a ring, handling the wrap-around at the end of the data area.
+ @param[in] data The data area of the ring.
+ @param[in] ringSize The number of bytes in the data area.
+ @param[in] position The position to read from.
+ @param[in] destination Where to copy the data.
+ @param[in] count The number of bytes to be copied. */
+static void
+copyOutOfRing(const char * data,
+              const size_t ringSize,
+              const size_t position,
+              char *       destination,
+              const size_t count)
+{
+    size_t offset = (position % ringSize);
+    size_t firstPart = std::min(count, ringSize - offset);
+
+    memcpy(destination, data + offset, firstPart);
+    if (firstPart < count)
+    {
+        memcpy(destination + firstPart, data, count - firstPart);
+    }
+} // copyOutOfRing
+
+/*! @brief Sleep until a signal word changes or a short time passes.
+ @param[in] signal The signal word to wait on.
+ @param[in] expected The value that the signal word had before the caller decided to wait. */
+static void
+sleepOnSignal(std::atomic<uint32_t> & signal,
+              const uint32_t          expected)
+{
+# if defined(__linux__)
+    struct timespec slice = { 0, kWaitSlice };
+
+    syscall(SYS_futex, reinterpret_cast<uint32_t *>(&signal), FUTEX_WAIT, expected, &slice,
+            NULL, 0);
+# else // ! defined(__linux__)
+    // Without futexes, poll at a fine granularity instead.
+    for (int ii = 0; (ii < 1000) && (signal.load() == expected); ++ii)
+    {
+        usleep(static_cast<useconds_t>(kWaitSlice / 1000000));
+    }
+# endif // ! defined(__linux__)
+} // sleepOnSignal
+
+/*! @brief Change a signal word and wake up anyone waiting on it.
+ @param[in] signal The signal word to change.
+ @param[in] waiting The flag indicating that someone is waiting on the signal word. */
+static void
+raiseSignal(std::atomic<uint32_t> & signal,
+            std::atomic<uint32_t> & waiting)
+{
+    signal.fetch_add(1);
+    if (waiting.exchange(0))
+    {
+# if defined(__linux__)
+        syscall(SYS_futex, reinterpret_cast<uint32_t *>(&signal), FUTEX_WAKE, INT_MAX, NULL,
+                NULL, 0);
+# endif // defined(__linux__)
+    }
+} // raiseSignal
+
+/*! @brief Initialize a ring control block.
+ @param[in] ring The ring to be initialized. */
+static void
+resetRing(SharedMemoryRing & ring)
+{
+    ring._readPosition = 0;
+    ring._writePosition = 0;
+    ring._dataSignal = 0;
+    ring._readerWaiting = 0;
+    ring._spaceSignal = 0;
+    ring._writerWaiting = 0;
+    ring._closed = 0;
+} // resetRing
+
+# if defined(__APPLE__)
+#  pragma mark Class methods
+# endif // defined(__APPLE__)
+
+# if defined(__APPLE__)
+#  pragma mark Constructors and Destructors
+# endif // defined(__APPLE__)
+
+SharedMemoryStream::SharedMemoryStream(const YarpString &        segmentName,
+                                       SharedMemorySegment *     segment,
+                                       const size_t              segmentSize,
+                                       const bool                isCreator,
+                                       const yarp::os::Contact & localAddress,
+                                       const yarp::os::Contact & remoteAddress) :
+    yarp::os::TwoWayStream(), yarp::os::InputStream(), yarp::os::OutputStream(),
+    _localAddress(localAddress), _remoteAddress(remoteAddress), _segmentName(segmentName),
+    _segment(segment), _inRing(NULL), _outRing(NULL), _inData(NULL), _outData(NULL),
+    _segmentSize(segmentSize), _startTime(yarp::os::Time::now()), _isCreator(isCreator),
+    _isOk(true)
+{
+    ODL_ENTER(); //####
+    ODL_S1s("segmentName = ", segmentName); //####
+    ODL_P3("segment = ", segment, "localAddress = ", &localAddress, "remoteAddress = ", //####
+           &remoteAddress); //####
+    ODL_I1("segmentSize = ", segmentSize); //####
+    ODL_B1("isCreator = ", isCreator); //####
+    char * dataArea = reinterpret_cast<char *>(segment + 1);
+
+    if (isCreator)
+    {
+        _inRing = &segment->_toCreator;
+        _outRing = &segment->_toAttacher;
+        _inData = dataArea;
+        _outData = dataArea + segment->_ringSize;
+    }
+    else
+    {
+        _inRing = &segment->_toAttacher;
+        _outRing = &segment->_toCreator;
+        _inData = dataArea + segment->_ringSize;
+        _outData = dataArea;
+    }
+    ODL_EXIT_P(this); //####
+} // SharedMemoryStream::SharedMemoryStream
+
+SharedMemoryStream::~SharedMemoryStream(void)
+{
+    ODL_OBJENTER(); //####
+    close();
+    munmap(_segment, _segmentSize);
+    ODL_OBJEXIT(); //####
+} // SharedMemoryStream::~SharedMemoryStream
+
+# if defined(__APPLE__)
+#  pragma mark Actions and Accessors
+# endif // defined(__APPLE__)
+
+SharedMemoryStream *
+SharedMemoryStream::Attach(const YarpString &        segmentName,
+                           const yarp::os::Contact & localAddress,
+                           const yarp::os::Contact & remoteAddress)
+{
+    ODL_ENTER(); //####
+    ODL_S1s("segmentName = ", segmentName); //####
+    ODL_P2("localAddress = ", &localAddress, "remoteAddress = ", &remoteAddress); //####
+    SharedMemoryStream * result = NULL;
+    int                  fd = shm_open(segmentName.c_str(), O_RDWR, 0);
+
+    if (0 <= fd)
+    {
+        struct stat info;
+
+        if ((0 == fstat(fd, &info)) &&
+            (sizeof(SharedMemorySegment) < static_cast<size_t>(info.st_size)))
+        {
+            size_t segmentSize = static_cast<size_t>(info.st_size);
+            void * mapped = mmap(NULL, segmentSize, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+
+            if (MAP_FAILED == mapped)
+            {
+                ODL_LOG("(MAP_FAILED == mapped)"); //####
+            }
+            else
+            {
+                SharedMemorySegment * segment = static_cast<SharedMemorySegment *>(mapped);
+
+                if ((kSegmentMagic == segment->_magic) &&
+                    ((sizeof(SharedMemorySegment) + (2 * segment->_ringSize)) <= segmentSize))
+                {
+                    segment->_attacherProcess = static_cast<int32_t>(getpid());
+                    result = new SharedMemoryStream(segmentName, segment, segmentSize, false,
+                                                    localAddress, remoteAddress);
+                }
+                else
+                {
+                    ODL_LOG("! ((kSegmentMagic == segment->_magic) && " //####
+                            "((sizeof(SharedMemorySegment) + (2 * segment->_ringSize)) <= " //####
+                            "segmentSize))"); //####
+                    munmap(mapped, segmentSize);
+                }
+            }
+        }
+        else
+        {
+            ODL_LOG("! ((0 == fstat(fd, &info)) && " //####
+                    "(sizeof(SharedMemorySegment) < static_cast<size_t>(info.st_size)))"); //####
+        }
+        ::close(fd);
+        // The name is no longer needed; the segment stays alive until both ends unmap it.
+        shm_unlink(segmentName.c_str());
+    }
+    else
+    {
+        ODL_LOG("! (0 <= fd)"); //####
+    }
+    ODL_EXIT_P(result); //####
+    return result;
+} // SharedMemoryStream::Attach
+
+void
+SharedMemoryStream::beginPacket(void)
+{
+    ODL_OBJENTER(); //####
+    ODL_OBJEXIT(); //####
+} // SharedMemoryStream::beginPacket
+
+void
+SharedMemoryStream::close(void)
+{
+    ODL_OBJENTER(); //####
+    if (_isOk.exchange(false))
+    {
+        _inRing->_closed = 1;
+        _outRing->_closed = 1;
+        raiseSignal(_inRing->_spaceSignal, _inRing->_writerWaiting);
+        raiseSignal(_outRing->_dataSignal, _outRing->_readerWaiting);
+        if (_isCreator)
+        {
+            // If the other end never attached, the name is still present.
+            shm_unlink(_segmentName.c_str());
+        }
+    }
+    ODL_OBJEXIT(); //####
+} // SharedMemoryStream::close
+
+SharedMemoryStream *
+SharedMemoryStream::Create(const size_t              ringSize,
+                           const yarp::os::Contact & localAddress,
+                           const yarp::os::Contact & remoteAddress)
+{
+    ODL_ENTER(); //####
+    ODL_I1("ringSize = ", ringSize); //####
+    ODL_P2("localAddress = ", &localAddress, "remoteAddress = ", &remoteAddress); //####
+    SharedMemoryStream * result = NULL;
+    char                 nameBuffer[40];
+
+    snprintf(nameBuffer, sizeof(nameBuffer), "/mpm.%ld.%lu", static_cast<long>(getpid()),
+             static_cast<unsigned long>(lSegmentCounter++));
+    int fd = shm_open(nameBuffer, O_RDWR | O_CREAT | O_EXCL, S_IRUSR | S_IWUSR);
+
+    if (0 <= fd)
+    {
+        size_t segmentSize = sizeof(SharedMemorySegment) + (2 * ringSize);
+
+        if (0 == ftruncate(fd, static_cast<off_t>(segmentSize)))
+        {
+            void * mapped = mmap(NULL, segmentSize, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+
+            if (MAP_FAILED == mapped)
+            {
+                ODL_LOG("(MAP_FAILED == mapped)"); //####
+                shm_unlink(nameBuffer);
+            }
+            else
+            {
+                SharedMemorySegment * segment = static_cast<SharedMemorySegment *>(mapped);
+
+                segment->_ringSize = static_cast<uint32_t>(ringSize);
+                segment->_creatorProcess = static_cast<int32_t>(getpid());
+                segment->_attacherProcess = 0;
+                resetRing(segment->_toCreator);
+                resetRing(segment->_toAttacher);
+                std::atomic_thread_fence(std::memory_order_release);
+                segment->_magic = kSegmentMagic;
+                result = new SharedMemoryStream(nameBuffer, segment, segmentSize, true,
+                                                localAddress, remoteAddress);
+            }
+        }
+        else
+        {
+            ODL_LOG("! (0 == ftruncate(fd, static_cast<off_t>(segmentSize)))"); //####
+            shm_unlink(nameBuffer);
+        }
+        ::close(fd);
+    }
+    else
+    {
+        ODL_LOG("! (0 <= fd)"); //####
+    }
+    ODL_EXIT_P(result); //####
+    return result;
+} // SharedMemoryStream::Create
+
+void
+SharedMemoryStream::endPacket(void)
+{
+    ODL_OBJENTER(); //####
+    ODL_OBJEXIT(); //####
+} // SharedMemoryStream::endPacket
+
+yarp::os::InputStream &
+SharedMemoryStream::getInputStream(void)
+{
+    ODL_OBJENTER(); //####
+    ODL_OBJEXIT_P(this); //####
+    return *this;
+} // SharedMemoryStream::getInputStream
+
+const yarp::os::Contact &
+SharedMemoryStream::getLocalAddress(void)
+{
+    ODL_OBJENTER(); //####
+    ODL_OBJEXIT_P(&_localAddress); //####
+    return _localAddress;
+} // SharedMemoryStream::getLocalAddress
+
+yarp::os::OutputStream &
+SharedMemoryStream::getOutputStream(void)
+{
+    ODL_OBJENTER(); //####
+    ODL_OBJEXIT_P(this); //####
+    return *this;
+} // SharedMemoryStream::getOutputStream
+
+const yarp::os::Contact &
+SharedMemoryStream::getRemoteAddress(void)
+{
+    ODL_OBJENTER(); //####
+    ODL_OBJEXIT_P(&_remoteAddress); //####
+    return _remoteAddress;
+} // SharedMemoryStream::getRemoteAddress
+
+void
+SharedMemoryStream::interrupt(void)
+{
+    ODL_OBJENTER(); //####
+    close();
+    ODL_OBJEXIT(); //####
+} // SharedMemoryStream::interrupt
+
+bool
+SharedMemoryStream::isOk(void)
+{
+    ODL_OBJENTER(); //####
+    bool result = _isOk.load();
+
+    ODL_OBJEXIT_B(result); //####
+    return result;
+} // SharedMemoryStream::isOk
+
+bool
+SharedMemoryStream::isPeerAlive(void)
+{
+    ODL_OBJENTER(); //####
+    bool    result;
+    int32_t peer;
+
+    if (_isCreator)
+    {
+        peer = _segment->_attacherProcess;
+    }
+    else
+    {
+        peer = _segment->_creatorProcess;
+    }
+    if (peer)
+    {
+        result = ((0 == kill(static_cast<pid_t>(peer), 0)) || (EPERM == errno));
+    }
+    else
+    {
+        result = ((yarp::os::Time::now() - _startTime) < kAttachTimeout);
+    }
+    ODL_OBJEXIT_B(result); //####
+    return result;
+} // SharedMemoryStream::isPeerAlive
+
+YARP_SSIZE_T
+SharedMemoryStream::read(const yarp::os::Bytes & bytes)
+{
+    ODL_OBJENTER(); //####
+    ODL_P1("bytes = ", &bytes); //####
+    YARP_SSIZE_T result = -1;
+    size_t       ringSize = _segment->_ringSize;
+    size_t       wanted = bytes.length();
+
+    for (int spins = 0; _isOk; )
+    {
+        uint64_t readPosition = _inRing->_readPosition.load(std::memory_order_relaxed);
+        uint64_t writePosition = _inRing->_writePosition.load(std::memory_order_acquire);
+
+        if (readPosition != writePosition)
+        {
+            size_t count = std::min(wanted, static_cast<size_t>(writePosition - readPosition));
+
+            copyOutOfRing(_inData, ringSize, static_cast<size_t>(readPosition), bytes.get(),
+                          count);
+            _inRing->_readPosition = (readPosition + count);
+            raiseSignal(_inRing->_spaceSignal, _inRing->_writerWaiting);
+            result = static_cast<YARP_SSIZE_T>(count);
+            break;
+        }
+
+        if (_inRing->_closed)
+        {
+            ODL_LOG("(_inRing->_closed)"); //####
+            break;
+        }
+
+        if (kSpinCount > ++spins)
+        {
+            continue;
+        }
+
+        uint32_t signal = _inRing->_dataSignal.load();
+
+        _inRing->_readerWaiting = 1;
+        if (writePosition == _inRing->_writePosition.load())
+        {
+            sleepOnSignal(_inRing->_dataSignal, signal);
+            if ((signal == _inRing->_dataSignal.load()) && (! isPeerAlive()))
+            {
+                ODL_LOG("((signal == _inRing->_dataSignal.load()) && (! isPeerAlive()))"); //####
+                close();
+            }
+        }
+    }
+    ODL_OBJEXIT_I(result); //####
+    return result;
+} // SharedMemoryStream::read
+
+void
+SharedMemoryStream::reset(void)
+{
+    ODL_OBJENTER(); //####
+    ODL_OBJEXIT(); //####
+} // SharedMemoryStream::reset
+
+void
+SharedMemoryStream::write(const yarp::os::Bytes & bytes)
+{
+    ODL_OBJENTER(); //####
+    ODL_P1("bytes = ", &bytes); //####
+    const char * source = bytes.get();
+    size_t       ringSize = _segment->_ringSize;
+    size_t       remaining = bytes.length();
+
+    for (int spins = 0; _isOk && (0 < remaining); )
+    {
+        if (_outRing->_closed)
+        {
+            ODL_LOG("(_outRing->_closed)"); //####
+            close();
+            break;
+        }
+
+        uint64_t writePosition = _outRing->_writePosition.load(std::memory_order_relaxed);
+        uint64_t readPosition = _outRing->_readPosition.load(std::memory_order_acquire);
+        size_t   space = ringSize - static_cast<size_t>(writePosition - readPosition);
+
+        if (0 < space)
+        {
+            size_t count = std::min(remaining, space);
+
+            copyIntoRing(_outData, ringSize, static_cast<size_t>(writePosition), source, count);
+            _outRing->_writePosition = (writePosition + count);
+            raiseSignal(_outRing->_dataSignal, _outRing->_readerWaiting);
+            source += count;
+            remaining -= count;
+            spins = 0;
+            continue;
+        }
+
+        if (kSpinCount > ++spins)
+        {
+            continue;
+        }
+
+        uint32_t signal = _outRing->_spaceSignal.load();
+
+        _outRing->_writerWaiting = 1;
+        if (readPosition == _outRing->_readPosition.load())
+        {
+            sleepOnSignal(_outRing->_spaceSignal, signal);
+            if ((signal == _outRing->_spaceSignal.load()) && (! isPeerAlive()))
+            {
+                ODL_LOG("((signal == _outRing->_spaceSignal.load()) && " //####
+                        "(! isPeerAlive()))"); //####
+                close();
+            }
+        }
+    }
+    ODL_OBJEXIT(); //####
+} // SharedMemoryStream::write
+#endif // defined(MpM_UseSharedMemory)
+
+#if defined(__APPLE__)
+# pragma mark Global functions
+#endif // defined(__APPLE__)
@@ -0,0 +1,290 @@
+//--------------------------------------------------------------------------------------------------
+//
+//  File:       m+m/m+mSharedMemoryStream.hpp
+//
+//  Project:    m+m
+//
+//  Contains:   The class declaration for a stream that exchanges data through a shared memory
+//              segment.
+//
+//  Written by: Norman Jaffe
+//
+//  Copyright:  (c) 2026 by OpenDragon.
+//
+//              All rights reserved. Redistribution and use in source and binary forms, with or
+//              without modification, are permitted provided that the following conditions are met:
+//                * Redistributions of source code must retain the above copyright notice, this list
+//                  of conditions and the following disclaimer.
+//                * Redistributions in binary form must reproduce the above copyright notice, this
+//                  list of conditions and the following disclaimer in the documentation and / or
+//                  other materials provided with the distribution.
+//                * Neither the name of the copyright holders nor the names of its contributors may
+//                  be used to endorse or promote products derived from this software without
+//                  specific prior written permission.
+//
+//              THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//              EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//              OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//              SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//              INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//              TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//              BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//              CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//              ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//              DAMAGE.
+//
+//  Created:    2026-10-17
+//
+//--------------------------------------------------------------------------------------------------
+
+
+#if (! defined(MpMSharedMemoryStream_HPP_))
+# define MpMSharedMemoryStream_HPP_ /* Header guard */
+
+# include <m+m/m+mCommon.hpp>
+
+# if defined(MpM_UseSharedMemory)
+#  if defined(__APPLE__)
+#   pragma clang diagnostic push
+#   pragma clang diagnostic ignored "-Wdocumentation"
+#   pragma clang diagnostic ignored "-Wdocumentation-unknown-command"
+#   pragma clang diagnostic ignored "-Wpadded"
+#   pragma clang diagnostic ignored "-Wshadow"
+#   pragma clang diagnostic ignored "-Wweak-vtables"
+#  endif // defined(__APPLE__)
+#  include <yarp/os/InputStream.h>
+#  include <yarp/os/OutputStream.h>
+#  include <yarp/os/TwoWayStream.h>
+#  if defined(__APPLE__)
+#   pragma clang diagnostic pop
+#  endif // defined(__APPLE__)
+
+#  include <atomic>
+# endif // defined(MpM_UseSharedMemory)
+
+# if defined(__APPLE__)
+#  pragma clang diagnostic push
+#  pragma clang diagnostic ignored "-Wunknown-pragmas"
+#  pragma clang diagnostic ignored "-Wdocumentation-unknown-command"
+# endif // defined(__APPLE__)
+/*! @file
+ @brief The class declaration for a stream that exchanges data through a shared memory segment. */
+# if defined(__APPLE__)
+#  pragma clang diagnostic pop
+# endif // defined(__APPLE__)
+
+# if defined(MpM_UseSharedMemory)
+namespace MplusM
+{
+    namespace Common
+    {
+        struct SharedMemoryRing;
+        struct SharedMemorySegment;
+
+        /*! @brief A stream that exchanges data through a pair of rings in a shared memory
+         segment.
+
+         The segment is created by the receiving end of a connection and attached to by the
+         sending end; each ring has a single writer and a single reader, so no locks are needed.
+         A reader or writer that has to wait spins briefly and then sleeps on a futex in the
+         segment, so that a message is usually picked up within a few microseconds. */
+        class SharedMemoryStream : public yarp::os::TwoWayStream,
+                                   public yarp::os::InputStream,
+                                   public yarp::os::OutputStream
+        {
+        public :
+
+        protected :
+
+        private :
+
+        public :
+
+            /*! @brief The destructor. */
+            virtual
+            ~SharedMemoryStream(void);
+
+            /*! @brief Attach to a shared memory segment that was created by the other end of a
+             connection.
+
+             The segment name is removed once it has been attached to, so that the segment will be
+             released when both ends of the connection have been closed.
+             @param[in] segmentName The name of the segment.
+             @param[in] localAddress The local address of the connection.
+             @param[in] remoteAddress The remote address of the connection.
+             @return A new stream or @c NULL if the segment could not be attached to. */
+            static SharedMemoryStream *
+            Attach(const YarpString &        segmentName,
+                   const yarp::os::Contact & localAddress,
+                   const yarp::os::Contact & remoteAddress);
+
+            /*! @brief Close the stream. */
+            virtual void
+            close(void);
+
+            /*! @brief Create a new shared memory segment for a connection.
+             @param[in] ringSize The number of bytes in each ring of the segment.
+             @param[in] localAddress The local address of the connection.
+             @param[in] remoteAddress The remote address of the connection.
+             @return A new stream or @c NULL if the segment could not be created. */
+            static SharedMemoryStream *
+            Create(const size_t              ringSize,
+                   const yarp::os::Contact & localAddress,
+                   const yarp::os::Contact & remoteAddress);
+
+            /*! @brief Return the stream to be used for reading.
+             @return The stream to be used for reading. */
+            virtual yarp::os::InputStream &
+            getInputStream(void);
+
+            /*! @brief Return the address of the local end of the connection.
+             @return The address of the local end of the connection. */
+            virtual const yarp::os::Contact &
+            getLocalAddress(void);
+
+            /*! @brief Return the stream to be used for writing.
+             @return The stream to be used for writing. */
+            virtual yarp::os::OutputStream &
+            getOutputStream(void);
+
+            /*! @brief Return the address of the remote end of the connection.
+             @return The address of the remote end of the connection. */
+            virtual const yarp::os::Contact &
+            getRemoteAddress(void);
+
+            /*! @brief Return the name of the shared memory segment.
+             @return The name of the shared memory segment. */
+            inline const YarpString &
+            getSegmentName(void)
+            const
+            {
+                return _segmentName;
+            } // getSegmentName
+
+            /*! @brief Release a reader that is waiting for data. */
+            virtual void
+            interrupt(void);
+
+            /*! @brief Return @c true if the stream can be used and @c false otherwise.
+             @return @c true if the stream can be used and @c false otherwise. */
+            virtual bool
+            isOk(void);
+
+            /*! @brief Read some data from the stream, waiting if none is available.
+             @param[in] bytes The buffer to be filled.
+             @return The number of bytes read or @c -1 if the stream has been closed. */
+            virtual YARP_SSIZE_T
+            read(const yarp::os::Bytes & bytes);
+
+            /*! @brief Write data to the stream, waiting if there is not enough room.
+             @param[in] bytes The data to be written. */
+            virtual void
+            write(const yarp::os::Bytes & bytes);
+
+            /*! @brief Mark the start of a message; not needed for this stream. */
+            virtual void
+            beginPacket(void);
+
+            /*! @brief Mark the end of a message; not needed for this stream. */
+            virtual void
+            endPacket(void);
+
+            /*! @brief Reset the stream; not needed for this stream. */
+            virtual void
+            reset(void);
+
+        protected :
+
+        private :
+
+            /*! @brief The constructor.
+             @param[in] segmentName The name of the shared memory segment.
+             @param[in] segment The mapped segment.
+             @param[in] segmentSize The number of bytes in the mapped segment.
+             @param[in] isCreator @c true if the segment was created by this end of the connection
+             and @c false if it was attached to.
+             @param[in] localAddress The local address of the connection.
+             @param[in] remoteAddress The remote address of the connection. */
+            SharedMemoryStream(const YarpString &        segmentName,
+                               SharedMemorySegment *     segment,
+                               const size_t              segmentSize,
+                               const bool                isCreator,
+                               const yarp::os::Contact & localAddress,
+                               const yarp::os::Contact & remoteAddress);
+
+            /*! @brief The copy constructor.
+             @param[in] other The object to be copied. */
+            SharedMemoryStream(const SharedMemoryStream & other);
+
+            /*! @brief Return @c true if the other end of the connection can still respond.
+             @return @c true if the other end of the connection can still respond and @c false
+             otherwise. */
+            bool
+            isPeerAlive(void);
+
+            /*! @brief The assignment operator.
+             @param[in] other The object to be copied.
+             @return The updated object. */
+            SharedMemoryStream &
+            operator =(const SharedMemoryStream & other);
+
+        public :
+
+        protected :
+
+        private :
+
+            /*! @brief The address of the local end of the connection. */
+            yarp::os::Contact _localAddress;
+
+            /*! @brief The address of the remote end of the connection. */
+            yarp::os::Contact _remoteAddress;
+
+            /*! @brief The name of the shared memory segment. */
+            YarpString _segmentName;
+
+            /*! @brief The mapped shared memory segment. */
+            SharedMemorySegment * _segment;
+
+            /*! @brief The ring that is read from. */
+            SharedMemoryRing * _inRing;
+
+            /*! @brief The ring that is written to. */
+            SharedMemoryRing * _outRing;
+
+            /*! @brief The data area of the ring that is read from. */
+            char * _inData;
+
+            /*! @brief The data area of the ring that is written to. */
+            char * _outData;
+
+            /*! @brief The number of bytes in the mapped segment. */
+            size_t _segmentSize;
+
+            /*! @brief The time at which the segment was created or attached to. */
+            double _startTime;
+
+            /*! @brief @c true if the segment was created by this end of the connection. */
+            bool _isCreator;
+
+            /*! @brief @c true if the stream can be used. */
+            std::atomic<bool> _isOk;
+
+#  if defined(__APPLE__)
+#   pragma clang diagnostic push
+#   pragma clang diagnostic ignored "-Wunused-private-field"
+#  endif // defined(__APPLE__)
+            /*! @brief Filler to pad to alignment boundary */
+            char _filler[6];
+#  if defined(__APPLE__)
+#   pragma clang diagnostic pop
+#  endif // defined(__APPLE__)
+
+        }; // SharedMemoryStream
+
+    } // Common
+
+} // MplusM
+# endif // defined(MpM_UseSharedMemory)
+
+#endif // ! defined(MpMSharedMemoryStream_HPP_)
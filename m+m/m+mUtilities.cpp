@@ -37,9 +37,13 @@
 //--------------------------------------------------------------------------------------------------
 
 #include "m+mUtilities.hpp"
+#include "m+mInventoryThread.hpp"
 
 #include <m+m/m+mBaseClient.hpp>
 #include <m+m/m+mClientChannel.hpp>
+#include <m+m/m+mClientChannelPool.hpp>
+#include <m+m/m+mNumericArray.hpp>
+#include <m+m/m+mRegistryCache.hpp>
 #include <m+m/m+mRequests.hpp>
 #include <m+m/m+mServiceRequest.hpp>
 #include <m+m/m+mServiceResponse.hpp>
@@ -106,9 +110,16 @@
 #endif // ! defined(__APPLE__)
 
 #if MAC_OR_LINUX_
+# include <arpa/inet.h>
+# include <fcntl.h>
 # include <netdb.h>
+# include <netinet/in.h>
 # include <pwd.h>
+# include <unistd.h>
 # include <uuid/uuid.h>
+# if defined(__linux__)
+#  include <sys/epoll.h>
+# endif // defined(__linux__)
 #endif // MAC_OR_LINUX_
 
 #if defined(__APPLE__)
@@ -141,6 +152,48 @@ using std::endl;
 # define strtok_r strtok_s /* Equivalent routine for Windows. */
 #endif // ! MAC_OR_LINUX_
 
+/*! @brief The maximum number of ports that RemoveStalePorts() checks at the same time; this
+ must not exceed the number of sockets that select() can handle. */
+#define MAX_STALE_PORT_PROBES_ 64
+
+/*! @brief The outcome of starting to check a port. */
+enum ProbeStart
+{
+    /*! @brief The port accepted the connection immediately. */
+    kProbeStartConnected,
+
+    /*! @brief The port could not be checked. */
+    kProbeStartFailed,
+
+    /*! @brief The connection to the port is in progress. */
+    kProbeStartPending,
+
+    /*! @brief The port refused the connection. */
+    kProbeStartRefused
+
+}; // ProbeStart
+
+/*! @brief A port that is being checked by RemoveStalePorts(). */
+struct StalePortProbe
+{
+    /*! @brief The registered name of the port. */
+    YarpString _portName;
+
+    /*! @brief The time at which the port is considered to be stale if it hasn't responded. */
+    double _expiryTime;
+
+    /*! @brief The socket that is connecting to the port. */
+    SOCKET _socket;
+
+}; // StalePortProbe
+
+/*! @brief A set of ports being checked. */
+typedef std::vector<StalePortProbe> StalePortProbeVector;
+
+/*! @brief The addresses of the hosts seen by RemoveStalePorts(); hosts that could not be
+ resolved have the address @c INADDR_NONE. */
+typedef std::map<YarpString, struct in_addr> ProbeHostMap;
+
 /*! @brief The number of seconds to wait on a select() for mDNS operatios. */
 static const int kDNSWaitTime = 3;
 
@@ -758,6 +811,30 @@ convertMetricPropertyToString(yarp::os::Property & propList,
     }
 } // convertMetricPropertyToString
 
+#if defined(MpM_UseSharedMemory)
+/*! @brief Return @c true if two ports are on the same machine.
+ @param[in] sourceName The name of the first port.
+ @param[in] destinationName The name of the second port.
+ @return @c true if the two ports are on the same machine and @c false otherwise. */
+static bool
+portsAreOnSameMachine(const YarpString & sourceName,
+                      const YarpString & destinationName)
+{
+    ODL_ENTER(); //####
+    ODL_S2s("sourceName = ", sourceName, "destinationName = ", destinationName); //####
+    bool              result = false;
+    yarp::os::Contact sourceContact = yarp::os::Network::queryName(sourceName);
+    yarp::os::Contact destinationContact = yarp::os::Network::queryName(destinationName);
+
+    if (sourceContact.isValid() && destinationContact.isValid())
+    {
+        result = (sourceContact.getHost() == destinationContact.getHost());
+    }
+    ODL_EXIT_B(result); //####
+    return result;
+} // portsAreOnSameMachine
+#endif // defined(MpM_UseSharedMemory)
+
 /*! @brief Process the response from the name server.
 
  Note that each line of the response, except the last, is started with 'registration name'. This is
@@ -1159,6 +1236,13 @@ processValue(std::stringstream &     outBuffer,
             }
         }
     }
+    else if (NumericArray::IsNumericArray(inputValue))
+    {
+        yarp::os::Bottle asList;
+
+        NumericArray::ConvertToList(inputValue, asList);
+        processList(outBuffer, asList);
+    }
     else
     {
         // We don't know what to do with this...
@@ -1171,6 +1255,323 @@ processValue(std::stringstream &     outBuffer,
     ODL_EXIT(); //####
 } // processValue
 
+/*! @brief Close a socket that was used to check a port.
+ @param[in] probeSocket The socket to be closed. */
+static void
+closeProbeSocket(SOCKET probeSocket)
+{
+    ODL_ENTER(); //####
+    ODL_I1("probeSocket = ", probeSocket); //####
+#if MAC_OR_LINUX_
+    close(probeSocket);
+#else // ! MAC_OR_LINUX_
+    closesocket(probeSocket);
+#endif // ! MAC_OR_LINUX_
+    ODL_EXIT(); //####
+} // closeProbeSocket
+
+/*! @brief Check if a socket that was used to check a port managed to connect.
+ @param[in] probeSocket The socket to be checked.
+ @return @c true if the socket is connected and @c false if the connection failed. */
+static bool
+probeSucceeded(SOCKET probeSocket)
+{
+    ODL_ENTER(); //####
+    ODL_I1("probeSocket = ", probeSocket); //####
+    int       error = 0;
+#if MAC_OR_LINUX_
+    socklen_t errorSize = sizeof(error);
+    int       res = getsockopt(probeSocket, SOL_SOCKET, SO_ERROR, &error, &errorSize);
+#else // ! MAC_OR_LINUX_
+    int       errorSize = sizeof(error);
+    int       res = getsockopt(probeSocket, SOL_SOCKET, SO_ERROR,
+                               reinterpret_cast<char *>(&error), &errorSize);
+#endif // ! MAC_OR_LINUX_
+    bool      result = ((! res) && (! error));
+
+    ODL_EXIT_B(result); //####
+    return result;
+} // probeSucceeded
+
+/*! @brief Find the network address of the host for a port.
+ @param[in] hostName The name or dotted address of the host.
+ @param[in,out] knownHosts The hosts that have already been looked up.
+ @param[out] hostAddress The network address of the host.
+ @return @c true if the host has a usable address and @c false otherwise. */
+static bool
+resolveProbeHost(const YarpString & hostName,
+                 ProbeHostMap &     knownHosts,
+                 struct in_addr &   hostAddress)
+{
+    ODL_ENTER(); //####
+    ODL_S1s("hostName = ", hostName); //####
+    ODL_P2("knownHosts = ", &knownHosts, "hostAddress = ", &hostAddress); //####
+    ProbeHostMap::const_iterator match(knownHosts.find(hostName));
+
+    if (knownHosts.end() == match)
+    {
+        YarpString target((hostName == SELF_ADDRESS_NAME_) ? SELF_ADDRESS_IPADDR_ : hostName);
+#if MAC_OR_LINUX_
+        int        res = inet_pton(AF_INET, target.c_str(), &hostAddress);
+#else // ! MAC_OR_LINUX_
+        int        res = InetPton(AF_INET, target.c_str(), &hostAddress);
+#endif // ! MAC_OR_LINUX_
+
+        if (0 >= res)
+        {
+            // Not a dotted address, so ask the resolver; this is only done once per host.
+            addrinfo   hints;
+            addrinfo * addrList = NULL;
+
+            memset(&hints, 0, sizeof(hints));
+            hints.ai_family = AF_INET;
+            hints.ai_socktype = SOCK_STREAM;
+            if (getaddrinfo(target.c_str(), NULL, &hints, &addrList))
+            {
+                ODL_LOG("(getaddrinfo(target.c_str(), NULL, &hints, &addrList))"); //####
+                hostAddress.s_addr = INADDR_NONE;
+            }
+            else
+            {
+                // Just use the first entry, as we aren't asking for a specific service.
+                sockaddr_in * asIP4 = reinterpret_cast<sockaddr_in *>(addrList->ai_addr);
+
+                hostAddress = asIP4->sin_addr;
+                freeaddrinfo(addrList);
+            }
+        }
+        knownHosts[hostName] = hostAddress;
+    }
+    else
+    {
+        hostAddress = match->second;
+    }
+    bool result = (INADDR_NONE != hostAddress.s_addr);
+
+    ODL_EXIT_B(result); //####
+    return result;
+} // resolveProbeHost
+
+/*! @brief Start a non-blocking connection to a port, to see if it is still alive.
+ @param[in] hostAddress The network address of the host for the port.
+ @param[in] port The port number to connect to.
+ @param[out] probeSocket The socket that is connecting to the port, if the connection is in
+ progress, or @c INVALID_SOCKET otherwise.
+ @return The state of the connection. */
+static ProbeStart
+startPortProbe(const struct in_addr & hostAddress,
+               const int              port,
+               SOCKET &               probeSocket)
+{
+    ODL_ENTER(); //####
+    ODL_P2("hostAddress = ", &hostAddress, "probeSocket = ", &probeSocket); //####
+    ODL_I1("port = ", port); //####
+    ProbeStart result = kProbeStartFailed;
+
+    probeSocket = socket(AF_INET, SOCK_STREAM, IPPROTO_TCP);
+    ODL_I1("probeSocket <- ", probeSocket); //####
+    if (INVALID_SOCKET != probeSocket)
+    {
+#if MAC_OR_LINUX_
+        struct sockaddr_in sockAddr;
+        int                flags = fcntl(probeSocket, F_GETFL, 0);
+        bool               nonBlocking = ((0 <= flags) &&
+                                          (0 <= fcntl(probeSocket, F_SETFL,
+                                                      flags | O_NONBLOCK)));
+#else // ! MAC_OR_LINUX_
+        SOCKADDR_IN        sockAddr;
+        u_long             mode = 1;
+        bool               nonBlocking = (0 == ioctlsocket(probeSocket, FIONBIO, &mode));
+#endif // ! MAC_OR_LINUX_
+
+        if (nonBlocking)
+        {
+            memset(&sockAddr, 0, sizeof(sockAddr));
+            sockAddr.sin_family = AF_INET;
+            sockAddr.sin_port = htons(port);
+            memcpy(&sockAddr.sin_addr.s_addr, &hostAddress.s_addr,
+                   sizeof(sockAddr.sin_addr.s_addr));
+            if (connect(probeSocket, reinterpret_cast<struct sockaddr *>(&sockAddr),
+                        sizeof(sockAddr)))
+            {
+#if MAC_OR_LINUX_
+                int error = errno;
+
+                if (EINPROGRESS == error)
+#else // ! MAC_OR_LINUX_
+                int error = WSAGetLastError();
+
+                if (WSAEWOULDBLOCK == error)
+#endif // ! MAC_OR_LINUX_
+                {
+                    result = kProbeStartPending;
+                }
+#if MAC_OR_LINUX_
+                else if (ECONNREFUSED == error)
+#else // ! MAC_OR_LINUX_
+                else if (WSAECONNREFUSED == error)
+#endif // ! MAC_OR_LINUX_
+                {
+                    result = kProbeStartRefused;
+                }
+                else
+                {
+                    // A local problem, such as running out of descriptors or no route to
+                    // the host, says nothing about whether the port is stale.
+                    ODL_I1("error = ", error); //####
+                }
+            }
+            else
+            {
+                result = kProbeStartConnected;
+            }
+        }
+        else
+        {
+            ODL_LOG("! (nonBlocking)"); //####
+        }
+        if (kProbeStartPending != result)
+        {
+            closeProbeSocket(probeSocket);
+            probeSocket = INVALID_SOCKET;
+        }
+    }
+    ODL_EXIT_I(result); //####
+    return result;
+} // startPortProbe
+
+/*! @brief Wait, using select(), for some of the ports being checked to respond.
+ @param[in] probes The ports being checked.
+ @param[in] waitTime The number of seconds to wait for a response.
+ @param[out] finished The sockets that have either connected or failed to connect. */
+static void
+selectPortProbes(const StalePortProbeVector & probes,
+                 const double                 waitTime,
+                 std::vector<SOCKET> &        finished)
+{
+    ODL_ENTER(); //####
+    ODL_P2("probes = ", &probes, "finished = ", &finished); //####
+    ODL_D1("waitTime = ", waitTime); //####
+    fd_set         writefds;
+    fd_set         exceptfds;
+    int            nfds = 0;
+    struct timeval tv;
+
+    FD_ZERO(&writefds);
+    FD_ZERO(&exceptfds);
+    for (StalePortProbeVector::const_iterator walker(probes.begin()); probes.end() != walker;
+         ++walker)
+    {
+        FD_SET(walker->_socket, &writefds);
+        FD_SET(walker->_socket, &exceptfds);
+        nfds = std::max(nfds, static_cast<int>(walker->_socket) + 1);
+    }
+    tv.tv_sec = static_cast<long>(waitTime);
+    tv.tv_usec = static_cast<long>((waitTime - tv.tv_sec) * 1000000);
+    if (0 < select(nfds, NULL, &writefds, &exceptfds, &tv))
+    {
+        for (StalePortProbeVector::const_iterator walker(probes.begin());
+             probes.end() != walker; ++walker)
+        {
+            if (FD_ISSET(walker->_socket, &writefds) || FD_ISSET(walker->_socket, &exceptfds))
+            {
+                finished.push_back(walker->_socket);
+            }
+        }
+    }
+    ODL_EXIT(); //####
+} // selectPortProbes
+
+#if (! MAC_OR_LINUX_)
+# pragma warning(push)
+# pragma warning(disable: 4100)
+#endif // ! MAC_OR_LINUX_
+/*! @brief Wait for some of the ports being checked to respond.
+ @param[in] probes The ports being checked.
+ @param[in] pollHandle The epoll descriptor that the sockets are registered with, on Linux, or
+ -1 if select() is to be used instead.
+ @param[in] waitTime The number of seconds to wait for a response.
+ @param[out] finished The sockets that have either connected or failed to connect. */
+static void
+waitForPortProbes(const StalePortProbeVector & probes,
+                  const int                    pollHandle,
+                  const double                 waitTime,
+                  std::vector<SOCKET> &        finished)
+{
+#if (! defined(ODL_ENABLE_LOGGING_))
+# if (MAC_OR_LINUX_ && (! defined(__linux__)))
+#  pragma unused(pollHandle)
+# endif // MAC_OR_LINUX_ && (! defined(__linux__))
+#endif // ! defined(ODL_ENABLE_LOGGING_)
+    ODL_ENTER(); //####
+    ODL_P2("probes = ", &probes, "finished = ", &finished); //####
+    ODL_I1("pollHandle = ", pollHandle); //####
+    ODL_D1("waitTime = ", waitTime); //####
+    finished.clear();
+#if defined(__linux__)
+    if (0 <= pollHandle)
+    {
+        struct epoll_event events[MAX_STALE_PORT_PROBES_];
+        int                count = epoll_wait(pollHandle, events, MAX_STALE_PORT_PROBES_,
+                                              static_cast<int>(waitTime * 1000) + 1);
+
+        for (int ii = 0; count > ii; ++ii)
+        {
+            finished.push_back(events[ii].data.fd);
+        }
+    }
+    else
+    {
+        selectPortProbes(probes, waitTime, finished);
+    }
+#else // ! defined(__linux__)
+    selectPortProbes(probes, waitTime, finished);
+#endif // ! defined(__linux__)
+    ODL_EXIT(); //####
+} // waitForPortProbes
+#if (! MAC_OR_LINUX_)
+# pragma warning(pop)
+#endif // ! MAC_OR_LINUX_
+
+/*! @brief Examine the entries of an inventory, using a bounded number of threads.
+ @param[in] work The work to be shared by the threads.
+ @param[in] count The number of entries in the inventory.
+ @param[in] fanOut The maximum number of entries that are examined at the same time. */
+static void
+runInventory(InventoryWork & work,
+             const size_t    count,
+             const int       fanOut)
+{
+    ODL_ENTER(); //####
+    ODL_P1("work = ", &work); //####
+    ODL_I2("count = ", count, "fanOut = ", fanOut); //####
+    size_t                         threadCount = std::min(count,
+                                                          static_cast<size_t>(std::max(1, fanOut)));
+    std::vector<InventoryThread *> threads;
+
+    work._nextEntry = 0;
+    for (size_t ii = 0; threadCount > ii; ++ii)
+    {
+        InventoryThread * aThread = new InventoryThread(work);
+
+        if (aThread->start())
+        {
+            threads.push_back(aThread);
+        }
+        else
+        {
+            ODL_LOG("! (aThread->start())"); //####
+            delete aThread;
+        }
+    }
+    for (size_t ii = 0, mm = threads.size(); mm > ii; ++ii)
+    {
+        threads[ii]->join();
+        delete threads[ii];
+    }
+    ODL_EXIT(); //####
+} // runInventory
+
 #if defined(__APPLE__)
 # pragma mark Global functions
 #endif // defined(__APPLE__)
@@ -1657,6 +2058,71 @@ Utilities::GatherPortConnections(const YarpString &    portName,
     ODL_EXIT(); //####
 } // Utilities::GatherPortConnections
 
+void
+Utilities::GatherPortInventory(const PortVector & ports,
+                               PortInventory &    inventory,
+                               const bool         quiet,
+                               const double       timeToWait,
+                               const int          fanOut,
+                               CheckFunction      checker,
+                               void *             checkStuff)
+{
+    ODL_ENTER(); //####
+    ODL_P3("ports = ", &ports, "inventory = ", &inventory, "checkStuff = ", checkStuff); //####
+    ODL_B1("quiet = ", quiet); //####
+    ODL_D1("timeToWait = ", timeToWait); //####
+    ODL_I1("fanOut = ", fanOut); //####
+    InventoryWork work;
+
+    inventory.clear();
+    inventory.resize(ports.size());
+    for (size_t ii = 0, mm = ports.size(); mm > ii; ++ii)
+    {
+        inventory[ii]._port = ports[ii];
+        inventory[ii]._valid = false;
+    }
+    work._services = NULL;
+    work._ports = &inventory;
+    work._checker = checker;
+    work._checkStuff = checkStuff;
+    work._timeToWait = timeToWait;
+    work._quiet = quiet;
+    runInventory(work, inventory.size(), fanOut);
+    ODL_EXIT(); //####
+} // Utilities::GatherPortInventory
+
+void
+Utilities::GatherServiceInventory(const YarpStringVector & services,
+                                  ServiceInventory &       inventory,
+                                  const double             timeToWait,
+                                  const int                fanOut,
+                                  CheckFunction            checker,
+                                  void *                   checkStuff)
+{
+    ODL_ENTER(); //####
+    ODL_P3("services = ", &services, "inventory = ", &inventory, "checkStuff = ", //####
+           checkStuff); //####
+    ODL_D1("timeToWait = ", timeToWait); //####
+    ODL_I1("fanOut = ", fanOut); //####
+    InventoryWork work;
+
+    inventory.clear();
+    inventory.resize(services.size());
+    for (size_t ii = 0, mm = services.size(); mm > ii; ++ii)
+    {
+        inventory[ii]._channelName = services[ii];
+        inventory[ii]._valid = false;
+    }
+    work._services = &inventory;
+    work._ports = NULL;
+    work._checker = checker;
+    work._checkStuff = checkStuff;
+    work._timeToWait = timeToWait;
+    work._quiet = true;
+    runInventory(work, inventory.size(), fanOut);
+    ODL_EXIT(); //####
+} // Utilities::GatherServiceInventory
+
 bool
 Utilities::GetConfigurationForService(const YarpString & serviceChannelName,
                                       YarpStringVector & values,
@@ -2874,6 +3340,12 @@ Utilities::NetworkConnectWithRetries(const YarpString & sourceName,
             {
                 carrier = "udp";
             }
+#if defined(MpM_UseSharedMemory)
+            else if (portsAreOnSameMachine(sourceName, destinationName))
+            {
+                carrier = SHARED_MEMORY_CARRIER_;
+            }
+#endif // defined(MpM_UseSharedMemory)
             else
             {
                 carrier = "tcp";
@@ -2894,11 +3366,18 @@ Utilities::NetworkConnectWithRetries(const YarpString & sourceName,
                 ODL_LOG("connected?"); //####
                 if (! result)
                 {
+#if defined(MpM_UseSharedMemory)
+                    // If the other end can't use shared memory, fall back to TCP.
+                    if (! strcmp(carrier, SHARED_MEMORY_CARRIER_))
+                    {
+                        carrier = "tcp";
+                    }
+#endif // defined(MpM_UseSharedMemory)
                     if (0 < --retriesLeft)
                     {
                         ODL_LOG("%%retry%%"); //####
+                        retryTime = Common::NextRetryInterval(retryTime);
                         yarp::os::Time::delay(retryTime);
-                        retryTime *= RETRY_MULTIPLIER_;
                     }
                 }
             }
@@ -2980,8 +3459,8 @@ Utilities::NetworkDisconnectWithRetries(const YarpString & sourceName,
                     if (0 < --retriesLeft)
                     {
                         ODL_LOG("%%retry%%"); //####
+                        retryTime = Common::NextRetryInterval(retryTime);
                         yarp::os::Time::delay(retryTime);
-                        retryTime *= RETRY_MULTIPLIER_;
                     }
                 }
             }
@@ -3332,16 +3811,22 @@ Utilities::RemoveConnection(const YarpString & fromPortName,
 } // Utilities::RemoveConnection
 
 void
-Utilities::RemoveStalePorts(const float timeout)
+Utilities::RemoveStalePorts(const float           timeout,
+                            const double          sweepLimit,
+                            StalePortStatistics * statistics)
 {
     ODL_ENTER(); //####
-    ODL_D1("timeout = ", timeout); //####
+    ODL_D2("timeout = ", timeout, "sweepLimit = ", sweepLimit); //####
+    ODL_P1("statistics = ", statistics); //####
     bool                       okSoFar;
+    double                     sweepStart = yarp::os::Time::now();
     yarp::os::impl::NameConfig nc;
     yarp::os::impl::String     name = nc.getNamespace();
     yarp::os::Bottle           msg;
     yarp::os::Bottle           reply;
+    StalePortStatistics        stats;
 
+    memset(&stats, 0, sizeof(stats));
     msg.addString("bot");
     msg.addString("list");
     okSoFar = yarp::os::NetworkBase::write(name.c_str(), msg, reply);
@@ -3360,6 +3845,10 @@ Utilities::RemoveStalePorts(const float timeout)
     }
     if (okSoFar)
     {
+        std::vector<yarp::os::Contact> candidates;
+        YarpStringVector               candidateNames;
+        YarpStringVector               staleNames;
+
         for (int ii = 1; reply.size() > ii; ++ii)
         {
             yarp::os::Bottle * entry = reply.get(ii).asList();
@@ -3376,46 +3865,201 @@ Utilities::RemoveStalePorts(const float timeout)
                     if (cc.getCarrier() == "mcast")
                     {
                         ODL_LOG("Skipping mcast port."); //####
+                        ++stats._portsSkipped;
+                    }
+                    else if (cc.isValid())
+                    {
+                        ODL_S1s("Testing at ", cc.toURI()); //####
+                        candidates.push_back(cc);
+                        candidateNames.push_back(port);
                     }
                     else
                     {
-                        ODL_LOG("! (cc.getCarrier() == \"mcast\")"); //####
-                        yarp::os::Contact addr = cc;
+                        ODL_LOG("! (cc.isValid())"); //####
+                        ++stats._portsSkipped;
+                    }
+                }
+                else if (port != "")
+                {
+                    ODL_LOG("Ignoring port"); //####
+                }
+            }
+        }
+        // Check the ports concurrently, rather than one after another, so that a few
+        // unresponsive hosts can't hold up the whole sweep.
+        double               deadline = sweepStart + sweepLimit;
+        size_t               nextCandidate = 0;
+        StalePortProbeVector inFlight;
+        std::vector<SOCKET>  finished;
+        ProbeHostMap         knownHosts;
+#if defined(__linux__)
+        int                  pollHandle = epoll_create1(0);
+
+        if (0 > pollHandle)
+        {
+            // Fall back to select(), which is slower but doesn't need a descriptor of its own.
+            ODL_LOG("(0 > pollHandle)"); //####
+        }
+#else // ! defined(__linux__)
+        int                  pollHandle = -1;
+#endif // ! defined(__linux__)
+
+        for ( ; ; )
+        {
+            double now = yarp::os::Time::now();
+
+            if (deadline <= now)
+            {
+                ODL_LOG("(deadline <= now)"); //####
+                break;
+            }
+
+            for ( ; (candidates.size() > nextCandidate) &&
+                    (static_cast<size_t>(MAX_STALE_PORT_PROBES_) > inFlight.size());
+                 ++nextCandidate)
+            {
+                const yarp::os::Contact & aContact = candidates[nextCandidate];
+                StalePortProbe            probe;
+                ProbeStart                started = kProbeStartFailed;
+                struct in_addr            hostAddress;
+
+                probe._portName = candidateNames[nextCandidate];
+                probe._socket = INVALID_SOCKET;
+                if (resolveProbeHost(aContact.getHost(), knownHosts, hostAddress))
+                {
+                    started = startPortProbe(hostAddress, aContact.getPort(), probe._socket);
+                }
+                else
+                {
+                    ODL_LOG("! (resolveProbeHost(aContact.getHost(), knownHosts, " //####
+                            "hostAddress))"); //####
+                }
+                if (kProbeStartPending == started)
+                {
+#if defined(__linux__)
+                    if (0 <= pollHandle)
+                    {
+                        struct epoll_event anEvent;
 
-                        ODL_S1s("Testing at ", addr.toURI()); //####
-                        if (addr.isValid())
+                        memset(&anEvent, 0, sizeof(anEvent));
+                        anEvent.events = EPOLLOUT;
+                        anEvent.data.fd = probe._socket;
+                        if (epoll_ctl(pollHandle, EPOLL_CTL_ADD, probe._socket, &anEvent))
                         {
-                            if (0 <= timeout)
-                            {
-                                addr.setTimeout(timeout);
-                            }
-                            yarp::os::OutputProtocol * out =
-                                                            yarp::os::impl::Carriers::connect(addr);
-
-                            if (out)
-                            {
-                                delete out;
-                            }
-                            else
-                            {
-                                ODL_LOG("No response, removing port."); //####
-                                char buffer1[DATE_TIME_BUFFER_SIZE_];
-                                char buffer2[DATE_TIME_BUFFER_SIZE_];
-
-                                GetDateAndTime(buffer1, sizeof(buffer1), buffer2, sizeof(buffer2));
-                                yarp::os::NetworkBase::unregisterName(port);
-                                cerr << buffer1 << " " << buffer2 << " Removing stale port '" <<
-                                        port.c_str() << "'." << endl;
-                            }
+                            ODL_LOG("(epoll_ctl(pollHandle, EPOLL_CTL_ADD, " //####
+                                    "probe._socket, &anEvent))"); //####
+                            closeProbeSocket(probe._socket);
+                            ++stats._portsSkipped;
+                            continue;
                         }
+
+                    }
+                    else if (FD_SETSIZE <= probe._socket)
+                    {
+                        // select() can't wait on this socket, so leave the port alone.
+                        ODL_LOG("(FD_SETSIZE <= probe._socket)"); //####
+                        closeProbeSocket(probe._socket);
+                        ++stats._portsSkipped;
+                        continue;
                     }
+#endif // defined(__linux__)
+                    probe._expiryTime = ((0 <= timeout) ? (now + timeout) : deadline);
+                    inFlight.push_back(probe);
+                    stats._peakInFlight = std::max(stats._peakInFlight,
+                                                   static_cast<int>(inFlight.size()));
                 }
-                else if (port != "")
+                else if (kProbeStartConnected == started)
                 {
-                    ODL_LOG("Ignoring port"); //####
+                    ++stats._portsChecked;
+                }
+                else if (kProbeStartRefused == started)
+                {
+                    ++stats._portsChecked;
+                    staleNames.push_back(probe._portName);
+                }
+                else
+                {
+                    ++stats._portsSkipped;
+                }
+            }
+            if (inFlight.empty())
+            {
+                break;
+            }
+
+            double waitUntil = deadline;
+
+            for (StalePortProbeVector::const_iterator walker(inFlight.begin());
+                 inFlight.end() != walker; ++walker)
+            {
+                waitUntil = std::min(waitUntil, walker->_expiryTime);
+            }
+            waitForPortProbes(inFlight, pollHandle, std::max(0.0, waitUntil - now), finished);
+            now = yarp::os::Time::now();
+            for (StalePortProbeVector::iterator walker(inFlight.begin());
+                 inFlight.end() != walker; )
+            {
+                bool isFinished = (finished.end() != std::find(finished.begin(),
+                                                               finished.end(),
+                                                               walker->_socket));
+
+                if (isFinished || (walker->_expiryTime <= now))
+                {
+                    ++stats._portsChecked;
+                    if (! (isFinished && probeSucceeded(walker->_socket)))
+                    {
+                        ODL_S1s("No response, removing port ", walker->_portName); //####
+                        staleNames.push_back(walker->_portName);
+                    }
+                    // Closing the socket also removes it from the epoll set.
+                    closeProbeSocket(walker->_socket);
+                    walker = inFlight.erase(walker);
+                }
+                else
+                {
+                    ++walker;
                 }
             }
         }
+        // Anything that wasn't checked in time is left alone.
+        for (StalePortProbeVector::const_iterator walker(inFlight.begin());
+             inFlight.end() != walker; ++walker)
+        {
+            closeProbeSocket(walker->_socket);
+        }
+        stats._portsUnchecked = static_cast<int>(inFlight.size() +
+                                                 (candidates.size() - nextCandidate));
+#if defined(__linux__)
+        if (0 <= pollHandle)
+        {
+            close(pollHandle);
+        }
+#endif // defined(__linux__)
+        // Remove the stale ports together, once all the checking is done.
+        if (! staleNames.empty())
+        {
+            char buffer1[DATE_TIME_BUFFER_SIZE_];
+            char buffer2[DATE_TIME_BUFFER_SIZE_];
+
+            GetDateAndTime(buffer1, sizeof(buffer1), buffer2, sizeof(buffer2));
+            for (YarpStringVector::const_iterator walker(staleNames.begin());
+                 staleNames.end() != walker; ++walker)
+            {
+                yarp::os::NetworkBase::unregisterName(*walker);
+                cerr << buffer1 << " " << buffer2 << " Removing stale port '" <<
+                        walker->c_str() << "'." << endl;
+            }
+        }
+        stats._portsRemoved = static_cast<int>(staleNames.size());
+    }
+    stats._elapsedTime = yarp::os::Time::now() - sweepStart;
+    ODL_D1("elapsed = ", stats._elapsedTime); //####
+    ODL_I4("checked = ", stats._portsChecked, "removed = ", stats._portsRemoved, //####
+           "skipped = ", stats._portsSkipped, "unchecked = ", stats._portsUnchecked); //####
+    ODL_I1("peak in flight = ", stats._peakInFlight); //####
+    if (statistics)
+    {
+        *statistics = stats;
     }
     ODL_LOG("Giving name server a chance to do garbage collection."); //####
     YarpString       serverName = yarp::os::NetworkBase::getNameServerName();
@@ -3674,6 +4318,8 @@ void
 Utilities::ShutDownGlobalStatusReporter(void)
 {
     ODL_ENTER(); //####
+    RegistryCache::Disable();
+    ClientChannelPool::CloseAll();
     delete lReporter;
     lReporter = NULL;
     ODL_EXIT(); //####
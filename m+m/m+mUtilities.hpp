@@ -164,9 +164,71 @@ namespace MplusM
 
         }; // ServiceDescriptor
 
+        /*! @brief The connections for a port, as gathered for an inventory. */
+        struct PortInventoryEntry
+        {
+            /*! @brief The port that was examined. */
+            PortDescriptor _port;
+
+            /*! @brief The collected inputs for the port. */
+            Common::ChannelVector _inputs;
+
+            /*! @brief The collected outputs for the port. */
+            Common::ChannelVector _outputs;
+
+            /*! @brief @c true if the connections were gathered in time and @c false otherwise. */
+            bool _valid;
+
+        }; // PortInventoryEntry
+
+        /*! @brief The details for a service, as gathered for an inventory. */
+        struct ServiceInventoryEntry
+        {
+            /*! @brief The channel for the service. */
+            YarpString _channelName;
+
+            /*! @brief The details for the service. */
+            ServiceDescriptor _descriptor;
+
+            /*! @brief @c true if the service returned its details and @c false otherwise. */
+            bool _valid;
+
+        }; // ServiceInventoryEntry
+
+        /*! @brief The results of a sweep for stale ports. */
+        struct StalePortStatistics
+        {
+            /*! @brief The number of seconds taken by the sweep. */
+            double _elapsedTime;
+
+            /*! @brief The number of ports that were checked. */
+            int _portsChecked;
+
+            /*! @brief The number of ports that were removed because they did not respond. */
+            int _portsRemoved;
+
+            /*! @brief The number of ports that were not checked because they cannot be probed. */
+            int _portsSkipped;
+
+            /*! @brief The number of ports that were not checked before the sweep ran out of
+             time. */
+            int _portsUnchecked;
+
+            /*! @brief The largest number of ports that were being checked at the same time. */
+            int _peakInFlight;
+
+        }; // StalePortStatistics
+
+        /*! @brief A set of port connections, in the same order as the ports that were examined. */
+        typedef std::vector<PortInventoryEntry> PortInventory;
+
         /*! @brief A set of port descriptions. */
         typedef std::vector<PortDescriptor> PortVector;
 
+        /*! @brief A set of service details, in the same order as the services that were
+         examined. */
+        typedef std::vector<ServiceInventoryEntry> ServiceInventory;
+
         /*! @brief Add a connection between two ports.
          @param[in] fromPortName The name of the source port.
          @param[in] toPortName The name of the destination port.
@@ -257,6 +319,44 @@ namespace MplusM
                               Common::CheckFunction   checker = NULL,
                               void *                  checkStuff = NULL);
 
+        /*! @brief Collect the input and output connections for a set of ports.
+
+         The ports are examined concurrently, and the results are only returned once every port
+         has been examined or has run out of time.
+         @param[in] ports The ports to be examined.
+         @param[out] inventory The connections for each port, in the same order as the ports.
+         @param[in] quiet @c true if status output is to be suppressed and @c false otherwise.
+         @param[in] timeToWait The number of seconds allowed for examining each port.
+         @param[in] fanOut The maximum number of ports that are examined at the same time.
+         @param[in] checker A function that provides for early exit from loops.
+         @param[in] checkStuff The private data for the early exit function. */
+        void
+        GatherPortInventory(const PortVector &    ports,
+                            PortInventory &       inventory,
+                            const bool            quiet = false,
+                            const double          timeToWait = STANDARD_WAIT_TIME_,
+                            const int             fanOut = DEFAULT_INVENTORY_FAN_OUT_,
+                            Common::CheckFunction checker = NULL,
+                            void *                checkStuff = NULL);
+
+        /*! @brief Retrieve the details for a set of services.
+
+         The services are examined concurrently, and the results are only returned once every
+         service has been examined or has run out of time.
+         @param[in] services The channels for the services to be examined.
+         @param[out] inventory The details for each service, in the same order as the services.
+         @param[in] timeToWait The number of seconds allowed for examining each service.
+         @param[in] fanOut The maximum number of services that are examined at the same time.
+         @param[in] checker A function that provides for early exit from loops.
+         @param[in] checkStuff The private data for the early exit function. */
+        void
+        GatherServiceInventory(const YarpStringVector & services,
+                               ServiceInventory &       inventory,
+                               const double             timeToWait = STANDARD_WAIT_TIME_,
+                               const int                fanOut = DEFAULT_INVENTORY_FAN_OUT_,
+                               Common::CheckFunction    checker = NULL,
+                               void *                   checkStuff = NULL);
+
         /*! @brief Retrieve the configuration values for a service.
          @param[in] serviceChannelName The channel for the service.
          @param[out] values The configuration values for a service.
@@ -558,9 +658,16 @@ namespace MplusM
                          void *                checkStuff = NULL);
 
         /*! @brief Remove any ports that YARP considers to be stale.
-         @param[in] timeout The number of seconds to allow YARP to check a port. */
+
+         The ports are checked concurrently, with a limit on the number of ports being checked at
+         once; ports that have not been checked when the sweep runs out of time are left alone.
+         @param[in] timeout The number of seconds to allow for checking a port.
+         @param[in] sweepLimit The number of seconds to allow for checking all the ports.
+         @param[out] statistics If non-@c NULL, filled in with the results of the sweep. */
         void
-        RemoveStalePorts(const float timeout = 5);
+        RemoveStalePorts(const float           timeout = 5,
+                         const double          sweepLimit = 30,
+                         StalePortStatistics * statistics = NULL);
 
         /*! @brief Restart a service.
          @param[in] serviceChannelName The channel for the service.
@@ -607,7 +714,8 @@ namespace MplusM
         void
         SetUpGlobalStatusReporter(void);
 
-        /*! @brief Shut down the global status reporter. */
+        /*! @brief Shut down the global status reporter, disable the registry cache and close the
+         pooled connections; this is done by each executable before the network is shut down. */
         void
         ShutDownGlobalStatusReporter(void);
 
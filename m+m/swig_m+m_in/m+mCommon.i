@@ -2,7 +2,6 @@
 %{
 #include "m+mAddressArgumentDescriptor.hpp"
 #include "m+mBailOut.hpp"
-#include "m+mBailOutThread.hpp"
 #include "m+mBaseAdapterData.hpp"
 #include "m+mBaseAdapterService.hpp"
 #include "m+mBaseArgumentDescriptor.hpp"
@@ -25,6 +24,7 @@
 #include "m+mChannelStatusReporter.hpp"
 #include "m+mClientChannel.hpp"
 #include "m+mCommon.hpp"
+#include "m+mDeadlineService.hpp"
 #include "m+mDoubleArgumentDescriptor.hpp"
 #include "m+mEndpoint.hpp"
 #include "m+mException.hpp"